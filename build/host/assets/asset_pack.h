@@ -0,0 +1,26 @@
+// written by mkpack from assets/pack.txt
+
+#pragma once
+
+#define ASSET_TITLE_SCREEN_MAP 0
+#define ASSET_MENU_TILEMAP 1
+#define ASSET_TITLE_SCREEN_CVGM 2
+#define ASSET_ENTERTAINER_CVGM 3
+#define ASSET_YOU_WIN_CVGM 4
+#define ASSET_YOU_WIN_PCM 5
+#define ASSET_CHECKERBOARD_TILES 6
+#define ASSET_CARDS_TILES 7
+#define ASSET_TITLE_SCREEN_TILES 8
+#define ASSET_TEXT_TILES 9
+#define ASSET_YOU_WIN_TILES 10
+#define ASSET_BAIZE_TILES 11
+#define ASSET_BAIZE_PALETTE 12
+#define ASSET_CARDS_PALETTE 13
+#define ASSET_COUNT 14
+
+#define ASSET_SET_COLOR 0
+#define ASSET_SET_MONO 1
+#define ASSET_SETS 2
+
+#define ASSET_NAMES { "title_screen_map", "menu_tilemap", "title_screen_cvgm", "entertainer_cvgm", "you_win_cvgm", "you_win_pcm", "checkerboard_tiles", "cards_tiles", "title_screen_tiles", "text_tiles", "you_win_tiles", "baize_tiles", "baize_palette", "cards_palette" }
+#define ASSET_SET_NAMES { "color", "mono" }
@@ -0,0 +1,2805 @@
+#include <stdint.h>
+
+const uint8_t __attribute__((aligned(2))) asset_pack[] = {
+	14, 2, 0, 0, 240, 3, 170, 0, 1, 0, 64, 2, 154, 4, 2, 0,
+	251, 16, 218, 6, 3, 0, 100, 53, 214, 23, 4, 0, 150, 10, 58, 77,
+	5, 0, 72, 9, 208, 87, 6, 0, 0, 2, 24, 97, 7, 0, 0, 20,
+	24, 99, 8, 1, 0, 63, 24, 119, 9, 1, 0, 8, 162, 136, 10, 1,
+	0, 4, 168, 141, 11, 0, 32, 1, 208, 144, 12, 0, 32, 0, 240, 145,
+	13, 0, 32, 0, 16, 146, 0, 0, 240, 3, 170, 0, 1, 0, 64, 2,
+	154, 4, 2, 0, 251, 16, 218, 6, 3, 0, 100, 53, 214, 23, 4, 0,
+	150, 10, 58, 77, 5, 0, 72, 9, 208, 87, 6, 0, 0, 1, 48, 146,
+	7, 0, 0, 10, 48, 147, 8, 1, 128, 31, 48, 157, 9, 1, 0, 4,
+	102, 169, 10, 1, 0, 2, 142, 172, 11, 0, 144, 0, 122, 174, 12, 0,
+	0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0,
+	3, 0, 4, 0, 5, 0, 6, 0, 7, 0, 8, 0, 9, 0, 10, 0,
+	11, 0, 12, 0, 13, 0, 14, 0, 15, 0, 16, 0, 17, 0, 18, 0,
+	19, 0, 20, 0, 21, 0, 22, 0, 23, 0, 24, 0, 25, 0, 26, 0,
+	27, 0, 28, 0, 29, 0, 30, 0, 31, 0, 32, 0, 33, 0, 34, 0,
+	35, 0, 36, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+	43, 0, 44, 0, 45, 0, 46, 0, 47, 0, 48, 0, 49, 0, 50, 0,
+	51, 0, 52, 0, 53, 0, 54, 0, 55, 0, 56, 0, 57, 0, 58, 0,
+	59, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 65, 0, 66, 0,
+	67, 0, 68, 0, 69, 0, 70, 0, 71, 0, 72, 0, 73, 0, 74, 0,
+	75, 0, 76, 0, 77, 0, 78, 0, 79, 0, 80, 0, 81, 0, 82, 0,
+	83, 0, 84, 0, 85, 0, 86, 0, 87, 0, 88, 0, 89, 0, 90, 0,
+	91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96, 0, 97, 0, 98, 0,
+	99, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106, 0,
+	107, 0, 108, 0, 109, 0, 110, 0, 111, 0, 112, 0, 113, 0, 114, 0,
+	115, 0, 116, 0, 117, 0, 118, 0, 119, 0, 120, 0, 121, 0, 122, 0,
+	123, 0, 124, 0, 125, 0, 126, 0, 127, 0, 128, 0, 129, 0, 130, 0,
+	131, 0, 132, 0, 133, 0, 134, 0, 135, 0, 136, 0, 137, 0, 138, 0,
+	139, 0, 140, 0, 141, 0, 142, 0, 143, 0, 144, 0, 145, 0, 146, 0,
+	147, 0, 148, 0, 149, 0, 150, 0, 151, 0, 152, 0, 153, 0, 154, 0,
+	155, 0, 156, 0, 157, 0, 158, 0, 159, 0, 160, 0, 161, 0, 162, 0,
+	163, 0, 164, 0, 165, 0, 166, 0, 167, 0, 168, 0, 169, 0, 170, 0,
+	171, 0, 172, 0, 173, 0, 174, 0, 175, 0, 176, 0, 177, 0, 178, 0,
+	179, 0, 180, 0, 181, 0, 182, 0, 183, 0, 184, 0, 185, 0, 186, 0,
+	187, 0, 188, 0, 189, 0, 190, 0, 191, 0, 192, 0, 193, 0, 194, 0,
+	195, 0, 196, 0, 197, 0, 198, 0, 199, 0, 200, 0, 201, 0, 202, 0,
+	203, 0, 204, 0, 205, 0, 206, 0, 207, 0, 208, 0, 209, 0, 210, 0,
+	211, 0, 212, 0, 213, 0, 214, 0, 215, 0, 216, 0, 217, 0, 218, 0,
+	219, 0, 220, 0, 221, 0, 222, 0, 223, 0, 224, 0, 225, 0, 226, 0,
+	227, 0, 228, 0, 229, 0, 230, 0, 231, 0, 232, 0, 233, 0, 234, 0,
+	235, 0, 236, 0, 237, 0, 238, 0, 239, 0, 240, 0, 241, 0, 242, 0,
+	243, 0, 244, 0, 245, 0, 246, 0, 247, 0, 248, 0, 249, 0, 250, 0,
+	251, 0, 252, 0, 253, 0, 254, 0, 255, 0, 0, 1, 1, 1, 2, 1,
+	3, 1, 4, 1, 5, 1, 6, 1, 7, 1, 8, 1, 9, 1, 10, 1,
+	11, 1, 12, 1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18, 1,
+	19, 1, 20, 1, 21, 1, 22, 1, 23, 1, 24, 1, 25, 1, 26, 1,
+	27, 1, 28, 1, 29, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34, 1,
+	35, 1, 36, 1, 37, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42, 1,
+	43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48, 1, 49, 1, 50, 1,
+	51, 1, 52, 1, 53, 1, 54, 1, 55, 1, 56, 1, 57, 1, 58, 1,
+	59, 1, 60, 1, 61, 1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1,
+	67, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72, 1, 73, 1, 74, 1,
+	75, 1, 76, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81, 1, 82, 1,
+	83, 1, 84, 1, 85, 1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1,
+	91, 1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97, 1, 98, 1,
+	99, 1, 100, 1, 101, 1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 1,
+	107, 1, 108, 1, 109, 1, 110, 1, 111, 1, 112, 1, 113, 1, 114, 1,
+	115, 1, 116, 1, 117, 1, 118, 1, 119, 1, 120, 1, 121, 1, 122, 1,
+	123, 1, 124, 1, 125, 1, 126, 1, 127, 1, 128, 1, 129, 1, 130, 1,
+	131, 1, 132, 1, 133, 1, 134, 1, 135, 1, 136, 1, 137, 1, 138, 1,
+	139, 1, 140, 1, 141, 1, 142, 1, 143, 1, 144, 1, 145, 1, 146, 1,
+	147, 1, 148, 1, 149, 1, 150, 1, 151, 1, 152, 1, 153, 1, 154, 1,
+	155, 1, 156, 1, 157, 1, 158, 1, 159, 1, 160, 1, 161, 1, 162, 1,
+	163, 1, 164, 1, 165, 1, 166, 1, 167, 1, 168, 1, 169, 1, 170, 1,
+	171, 1, 172, 1, 173, 1, 174, 1, 175, 1, 176, 1, 177, 1, 178, 1,
+	179, 1, 180, 1, 181, 1, 182, 1, 183, 1, 184, 1, 185, 1, 186, 1,
+	187, 1, 188, 1, 189, 1, 190, 1, 191, 1, 192, 1, 193, 1, 194, 1,
+	195, 1, 196, 1, 197, 1, 198, 1, 199, 1, 200, 1, 201, 1, 202, 1,
+	203, 1, 204, 1, 205, 1, 206, 1, 207, 1, 208, 1, 209, 1, 210, 1,
+	211, 1, 212, 1, 213, 1, 214, 1, 215, 1, 216, 1, 217, 1, 218, 1,
+	219, 1, 220, 1, 221, 1, 222, 1, 223, 1, 224, 1, 225, 1, 226, 1,
+	227, 1, 228, 1, 229, 1, 230, 1, 231, 1, 232, 1, 233, 1, 234, 1,
+	235, 1, 236, 1, 237, 1, 238, 1, 239, 1, 240, 1, 241, 1, 242, 1,
+	243, 1, 244, 1, 245, 1, 246, 1, 247, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 213, 206, 196, 207, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 210, 197, 211, 212, 193, 210, 212, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 206, 197, 215, 160, 199, 193, 205, 197, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 160, 160, 160, 194, 193, 195, 203, 160, 160, 160, 160, 160, 160, 160, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 255, 255, 106, 255, 255,
+	72, 255, 0, 16, 2, 16, 33, 50, 67, 84, 101, 118, 135, 152, 169, 186,
+	203, 220, 237, 206, 96, 183, 7, 73, 255, 253, 10, 0, 98, 110, 7, 100,
+	0, 0, 75, 255, 255, 10, 0, 102, 34, 5, 80, 11, 240, 104, 255, 255,
+	75, 255, 80, 11, 240, 239, 51, 0, 104, 238, 238, 75, 238, 80, 11, 240,
+	239, 62, 0, 239, 62, 0, 104, 221, 221, 75, 221, 80, 11, 240, 104, 204,
+	204, 75, 204, 80, 11, 240, 104, 187, 187, 75, 187, 80, 11, 240, 104, 170,
+	170, 75, 170, 80, 11, 240, 104, 153, 153, 75, 153, 80, 11, 240, 104, 136,
+	136, 75, 136, 80, 11, 240, 104, 119, 119, 75, 119, 80, 11, 240, 104, 85,
+	85, 75, 85, 80, 11, 240, 104, 51, 51, 75, 51, 80, 11, 240, 104, 0,
+	0, 75, 0, 80, 11, 240, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 72, 255,
+	96, 187, 7, 73, 255, 98, 119, 7, 75, 0, 80, 11, 240, 104, 255, 255,
+	75, 0, 80, 11, 240, 239, 195, 0, 104, 238, 238, 75, 0, 80, 11, 240,
+	239, 206, 0, 239, 206, 0, 104, 221, 221, 75, 0, 80, 11, 240, 104, 204,
+	204, 75, 0, 80, 11, 240, 72, 255, 96, 191, 7, 73, 255, 98, 126, 7,
+	74, 255, 254, 10, 0, 100, 100, 6, 75, 255, 102, 22, 6, 80, 15, 240,
+	104, 255, 255, 106, 255, 255, 80, 15, 240, 239, 6, 1, 104, 238, 238, 106,
+	238, 238, 80, 15, 240, 239, 18, 1, 239, 18, 1, 104, 221, 221, 106, 221,
+	221, 80, 15, 240, 104, 204, 204, 106, 204, 204, 80, 15, 240, 104, 187, 187,
+	106, 187, 187, 80, 15, 240, 104, 170, 170, 106, 170, 170, 80, 15, 240, 104,
+	153, 153, 106, 153, 153, 80, 15, 240, 104, 136, 136, 106, 136, 136, 80, 15,
+	240, 104, 119, 119, 106, 119, 119, 80, 15, 240, 104, 85, 85, 106, 85, 85,
+	80, 15, 240, 104, 51, 51, 106, 51, 51, 80, 15, 240, 104, 0, 0, 106,
+	0, 0, 80, 15, 240, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 72, 255, 96,
+	195, 7, 73, 255, 98, 134, 7, 106, 0, 0, 80, 15, 240, 104, 255, 255,
+	106, 0, 0, 80, 15, 240, 239, 163, 1, 104, 238, 238, 106, 0, 0, 80,
+	15, 240, 239, 175, 1, 239, 175, 1, 104, 221, 221, 106, 0, 0, 80, 15,
+	240, 104, 204, 204, 106, 0, 0, 80, 15, 240, 72, 255, 96, 205, 7, 73,
+	255, 98, 153, 7, 100, 100, 6, 75, 255, 102, 34, 5, 80, 11, 240, 239,
+	51, 0, 239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76,
+	0, 239, 84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0,
+	239, 124, 0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 72, 255, 96, 201, 7, 73, 255, 98, 147, 7, 75, 0,
+	80, 11, 240, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239,
+	206, 0, 239, 220, 0, 239, 228, 0, 72, 255, 96, 195, 7, 73, 255, 98,
+	134, 7, 74, 255, 100, 100, 6, 75, 255, 102, 22, 6, 80, 15, 240, 239,
+	6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33,
+	1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1,
+	239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 72, 255, 96, 201, 7, 73, 255, 98, 147, 7, 106, 0,
+	0, 80, 15, 240, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1,
+	239, 175, 1, 239, 190, 1, 239, 199, 1, 72, 255, 96, 195, 7, 73, 255,
+	98, 134, 7, 100, 100, 6, 75, 255, 102, 44, 4, 80, 11, 240, 239, 51,
+	0, 239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76, 0,
+	239, 84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0, 239,
+	124, 0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 72, 255, 96, 191, 7, 73, 255, 98, 126, 7, 75, 0, 80,
+	11, 240, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239, 206,
+	0, 239, 220, 0, 239, 228, 0, 72, 255, 96, 187, 7, 73, 255, 98, 119,
+	7, 74, 255, 100, 22, 6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 6,
+	1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33, 1,
+	239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1, 239,
+	87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 72, 255, 96, 183, 7, 73, 255, 98, 110, 7, 106, 0, 0,
+	80, 15, 240, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239,
+	175, 1, 239, 190, 1, 239, 199, 1, 104, 187, 187, 100, 22, 6, 75, 255,
+	102, 44, 4, 80, 11, 240, 104, 170, 170, 75, 255, 80, 11, 240, 104, 153,
+	153, 75, 255, 80, 11, 240, 104, 136, 136, 75, 238, 80, 11, 240, 104, 119,
+	119, 75, 238, 80, 11, 240, 104, 85, 85, 75, 238, 80, 11, 240, 104, 51,
+	51, 75, 221, 80, 11, 240, 104, 0, 0, 75, 204, 80, 11, 240, 104, 0,
+	0, 75, 187, 80, 11, 240, 104, 0, 0, 75, 170, 80, 11, 240, 104, 0,
+	0, 75, 153, 80, 11, 240, 104, 0, 0, 75, 136, 80, 11, 240, 104, 0,
+	0, 75, 119, 80, 11, 240, 104, 0, 0, 75, 85, 80, 11, 240, 104, 0,
+	0, 75, 51, 80, 11, 240, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 72, 255, 96, 159, 7, 73, 255, 98, 62, 7, 75, 0, 80, 11, 240,
+	239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239, 206, 0, 239,
+	220, 0, 239, 228, 0, 72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 74,
+	255, 100, 22, 6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 6, 1, 239,
+	6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33, 1, 239, 42,
+	1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1, 239, 87, 1,
+	239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 72, 255, 96, 179, 7, 73, 255, 98, 102, 7, 106, 0, 0, 80, 15,
+	240, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239, 175, 1,
+	239, 190, 1, 239, 199, 1, 72, 255, 96, 183, 7, 73, 255, 98, 110, 7,
+	100, 22, 6, 75, 255, 102, 34, 5, 80, 11, 240, 239, 51, 0, 239, 51,
+	0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76, 0, 239, 84, 0,
+	239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0, 239, 124, 0, 239,
+	132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 180, 0, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239,
+	206, 0, 239, 220, 0, 239, 228, 0, 72, 255, 96, 191, 7, 73, 255, 98,
+	126, 7, 74, 255, 100, 100, 6, 75, 255, 102, 22, 6, 80, 15, 240, 239,
+	6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33,
+	1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1,
+	239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 147, 1, 239, 163, 1, 239, 163, 1, 239, 175, 1,
+	239, 175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 239, 208, 1, 239,
+	51, 0, 239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76,
+	0, 239, 84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0,
+	239, 124, 0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 239, 42, 2, 239, 195, 0, 239, 195, 0, 239, 206, 0,
+	239, 206, 0, 239, 206, 0, 239, 220, 0, 239, 228, 0, 239, 78, 2, 239,
+	6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33,
+	1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1,
+	239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 170, 2, 239, 163, 1, 239, 163, 1, 239, 175, 1,
+	239, 175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 72, 255, 96, 207,
+	7, 73, 255, 98, 93, 7, 100, 100, 6, 75, 255, 102, 44, 4, 80, 11,
+	240, 239, 51, 0, 239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0,
+	239, 76, 0, 239, 84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239,
+	116, 0, 239, 124, 0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 239, 148, 0, 72, 255, 96, 201, 7, 73, 255, 98, 73, 7,
+	75, 0, 80, 11, 240, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206,
+	0, 239, 206, 0, 239, 220, 0, 239, 228, 0, 72, 255, 96, 207, 7, 73,
+	255, 98, 93, 7, 74, 255, 100, 22, 6, 75, 255, 102, 218, 5, 80, 15,
+	240, 239, 6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1,
+	239, 33, 1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239,
+	78, 1, 239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 239, 114, 1, 72, 255, 96, 195, 7, 73, 255, 98, 62, 7,
+	106, 0, 0, 80, 15, 240, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239,
+	175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 239, 206, 3, 239, 220,
+	3, 239, 228, 3, 239, 236, 3, 239, 244, 3, 239, 252, 3, 239, 4, 4,
+	239, 12, 4, 239, 20, 4, 239, 28, 4, 239, 36, 4, 239, 44, 4, 239,
+	52, 4, 239, 60, 4, 239, 68, 4, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 72, 255, 96, 187, 7,
+	73, 255, 98, 38, 7, 74, 255, 100, 22, 6, 75, 255, 102, 218, 5, 80,
+	15, 240, 239, 6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18,
+	1, 239, 33, 1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1,
+	239, 78, 1, 239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 72,
+	255, 96, 195, 7, 73, 255, 98, 134, 7, 100, 22, 6, 75, 255, 102, 186,
+	5, 80, 11, 240, 239, 51, 0, 239, 51, 0, 239, 62, 0, 239, 62, 0,
+	239, 62, 0, 239, 76, 0, 239, 84, 0, 239, 92, 0, 239, 100, 0, 239,
+	108, 0, 239, 116, 0, 239, 124, 0, 239, 132, 0, 239, 140, 0, 239, 148,
+	0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 239, 148, 0, 239, 148, 0, 72, 255, 96, 195, 7, 73, 255,
+	98, 134, 7, 75, 0, 80, 11, 240, 239, 195, 0, 239, 195, 0, 239, 206,
+	0, 239, 206, 0, 239, 206, 0, 239, 220, 0, 239, 228, 0, 104, 187, 187,
+	74, 255, 100, 123, 6, 75, 255, 102, 22, 6, 80, 15, 240, 104, 170, 170,
+	106, 255, 255, 80, 15, 240, 104, 153, 153, 106, 255, 255, 80, 15, 240, 104,
+	136, 136, 106, 238, 238, 80, 15, 240, 104, 119, 119, 106, 238, 238, 80, 15,
+	240, 104, 85, 85, 106, 238, 238, 80, 15, 240, 104, 51, 51, 106, 221, 221,
+	80, 15, 240, 104, 0, 0, 106, 204, 204, 80, 15, 240, 104, 0, 0, 106,
+	187, 187, 80, 15, 240, 104, 0, 0, 106, 170, 170, 80, 15, 240, 104, 0,
+	0, 106, 153, 153, 80, 15, 240, 104, 0, 0, 106, 136, 136, 80, 15, 240,
+	104, 0, 0, 106, 119, 119, 80, 15, 240, 104, 0, 0, 106, 85, 85, 80,
+	15, 240, 104, 0, 0, 106, 51, 51, 80, 15, 240, 239, 114, 1, 239, 147,
+	1, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239, 175, 1,
+	239, 190, 1, 239, 199, 1, 239, 170, 2, 239, 163, 1, 239, 163, 1, 239,
+	175, 1, 239, 175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 72, 255,
+	96, 195, 7, 73, 255, 98, 134, 7, 100, 123, 6, 75, 255, 102, 186, 5,
+	80, 11, 240, 239, 51, 0, 239, 51, 0, 239, 62, 0, 239, 62, 0, 239,
+	62, 0, 239, 76, 0, 239, 84, 0, 239, 92, 0, 239, 100, 0, 239, 108,
+	0, 72, 255, 96, 187, 7, 73, 255, 98, 119, 7, 75, 136, 80, 11, 240,
+	104, 255, 255, 75, 119, 80, 11, 240, 104, 255, 255, 75, 85, 80, 11, 240,
+	104, 238, 238, 75, 51, 80, 11, 240, 239, 206, 0, 239, 206, 0, 239, 220,
+	0, 239, 228, 0, 104, 187, 187, 75, 0, 80, 11, 240, 104, 170, 170, 75,
+	0, 80, 11, 240, 104, 153, 153, 75, 0, 80, 11, 240, 72, 255, 96, 183,
+	7, 73, 255, 98, 110, 7, 75, 0, 80, 11, 240, 239, 195, 0, 239, 195,
+	0, 239, 206, 0, 239, 206, 0, 239, 206, 0, 239, 220, 0, 239, 228, 0,
+	239, 42, 10, 239, 50, 10, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7,
+	74, 255, 100, 123, 6, 75, 255, 102, 22, 6, 80, 15, 240, 239, 6, 1,
+	239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33, 1, 239,
+	42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 72, 255, 96, 164, 7,
+	73, 255, 98, 73, 7, 106, 136, 136, 80, 15, 240, 104, 255, 255, 106, 119,
+	119, 80, 15, 240, 104, 255, 255, 106, 85, 85, 80, 15, 240, 104, 238, 238,
+	106, 51, 51, 80, 15, 240, 239, 175, 1, 239, 175, 1, 239, 190, 1, 239,
+	199, 1, 104, 187, 187, 106, 0, 0, 80, 15, 240, 104, 170, 170, 106, 0,
+	0, 80, 15, 240, 104, 153, 153, 106, 0, 0, 80, 15, 240, 72, 255, 96,
+	159, 7, 73, 255, 98, 62, 7, 106, 0, 0, 80, 15, 240, 239, 163, 1,
+	239, 163, 1, 239, 175, 1, 239, 175, 1, 239, 175, 1, 239, 190, 1, 239,
+	199, 1, 239, 216, 10, 239, 225, 10, 72, 255, 96, 164, 7, 73, 255, 98,
+	73, 7, 100, 123, 6, 75, 255, 102, 151, 4, 80, 11, 240, 239, 51, 0,
+	239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76, 0, 239,
+	84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0, 239, 124,
+	0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 75, 0, 80, 11,
+	240, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239, 206, 0,
+	239, 220, 0, 239, 228, 0, 104, 187, 187, 74, 255, 100, 76, 6, 75, 255,
+	102, 22, 6, 80, 15, 240, 239, 19, 9, 239, 28, 9, 239, 37, 9, 239,
+	46, 9, 239, 55, 9, 239, 64, 9, 239, 73, 9, 239, 82, 9, 239, 91,
+	9, 239, 100, 9, 239, 109, 9, 239, 118, 9, 239, 127, 9, 239, 136, 9,
+	239, 114, 1, 72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 106, 0, 0,
+	80, 15, 240, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239,
+	175, 1, 239, 190, 1, 239, 199, 1, 239, 243, 10, 239, 163, 1, 239, 163,
+	1, 239, 175, 1, 239, 175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1,
+	72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 100, 76, 6, 75, 255, 102,
+	151, 4, 80, 11, 240, 239, 51, 0, 239, 51, 0, 239, 62, 0, 239, 62,
+	0, 239, 62, 0, 239, 76, 0, 239, 84, 0, 72, 255, 96, 169, 7, 73,
+	255, 98, 83, 7, 75, 187, 80, 11, 240, 104, 255, 255, 75, 170, 80, 11,
+	240, 104, 255, 255, 75, 153, 80, 11, 240, 104, 238, 238, 75, 136, 80, 11,
+	240, 104, 238, 238, 75, 119, 80, 11, 240, 104, 238, 238, 75, 85, 80, 11,
+	240, 104, 221, 221, 75, 51, 80, 11, 240, 239, 228, 0, 72, 255, 96, 174,
+	7, 73, 255, 98, 93, 7, 75, 0, 80, 11, 240, 239, 195, 0, 239, 195,
+	0, 239, 206, 0, 239, 206, 0, 239, 206, 0, 239, 220, 0, 239, 228, 0,
+	72, 255, 96, 179, 7, 73, 255, 98, 102, 7, 75, 0, 80, 11, 240, 239,
+	195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239, 206, 0, 239, 220,
+	0, 239, 228, 0, 72, 255, 96, 183, 7, 73, 255, 98, 110, 7, 74, 255,
+	100, 76, 6, 75, 255, 102, 22, 6, 80, 15, 240, 239, 6, 1, 239, 6,
+	1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33, 1, 239, 42, 1,
+	239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1, 239, 87, 1, 239,
+	96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 72, 255, 96, 187, 7, 73, 255, 98,
+	119, 7, 100, 76, 6, 75, 255, 102, 114, 5, 80, 11, 240, 239, 51, 0,
+	239, 51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76, 0, 239,
+	84, 0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0, 239, 124,
+	0, 239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0,
+	239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 180, 0, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206,
+	0, 239, 206, 0, 239, 220, 0, 239, 228, 0, 104, 187, 187, 74, 255, 100,
+	76, 6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 19, 9, 239, 28, 9,
+	239, 37, 9, 239, 46, 9, 239, 55, 9, 239, 64, 9, 239, 73, 9, 239,
+	82, 9, 239, 91, 9, 239, 100, 9, 239, 109, 9, 239, 118, 9, 239, 127,
+	9, 239, 136, 9, 239, 114, 1, 72, 255, 96, 187, 7, 73, 255, 98, 119,
+	7, 106, 0, 0, 80, 15, 240, 239, 163, 1, 239, 163, 1, 239, 175, 1,
+	239, 175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 239, 147, 1, 239,
+	163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239, 175, 1, 239, 190,
+	1, 239, 199, 1, 239, 62, 13, 239, 51, 0, 239, 51, 0, 239, 62, 0,
+	239, 62, 0, 239, 62, 0, 239, 76, 0, 239, 84, 0, 239, 92, 0, 239,
+	100, 0, 239, 108, 0, 72, 255, 96, 183, 7, 73, 255, 98, 110, 7, 75,
+	136, 80, 11, 240, 239, 6, 10, 239, 14, 10, 239, 22, 10, 239, 206, 0,
+	239, 206, 0, 239, 220, 0, 239, 228, 0, 239, 42, 10, 239, 50, 10, 239,
+	58, 10, 239, 130, 12, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206,
+	0, 239, 206, 0, 239, 220, 0, 239, 228, 0, 239, 42, 10, 239, 50, 10,
+	72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 74, 255, 100, 76, 6, 75,
+	255, 102, 218, 5, 80, 15, 240, 239, 6, 1, 239, 6, 1, 239, 18, 1,
+	239, 18, 1, 239, 18, 1, 239, 33, 1, 239, 42, 1, 239, 51, 1, 239,
+	60, 1, 239, 69, 1, 72, 255, 96, 159, 7, 73, 255, 98, 62, 7, 106,
+	136, 136, 80, 15, 240, 239, 177, 10, 239, 186, 10, 239, 195, 10, 239, 175,
+	1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 239, 216, 10, 239, 225, 10,
+	239, 234, 10, 239, 217, 11, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239,
+	175, 1, 239, 175, 1, 239, 190, 1, 239, 199, 1, 239, 216, 10, 239, 225,
+	10, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7, 100, 76, 6, 75, 255,
+	102, 44, 4, 80, 11, 240, 239, 51, 0, 239, 51, 0, 239, 62, 0, 239,
+	62, 0, 239, 62, 0, 239, 76, 0, 239, 84, 0, 239, 92, 0, 239, 100,
+	0, 239, 108, 0, 239, 116, 0, 239, 124, 0, 239, 132, 0, 239, 140, 0,
+	239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 130, 12, 239, 195,
+	0, 239, 195, 0, 239, 206, 0, 239, 206, 0, 239, 206, 0, 239, 220, 0,
+	239, 228, 0, 72, 255, 96, 159, 7, 73, 255, 98, 62, 7, 74, 255, 100,
+	123, 6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 6, 1, 239, 6, 1,
+	239, 18, 1, 239, 18, 1, 239, 18, 1, 239, 33, 1, 239, 42, 1, 239,
+	51, 1, 239, 60, 1, 239, 69, 1, 239, 78, 1, 239, 87, 1, 239, 96,
+	1, 239, 105, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239,
+	243, 10, 239, 163, 1, 239, 163, 1, 239, 175, 1, 239, 175, 1, 239, 175,
+	1, 239, 190, 1, 239, 199, 1, 72, 255, 96, 187, 7, 73, 255, 98, 119,
+	7, 100, 123, 6, 75, 255, 102, 44, 4, 80, 11, 240, 239, 51, 0, 239,
+	51, 0, 239, 62, 0, 239, 62, 0, 239, 62, 0, 239, 76, 0, 239, 84,
+	0, 239, 92, 0, 239, 100, 0, 239, 108, 0, 239, 116, 0, 239, 124, 0,
+	239, 132, 0, 239, 140, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239,
+	148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148, 0, 239, 148,
+	0, 239, 180, 0, 239, 195, 0, 239, 195, 0, 239, 206, 0, 239, 206, 0,
+	239, 206, 0, 239, 220, 0, 239, 228, 0, 72, 255, 96, 195, 7, 73, 255,
+	98, 134, 7, 74, 255, 100, 11, 7, 75, 255, 102, 22, 6, 80, 15, 240,
+	239, 6, 1, 239, 6, 1, 239, 18, 1, 239, 18, 1, 239, 18, 1, 239,
+	33, 1, 239, 42, 1, 239, 51, 1, 239, 60, 1, 239, 69, 1, 239, 78,
+	1, 239, 87, 1, 239, 96, 1, 239, 105, 1, 239, 114, 1, 239, 114, 1,
+	239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239,
+	114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114,
+	1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 239, 114, 1, 72, 255, 96,
+	183, 7, 73, 255, 98, 110, 7, 100, 11, 7, 75, 255, 102, 34, 5, 80,
+	11, 240, 250, 0, 0, 0, 104, 255, 255, 106, 255, 255, 72, 255, 0, 16,
+	0, 16, 33, 50, 67, 84, 101, 118, 135, 152, 169, 186, 203, 220, 237, 254,
+	96, 174, 7, 73, 255, 253, 10, 0, 98, 93, 7, 100, 0, 0, 102, 0,
+	0, 80, 3, 240, 104, 238, 238, 80, 3, 240, 104, 204, 204, 80, 3, 240,
+	104, 187, 187, 80, 3, 240, 104, 170, 170, 80, 3, 240, 239, 64, 0, 104,
+	153, 153, 80, 3, 240, 104, 136, 136, 80, 3, 240, 239, 79, 0, 104, 119,
+	119, 80, 3, 240, 104, 102, 102, 80, 3, 240, 104, 68, 68, 80, 3, 240,
+	72, 255, 96, 183, 7, 73, 255, 98, 110, 7, 80, 3, 240, 239, 46, 0,
+	239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239,
+	79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 72, 255,
+	96, 164, 7, 73, 255, 98, 73, 7, 80, 3, 240, 239, 46, 0, 239, 52,
+	0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79, 0,
+	239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 72, 255, 96, 147,
+	7, 73, 255, 98, 38, 7, 80, 3, 240, 239, 46, 0, 239, 52, 0, 239,
+	58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79, 0, 239, 79,
+	0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 104, 34, 34, 80, 3, 240,
+	104, 17, 17, 80, 3, 240, 104, 0, 0, 80, 3, 240, 239, 0, 1, 239,
+	0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0,
+	1, 239, 0, 1, 239, 0, 1, 72, 255, 96, 159, 7, 73, 255, 98, 62,
+	7, 80, 3, 240, 239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0,
+	239, 64, 0, 239, 73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239,
+	94, 0, 239, 100, 0, 72, 255, 96, 134, 7, 73, 255, 98, 11, 7, 80,
+	3, 240, 239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64,
+	0, 239, 73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0,
+	239, 100, 0, 239, 244, 0, 239, 250, 0, 239, 0, 1, 239, 0, 1, 239,
+	0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0,
+	1, 239, 0, 1, 239, 0, 1, 72, 255, 96, 93, 7, 73, 255, 98, 185,
+	6, 80, 3, 240, 239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0,
+	239, 64, 0, 239, 73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239,
+	94, 0, 239, 100, 0, 72, 255, 96, 110, 7, 73, 255, 98, 221, 6, 80,
+	3, 240, 239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64,
+	0, 239, 73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0,
+	239, 100, 0, 72, 255, 96, 73, 7, 73, 255, 98, 145, 6, 80, 3, 240,
+	239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239,
+	73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100,
+	0, 72, 255, 96, 38, 7, 73, 255, 98, 76, 6, 80, 3, 240, 239, 46,
+	0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0,
+	239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 239,
+	244, 0, 239, 250, 0, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0,
+	1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1,
+	239, 0, 1, 72, 255, 96, 62, 7, 73, 255, 98, 123, 6, 80, 3, 240,
+	239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239,
+	73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100,
+	0, 72, 255, 96, 11, 7, 73, 255, 98, 22, 6, 80, 3, 240, 239, 46,
+	0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0,
+	239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 239,
+	244, 0, 239, 250, 0, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0,
+	1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1,
+	239, 0, 1, 72, 255, 96, 185, 6, 73, 255, 98, 114, 5, 80, 3, 240,
+	239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239,
+	73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100,
+	0, 72, 255, 96, 221, 6, 73, 255, 98, 186, 5, 80, 3, 240, 239, 46,
+	0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0,
+	239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 72,
+	255, 96, 145, 6, 73, 255, 98, 34, 5, 80, 3, 240, 239, 46, 0, 239,
+	52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79,
+	0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 72, 255, 96,
+	76, 6, 73, 255, 98, 151, 4, 80, 3, 240, 239, 46, 0, 239, 52, 0,
+	239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79, 0, 239,
+	79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 239, 244, 0, 239, 250,
+	0, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1,
+	239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 72,
+	255, 96, 123, 6, 73, 255, 98, 246, 4, 80, 3, 240, 239, 46, 0, 239,
+	52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79,
+	0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 239, 135, 3,
+	239, 46, 0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239,
+	73, 0, 239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100,
+	0, 72, 255, 96, 50, 6, 73, 255, 98, 99, 4, 80, 3, 240, 239, 46,
+	0, 239, 52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0,
+	239, 79, 0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 72,
+	255, 96, 22, 6, 73, 255, 98, 44, 4, 80, 3, 240, 239, 46, 0, 239,
+	52, 0, 239, 58, 0, 239, 64, 0, 239, 64, 0, 239, 73, 0, 239, 79,
+	0, 239, 79, 0, 239, 88, 0, 239, 94, 0, 239, 100, 0, 239, 244, 0,
+	239, 250, 0, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239,
+	0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0, 1, 239, 0,
+	1, 96, 22, 6, 98, 44, 4, 80, 0, 240, 80, 0, 240, 239, 180, 4,
+	239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239,
+	180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180,
+	4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4,
+	239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 239, 180, 4, 72,
+	255, 96, 134, 7, 73, 255, 98, 62, 7, 74, 255, 254, 10, 0, 100, 22,
+	6, 75, 255, 255, 10, 0, 102, 44, 4, 80, 15, 240, 104, 238, 238, 106,
+	238, 238, 80, 15, 240, 104, 204, 204, 106, 204, 204, 80, 15, 240, 104, 187,
+	187, 106, 187, 187, 80, 15, 240, 104, 170, 170, 106, 170, 170, 80, 15, 240,
+	239, 49, 5, 104, 153, 153, 106, 153, 153, 80, 15, 240, 104, 136, 136, 106,
+	136, 136, 80, 15, 240, 239, 70, 5, 104, 119, 119, 106, 119, 119, 80, 15,
+	240, 104, 102, 102, 106, 102, 102, 80, 15, 240, 104, 68, 68, 106, 68, 68,
+	80, 15, 240, 104, 34, 34, 106, 34, 34, 80, 15, 240, 104, 17, 17, 106,
+	17, 17, 80, 15, 240, 104, 0, 0, 106, 0, 0, 80, 15, 240, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 93, 7, 98, 62,
+	7, 100, 22, 6, 102, 44, 4, 80, 1, 240, 72, 238, 80, 1, 240, 72,
+	204, 80, 1, 240, 72, 187, 80, 1, 240, 72, 170, 80, 1, 240, 239, 195,
+	5, 72, 153, 80, 1, 240, 72, 136, 80, 1, 240, 239, 208, 5, 72, 119,
+	80, 1, 240, 72, 102, 80, 1, 240, 72, 68, 80, 1, 240, 72, 255, 96,
+	102, 7, 80, 1, 240, 239, 180, 5, 239, 185, 5, 239, 190, 5, 239, 195,
+	5, 239, 195, 5, 239, 203, 5, 239, 208, 5, 239, 208, 5, 239, 216, 5,
+	239, 221, 5, 239, 226, 5, 72, 255, 96, 110, 7, 98, 62, 7, 100, 22,
+	6, 75, 255, 102, 34, 5, 80, 9, 240, 72, 238, 75, 238, 80, 9, 240,
+	72, 204, 75, 204, 80, 9, 240, 72, 187, 75, 187, 80, 9, 240, 72, 170,
+	75, 170, 80, 9, 240, 239, 56, 6, 72, 153, 75, 153, 80, 9, 240, 72,
+	136, 75, 136, 80, 9, 240, 239, 73, 6, 72, 119, 75, 119, 80, 9, 240,
+	72, 102, 75, 102, 80, 9, 240, 72, 68, 75, 68, 80, 9, 240, 72, 255,
+	96, 164, 7, 75, 34, 80, 9, 240, 72, 238, 75, 17, 80, 9, 240, 72,
+	204, 75, 0, 80, 9, 240, 72, 187, 75, 0, 80, 9, 240, 72, 170, 75,
+	0, 80, 9, 240, 239, 135, 6, 72, 153, 75, 0, 80, 9, 240, 72, 136,
+	75, 0, 80, 9, 240, 239, 152, 6, 72, 119, 75, 0, 80, 9, 240, 72,
+	102, 75, 0, 80, 9, 240, 72, 68, 75, 0, 80, 9, 240, 104, 34, 255,
+	98, 145, 6, 74, 255, 100, 22, 6, 75, 255, 102, 186, 5, 80, 15, 240,
+	104, 17, 238, 106, 238, 238, 80, 15, 240, 104, 0, 204, 106, 204, 204, 80,
+	15, 240, 104, 0, 187, 106, 187, 187, 80, 15, 240, 104, 0, 170, 106, 170,
+	170, 80, 15, 240, 239, 229, 6, 104, 0, 153, 106, 153, 153, 80, 15, 240,
+	104, 0, 136, 106, 136, 136, 80, 15, 240, 239, 250, 6, 104, 0, 119, 106,
+	119, 119, 80, 15, 240, 104, 0, 102, 106, 102, 102, 80, 15, 240, 104, 0,
+	68, 106, 68, 68, 80, 15, 240, 72, 255, 96, 110, 7, 105, 34, 34, 75,
+	34, 80, 15, 240, 104, 238, 17, 106, 17, 17, 80, 15, 240, 104, 204, 0,
+	106, 0, 0, 80, 15, 240, 104, 187, 0, 106, 0, 0, 80, 15, 240, 104,
+	170, 0, 106, 0, 0, 80, 15, 240, 239, 73, 7, 104, 153, 0, 106, 0,
+	0, 80, 15, 240, 104, 136, 0, 106, 0, 0, 80, 15, 240, 239, 94, 7,
+	104, 119, 0, 106, 0, 0, 80, 15, 240, 104, 102, 0, 106, 0, 0, 80,
+	15, 240, 104, 68, 0, 106, 0, 0, 80, 15, 240, 72, 255, 96, 164, 7,
+	98, 145, 6, 100, 22, 6, 75, 255, 102, 44, 4, 80, 9, 240, 239, 35,
+	6, 239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6, 239, 66, 6,
+	239, 73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239, 97, 6, 72,
+	34, 75, 34, 80, 9, 240, 72, 17, 75, 17, 80, 9, 240, 72, 0, 75,
+	0, 80, 9, 240, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7,
+	239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 72,
+	255, 96, 110, 7, 73, 255, 98, 145, 6, 74, 255, 100, 100, 6, 75, 255,
+	102, 22, 6, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 164, 7, 105, 34, 34, 75,
+	34, 80, 15, 240, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7,
+	239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239,
+	115, 7, 239, 124, 7, 72, 34, 98, 145, 6, 100, 100, 6, 75, 255, 102,
+	180, 3, 80, 9, 240, 72, 17, 75, 238, 80, 9, 240, 72, 0, 75, 204,
+	80, 9, 240, 72, 0, 75, 187, 80, 9, 240, 72, 0, 75, 170, 80, 9,
+	240, 239, 116, 8, 72, 0, 75, 153, 80, 9, 240, 72, 0, 75, 136, 80,
+	9, 240, 239, 133, 8, 72, 0, 75, 119, 80, 9, 240, 72, 0, 75, 102,
+	80, 9, 240, 72, 0, 75, 68, 80, 9, 240, 72, 0, 75, 34, 80, 9,
+	240, 72, 0, 75, 17, 80, 9, 240, 239, 199, 7, 239, 199, 7, 239, 199,
+	7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7,
+	239, 199, 7, 239, 199, 7, 104, 0, 255, 98, 145, 6, 74, 255, 100, 76,
+	6, 102, 180, 3, 80, 7, 240, 104, 0, 238, 74, 238, 80, 7, 240, 104,
+	0, 204, 74, 204, 80, 7, 240, 104, 0, 187, 74, 187, 80, 7, 240, 104,
+	0, 170, 74, 170, 80, 7, 240, 239, 249, 8, 104, 0, 153, 74, 153, 80,
+	7, 240, 104, 0, 136, 74, 136, 80, 7, 240, 239, 12, 9, 104, 0, 119,
+	74, 119, 80, 7, 240, 104, 0, 102, 74, 102, 80, 7, 240, 104, 0, 68,
+	74, 68, 80, 7, 240, 104, 0, 34, 74, 34, 80, 7, 240, 104, 0, 17,
+	74, 17, 80, 7, 240, 104, 0, 0, 74, 0, 80, 7, 240, 239, 63, 9,
+	239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239,
+	63, 9, 239, 63, 9, 239, 63, 9, 72, 0, 98, 145, 6, 100, 76, 6,
+	75, 255, 102, 115, 3, 80, 9, 240, 72, 0, 75, 238, 80, 9, 240, 239,
+	102, 8, 239, 109, 8, 239, 116, 8, 239, 116, 8, 239, 126, 8, 239, 133,
+	8, 239, 133, 8, 239, 143, 8, 239, 150, 8, 239, 157, 8, 72, 255, 96,
+	164, 7, 73, 255, 98, 110, 7, 75, 34, 80, 11, 240, 104, 238, 238, 75,
+	17, 80, 11, 240, 104, 204, 204, 75, 0, 80, 11, 240, 104, 187, 187, 75,
+	0, 80, 11, 240, 104, 170, 170, 75, 0, 80, 11, 240, 239, 190, 9, 104,
+	153, 153, 75, 0, 80, 11, 240, 104, 136, 136, 75, 0, 80, 11, 240, 239,
+	209, 9, 104, 119, 119, 75, 0, 80, 11, 240, 104, 102, 102, 75, 0, 80,
+	11, 240, 104, 68, 68, 75, 0, 80, 11, 240, 72, 255, 96, 174, 7, 73,
+	255, 98, 119, 7, 74, 255, 100, 145, 6, 75, 255, 102, 22, 6, 80, 15,
+	240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5,
+	239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239,
+	100, 5, 72, 255, 96, 179, 7, 73, 255, 98, 126, 7, 106, 34, 34, 80,
+	15, 240, 104, 238, 238, 106, 17, 17, 80, 15, 240, 104, 204, 204, 106, 0,
+	0, 80, 15, 240, 104, 187, 187, 106, 0, 0, 80, 15, 240, 104, 170, 170,
+	106, 0, 0, 80, 15, 240, 239, 87, 10, 104, 153, 153, 106, 0, 0, 80,
+	15, 240, 104, 136, 136, 106, 0, 0, 80, 15, 240, 239, 108, 10, 104, 119,
+	119, 106, 0, 0, 80, 15, 240, 104, 102, 102, 106, 0, 0, 80, 15, 240,
+	104, 68, 68, 106, 0, 0, 80, 15, 240, 72, 255, 96, 183, 7, 73, 255,
+	98, 134, 7, 100, 145, 6, 75, 255, 102, 44, 4, 80, 11, 240, 104, 238,
+	238, 75, 238, 80, 11, 240, 104, 204, 204, 75, 204, 80, 11, 240, 104, 187,
+	187, 75, 187, 80, 11, 240, 104, 170, 170, 75, 170, 80, 11, 240, 239, 192,
+	10, 104, 153, 153, 75, 153, 80, 11, 240, 104, 136, 136, 75, 136, 80, 11,
+	240, 239, 211, 10, 104, 119, 119, 75, 119, 80, 11, 240, 104, 102, 102, 75,
+	102, 80, 11, 240, 104, 68, 68, 75, 68, 80, 11, 240, 239, 151, 9, 239,
+	166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9, 239, 201,
+	9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239, 236, 9,
+	72, 255, 96, 174, 7, 73, 255, 98, 119, 7, 74, 255, 100, 22, 6, 75,
+	255, 102, 186, 5, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5,
+	239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239,
+	82, 5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 183, 7, 73, 255, 98,
+	134, 7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78,
+	10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10,
+	239, 120, 10, 239, 129, 10, 239, 138, 10, 104, 34, 34, 100, 22, 6, 75,
+	255, 102, 44, 4, 80, 11, 240, 104, 17, 17, 75, 238, 80, 11, 240, 104,
+	0, 0, 75, 204, 80, 11, 240, 104, 0, 0, 75, 187, 80, 11, 240, 104,
+	0, 0, 75, 170, 80, 11, 240, 239, 169, 11, 104, 0, 0, 75, 153, 80,
+	11, 240, 104, 0, 0, 75, 136, 80, 11, 240, 239, 188, 11, 104, 0, 0,
+	75, 119, 80, 11, 240, 104, 0, 0, 75, 102, 80, 11, 240, 104, 0, 0,
+	75, 68, 80, 11, 240, 72, 255, 96, 159, 7, 73, 255, 98, 93, 7, 75,
+	34, 80, 11, 240, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9,
+	239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239,
+	228, 9, 239, 236, 9, 72, 255, 96, 174, 7, 73, 255, 98, 119, 7, 74,
+	255, 100, 22, 6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 22, 5, 239,
+	31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70,
+	5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 109, 5,
+	239, 118, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 72, 255, 96, 164, 7, 73, 255, 98, 221, 6, 100, 22, 6, 75, 255,
+	102, 68, 2, 80, 11, 240, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239,
+	192, 10, 239, 192, 10, 239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222,
+	10, 239, 230, 10, 239, 238, 10, 104, 34, 34, 75, 34, 80, 11, 240, 104,
+	17, 17, 75, 17, 80, 11, 240, 104, 0, 0, 75, 0, 80, 11, 240, 239,
+	177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177,
+	12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 104, 0, 0, 74, 255, 100,
+	145, 6, 75, 255, 102, 186, 5, 80, 15, 240, 104, 0, 0, 106, 238, 238,
+	80, 15, 240, 104, 0, 0, 106, 204, 204, 80, 15, 240, 104, 0, 0, 106,
+	187, 187, 80, 15, 240, 104, 0, 0, 106, 170, 170, 80, 15, 240, 239, 255,
+	12, 104, 0, 0, 106, 153, 153, 80, 15, 240, 104, 0, 0, 106, 136, 136,
+	80, 15, 240, 239, 20, 13, 104, 0, 0, 106, 119, 119, 80, 15, 240, 104,
+	0, 0, 106, 102, 102, 80, 15, 240, 104, 0, 0, 106, 68, 68, 80, 15,
+	240, 104, 0, 0, 106, 34, 34, 80, 15, 240, 104, 0, 0, 106, 17, 17,
+	80, 15, 240, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 104, 0, 0, 74, 255, 100, 145, 6, 75, 255, 102, 22, 6, 80, 15,
+	240, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239, 255, 12,
+	239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41, 13, 239,
+	50, 13, 239, 59, 13, 239, 68, 13, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 72, 255, 96, 93, 7, 98, 221, 6, 74, 255,
+	100, 123, 6, 75, 255, 102, 22, 6, 80, 13, 240, 72, 238, 106, 238, 238,
+	80, 13, 240, 72, 204, 106, 204, 204, 80, 13, 240, 72, 187, 106, 187, 187,
+	80, 13, 240, 72, 170, 106, 170, 170, 80, 13, 240, 239, 237, 13, 72, 153,
+	106, 153, 153, 80, 13, 240, 72, 136, 106, 136, 136, 80, 13, 240, 239, 0,
+	14, 72, 119, 106, 119, 119, 80, 13, 240, 72, 102, 106, 102, 102, 80, 13,
+	240, 72, 68, 106, 68, 68, 80, 13, 240, 72, 255, 96, 102, 7, 106, 34,
+	34, 80, 13, 240, 72, 238, 106, 17, 17, 80, 13, 240, 72, 204, 106, 0,
+	0, 80, 13, 240, 72, 187, 106, 0, 0, 80, 13, 240, 72, 170, 106, 0,
+	0, 80, 13, 240, 239, 70, 14, 72, 153, 106, 0, 0, 80, 13, 240, 72,
+	136, 106, 0, 0, 80, 13, 240, 239, 89, 14, 72, 119, 106, 0, 0, 80,
+	13, 240, 72, 102, 106, 0, 0, 80, 13, 240, 72, 68, 106, 0, 0, 80,
+	13, 240, 72, 255, 96, 110, 7, 106, 0, 255, 102, 68, 2, 80, 13, 240,
+	72, 238, 106, 0, 238, 80, 13, 240, 72, 204, 106, 0, 204, 80, 13, 240,
+	72, 187, 106, 0, 187, 80, 13, 240, 72, 170, 106, 0, 170, 80, 13, 240,
+	239, 162, 14, 72, 153, 106, 0, 153, 80, 13, 240, 72, 136, 106, 0, 136,
+	80, 13, 240, 239, 181, 14, 72, 119, 106, 0, 119, 80, 13, 240, 72, 102,
+	106, 0, 102, 80, 13, 240, 72, 68, 106, 0, 68, 80, 13, 240, 72, 255,
+	96, 164, 7, 106, 0, 34, 80, 13, 240, 72, 238, 106, 0, 17, 80, 13,
+	240, 239, 54, 14, 239, 62, 14, 239, 70, 14, 239, 70, 14, 239, 81, 14,
+	239, 89, 14, 239, 89, 14, 239, 100, 14, 239, 108, 14, 239, 116, 14, 104,
+	34, 255, 98, 145, 6, 74, 255, 100, 22, 6, 75, 255, 102, 221, 6, 80,
+	15, 240, 239, 202, 6, 239, 211, 6, 239, 220, 6, 239, 229, 6, 239, 229,
+	6, 239, 241, 6, 239, 250, 6, 239, 250, 6, 239, 6, 7, 239, 15, 7,
+	239, 24, 7, 239, 33, 7, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239,
+	73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106,
+	7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 164, 7, 105, 0, 0, 75,
+	255, 102, 44, 4, 80, 15, 240, 104, 238, 0, 106, 0, 238, 80, 15, 240,
+	104, 204, 0, 106, 0, 204, 80, 15, 240, 104, 187, 0, 106, 0, 187, 80,
+	15, 240, 104, 170, 0, 106, 0, 170, 80, 15, 240, 239, 140, 15, 104, 153,
+	0, 106, 0, 153, 80, 15, 240, 104, 136, 0, 106, 0, 136, 80, 15, 240,
+	239, 161, 15, 104, 119, 0, 106, 0, 119, 80, 15, 240, 104, 102, 0, 106,
+	0, 102, 80, 15, 240, 104, 68, 0, 106, 0, 68, 80, 15, 240, 104, 34,
+	0, 106, 0, 34, 80, 15, 240, 104, 17, 0, 106, 0, 17, 80, 15, 240,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 233,
+	7, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5,
+	239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239,
+	100, 5, 239, 33, 8, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73,
+	7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7,
+	239, 115, 7, 239, 124, 7, 104, 34, 0, 106, 0, 255, 102, 180, 3, 80,
+	15, 240, 104, 17, 0, 106, 0, 238, 80, 15, 240, 104, 0, 0, 106, 0,
+	204, 80, 15, 240, 104, 0, 0, 106, 0, 187, 80, 15, 240, 104, 0, 0,
+	106, 0, 170, 80, 15, 240, 239, 103, 16, 104, 0, 0, 106, 0, 153, 80,
+	15, 240, 104, 0, 0, 106, 0, 136, 80, 15, 240, 239, 124, 16, 104, 0,
+	0, 106, 0, 119, 80, 15, 240, 104, 0, 0, 106, 0, 102, 80, 15, 240,
+	104, 0, 0, 106, 0, 68, 80, 15, 240, 104, 0, 0, 106, 0, 34, 80,
+	15, 240, 104, 0, 0, 106, 0, 17, 80, 15, 240, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 208, 8, 239, 225, 8, 239,
+	233, 8, 239, 241, 8, 239, 249, 8, 239, 249, 8, 239, 4, 9, 239, 12,
+	9, 239, 12, 9, 239, 23, 9, 239, 31, 9, 239, 39, 9, 239, 47, 9,
+	239, 55, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239,
+	63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63,
+	9, 72, 0, 98, 145, 6, 74, 255, 100, 186, 5, 75, 255, 102, 115, 3,
+	80, 13, 240, 72, 0, 106, 238, 238, 80, 13, 240, 72, 0, 106, 204, 204,
+	80, 13, 240, 72, 0, 106, 187, 187, 80, 13, 240, 72, 0, 106, 170, 170,
+	80, 13, 240, 239, 69, 17, 72, 0, 106, 153, 153, 80, 13, 240, 72, 0,
+	106, 136, 136, 80, 13, 240, 239, 88, 17, 72, 0, 106, 119, 119, 80, 13,
+	240, 72, 0, 106, 102, 102, 80, 13, 240, 72, 0, 106, 68, 68, 80, 13,
+	240, 72, 0, 106, 34, 34, 80, 13, 240, 72, 0, 106, 17, 17, 80, 13,
+	240, 72, 0, 106, 0, 0, 80, 13, 240, 239, 139, 17, 239, 139, 17, 239,
+	139, 17, 239, 139, 17, 239, 139, 17, 239, 139, 17, 239, 139, 17, 239, 139,
+	17, 239, 139, 17, 72, 255, 96, 147, 7, 73, 255, 98, 38, 7, 74, 255,
+	100, 151, 5, 75, 255, 102, 46, 3, 80, 15, 240, 239, 22, 5, 239, 31,
+	5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5,
+	239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 134,
+	7, 73, 255, 98, 11, 7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239,
+	69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108,
+	10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96,
+	126, 7, 73, 255, 98, 253, 6, 74, 255, 100, 114, 5, 75, 255, 102, 228,
+	2, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5,
+	239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239,
+	91, 5, 239, 100, 5, 72, 255, 96, 147, 7, 73, 255, 98, 38, 7, 106,
+	34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78, 10, 239, 87,
+	10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10, 239, 120, 10,
+	239, 129, 10, 239, 138, 10, 72, 255, 96, 164, 7, 73, 255, 98, 73, 7,
+	74, 255, 100, 249, 5, 75, 255, 102, 114, 5, 80, 15, 240, 239, 22, 5,
+	239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239,
+	70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72, 255,
+	96, 183, 7, 73, 255, 98, 110, 7, 106, 34, 34, 80, 15, 240, 239, 60,
+	10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10,
+	239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 104,
+	34, 34, 100, 249, 5, 75, 255, 102, 114, 5, 80, 11, 240, 239, 145, 11,
+	239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11, 239,
+	188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 72, 255,
+	96, 174, 7, 73, 255, 98, 93, 7, 75, 34, 80, 11, 240, 239, 166, 9,
+	239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9, 239, 201, 9, 239,
+	209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239, 236, 9, 72, 255,
+	96, 164, 7, 73, 255, 98, 73, 7, 74, 255, 100, 76, 6, 75, 255, 102,
+	218, 5, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49,
+	5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5,
+	239, 91, 5, 239, 100, 5, 239, 79, 18, 239, 60, 10, 239, 69, 10, 239,
+	78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108,
+	10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96, 174, 7, 73,
+	255, 98, 93, 7, 74, 255, 100, 123, 6, 75, 255, 102, 22, 6, 80, 15,
+	240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5,
+	239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239,
+	100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 104, 0, 0, 74, 255, 100, 22, 6, 75, 255,
+	102, 44, 4, 80, 15, 240, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239,
+	255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32,
+	13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 104, 0, 0, 74, 255,
+	100, 76, 6, 75, 255, 102, 151, 4, 80, 15, 240, 239, 228, 12, 239, 237,
+	12, 239, 246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13,
+	239, 20, 13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239,
+	68, 13, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	72, 255, 96, 93, 7, 105, 0, 255, 100, 123, 6, 75, 255, 102, 246, 4,
+	80, 15, 240, 104, 238, 0, 106, 238, 238, 80, 15, 240, 104, 204, 0, 106,
+	204, 204, 80, 15, 240, 104, 187, 0, 106, 187, 187, 80, 15, 240, 104, 170,
+	0, 106, 170, 170, 80, 15, 240, 239, 216, 20, 104, 153, 0, 106, 153, 153,
+	80, 15, 240, 104, 136, 0, 106, 136, 136, 80, 15, 240, 239, 237, 20, 104,
+	119, 0, 106, 119, 119, 80, 15, 240, 104, 102, 0, 106, 102, 102, 80, 15,
+	240, 104, 68, 0, 106, 68, 68, 80, 15, 240, 72, 255, 96, 102, 7, 105,
+	0, 34, 75, 34, 80, 15, 240, 104, 238, 0, 106, 17, 17, 80, 15, 240,
+	239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239,
+	94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255,
+	96, 110, 7, 98, 93, 7, 100, 123, 6, 75, 255, 102, 34, 5, 80, 9,
+	240, 239, 35, 6, 239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6,
+	239, 66, 6, 239, 73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239,
+	97, 6, 239, 104, 6, 239, 114, 6, 239, 121, 6, 239, 128, 6, 239, 135,
+	6, 239, 135, 6, 239, 145, 6, 239, 152, 6, 239, 152, 6, 239, 162, 6,
+	239, 169, 6, 239, 176, 6, 239, 183, 6, 239, 202, 6, 239, 211, 6, 239,
+	220, 6, 239, 229, 6, 239, 229, 6, 239, 241, 6, 239, 250, 6, 239, 250,
+	6, 239, 6, 7, 239, 15, 7, 239, 24, 7, 239, 33, 7, 239, 46, 7,
+	239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239,
+	94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 239, 133,
+	7, 239, 35, 6, 239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6,
+	239, 66, 6, 239, 73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239,
+	97, 6, 239, 185, 7, 239, 192, 7, 239, 199, 7, 239, 199, 7, 239, 199,
+	7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7,
+	239, 199, 7, 239, 199, 7, 239, 233, 7, 239, 22, 5, 239, 31, 5, 239,
+	40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70,
+	5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 33, 8, 239, 46, 7,
+	239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239,
+	94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 239, 79,
+	8, 239, 95, 8, 239, 102, 8, 239, 109, 8, 239, 116, 8, 239, 116, 8,
+	239, 126, 8, 239, 133, 8, 239, 133, 8, 239, 143, 8, 239, 150, 8, 239,
+	157, 8, 239, 164, 8, 239, 171, 8, 239, 199, 7, 239, 199, 7, 239, 199,
+	7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7,
+	239, 199, 7, 239, 199, 7, 239, 208, 8, 239, 225, 8, 239, 233, 8, 239,
+	241, 8, 239, 249, 8, 239, 249, 8, 239, 4, 9, 239, 12, 9, 239, 12,
+	9, 239, 23, 9, 239, 31, 9, 239, 39, 9, 239, 47, 9, 239, 55, 9,
+	239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239,
+	63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 63, 9, 239, 98,
+	9, 239, 114, 9, 239, 102, 8, 239, 109, 8, 239, 116, 8, 239, 116, 8,
+	239, 126, 8, 239, 133, 8, 239, 133, 8, 239, 143, 8, 239, 150, 8, 239,
+	157, 8, 239, 151, 9, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190,
+	9, 239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9,
+	239, 228, 9, 239, 236, 9, 239, 244, 9, 239, 22, 5, 239, 31, 5, 239,
+	40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70,
+	5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 44, 10, 239, 60, 10,
+	239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239,
+	108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239, 147,
+	10, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10,
+	239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239,
+	238, 10, 239, 151, 9, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190,
+	9, 239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9,
+	239, 228, 9, 239, 236, 9, 239, 26, 11, 239, 22, 5, 239, 31, 5, 239,
+	40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70,
+	5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 82, 11, 239, 60, 10,
+	239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239,
+	108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239, 131,
+	11, 239, 145, 11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11,
+	239, 180, 11, 239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239,
+	215, 11, 239, 223, 11, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190,
+	9, 239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9,
+	239, 228, 9, 239, 236, 9, 239, 15, 12, 239, 22, 5, 239, 31, 5, 239,
+	40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70,
+	5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 109, 5, 239, 118, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 107,
+	12, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10,
+	239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239,
+	238, 10, 239, 161, 12, 239, 169, 12, 239, 177, 12, 239, 177, 12, 239, 177,
+	12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12,
+	239, 177, 12, 239, 177, 12, 239, 212, 12, 239, 228, 12, 239, 237, 12, 239,
+	246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20,
+	13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 107,
+	13, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239, 255, 12,
+	239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41, 13, 239,
+	50, 13, 239, 59, 13, 239, 68, 13, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 192, 13, 239, 213, 13, 239, 221, 13, 239,
+	229, 13, 239, 237, 13, 239, 237, 13, 239, 248, 13, 239, 0, 14, 239, 0,
+	14, 239, 11, 14, 239, 19, 14, 239, 27, 14, 239, 35, 14, 239, 46, 14,
+	239, 54, 14, 239, 62, 14, 239, 70, 14, 239, 70, 14, 239, 81, 14, 239,
+	89, 14, 239, 89, 14, 239, 100, 14, 239, 108, 14, 239, 116, 14, 72, 255,
+	96, 183, 7, 73, 255, 98, 110, 7, 100, 123, 6, 75, 255, 102, 34, 5,
+	80, 11, 240, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239,
+	192, 10, 239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230,
+	10, 239, 238, 10, 72, 255, 96, 164, 7, 73, 255, 98, 73, 7, 75, 34,
+	80, 11, 240, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239,
+	190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228,
+	9, 239, 236, 9, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7, 74, 255,
+	100, 186, 5, 75, 255, 102, 34, 5, 80, 15, 240, 239, 22, 5, 239, 31,
+	5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5,
+	239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 184, 18, 239,
+	60, 10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99,
+	10, 239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10,
+	104, 34, 34, 100, 186, 5, 75, 255, 102, 200, 4, 80, 11, 240, 239, 145,
+	11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11,
+	239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 239,
+	14, 26, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190,
+	9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9,
+	239, 236, 9, 239, 62, 26, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 164, 7, 73, 255, 98, 73,
+	7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78, 10,
+	239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10, 239,
+	120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96, 183, 7, 73, 255, 98,
+	110, 7, 100, 186, 5, 75, 255, 102, 151, 4, 80, 11, 240, 239, 168, 10,
+	239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10, 239, 203, 10, 239,
+	211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239, 238, 10, 239, 14,
+	26, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9,
+	239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239,
+	236, 9, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7, 74, 255, 100, 218,
+	5, 75, 255, 102, 151, 4, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239,
+	40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70,
+	5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 184, 18, 239, 60, 10,
+	239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239,
+	108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 104, 34,
+	34, 100, 218, 5, 75, 255, 102, 99, 4, 80, 11, 240, 239, 145, 11, 239,
+	153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11, 239, 188,
+	11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 239, 14, 26,
+	239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9, 239,
+	201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239, 236,
+	9, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7, 74, 255, 100, 218, 5,
+	75, 255, 102, 99, 4, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40,
+	5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5,
+	239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 17, 27, 239, 60, 10, 239,
+	69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108,
+	10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96,
+	183, 7, 73, 255, 98, 110, 7, 100, 218, 5, 75, 255, 102, 44, 4, 80,
+	11, 240, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192,
+	10, 239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10,
+	239, 238, 10, 239, 14, 26, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239,
+	190, 9, 239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220,
+	9, 239, 228, 9, 239, 236, 9, 239, 62, 26, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 184, 18, 239, 60,
+	10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10,
+	239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 104,
+	34, 34, 100, 186, 5, 75, 255, 102, 44, 4, 80, 11, 240, 239, 145, 11,
+	239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11, 239,
+	188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 239, 14,
+	26, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9,
+	239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239,
+	236, 9, 239, 164, 19, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49,
+	5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5,
+	239, 91, 5, 239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 164, 7, 73,
+	255, 98, 73, 7, 74, 255, 100, 186, 5, 75, 255, 102, 34, 5, 80, 15,
+	240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5,
+	239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239,
+	100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 0, 20, 239, 228, 12, 239, 237, 12, 239,
+	246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20,
+	13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 85,
+	20, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239, 255, 12,
+	239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41, 13, 239,
+	50, 13, 239, 59, 13, 239, 68, 13, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 104, 0, 0, 74, 255, 100, 123, 6, 75, 255,
+	102, 246, 4, 80, 15, 240, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239,
+	255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32,
+	13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 195, 7,
+	73, 255, 98, 183, 7, 74, 255, 100, 34, 5, 75, 255, 102, 68, 2, 80,
+	15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49,
+	5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5,
+	239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 201, 7, 73, 255, 98, 183,
+	7, 74, 255, 100, 110, 7, 75, 255, 102, 73, 7, 80, 15, 240, 239, 22,
+	5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5,
+	239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72,
+	255, 96, 195, 7, 73, 255, 98, 183, 7, 106, 34, 34, 80, 15, 240, 239,
+	60, 10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99,
+	10, 239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10,
+	104, 34, 34, 100, 110, 7, 75, 255, 102, 44, 4, 80, 11, 240, 239, 145,
+	11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11,
+	239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 72,
+	255, 96, 183, 7, 73, 255, 98, 164, 7, 75, 34, 80, 11, 240, 239, 166,
+	9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9, 239, 201, 9,
+	239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239, 236, 9, 72,
+	255, 96, 187, 7, 73, 255, 98, 174, 7, 74, 255, 100, 110, 7, 75, 255,
+	102, 73, 7, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 191, 7, 73, 255, 98, 174,
+	7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78, 10,
+	239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10, 239,
+	120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96, 195, 7, 73, 255, 98,
+	183, 7, 100, 110, 7, 75, 255, 102, 34, 5, 80, 11, 240, 239, 168, 10,
+	239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10, 239, 203, 10, 239,
+	211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239, 238, 10, 239, 161,
+	12, 239, 169, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12,
+	239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239,
+	177, 12, 239, 129, 31, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49,
+	5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5,
+	239, 91, 5, 239, 100, 5, 239, 185, 31, 239, 60, 10, 239, 69, 10, 239,
+	78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108,
+	10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 72, 34, 98, 183, 7, 100,
+	110, 7, 75, 255, 102, 44, 4, 80, 9, 240, 239, 95, 8, 239, 102, 8,
+	239, 109, 8, 239, 116, 8, 239, 116, 8, 239, 126, 8, 239, 133, 8, 239,
+	133, 8, 239, 143, 8, 239, 150, 8, 239, 157, 8, 72, 255, 96, 183, 7,
+	75, 34, 80, 9, 240, 239, 114, 6, 239, 121, 6, 239, 128, 6, 239, 135,
+	6, 239, 135, 6, 239, 145, 6, 239, 152, 6, 239, 152, 6, 239, 162, 6,
+	239, 169, 6, 239, 176, 6, 72, 255, 96, 164, 7, 73, 255, 98, 110, 7,
+	74, 255, 100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240, 239, 22, 5,
+	239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239,
+	70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72, 255,
+	96, 134, 7, 105, 34, 34, 75, 34, 80, 15, 240, 239, 46, 7, 239, 55,
+	7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7,
+	239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 147,
+	7, 98, 110, 7, 100, 73, 7, 75, 255, 102, 180, 3, 80, 9, 240, 239,
+	35, 6, 239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6, 239, 66,
+	6, 239, 73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239, 97, 6,
+	72, 255, 96, 159, 7, 75, 34, 80, 9, 240, 239, 114, 6, 239, 121, 6,
+	239, 128, 6, 239, 135, 6, 239, 135, 6, 239, 145, 6, 239, 152, 6, 239,
+	152, 6, 239, 162, 6, 239, 169, 6, 239, 176, 6, 72, 255, 96, 164, 7,
+	73, 255, 98, 119, 7, 74, 255, 100, 73, 7, 75, 255, 102, 38, 7, 80,
+	15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49,
+	5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5,
+	239, 100, 5, 72, 255, 96, 174, 7, 105, 34, 34, 75, 34, 80, 15, 240,
+	239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239,
+	85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124,
+	7, 72, 255, 96, 183, 7, 98, 119, 7, 100, 73, 7, 75, 255, 102, 218,
+	5, 80, 9, 240, 239, 35, 6, 239, 42, 6, 239, 49, 6, 239, 56, 6,
+	239, 56, 6, 239, 66, 6, 239, 73, 6, 239, 73, 6, 239, 83, 6, 239,
+	90, 6, 239, 97, 6, 72, 255, 96, 174, 7, 75, 34, 80, 9, 240, 239,
+	114, 6, 239, 121, 6, 239, 128, 6, 239, 135, 6, 239, 135, 6, 239, 145,
+	6, 239, 152, 6, 239, 152, 6, 239, 162, 6, 239, 169, 6, 239, 176, 6,
+	72, 255, 96, 164, 7, 73, 255, 98, 119, 7, 74, 255, 100, 73, 7, 75,
+	255, 102, 25, 7, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5,
+	239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239,
+	82, 5, 239, 91, 5, 239, 100, 5, 239, 173, 34, 239, 46, 7, 239, 55,
+	7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7,
+	239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 134,
+	7, 98, 119, 7, 100, 73, 7, 75, 255, 102, 186, 5, 80, 9, 240, 239,
+	35, 6, 239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6, 239, 66,
+	6, 239, 73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239, 97, 6,
+	239, 133, 33, 239, 114, 6, 239, 121, 6, 239, 128, 6, 239, 135, 6, 239,
+	135, 6, 239, 145, 6, 239, 152, 6, 239, 152, 6, 239, 162, 6, 239, 169,
+	6, 239, 176, 6, 72, 255, 96, 187, 7, 73, 255, 98, 110, 7, 74, 255,
+	100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240, 239, 22, 5, 239, 31,
+	5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5,
+	239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 195,
+	7, 105, 34, 34, 75, 34, 80, 15, 240, 239, 46, 7, 239, 55, 7, 239,
+	64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94,
+	7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 201, 7, 98,
+	110, 7, 100, 73, 7, 75, 255, 102, 44, 4, 80, 9, 240, 239, 35, 6,
+	239, 42, 6, 239, 49, 6, 239, 56, 6, 239, 56, 6, 239, 66, 6, 239,
+	73, 6, 239, 73, 6, 239, 83, 6, 239, 90, 6, 239, 97, 6, 72, 255,
+	96, 195, 7, 75, 34, 80, 9, 240, 239, 114, 6, 239, 121, 6, 239, 128,
+	6, 239, 135, 6, 239, 135, 6, 239, 145, 6, 239, 152, 6, 239, 152, 6,
+	239, 162, 6, 239, 169, 6, 239, 176, 6, 72, 255, 96, 183, 7, 73, 255,
+	98, 110, 7, 74, 255, 100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240,
+	239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239,
+	61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100,
+	5, 72, 255, 96, 187, 7, 105, 34, 34, 75, 34, 80, 15, 240, 239, 46,
+	7, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7,
+	239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 239,
+	37, 31, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49,
+	5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5,
+	239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 129, 31, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 185, 31, 239, 60,
+	10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10,
+	239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239,
+	234, 31, 239, 145, 11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169,
+	11, 239, 180, 11, 239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11,
+	239, 215, 11, 239, 25, 32, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239,
+	190, 9, 239, 190, 9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220,
+	9, 239, 228, 9, 239, 236, 9, 239, 73, 32, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 129, 32, 239, 60,
+	10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10,
+	239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239,
+	178, 32, 239, 168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192,
+	10, 239, 203, 10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10,
+	239, 238, 10, 239, 161, 12, 239, 169, 12, 239, 177, 12, 239, 177, 12, 239,
+	177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177,
+	12, 239, 177, 12, 239, 177, 12, 239, 129, 31, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 185, 31, 239, 60,
+	10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10,
+	239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 72,
+	34, 98, 183, 7, 100, 110, 7, 75, 255, 102, 186, 5, 80, 9, 240, 239,
+	95, 8, 239, 102, 8, 239, 109, 8, 239, 116, 8, 239, 116, 8, 239, 126,
+	8, 239, 133, 8, 239, 133, 8, 239, 143, 8, 239, 150, 8, 239, 157, 8,
+	239, 136, 36, 239, 114, 6, 239, 121, 6, 239, 128, 6, 239, 135, 6, 239,
+	135, 6, 239, 145, 6, 239, 152, 6, 239, 152, 6, 239, 162, 6, 239, 169,
+	6, 239, 176, 6, 72, 255, 96, 201, 7, 73, 255, 98, 110, 7, 74, 255,
+	100, 73, 7, 75, 255, 102, 151, 5, 80, 15, 240, 239, 22, 5, 239, 31,
+	5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5,
+	239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 205,
+	7, 105, 34, 34, 75, 34, 80, 15, 240, 239, 46, 7, 239, 55, 7, 239,
+	64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94,
+	7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 207, 7, 73,
+	255, 98, 195, 7, 100, 73, 7, 75, 255, 102, 114, 5, 80, 11, 240, 239,
+	168, 10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10, 239, 203,
+	10, 239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239, 238, 10,
+	72, 255, 96, 207, 7, 73, 255, 98, 195, 7, 75, 34, 80, 11, 240, 239,
+	166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190, 9, 239, 201,
+	9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9, 239, 236, 9,
+	104, 34, 34, 74, 255, 100, 62, 7, 75, 255, 102, 11, 7, 80, 15, 240,
+	104, 17, 17, 106, 238, 238, 80, 15, 240, 239, 237, 12, 239, 246, 12, 239,
+	255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32,
+	13, 239, 41, 13, 239, 50, 13, 72, 255, 96, 207, 7, 73, 255, 98, 191,
+	7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78, 10,
+	239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10, 239,
+	120, 10, 239, 129, 10, 239, 138, 10, 104, 34, 34, 100, 62, 7, 75, 255,
+	102, 114, 5, 80, 11, 240, 239, 145, 11, 239, 153, 11, 239, 161, 11, 239,
+	169, 11, 239, 169, 11, 239, 180, 11, 239, 188, 11, 239, 188, 11, 239, 199,
+	11, 239, 207, 11, 239, 215, 11, 72, 255, 96, 201, 7, 73, 0, 75, 34,
+	80, 11, 240, 104, 238, 0, 75, 17, 80, 11, 240, 104, 204, 0, 75, 0,
+	80, 11, 240, 104, 187, 0, 75, 0, 80, 11, 240, 104, 170, 0, 75, 0,
+	80, 11, 240, 239, 165, 40, 104, 153, 0, 75, 0, 80, 11, 240, 104, 136,
+	0, 75, 0, 80, 11, 240, 239, 184, 40, 104, 119, 0, 75, 0, 80, 11,
+	240, 104, 102, 0, 75, 0, 80, 11, 240, 104, 68, 0, 75, 0, 80, 11,
+	240, 72, 255, 96, 187, 7, 73, 255, 98, 164, 7, 74, 255, 100, 73, 7,
+	75, 255, 102, 76, 6, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40,
+	5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5,
+	239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 173, 34, 239, 46, 7, 239,
+	55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94,
+	7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96,
+	195, 7, 73, 255, 98, 159, 7, 74, 255, 100, 62, 7, 75, 255, 102, 22,
+	6, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5,
+	239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239,
+	91, 5, 239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 104, 0, 0, 74, 255, 100, 237,
+	6, 75, 255, 102, 218, 5, 80, 15, 240, 239, 228, 12, 239, 237, 12, 239,
+	246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20,
+	13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 104, 0,
+	0, 74, 255, 100, 221, 6, 75, 255, 102, 186, 5, 80, 15, 240, 239, 228,
+	12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13,
+	239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 72,
+	255, 96, 183, 7, 73, 255, 98, 164, 7, 106, 34, 34, 80, 15, 240, 239,
+	60, 10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99,
+	10, 239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10,
+	72, 255, 96, 187, 7, 73, 255, 98, 174, 7, 74, 255, 100, 185, 6, 75,
+	255, 102, 114, 5, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5,
+	239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239,
+	82, 5, 239, 91, 5, 239, 100, 5, 72, 255, 96, 191, 7, 73, 255, 98,
+	179, 7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78,
+	10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10,
+	239, 120, 10, 239, 129, 10, 239, 138, 10, 72, 255, 96, 195, 7, 73, 255,
+	98, 183, 7, 100, 185, 6, 75, 255, 102, 68, 2, 80, 11, 240, 239, 168,
+	10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10, 239, 203, 10,
+	239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239, 238, 10, 239,
+	161, 12, 239, 169, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177,
+	12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12,
+	239, 177, 12, 239, 129, 31, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 239, 185, 31, 239, 60, 10, 239, 69, 10,
+	239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239,
+	108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239, 234, 31, 239, 145,
+	11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11,
+	239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 239,
+	25, 32, 239, 166, 9, 239, 174, 9, 239, 182, 9, 239, 190, 9, 239, 190,
+	9, 239, 201, 9, 239, 209, 9, 239, 209, 9, 239, 220, 9, 239, 228, 9,
+	239, 236, 9, 239, 73, 32, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 239, 130, 42, 239, 60, 10, 239, 69, 10,
+	239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239,
+	108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239, 178, 32, 239, 168,
+	10, 239, 176, 10, 239, 184, 10, 239, 192, 10, 239, 192, 10, 239, 203, 10,
+	239, 211, 10, 239, 211, 10, 239, 222, 10, 239, 230, 10, 239, 238, 10, 239,
+	161, 12, 239, 169, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177,
+	12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12, 239, 177, 12,
+	239, 177, 12, 239, 129, 31, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 239, 185, 31, 239, 60, 10, 239, 69, 10,
+	239, 78, 10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239,
+	108, 10, 239, 120, 10, 239, 129, 10, 239, 138, 10, 239, 234, 31, 239, 145,
+	11, 239, 153, 11, 239, 161, 11, 239, 169, 11, 239, 169, 11, 239, 180, 11,
+	239, 188, 11, 239, 188, 11, 239, 199, 11, 239, 207, 11, 239, 215, 11, 72,
+	255, 96, 183, 7, 98, 183, 7, 75, 34, 80, 9, 240, 239, 114, 6, 239,
+	121, 6, 239, 128, 6, 239, 135, 6, 239, 135, 6, 239, 145, 6, 239, 152,
+	6, 239, 152, 6, 239, 162, 6, 239, 169, 6, 239, 176, 6, 239, 176, 33,
+	239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239,
+	61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100,
+	5, 239, 232, 33, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7,
+	239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239,
+	115, 7, 239, 124, 7, 239, 22, 34, 239, 35, 6, 239, 42, 6, 239, 49,
+	6, 239, 56, 6, 239, 56, 6, 239, 66, 6, 239, 73, 6, 239, 73, 6,
+	239, 83, 6, 239, 90, 6, 239, 97, 6, 239, 74, 34, 239, 114, 6, 239,
+	121, 6, 239, 128, 6, 239, 135, 6, 239, 135, 6, 239, 145, 6, 239, 152,
+	6, 239, 152, 6, 239, 162, 6, 239, 169, 6, 239, 176, 6, 239, 117, 34,
+	239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239,
+	61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100,
+	5, 239, 173, 34, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7,
+	239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239,
+	115, 7, 239, 124, 7, 239, 219, 34, 239, 35, 6, 239, 42, 6, 239, 49,
+	6, 239, 56, 6, 239, 56, 6, 239, 66, 6, 239, 73, 6, 239, 73, 6,
+	239, 83, 6, 239, 90, 6, 239, 97, 6, 239, 15, 35, 239, 114, 6, 239,
+	121, 6, 239, 128, 6, 239, 135, 6, 239, 135, 6, 239, 145, 6, 239, 152,
+	6, 239, 152, 6, 239, 162, 6, 239, 169, 6, 239, 176, 6, 239, 58, 35,
+	239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239,
+	61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100,
+	5, 239, 173, 34, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7,
+	239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239,
+	115, 7, 239, 124, 7, 72, 255, 96, 164, 7, 98, 119, 7, 100, 73, 7,
+	75, 255, 102, 186, 5, 80, 9, 240, 239, 35, 6, 239, 42, 6, 239, 49,
+	6, 239, 56, 6, 239, 56, 6, 239, 66, 6, 239, 73, 6, 239, 73, 6,
+	239, 83, 6, 239, 90, 6, 239, 97, 6, 239, 185, 7, 239, 192, 7, 239,
+	199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199,
+	7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 239, 199, 7, 104, 0, 255,
+	98, 110, 7, 74, 255, 100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240,
+	104, 0, 238, 106, 238, 238, 80, 15, 240, 239, 211, 6, 239, 220, 6, 239,
+	229, 6, 239, 229, 6, 239, 241, 6, 239, 250, 6, 239, 250, 6, 239, 6,
+	7, 239, 15, 7, 239, 24, 7, 104, 0, 34, 106, 34, 34, 80, 15, 240,
+	104, 0, 17, 106, 17, 17, 80, 15, 240, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 72, 0, 98, 110, 7, 100, 73, 7, 75,
+	255, 102, 34, 5, 80, 9, 240, 239, 114, 9, 239, 102, 8, 239, 109, 8,
+	239, 116, 8, 239, 116, 8, 239, 126, 8, 239, 133, 8, 239, 133, 8, 239,
+	143, 8, 239, 150, 8, 239, 157, 8, 72, 255, 96, 134, 7, 75, 34, 80,
+	9, 240, 239, 114, 6, 239, 121, 6, 239, 128, 6, 239, 135, 6, 239, 135,
+	6, 239, 145, 6, 239, 152, 6, 239, 152, 6, 239, 162, 6, 239, 169, 6,
+	239, 176, 6, 72, 255, 96, 126, 7, 73, 255, 98, 110, 7, 74, 255, 100,
+	73, 7, 75, 255, 102, 50, 7, 80, 15, 240, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 232, 33, 239, 46,
+	7, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7,
+	239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 72,
+	255, 96, 164, 7, 73, 255, 98, 73, 7, 74, 255, 100, 38, 7, 75, 255,
+	102, 237, 6, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 147, 7,
+	73, 255, 98, 73, 7, 74, 255, 100, 38, 7, 75, 255, 102, 237, 6, 80,
+	15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49,
+	5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5,
+	239, 100, 5, 239, 33, 8, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239,
+	73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106,
+	7, 239, 115, 7, 239, 124, 7, 104, 34, 255, 98, 73, 7, 74, 255, 100,
+	38, 7, 75, 255, 102, 253, 6, 80, 15, 240, 239, 202, 6, 239, 211, 6,
+	239, 220, 6, 239, 229, 6, 239, 229, 6, 239, 241, 6, 239, 250, 6, 239,
+	250, 6, 239, 6, 7, 239, 15, 7, 239, 24, 7, 72, 255, 96, 147, 7,
+	105, 34, 34, 75, 34, 80, 15, 240, 239, 46, 7, 239, 55, 7, 239, 64,
+	7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7,
+	239, 106, 7, 239, 115, 7, 239, 124, 7, 72, 255, 96, 164, 7, 73, 255,
+	98, 73, 7, 74, 255, 100, 38, 7, 75, 255, 102, 253, 6, 80, 15, 240,
+	239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239,
+	61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100,
+	5, 239, 149, 48, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7,
+	239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239,
+	115, 7, 239, 124, 7, 72, 255, 96, 134, 7, 73, 255, 98, 110, 7, 74,
+	255, 100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240, 239, 22, 5, 239,
+	31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70,
+	5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 33, 8,
+	239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7, 239,
+	85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239, 124,
+	7, 239, 179, 36, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5,
+	239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239,
+	91, 5, 239, 100, 5, 239, 38, 36, 239, 46, 7, 239, 55, 7, 239, 64,
+	7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7,
+	239, 106, 7, 239, 115, 7, 239, 124, 7, 104, 34, 255, 98, 110, 7, 74,
+	255, 100, 73, 7, 75, 255, 102, 11, 7, 80, 15, 240, 239, 202, 6, 239,
+	211, 6, 239, 220, 6, 239, 229, 6, 239, 229, 6, 239, 241, 6, 239, 250,
+	6, 239, 250, 6, 239, 6, 7, 239, 15, 7, 239, 24, 7, 72, 255, 96,
+	183, 7, 105, 34, 34, 75, 34, 80, 15, 240, 239, 46, 7, 239, 55, 7,
+	239, 64, 7, 239, 73, 7, 239, 73, 7, 239, 85, 7, 239, 94, 7, 239,
+	94, 7, 239, 106, 7, 239, 115, 7, 239, 124, 7, 239, 176, 33, 239, 22,
+	5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5,
+	239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239,
+	232, 33, 239, 46, 7, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73,
+	7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7,
+	239, 124, 7, 72, 255, 96, 147, 7, 73, 255, 98, 126, 7, 74, 255, 100,
+	73, 7, 75, 255, 102, 185, 6, 80, 15, 240, 239, 22, 5, 239, 31, 5,
+	239, 40, 5, 239, 49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239,
+	70, 5, 239, 82, 5, 239, 91, 5, 239, 100, 5, 239, 109, 5, 239, 118,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 72,
+	255, 96, 164, 7, 73, 255, 98, 126, 7, 74, 255, 100, 38, 7, 75, 255,
+	102, 185, 6, 80, 15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239,
+	49, 5, 239, 49, 5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82,
+	5, 239, 91, 5, 239, 100, 5, 239, 109, 5, 239, 118, 5, 239, 127, 5,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 72, 255, 96, 183, 7,
+	73, 255, 98, 119, 7, 74, 255, 100, 62, 7, 75, 255, 102, 11, 7, 80,
+	15, 240, 239, 22, 5, 239, 31, 5, 239, 40, 5, 239, 49, 5, 239, 49,
+	5, 239, 61, 5, 239, 70, 5, 239, 70, 5, 239, 82, 5, 239, 91, 5,
+	239, 100, 5, 72, 255, 96, 174, 7, 73, 255, 98, 119, 7, 106, 34, 34,
+	80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78, 10, 239, 87, 10, 239,
+	87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10, 239, 120, 10, 239, 129,
+	10, 239, 138, 10, 239, 234, 39, 239, 250, 39, 239, 237, 12, 239, 246, 12,
+	239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20, 13, 239,
+	32, 13, 239, 41, 13, 239, 50, 13, 72, 255, 96, 164, 7, 73, 255, 98,
+	110, 7, 106, 34, 34, 80, 15, 240, 239, 60, 10, 239, 69, 10, 239, 78,
+	10, 239, 87, 10, 239, 87, 10, 239, 99, 10, 239, 108, 10, 239, 108, 10,
+	239, 120, 10, 239, 129, 10, 239, 138, 10, 104, 34, 34, 74, 255, 100, 73,
+	7, 75, 255, 102, 145, 6, 80, 15, 240, 239, 250, 39, 239, 237, 12, 239,
+	246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13, 239, 20, 13, 239, 20,
+	13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239, 59, 13, 239, 68, 13,
+	239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239,
+	127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 104, 0,
+	0, 74, 255, 100, 11, 7, 75, 255, 102, 22, 6, 80, 15, 240, 239, 228,
+	12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239, 255, 12, 239, 11, 13,
+	239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41, 13, 239, 50, 13, 239,
+	59, 13, 239, 68, 13, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127,
+	5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5, 239, 127, 5,
+	239, 127, 5, 104, 0, 0, 74, 255, 100, 110, 7, 75, 255, 102, 186, 5,
+	80, 15, 240, 239, 228, 12, 239, 237, 12, 239, 246, 12, 239, 255, 12, 239,
+	255, 12, 239, 11, 13, 239, 20, 13, 239, 20, 13, 239, 32, 13, 239, 41,
+	13, 239, 50, 13, 72, 255, 96, 183, 7, 105, 0, 34, 75, 34, 80, 15,
+	240, 239, 33, 21, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239, 73, 7,
+	239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115, 7, 239,
+	124, 7, 72, 255, 96, 187, 7, 105, 0, 255, 100, 93, 7, 75, 255, 102,
+	114, 5, 80, 15, 240, 239, 189, 20, 239, 198, 20, 239, 207, 20, 239, 216,
+	20, 239, 216, 20, 239, 228, 20, 239, 237, 20, 239, 237, 20, 239, 249, 20,
+	239, 2, 21, 239, 11, 21, 72, 255, 96, 191, 7, 105, 0, 34, 75, 34,
+	80, 15, 240, 239, 33, 21, 239, 55, 7, 239, 64, 7, 239, 73, 7, 239,
+	73, 7, 239, 85, 7, 239, 94, 7, 239, 94, 7, 239, 106, 7, 239, 115,
+	7, 239, 124, 7, 72, 255, 96, 174, 7, 73, 255, 98, 93, 7, 100, 93,
+	7, 102, 114, 5, 80, 3, 240, 250, 0, 0, 104, 255, 255, 106, 255, 255,
+	96, 0, 0, 98, 0, 0, 100, 0, 0, 75, 255, 48, 16, 0, 16, 33,
+	50, 67, 84, 101, 118, 135, 152, 169, 186, 203, 220, 237, 254, 102, 100, 6,
+	80, 8, 240, 75, 255, 80, 8, 240, 239, 41, 0, 239, 41, 0, 239, 41,
+	0, 239, 41, 0, 239, 41, 0, 239, 41, 0, 75, 238, 80, 8, 240, 75,
+	221, 80, 8, 240, 75, 204, 80, 8, 240, 75, 187, 80, 8, 240, 75, 170,
+	80, 8, 240, 75, 136, 80, 8, 240, 75, 119, 80, 8, 240, 75, 85, 80,
+	8, 240, 72, 255, 252, 19, 0, 96, 93, 7, 75, 51, 80, 9, 240, 72,
+	255, 75, 34, 80, 9, 240, 72, 255, 75, 0, 80, 9, 240, 239, 124, 0,
+	239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 72, 255, 96, 102,
+	7, 75, 0, 80, 9, 240, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239,
+	124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 72, 255, 96, 119, 7,
+	74, 255, 254, 19, 0, 100, 38, 7, 75, 255, 102, 237, 6, 80, 13, 240,
+	72, 255, 106, 255, 255, 80, 13, 240, 239, 198, 0, 239, 198, 0, 239, 198,
+	0, 239, 198, 0, 239, 198, 0, 239, 198, 0, 72, 238, 106, 238, 238, 80,
+	13, 240, 72, 221, 106, 221, 221, 80, 13, 240, 72, 204, 106, 204, 204, 80,
+	13, 240, 72, 187, 106, 187, 187, 80, 13, 240, 72, 170, 106, 170, 170, 80,
+	13, 240, 72, 136, 106, 136, 136, 80, 13, 240, 72, 119, 106, 119, 119, 80,
+	13, 240, 72, 85, 106, 85, 85, 80, 13, 240, 72, 51, 106, 51, 51, 80,
+	13, 240, 72, 34, 106, 34, 34, 80, 13, 240, 72, 0, 106, 0, 0, 80,
+	13, 240, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48,
+	1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1,
+	239, 48, 1, 239, 48, 1, 239, 48, 1, 72, 255, 96, 153, 7, 100, 38,
+	7, 75, 255, 102, 100, 6, 80, 9, 240, 72, 255, 75, 255, 80, 9, 240,
+	239, 111, 1, 239, 111, 1, 239, 111, 1, 239, 111, 1, 239, 111, 1, 239,
+	111, 1, 72, 238, 75, 238, 80, 9, 240, 72, 221, 75, 221, 80, 9, 240,
+	72, 204, 75, 204, 80, 9, 240, 72, 187, 75, 187, 80, 9, 240, 72, 170,
+	75, 170, 80, 9, 240, 72, 136, 75, 136, 80, 9, 240, 72, 119, 75, 119,
+	80, 9, 240, 72, 85, 75, 85, 80, 9, 240, 72, 51, 75, 51, 80, 9,
+	240, 72, 34, 75, 34, 80, 9, 240, 72, 0, 75, 0, 80, 9, 240, 239,
+	206, 1, 239, 206, 1, 239, 206, 1, 239, 206, 1, 239, 206, 1, 72, 255,
+	96, 147, 7, 75, 0, 80, 9, 240, 239, 124, 0, 239, 124, 0, 239, 124,
+	0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 72, 238, 74,
+	255, 100, 38, 7, 75, 255, 102, 237, 6, 80, 13, 240, 72, 221, 106, 255,
+	255, 80, 13, 240, 72, 204, 106, 255, 255, 80, 13, 240, 72, 187, 106, 255,
+	255, 80, 13, 240, 72, 170, 106, 255, 255, 80, 13, 240, 72, 136, 106, 255,
+	255, 80, 13, 240, 72, 119, 106, 255, 255, 80, 13, 240, 72, 85, 106, 255,
+	255, 80, 13, 240, 72, 51, 106, 238, 238, 80, 13, 240, 72, 34, 106, 221,
+	221, 80, 13, 240, 72, 0, 106, 204, 204, 80, 13, 240, 72, 0, 106, 187,
+	187, 80, 13, 240, 72, 0, 106, 170, 170, 80, 13, 240, 72, 0, 106, 136,
+	136, 80, 13, 240, 72, 0, 106, 119, 119, 80, 13, 240, 72, 0, 106, 85,
+	85, 80, 13, 240, 72, 255, 96, 134, 7, 106, 51, 51, 80, 13, 240, 72,
+	255, 106, 34, 34, 80, 13, 240, 72, 255, 106, 0, 0, 80, 13, 240, 239,
+	157, 2, 239, 157, 2, 239, 157, 2, 239, 157, 2, 239, 157, 2, 72, 238,
+	106, 0, 0, 80, 13, 240, 72, 221, 106, 0, 0, 80, 13, 240, 72, 204,
+	106, 0, 0, 80, 13, 240, 72, 187, 106, 0, 0, 80, 13, 240, 72, 170,
+	106, 0, 0, 80, 13, 240, 72, 136, 106, 0, 0, 80, 13, 240, 72, 119,
+	106, 0, 0, 80, 13, 240, 72, 85, 106, 0, 0, 80, 13, 240, 72, 51,
+	100, 38, 7, 75, 255, 102, 151, 5, 80, 9, 240, 72, 34, 75, 255, 80,
+	9, 240, 72, 0, 75, 255, 80, 9, 240, 239, 8, 3, 239, 8, 3, 239,
+	8, 3, 239, 8, 3, 239, 8, 3, 72, 0, 75, 238, 80, 9, 240, 72,
+	0, 75, 221, 80, 9, 240, 72, 0, 75, 204, 80, 9, 240, 72, 0, 75,
+	187, 80, 9, 240, 72, 0, 75, 170, 80, 9, 240, 72, 0, 75, 136, 80,
+	9, 240, 72, 0, 75, 119, 80, 9, 240, 72, 0, 75, 85, 80, 9, 240,
+	72, 255, 96, 93, 7, 75, 51, 80, 9, 240, 239, 117, 0, 239, 124, 0,
+	239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239,
+	146, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124,
+	0, 239, 124, 0, 239, 124, 0, 72, 255, 96, 119, 7, 74, 255, 100, 11,
+	7, 75, 255, 102, 203, 6, 80, 13, 240, 239, 198, 0, 239, 198, 0, 239,
+	198, 0, 239, 198, 0, 239, 198, 0, 239, 198, 0, 239, 198, 0, 239, 224,
+	0, 239, 232, 0, 239, 240, 0, 239, 248, 0, 239, 0, 1, 239, 8, 1,
+	239, 16, 1, 239, 24, 1, 239, 32, 1, 239, 40, 1, 239, 48, 1, 239,
+	48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48,
+	1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1,
+	239, 48, 1, 239, 48, 1, 72, 255, 96, 134, 7, 73, 255, 253, 19, 0,
+	98, 102, 7, 100, 11, 7, 75, 255, 102, 151, 5, 80, 11, 240, 104, 255,
+	255, 75, 255, 80, 11, 240, 239, 20, 4, 239, 20, 4, 239, 20, 4, 239,
+	20, 4, 239, 20, 4, 239, 20, 4, 72, 255, 96, 119, 7, 73, 255, 98,
+	93, 7, 75, 238, 80, 11, 240, 104, 255, 255, 75, 221, 80, 11, 240, 104,
+	255, 255, 75, 204, 80, 11, 240, 104, 255, 255, 75, 187, 80, 11, 240, 104,
+	255, 255, 75, 170, 80, 11, 240, 104, 255, 255, 75, 136, 80, 11, 240, 104,
+	255, 255, 75, 119, 80, 11, 240, 104, 255, 255, 75, 85, 80, 11, 240, 72,
+	255, 96, 102, 7, 73, 255, 98, 73, 7, 75, 51, 80, 11, 240, 104, 255,
+	255, 75, 34, 80, 11, 240, 104, 255, 255, 75, 0, 80, 11, 240, 239, 140,
+	4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 72, 255, 96,
+	93, 7, 73, 255, 98, 50, 7, 75, 0, 80, 11, 240, 239, 140, 4, 239,
+	140, 4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 239, 140,
+	4, 72, 255, 96, 93, 7, 73, 255, 98, 50, 7, 74, 255, 100, 11, 7,
+	75, 255, 102, 203, 6, 80, 15, 240, 104, 255, 255, 106, 255, 255, 80, 15,
+	240, 239, 222, 4, 239, 222, 4, 239, 222, 4, 239, 222, 4, 239, 222, 4,
+	239, 222, 4, 72, 255, 96, 102, 7, 73, 255, 98, 73, 7, 106, 238, 238,
+	80, 15, 240, 104, 255, 255, 106, 221, 221, 80, 15, 240, 104, 255, 255, 106,
+	204, 204, 80, 15, 240, 104, 255, 255, 106, 187, 187, 80, 15, 240, 104, 255,
+	255, 106, 170, 170, 80, 15, 240, 104, 255, 255, 106, 136, 136, 80, 15, 240,
+	104, 255, 255, 106, 119, 119, 80, 15, 240, 104, 255, 255, 106, 85, 85, 80,
+	15, 240, 72, 255, 96, 119, 7, 73, 255, 98, 93, 7, 106, 51, 51, 80,
+	15, 240, 104, 255, 255, 106, 34, 34, 80, 15, 240, 104, 255, 255, 106, 0,
+	0, 80, 15, 240, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5,
+	239, 97, 5, 72, 255, 96, 134, 7, 73, 255, 98, 102, 7, 106, 0, 0,
+	80, 15, 240, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239,
+	97, 5, 239, 97, 5, 239, 97, 5, 96, 134, 7, 98, 102, 7, 100, 11,
+	7, 75, 255, 102, 100, 6, 80, 8, 240, 239, 41, 0, 239, 41, 0, 239,
+	41, 0, 239, 41, 0, 239, 41, 0, 239, 41, 0, 239, 41, 0, 239, 64,
+	0, 239, 69, 0, 239, 74, 0, 239, 79, 0, 239, 84, 0, 239, 89, 0,
+	239, 94, 0, 239, 99, 0, 239, 86, 3, 239, 117, 0, 239, 124, 0, 239,
+	124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 146,
+	0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0, 239, 124, 0,
+	239, 124, 0, 239, 124, 0, 72, 255, 96, 119, 7, 74, 255, 100, 38, 7,
+	75, 255, 102, 237, 6, 80, 13, 240, 239, 198, 0, 239, 198, 0, 239, 198,
+	0, 239, 198, 0, 239, 198, 0, 239, 198, 0, 239, 198, 0, 239, 224, 0,
+	239, 232, 0, 239, 240, 0, 239, 248, 0, 239, 0, 1, 239, 8, 1, 239,
+	16, 1, 239, 24, 1, 239, 32, 1, 239, 40, 1, 239, 48, 1, 239, 48,
+	1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1,
+	239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239, 48, 1, 239,
+	48, 1, 239, 48, 1, 72, 255, 96, 153, 7, 73, 255, 98, 93, 7, 100,
+	38, 7, 75, 255, 102, 100, 6, 80, 11, 240, 239, 20, 4, 239, 20, 4,
+	239, 20, 4, 239, 20, 4, 239, 20, 4, 239, 20, 4, 239, 20, 4, 104,
+	238, 238, 75, 238, 80, 11, 240, 104, 221, 221, 75, 221, 80, 11, 240, 104,
+	204, 204, 75, 204, 80, 11, 240, 104, 187, 187, 75, 187, 80, 11, 240, 104,
+	170, 170, 75, 170, 80, 11, 240, 104, 136, 136, 75, 136, 80, 11, 240, 104,
+	119, 119, 75, 119, 80, 11, 240, 104, 85, 85, 75, 85, 80, 11, 240, 104,
+	51, 51, 75, 51, 80, 11, 240, 104, 34, 34, 75, 34, 80, 11, 240, 104,
+	0, 0, 75, 0, 80, 11, 240, 239, 245, 6, 239, 245, 6, 239, 245, 6,
+	239, 245, 6, 239, 245, 6, 72, 255, 96, 147, 7, 73, 255, 98, 73, 7,
+	75, 0, 80, 11, 240, 239, 140, 4, 239, 140, 4, 239, 140, 4, 239, 140,
+	4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 104, 238, 238, 74, 255, 100,
+	38, 7, 75, 255, 102, 237, 6, 80, 15, 240, 104, 221, 221, 106, 255, 255,
+	80, 15, 240, 104, 204, 204, 106, 255, 255, 80, 15, 240, 104, 187, 187, 106,
+	255, 255, 80, 15, 240, 104, 170, 170, 106, 255, 255, 80, 15, 240, 104, 136,
+	136, 106, 255, 255, 80, 15, 240, 104, 119, 119, 106, 255, 255, 80, 15, 240,
+	104, 85, 85, 106, 255, 255, 80, 15, 240, 104, 51, 51, 106, 238, 238, 80,
+	15, 240, 104, 34, 34, 106, 221, 221, 80, 15, 240, 104, 0, 0, 106, 204,
+	204, 80, 15, 240, 104, 0, 0, 106, 187, 187, 80, 15, 240, 104, 0, 0,
+	106, 170, 170, 80, 15, 240, 104, 0, 0, 106, 136, 136, 80, 15, 240, 104,
+	0, 0, 106, 119, 119, 80, 15, 240, 104, 0, 0, 106, 85, 85, 80, 15,
+	240, 72, 255, 96, 153, 7, 73, 255, 98, 93, 7, 106, 51, 51, 80, 15,
+	240, 239, 88, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5,
+	239, 97, 5, 239, 97, 5, 104, 238, 238, 106, 0, 0, 80, 15, 240, 104,
+	221, 221, 106, 0, 0, 80, 15, 240, 104, 204, 204, 106, 0, 0, 80, 15,
+	240, 104, 187, 187, 106, 0, 0, 80, 15, 240, 104, 170, 170, 106, 0, 0,
+	80, 15, 240, 104, 136, 136, 106, 0, 0, 80, 15, 240, 104, 119, 119, 106,
+	0, 0, 80, 15, 240, 104, 85, 85, 106, 0, 0, 80, 15, 240, 72, 255,
+	96, 174, 7, 73, 255, 98, 119, 7, 100, 38, 7, 75, 255, 102, 151, 5,
+	80, 11, 240, 239, 20, 4, 239, 20, 4, 239, 20, 4, 239, 20, 4, 239,
+	20, 4, 239, 20, 4, 239, 20, 4, 239, 165, 6, 239, 173, 6, 239, 181,
+	6, 239, 189, 6, 239, 197, 6, 239, 205, 6, 239, 213, 6, 239, 221, 6,
+	239, 229, 6, 239, 237, 6, 239, 245, 6, 239, 245, 6, 239, 245, 6, 239,
+	245, 6, 239, 245, 6, 239, 245, 6, 72, 255, 96, 164, 7, 73, 255, 98,
+	102, 7, 75, 0, 80, 11, 240, 239, 140, 4, 239, 140, 4, 239, 140, 4,
+	239, 140, 4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 104, 238, 238, 74,
+	255, 100, 11, 7, 75, 255, 102, 203, 6, 80, 15, 240, 239, 64, 7, 239,
+	73, 7, 239, 82, 7, 239, 91, 7, 239, 100, 7, 239, 109, 7, 239, 118,
+	7, 239, 127, 7, 239, 136, 7, 239, 145, 7, 239, 154, 7, 239, 163, 7,
+	239, 172, 7, 239, 181, 7, 239, 190, 7, 239, 199, 7, 239, 88, 5, 239,
+	97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97,
+	5, 239, 236, 7, 239, 245, 7, 239, 254, 7, 239, 7, 8, 239, 16, 8,
+	239, 25, 8, 239, 34, 8, 239, 43, 8, 104, 51, 51, 100, 11, 7, 75,
+	255, 102, 218, 5, 80, 11, 240, 104, 34, 34, 75, 255, 80, 11, 240, 104,
+	0, 0, 75, 255, 80, 11, 240, 239, 53, 9, 239, 53, 9, 239, 53, 9,
+	239, 53, 9, 239, 53, 9, 104, 0, 0, 75, 238, 80, 11, 240, 104, 0,
+	0, 75, 221, 80, 11, 240, 104, 0, 0, 75, 204, 80, 11, 240, 104, 0,
+	0, 75, 187, 80, 11, 240, 104, 0, 0, 75, 170, 80, 11, 240, 104, 0,
+	0, 75, 136, 80, 11, 240, 104, 0, 0, 75, 119, 80, 11, 240, 104, 0,
+	0, 75, 85, 80, 11, 240, 72, 255, 96, 153, 7, 73, 255, 98, 73, 7,
+	75, 51, 80, 11, 240, 239, 132, 4, 239, 140, 4, 239, 140, 4, 239, 140,
+	4, 239, 140, 4, 239, 140, 4, 239, 140, 4, 104, 238, 238, 75, 0, 80,
+	11, 240, 104, 221, 221, 75, 0, 80, 11, 240, 104, 204, 204, 75, 0, 80,
+	11, 240, 104, 187, 187, 75, 0, 80, 11, 240, 104, 170, 170, 75, 0, 80,
+	11, 240, 104, 136, 136, 75, 0, 80, 11, 240, 104, 119, 119, 75, 0, 80,
+	11, 240, 104, 85, 85, 75, 0, 80, 11, 240, 104, 51, 51, 74, 255, 100,
+	237, 6, 75, 255, 102, 203, 6, 80, 15, 240, 104, 34, 34, 106, 255, 255,
+	80, 15, 240, 104, 0, 0, 106, 255, 255, 80, 15, 240, 239, 9, 10, 239,
+	9, 10, 239, 9, 10, 239, 9, 10, 239, 9, 10, 104, 0, 0, 106, 238,
+	238, 80, 15, 240, 104, 0, 0, 106, 221, 221, 80, 15, 240, 239, 145, 7,
+	239, 154, 7, 239, 163, 7, 239, 172, 7, 239, 181, 7, 239, 190, 7, 72,
+	255, 96, 119, 7, 73, 255, 98, 73, 7, 106, 51, 51, 80, 15, 240, 239,
+	88, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97, 5, 239, 97,
+	5, 239, 97, 5, 239, 236, 7, 239, 245, 7, 239, 254, 7, 239, 7, 8,
+	239, 16, 8, 239, 25, 8, 239, 34, 8, 239, 43, 8, 96, 119, 7, 98,
+	73, 7, 100, 237, 6, 75, 255, 102, 100, 6, 80, 8, 240, 250, 0, 0,
+	17, 1, 132, 18, 0, 0, 32, 34, 152, 170, 187, 89, 85, 180, 188, 203,
+	204, 101, 55, 203, 189, 220, 44, 118, 54, 220, 204, 220, 107, 118, 197, 205,
+	204, 205, 100, 103, 200, 205, 204, 173, 102, 71, 220, 188, 220, 76, 118, 182,
+	220, 204, 220, 97, 118, 194, 220, 203, 189, 100, 87, 194, 189, 220, 140, 102,
+	151, 220, 203, 220, 91, 118, 181, 220, 203, 220, 99, 118, 203, 204, 204, 189,
+	101, 71, 203, 173, 204, 77, 102, 86, 204, 204, 220, 89, 118, 179, 220, 202,
+	204, 105, 102, 196, 204, 204, 204, 101, 55, 203, 204, 204, 156, 102, 70, 204,
+	204, 204, 92, 118, 177, 204, 204, 204, 98, 102, 194, 204, 204, 188, 101, 102,
+	204, 204, 204, 76, 102, 150, 204, 204, 204, 89, 102, 181, 204, 203, 204, 100,
+	102, 203, 204, 203, 188, 101, 86, 203, 204, 203, 76, 102, 182, 204, 188, 204,
+	90, 102, 180, 204, 203, 188, 100, 86, 201, 188, 204, 60, 101, 70, 204, 187,
+	204, 75, 102, 181, 204, 187, 204, 98, 86, 195, 188, 203, 188, 101, 70, 203,
+	172, 204, 43, 102, 5, 204, 187, 204, 89, 102, 179, 204, 202, 188, 99, 86,
+	202, 172, 203, 172, 101, 38, 203, 172, 203, 76, 102, 4, 188, 172, 204, 80,
+	86, 181, 204, 186, 188, 99, 85, 194, 187, 203, 12, 101, 69, 203, 187, 203,
+	75, 86, 149, 188, 187, 188, 90, 86, 180, 188, 203, 187, 100, 85, 202, 187,
+	203, 155, 101, 53, 203, 187, 203, 74, 86, 132, 188, 187, 188, 82, 86, 177,
+	188, 187, 156, 100, 69, 201, 187, 203, 26, 101, 149, 203, 171, 188, 74, 86,
+	164, 188, 187, 187, 80, 70, 178, 172, 187, 140, 100, 69, 187, 172, 203, 58,
+	101, 4, 203, 186, 203, 81, 85, 181, 188, 186, 172, 83, 70, 185, 172, 187,
+	171, 85, 69, 202, 186, 187, 59, 101, 147, 187, 187, 203, 82, 85, 180, 187,
+	42, 2, 153, 187, 89, 85, 203, 203, 172, 102, 181, 204, 205, 108, 103, 220,
+	220, 189, 118, 166, 205, 221, 108, 119, 221, 220, 205, 118, 54, 205, 221, 108,
+	103, 210, 220, 205, 117, 199, 205, 220, 93, 103, 213, 204, 221, 117, 86, 220,
+	220, 77, 103, 214, 220, 220, 96, 103, 205, 220, 141, 118, 198, 205, 205, 108,
+	103, 220, 204, 205, 118, 198, 205, 220, 108, 103, 220, 204, 205, 117, 38, 205,
+	220, 92, 103, 210, 204, 205, 116, 70, 205, 204, 77, 118, 196, 205, 220, 99,
+	87, 220, 204, 13, 118, 197, 205, 220, 104, 87, 220, 203, 189, 118, 197, 189,
+	220, 107, 102, 210, 203, 189, 117, 21, 189, 220, 91, 87, 210, 203, 220, 117,
+	69, 220, 203, 93, 118, 202, 189, 220, 100, 151, 220, 202, 61, 118, 193, 173,
+	220, 99, 102, 204, 204, 141, 102, 198, 204, 220, 96, 102, 219, 203, 204, 117,
+	181, 189, 204, 92, 102, 196, 204, 189, 101, 70, 204, 204, 60, 102, 197, 204,
+	220, 101, 86, 204, 204, 156, 102, 197, 204, 204, 105, 86, 204, 203, 188, 102,
+	181, 204, 204, 107, 86, 203, 204, 188, 101, 182, 204, 204, 91, 102, 203, 188,
+	204, 101, 166, 204, 204, 92, 102, 200, 188, 204, 100, 22, 204, 203, 60, 102,
+	195, 188, 204, 98, 70, 204, 203, 140, 102, 196, 188, 204, 104, 70, 203, 188,
+	188, 101, 149, 188, 204, 91, 102, 204, 203, 188, 101, 37, 188, 204, 91, 86,
+	194, 188, 188, 100, 182, 188, 204, 75, 86, 196, 187, 204, 99, 150, 188, 188,
+	44, 86, 197, 172, 204, 98, 85, 203, 203, 12, 101, 181, 188, 204, 80, 86,
+	203, 187, 188, 101, 181, 188, 203, 91, 86, 203, 187, 188, 100, 37, 188, 203,
+	75, 86, 193, 187, 188, 99, 53, 188, 203, 59, 86, 179, 188, 203, 82, 70,
+	188, 187, 12, 101, 180, 188, 203, 88, 70, 203, 26, 146, 169, 11, 85, 186,
+	204, 91, 102, 205, 220, 112, 38, 205, 221, 117, 215, 221, 221, 119, 213, 221,
+	13, 119, 219, 221, 109, 103, 220, 220, 125, 71, 221, 221, 114, 199, 221, 205,
+	117, 182, 221, 205, 119, 210, 205, 173, 119, 220, 221, 109, 103, 220, 221, 123,
+	183, 221, 220, 114, 215, 205, 221, 118, 214, 220, 189, 119, 219, 205, 61, 103,
+	218, 220, 109, 103, 205, 221, 122, 86, 221, 220, 116, 182, 205, 205, 118, 213,
+	220, 45, 103, 212, 220, 93, 103, 219, 220, 108, 87, 205, 221, 114, 38, 205,
+	205, 116, 198, 205, 205, 118, 213, 204, 189, 103, 216, 220, 92, 103, 205, 220,
+	108, 55, 205, 220, 113, 182, 205, 220, 117, 214, 204, 205, 118, 211, 204, 77,
+	103, 220, 219, 92, 87, 220, 219, 107, 7, 205, 220, 116, 198, 189, 205, 117,
+	197, 189, 173, 118, 219, 203, 77, 87, 219, 203, 109, 55, 220, 219, 105, 183,
+	205, 204, 113, 197, 204, 189, 117, 196, 189, 29, 118, 204, 220, 76, 87, 204,
+	220, 91, 55, 204, 220, 105, 86, 189, 220, 117, 180, 189, 204, 102, 197, 204,
+	45, 102, 196, 204, 93, 102, 203, 204, 108, 86, 220, 203, 106, 38, 204, 204,
+	100, 198, 204, 204, 102, 197, 204, 77, 102, 200, 204, 76, 102, 204, 204, 108,
+	70, 204, 204, 98, 166, 204, 204, 101, 181, 204, 188, 102, 195, 204, 44, 102,
+	203, 204, 92, 102, 204, 204, 108, 54, 204, 204, 99, 182, 204, 204, 101, 181,
+	188, 188, 102, 202, 204, 76, 102, 204, 203, 92, 86, 204, 203, 106, 166, 204,
+	204, 100, 198, 188, 204, 101, 197, 188, 172, 102, 203, 188, 76, 86, 202, 203,
+	92, 86, 204, 203, 105, 53, 188, 204, 100, 165, 188, 188, 101, 196, 203, 28,
+	86, 194, 203, 92, 86, 188, 204, 90, 70, 188, 204, 98, 21, 188, 188, 100,
+	197, 203, 156, 101, 156, 152, 155, 69, 187, 12, 86, 189, 109, 199, 221, 125,
+	215, 237, 121, 231, 236, 246, 221, 237, 119, 219, 206, 119, 221, 78, 143, 206,
+	110, 223, 237, 125, 199, 237, 123, 215, 237, 245, 235, 236, 246, 221, 222, 119,
+	220, 174, 119, 221, 94, 207, 206, 126, 151, 237, 124, 215, 221, 253, 211, 237,
+	245, 221, 237, 119, 219, 206, 119, 221, 205, 119, 222, 93, 223, 206, 109, 167,
+	221, 125, 215, 237, 116, 214, 221, 245, 237, 221, 119, 221, 221, 119, 221, 94,
+	207, 206, 109, 151, 221, 125, 215, 237, 122, 231, 236, 118, 214, 237, 119, 220,
+	221, 119, 221, 62, 119, 222, 93, 87, 221, 109, 183, 221, 125, 215, 237, 117,
+	214, 237, 119, 219, 221, 119, 221, 174, 119, 206, 141, 103, 221, 126, 199, 221,
+	125, 215, 237, 115, 231, 236, 118, 213, 221, 118, 218, 221, 119, 221, 78, 103,
+	221, 93, 87, 221, 109, 199, 221, 124, 214, 220, 123, 214, 237, 119, 220, 221,
+	119, 221, 221, 119, 206, 45, 103, 221, 126, 199, 221, 125, 215, 237, 115, 214,
+	236, 118, 213, 221, 118, 219, 221, 119, 221, 94, 103, 221, 93, 71, 221, 109,
+	199, 221, 124, 214, 220, 123, 214, 221, 117, 210, 221, 119, 221, 221, 119, 206,
+	61, 87, 221, 109, 167, 221, 125, 215, 221, 124, 214, 221, 116, 213, 221, 118,
+	220, 205, 103, 205, 189, 103, 221, 93, 39, 221, 125, 182, 221, 124, 214, 220,
+	123, 213, 220, 117, 217, 221, 103, 219, 205, 103, 205, 157, 87, 221, 109, 183,
+	221, 125, 215, 221, 124, 214, 221, 117, 211, 221, 118, 219, 205, 103, 205, 189,
+	87, 205, 93, 151, 221, 125, 182, 221, 124, 214, 220, 122, 213, 220, 117, 219,
+	205, 118, 205, 205, 103, 221, 77, 87, 221, 109, 183, 221, 124, 214, 220, 124,
+	214, 221, 117, 211, 220, 118, 205, 205, 103, 221, 45, 87, 205, 93, 167, 205,
+	109, 215, 220, 124, 214, 221, 116, 213, 221, 118, 219, 205, 118, 205, 205, 103,
+	221, 77, 71, 205, 109, 199, 221, 108, 215, 220, 124, 214, 221, 117, 209, 220,
+	118, 205, 205, 103, 221, 61, 87, 205, 93, 183, 205, 109, 215, 220, 124, 214,
+	220, 121, 212, 220, 117, 219, 220, 118, 205, 189, 87, 205, 77, 55, 205, 109,
+	199, 221, 124, 214, 220, 123, 213, 220, 116, 208, 220, 118, 205, 205, 103, 205,
+	189, 87, 205, 93, 183, 205, 109, 215, 220, 123, 213, 220, 115, 212, 220, 117,
+	219, 220, 118, 205, 173, 87, 205, 77, 7, 205, 109, 199, 221, 124, 197, 220,
+	123, 213, 220, 116, 217, 220, 118, 205, 189, 118, 221, 61, 71, 205, 93, 183,
+	205, 108, 182, 220, 107, 198, 220, 115, 210, 220, 118, 220, 220, 118, 205, 189,
+	71, 220, 44, 167, 205, 109, 199, 205, 125, 197, 220, 121, 212, 220, 117, 219,
+	204, 117, 220, 204, 102, 204, 29, 55, 205, 93, 183, 189, 109, 215, 220, 107,
+	198, 220, 116, 217, 204, 117, 220, 220, 118, 205, 173, 71, 189, 77, 167, 205,
+	92, 215, 204, 108, 198, 220, 121, 211, 219, 117, 204, 205, 102, 202, 189, 102,
+	204, 45, 7, 189, 93, 199, 220, 108, 182, 220, 106, 198, 220, 116, 218, 219,
+	117, 204, 205, 102, 203, 157, 102, 204, 77, 183, 189, 109, 134, 220, 107, 198,
+	220, 98, 198, 220, 116, 204, 220, 102, 202, 189, 102, 204, 188, 102, 205, 76,
+	86, 189, 92, 150, 204, 108, 198, 220, 114, 203, 220, 117, 220, 204, 102, 204,
+	188, 102, 189, 77, 183, 204, 93, 199, 205, 108, 198, 204, 107, 214, 219, 101,
+	213, 203, 101, 201, 204, 102, 204, 45, 102, 205, 76, 70, 204, 92, 166, 204,
+	108, 198, 220, 100, 197, 204, 100, 195, 204, 102, 204, 157, 102, 189, 140, 86,
+	204, 109, 166, 204, 108, 198, 220, 105, 214, 203, 97, 196, 204, 101, 201, 204,
+	102, 204, 61, 86, 204, 76, 70, 204, 92, 182, 204, 107, 197, 203, 106, 197,
+	204, 100, 194, 204, 102, 204, 141, 102, 189, 140, 86, 204, 109, 182, 204, 108,
+	198, 204, 108, 214, 203, 98, 196, 204, 101, 202, 204, 102, 204, 188, 86, 204,
+	76, 54, 204, 92, 166, 204, 108, 198, 220, 100, 197, 204, 100, 194, 204, 102,
+	204, 204, 102, 189, 44, 70, 204, 92, 150, 204, 108, 198, 204, 107, 197, 204,
+	99, 196, 204, 101, 203, 188, 86, 203, 172, 86, 204, 76, 38, 204, 92, 166,
+	204, 107, 197, 204, 98, 197, 204, 100, 192, 204, 86, 202, 188, 86, 188, 140,
+	70, 204, 92, 166, 204, 108, 198, 204, 107, 197, 204, 99, 196, 204, 101, 202,
+	188, 86, 204, 28, 86, 204, 76, 6, 204, 108, 165, 204, 107, 197, 203, 105,
+	196, 203, 100, 201, 204, 86, 187, 188, 86, 204, 60, 54, 188, 92, 182, 204,
+	91, 198, 204, 104, 197, 204, 100, 194, 204, 101, 202, 188, 86, 188, 172, 70,
+	188, 76, 150, 188, 92, 198, 203, 107, 197, 204, 99, 196, 204, 101, 202, 188,
+	101, 188, 188, 86, 204, 60, 54, 188, 92, 182, 204, 91, 198, 203, 107, 197,
+	204, 100, 193, 203, 101, 188, 188, 86, 204, 44, 70, 188, 76, 166, 188, 92,
+	198, 203, 107, 197, 203, 105, 195, 203, 100, 201, 203, 101, 188, 172, 70, 188,
+	44, 54, 188, 92, 198, 203, 91, 198, 188, 107, 196, 203, 100, 200, 203, 101,
+	188, 188, 70, 187, 172, 54, 188, 76, 150, 188, 92, 182, 204, 106, 196, 203,
+	99, 194, 203, 101, 203, 203, 101, 188, 172, 70, 188, 44, 38, 188, 92, 182,
+	204, 91, 198, 203, 106, 195, 202, 99, 200, 203, 101, 188, 172, 85, 186, 156,
+	54, 188, 76, 166, 188, 91, 165, 203, 107, 180, 188, 105, 193, 203, 85, 195,
+	187, 85, 186, 172, 54, 203, 11, 134, 188, 92, 182, 188, 92, 198, 203, 105,
+	195, 203, 100, 201, 203, 101, 188, 187, 85, 187, 140, 38, 188, 59, 182, 203,
+	91, 149, 203, 107, 196, 187, 105, 200, 202, 100, 187, 188, 85, 186, 156, 85,
+	187, 60, 150, 188, 75, 198, 187, 91, 181, 203, 105, 178, 188, 99, 202, 187,
+	100, 188, 187, 85, 187, 12, 6, 172, 76, 182, 187, 92, 149, 203, 90, 181,
+	203, 98, 200, 202, 100, 187, 203, 85, 185, 156, 85, 187, 60, 166, 172, 92,
+	5, 203, 90, 181, 203, 80, 181, 203, 99, 202, 202, 85, 185, 187, 85, 187,
+	12, 85, 172, 76, 182, 203, 91, 165, 203, 89, 181, 203, 98, 201, 202, 100,
+	187, 203, 85, 186, 187, 85, 187, 60, 69, 187, 92, 133, 187, 91, 181, 203,
+	89, 197, 186, 81, 180, 203, 85, 186, 187, 85, 187, 12, 85, 172, 76, 53,
+	187, 75, 133, 187, 91, 181, 203, 82, 180, 187, 83, 179, 187, 84, 185, 187,
+	85, 187, 60, 69, 187, 92, 149, 187, 91, 181, 203, 88, 197, 186, 80, 180,
+	203, 85, 186, 187, 85, 187, 28, 69, 187, 59, 53, 187, 75, 149, 187, 91,
+	181, 203, 82, 180, 187, 83, 179, 187, 84, 186, 171, 69, 186, 155, 69, 187,
+	59, 21, 187, 91, 181, 203, 81, 180, 186, 80, 179, 187, 84, 185, 187, 85,
+	187, 171, 69, 187, 43, 53, 187, 75, 149, 187, 91, 181, 203, 83, 180, 187,
+	83, 177, 187, 69, 185, 171, 69, 171, 155, 53, 171, 59, 133, 187, 91, 181,
+	187, 90, 180, 187, 82, 179, 187, 84, 185, 187, 85, 187, 171, 69, 187, 59,
+	21, 187, 75, 149, 187, 90, 180, 186, 89, 179, 186, 83, 176, 187, 69, 185,
+	171, 69, 171, 139, 53, 187, 75, 149, 187, 74, 181, 186, 90, 180, 187, 82,
+	179, 187, 84, 185, 171, 69, 171, 171, 69, 187, 59, 21, 187, 75, 149, 187,
+	90, 180, 186, 89, 179, 186, 83, 184, 171, 84, 171, 171, 69, 187, 43, 53,
+	187, 75, 149, 187, 74, 181, 186, 90, 180, 187, 36, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118, 119, 120, 121, 130, 131,
+	132, 133, 134, 130, 131, 145, 146, 147, 143, 144, 145, 146, 160, 156, 157, 158,
+	159, 160, 156, 170, 171, 172, 173, 169, 170, 171, 185, 186, 182, 183, 184, 185,
+	186, 195, 196, 197, 198, 199, 195, 196, 210, 211, 212, 208, 209, 210, 211, 225,
+	221, 222, 223, 224, 225, 221, 235, 236, 237, 238, 234, 235, 236, 250, 251, 247,
+	248, 249, 250, 251, 4, 5, 6, 7, 8, 4, 5, 19, 20, 21, 17, 18,
+	19, 20, 34, 30, 31, 32, 33, 34, 30, 44, 45, 46, 47, 43, 44, 45,
+	59, 60, 56, 57, 58, 59, 60, 69, 70, 71, 72, 73, 69, 70, 84, 85,
+	86, 82, 83, 84, 85, 99, 95, 96, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 213, 214, 215, 229, 225, 226, 227, 228,
+	229, 225, 239, 240, 241, 242, 238, 239, 240, 254, 255, 251, 252, 253, 254, 255,
+	8, 9, 10, 11, 12, 8, 9, 23, 24, 25, 21, 22, 23, 24, 38, 34,
+	35, 36, 37, 38, 34, 48, 49, 50, 51, 47, 48, 49, 63, 64, 60, 61,
+	62, 63, 64, 73, 74, 75, 76, 77, 73, 74, 88, 89, 90, 86, 87, 88,
+	89, 103, 99, 100, 101, 102, 103, 99, 113, 114, 115, 116, 112, 113, 114, 128,
+	129, 125, 126, 127, 128, 129, 138, 139, 140, 141, 142, 138, 139, 153, 154, 155,
+	151, 152, 153, 154, 168, 164, 165, 166, 167, 168, 164, 178, 179, 180, 181, 177,
+	178, 179, 193, 194, 190, 191, 192, 193, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 67, 68, 64, 65, 66, 67, 68, 77,
+	78, 79, 80, 81, 77, 78, 92, 93, 94, 90, 91, 92, 93, 107, 103, 104,
+	105, 106, 107, 103, 117, 118, 119, 120, 116, 117, 118, 132, 133, 129, 130, 131,
+	132, 133, 142, 143, 144, 145, 146, 142, 143, 157, 158, 159, 155, 156, 157, 158,
+	172, 168, 169, 170, 171, 172, 168, 182, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118, 119, 120, 121, 130, 131,
+	132, 133, 134, 130, 131, 145, 146, 147, 143, 144, 145, 146, 160, 156, 157, 158,
+	159, 160, 156, 170, 171, 172, 173, 169, 170, 171, 185, 186, 182, 183, 184, 185,
+	186, 195, 196, 197, 198, 199, 195, 196, 210, 211, 212, 208, 209, 210, 211, 225,
+	221, 222, 223, 224, 225, 221, 235, 236, 237, 238, 234, 235, 236, 250, 251, 247,
+	248, 249, 250, 251, 4, 5, 6, 7, 8, 4, 5, 19, 20, 21, 17, 18,
+	19, 20, 34, 30, 31, 32, 33, 34, 30, 44, 45, 46, 47, 43, 44, 45,
+	59, 60, 56, 57, 58, 59, 60, 69, 70, 71, 72, 73, 69, 70, 84, 85,
+	86, 82, 83, 84, 85, 99, 95, 96, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 213, 214, 215, 229, 225, 226, 227, 228,
+	229, 225, 239, 240, 241, 242, 238, 239, 240, 254, 255, 251, 252, 253, 254, 255,
+	8, 9, 10, 11, 12, 8, 9, 23, 24, 25, 21, 22, 23, 24, 38, 34,
+	35, 36, 37, 38, 34, 48, 49, 50, 51, 47, 48, 49, 63, 64, 60, 61,
+	62, 63, 64, 73, 74, 75, 76, 77, 73, 74, 88, 89, 90, 86, 87, 88,
+	89, 103, 99, 100, 101, 102, 103, 99, 113, 114, 115, 116, 112, 113, 114, 128,
+	129, 125, 126, 127, 128, 129, 138, 139, 140, 141, 142, 138, 139, 153, 154, 155,
+	151, 152, 153, 154, 168, 164, 165, 166, 167, 168, 164, 178, 179, 180, 181, 177,
+	178, 179, 193, 194, 190, 191, 192, 193, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 67, 68, 64, 65, 66, 67, 68, 77,
+	78, 79, 80, 81, 77, 78, 92, 93, 94, 90, 91, 92, 93, 107, 103, 104,
+	105, 106, 107, 103, 117, 118, 119, 120, 116, 117, 118, 132, 133, 129, 130, 131,
+	132, 133, 142, 143, 144, 145, 146, 142, 143, 157, 158, 159, 155, 156, 157, 158,
+	172, 168, 169, 170, 171, 172, 168, 182, 183, 184, 185, 181, 182, 183, 197, 198,
+	194, 195, 196, 197, 198, 207, 208, 209, 210, 211, 207, 208, 222, 223, 224, 220,
+	221, 222, 223, 237, 233, 234, 235, 236, 237, 233, 247, 248, 249, 250, 246, 247,
+	248, 6, 7, 3, 4, 5, 6, 7, 16, 17, 18, 19, 20, 16, 17, 31,
+	32, 33, 29, 30, 31, 32, 46, 42, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 159, 160, 161, 162, 176, 172, 173, 174,
+	175, 176, 172, 186, 187, 188, 189, 185, 186, 187, 201, 202, 198, 199, 200, 201,
+	202, 211, 212, 213, 214, 215, 211, 212, 226, 227, 228, 224, 225, 226, 227, 241,
+	237, 238, 239, 240, 241, 237, 251, 252, 253, 254, 250, 251, 252, 10, 11, 7,
+	8, 9, 10, 11, 20, 21, 22, 23, 24, 20, 21, 35, 36, 37, 33, 34,
+	35, 36, 50, 46, 47, 48, 49, 50, 46, 60, 61, 62, 63, 59, 60, 61,
+	75, 76, 72, 73, 74, 75, 76, 85, 86, 87, 88, 89, 85, 86, 100, 101,
+	102, 98, 99, 100, 101, 115, 111, 112, 113, 114, 115, 111, 125, 126, 127, 128,
+	124, 125, 126, 140, 141, 137, 138, 139, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 0, 14, 15, 11, 12, 13, 14, 15,
+	24, 25, 26, 27, 28, 24, 25, 39, 40, 41, 37, 38, 39, 40, 54, 50,
+	51, 52, 53, 54, 50, 64, 65, 66, 67, 63, 64, 65, 79, 80, 76, 77,
+	78, 79, 80, 89, 90, 91, 92, 93, 89, 90, 104, 105, 106, 102, 103, 104,
+	105, 119, 115, 116, 117, 118, 119, 115, 129, 130, 131, 132, 128, 129, 130, 144,
+	145, 141, 142, 143, 144, 145, 154, 155, 156, 157, 158, 154, 155, 169, 170, 171,
+	167, 168, 169, 170, 184, 180, 181, 182, 183, 184, 180, 194, 195, 196, 197, 193,
+	194, 195, 209, 210, 206, 207, 208, 209, 210, 219, 220, 221, 222, 223, 219, 220,
+	234, 235, 236, 232, 233, 234, 235, 249, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 110, 106, 107, 108, 109, 123, 119, 120,
+	121, 122, 123, 119, 133, 134, 135, 136, 132, 133, 134, 148, 149, 145, 146, 147,
+	148, 149, 158, 159, 160, 161, 162, 158, 159, 173, 174, 175, 171, 172, 173, 174,
+	188, 184, 185, 186, 187, 188, 184, 198, 199, 200, 201, 197, 198, 199, 213, 214,
+	210, 211, 212, 213, 214, 223, 224, 225, 226, 227, 223, 224, 238, 239, 240, 236,
+	237, 238, 239, 253, 249, 250, 251, 252, 253, 249, 7, 8, 9, 10, 6, 7,
+	8, 22, 23, 19, 20, 21, 22, 23, 32, 33, 34, 35, 36, 32, 33, 47,
+	48, 49, 45, 46, 47, 48, 62, 58, 59, 60, 61, 62, 58, 72, 73, 74,
+	75, 71, 72, 73, 87, 88, 84, 85, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 202, 203, 217, 218, 214, 215, 216, 217,
+	218, 227, 228, 229, 230, 231, 227, 228, 242, 243, 244, 240, 241, 242, 243, 1,
+	253, 254, 255, 0, 1, 253, 11, 12, 13, 14, 10, 11, 12, 26, 27, 23,
+	24, 25, 26, 27, 36, 37, 38, 39, 40, 36, 37, 51, 52, 53, 49, 50,
+	51, 52, 66, 62, 63, 64, 65, 66, 62, 76, 77, 78, 79, 75, 76, 77,
+	91, 92, 88, 89, 90, 91, 92, 101, 102, 103, 104, 105, 101, 102, 116, 117,
+	118, 114, 115, 116, 117, 131, 127, 128, 129, 130, 131, 127, 141, 142, 143, 144,
+	140, 141, 142, 156, 157, 153, 154, 155, 156, 157, 166, 167, 168, 169, 170, 166,
+	167, 181, 182, 183, 179, 180, 181, 182, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 56, 57, 53, 54, 55, 56, 70, 66,
+	67, 68, 69, 70, 66, 80, 81, 82, 83, 79, 80, 81, 95, 96, 92, 93,
+	94, 95, 96, 105, 106, 107, 108, 109, 105, 106, 120, 121, 122, 118, 119, 120,
+	121, 135, 131, 132, 133, 134, 135, 131, 145, 146, 147, 148, 144, 145, 146, 160,
+	161, 157, 158, 159, 160, 161, 170, 171, 172, 173, 174, 170, 171, 185, 186, 187,
+	183, 184, 185, 186, 200, 196, 197, 198, 199, 200, 196, 210, 211, 212, 213, 209,
+	210, 211, 225, 226, 222, 223, 224, 225, 226, 235, 236, 237, 238, 239, 235, 236,
+	250, 251, 252, 248, 249, 250, 251, 9, 5, 6, 7, 8, 9, 5, 19, 20,
+	21, 22, 18, 19, 20, 34, 35, 31, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 148, 149, 150, 164, 165, 161, 162, 163,
+	164, 165, 174, 175, 176, 177, 178, 174, 175, 189, 190, 191, 187, 188, 189, 190,
+	204, 200, 201, 202, 203, 204, 200, 214, 215, 216, 217, 213, 214, 215, 229, 230,
+	226, 227, 228, 229, 230, 239, 240, 241, 242, 243, 239, 240, 254, 255, 0, 252,
+	253, 254, 255, 13, 9, 10, 11, 12, 13, 9, 23, 24, 25, 26, 22, 23,
+	24, 38, 39, 35, 36, 37, 38, 39, 48, 49, 50, 51, 52, 48, 49, 63,
+	64, 65, 61, 62, 63, 64, 78, 74, 75, 76, 77, 78, 74, 88, 89, 90,
+	91, 87, 88, 89, 103, 104, 100, 101, 102, 103, 104, 113, 114, 115, 116, 117,
+	113, 114, 128, 129, 130, 126, 127, 128, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 2, 3, 4, 0, 1, 2, 3, 17,
+	13, 14, 15, 16, 17, 13, 27, 28, 29, 30, 26, 27, 28, 42, 43, 39,
+	40, 41, 42, 43, 52, 53, 54, 55, 56, 52, 53, 67, 68, 69, 65, 66,
+	67, 68, 82, 78, 79, 80, 81, 82, 78, 92, 93, 94, 95, 91, 92, 93,
+	107, 108, 104, 105, 106, 107, 108, 117, 118, 119, 120, 121, 117, 118, 132, 133,
+	134, 130, 131, 132, 133, 147, 143, 144, 145, 146, 147, 143, 157, 158, 159, 160,
+	156, 157, 158, 172, 173, 169, 170, 171, 172, 173, 182, 183, 184, 185, 186, 182,
+	183, 197, 198, 199, 195, 196, 197, 198, 212, 208, 209, 210, 211, 212, 208, 222,
+	223, 224, 225, 221, 222, 223, 237, 238, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 99, 95, 96, 97, 111, 112, 108, 109,
+	110, 111, 112, 121, 122, 123, 124, 125, 121, 122, 136, 137, 138, 134, 135, 136,
+	137, 151, 147, 148, 149, 150, 151, 147, 161, 162, 163, 164, 160, 161, 162, 176,
+	177, 173, 174, 175, 176, 177, 186, 187, 188, 189, 190, 186, 187, 201, 202, 203,
+	199, 200, 201, 202, 216, 212, 213, 214, 215, 216, 212, 226, 227, 228, 229, 225,
+	226, 227, 241, 242, 238, 239, 240, 241, 242, 251, 252, 253, 254, 255, 251, 252,
+	10, 11, 12, 8, 9, 10, 11, 25, 21, 22, 23, 24, 25, 21, 35, 36,
+	37, 38, 34, 35, 36, 50, 51, 47, 48, 49, 50, 51, 60, 61, 62, 63,
+	64, 60, 61, 75, 76, 77, 73, 74, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 191, 205, 206, 207, 203, 204, 205, 206,
+	220, 216, 217, 218, 219, 220, 216, 230, 231, 232, 233, 229, 230, 231, 245, 246,
+	242, 243, 244, 245, 246, 255, 0, 1, 2, 3, 255, 0, 14, 15, 16, 12,
+	13, 14, 15, 29, 25, 26, 27, 28, 29, 25, 39, 40, 41, 42, 38, 39,
+	40, 54, 55, 51, 52, 53, 54, 55, 64, 65, 66, 67, 68, 64, 65, 79,
+	80, 81, 77, 78, 79, 80, 94, 90, 91, 92, 93, 94, 90, 104, 105, 106,
+	107, 103, 104, 105, 119, 120, 116, 117, 118, 119, 120, 129, 130, 131, 132, 133,
+	129, 130, 144, 145, 146, 142, 143, 144, 145, 159, 155, 156, 157, 158, 159, 155,
+	169, 170, 171, 172, 168, 169, 170, 184, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 45, 46, 42, 43, 44, 58, 59, 55,
+	56, 57, 58, 59, 68, 69, 70, 71, 72, 68, 69, 83, 84, 85, 81, 82,
+	83, 84, 98, 94, 95, 96, 97, 98, 94, 108, 109, 110, 111, 107, 108, 109,
+	123, 124, 120, 121, 122, 123, 124, 133, 134, 135, 136, 137, 133, 134, 148, 149,
+	150, 146, 147, 148, 149, 163, 159, 160, 161, 162, 163, 159, 173, 174, 175, 176,
+	172, 173, 174, 188, 189, 185, 186, 187, 188, 189, 198, 199, 200, 201, 202, 198,
+	199, 213, 214, 215, 211, 212, 213, 214, 228, 224, 225, 226, 227, 228, 224, 238,
+	239, 240, 241, 237, 238, 239, 253, 254, 250, 251, 252, 253, 254, 7, 8, 9,
+	10, 11, 7, 8, 22, 23, 24, 20, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 137, 138, 152, 153, 154, 150, 151, 152,
+	153, 167, 163, 164, 165, 166, 167, 163, 177, 178, 179, 180, 176, 177, 178, 192,
+	193, 189, 190, 191, 192, 193, 202, 203, 204, 205, 206, 202, 203, 217, 218, 219,
+	215, 216, 217, 218, 232, 228, 229, 230, 231, 232, 228, 242, 243, 244, 245, 241,
+	242, 243, 1, 2, 254, 255, 0, 1, 2, 11, 12, 13, 14, 15, 11, 12,
+	26, 27, 28, 24, 25, 26, 27, 41, 37, 38, 39, 40, 41, 37, 51, 52,
+	53, 54, 50, 51, 52, 66, 67, 63, 64, 65, 66, 67, 76, 77, 78, 79,
+	80, 76, 77, 91, 92, 93, 89, 90, 91, 92, 106, 102, 103, 104, 105, 106,
+	102, 116, 117, 118, 119, 115, 116, 117, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 247, 248, 249, 245, 246, 247, 5, 6,
+	2, 3, 4, 5, 6, 15, 16, 17, 18, 19, 15, 16, 30, 31, 32, 28,
+	29, 30, 31, 45, 41, 42, 43, 44, 45, 41, 55, 56, 57, 58, 54, 55,
+	56, 70, 71, 67, 68, 69, 70, 71, 80, 81, 82, 83, 84, 80, 81, 95,
+	96, 97, 93, 94, 95, 96, 110, 106, 107, 108, 109, 110, 106, 120, 121, 122,
+	123, 119, 120, 121, 135, 136, 132, 133, 134, 135, 136, 145, 146, 147, 148, 149,
+	145, 146, 160, 161, 162, 158, 159, 160, 161, 175, 171, 172, 173, 174, 175, 171,
+	185, 186, 187, 188, 184, 185, 186, 200, 201, 197, 198, 199, 200, 201, 210, 211,
+	212, 213, 214, 210, 211, 225, 226, 227, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 88, 84, 85, 99, 100, 101, 97, 98,
+	99, 100, 114, 110, 111, 112, 113, 114, 110, 124, 125, 126, 127, 123, 124, 125,
+	139, 140, 136, 137, 138, 139, 140, 149, 150, 151, 152, 153, 149, 150, 164, 165,
+	166, 162, 163, 164, 165, 179, 175, 176, 177, 178, 179, 175, 189, 190, 191, 192,
+	188, 189, 190, 204, 205, 201, 202, 203, 204, 205, 214, 215, 216, 217, 218, 214,
+	215, 229, 230, 231, 227, 228, 229, 230, 244, 240, 241, 242, 243, 244, 240, 254,
+	255, 0, 1, 253, 254, 255, 13, 14, 10, 11, 12, 13, 14, 23, 24, 25,
+	26, 27, 23, 24, 38, 39, 40, 36, 37, 38, 39, 53, 49, 50, 51, 52,
+	53, 49, 63, 64, 65, 66, 62, 63, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 193, 194, 195, 196, 192, 193, 194, 208,
+	209, 205, 206, 207, 208, 209, 218, 219, 220, 221, 222, 218, 219, 233, 234, 235,
+	231, 232, 233, 234, 248, 244, 245, 246, 247, 248, 244, 2, 3, 4, 5, 1,
+	2, 3, 17, 18, 14, 15, 16, 17, 18, 27, 28, 29, 30, 31, 27, 28,
+	42, 43, 44, 40, 41, 42, 43, 57, 53, 54, 55, 56, 57, 53, 67, 68,
+	69, 70, 66, 67, 68, 82, 83, 79, 80, 81, 82, 83, 92, 93, 94, 95,
+	96, 92, 93, 107, 108, 109, 105, 106, 107, 108, 122, 118, 119, 120, 121, 122,
+	118, 132, 133, 134, 135, 131, 132, 133, 147, 148, 144, 145, 146, 147, 148, 157,
+	158, 159, 160, 161, 157, 158, 172, 173, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 34, 35, 31, 32, 46, 47, 48, 44,
+	45, 46, 47, 61, 57, 58, 59, 60, 61, 57, 71, 72, 73, 74, 70, 71,
+	72, 86, 87, 83, 84, 85, 86, 87, 96, 97, 98, 99, 100, 96, 97, 111,
+	112, 113, 109, 110, 111, 112, 126, 122, 123, 124, 125, 126, 122, 136, 137, 138,
+	139, 135, 136, 137, 151, 152, 148, 149, 150, 151, 152, 161, 162, 163, 164, 165,
+	161, 162, 176, 177, 178, 174, 175, 176, 177, 191, 187, 188, 189, 190, 191, 187,
+	201, 202, 203, 204, 200, 201, 202, 216, 217, 213, 214, 215, 216, 217, 226, 227,
+	228, 229, 230, 226, 227, 241, 242, 243, 239, 240, 241, 242, 0, 252, 253, 254,
+	255, 0, 252, 10, 11, 12, 13, 9, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 126, 140, 141, 142, 143, 139, 140, 141,
+	155, 156, 152, 153, 154, 155, 156, 165, 166, 167, 168, 169, 165, 166, 180, 181,
+	182, 178, 179, 180, 181, 195, 191, 192, 193, 194, 195, 191, 205, 206, 207, 208,
+	204, 205, 206, 220, 221, 217, 218, 219, 220, 221, 230, 231, 232, 233, 234, 230,
+	231, 245, 246, 247, 243, 244, 245, 246, 4, 0, 1, 2, 3, 4, 0, 14,
+	15, 16, 17, 13, 14, 15, 29, 30, 26, 27, 28, 29, 30, 39, 40, 41,
+	42, 43, 39, 40, 54, 55, 56, 52, 53, 54, 55, 69, 65, 66, 67, 68,
+	69, 65, 79, 80, 81, 82, 78, 79, 80, 94, 95, 91, 92, 93, 94, 95,
+	104, 105, 106, 107, 108, 104, 105, 119, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 236, 237, 238, 234, 235, 249, 250, 251,
+	247, 248, 249, 250, 8, 4, 5, 6, 7, 8, 4, 18, 19, 20, 21, 17,
+	18, 19, 33, 34, 30, 31, 32, 33, 34, 43, 44, 45, 46, 47, 43, 44,
+	58, 59, 60, 56, 57, 58, 59, 73, 69, 70, 71, 72, 73, 69, 83, 84,
+	85, 86, 82, 83, 84, 98, 99, 95, 96, 97, 98, 99, 108, 109, 110, 111,
+	112, 108, 109, 123, 124, 125, 121, 122, 123, 124, 138, 134, 135, 136, 137, 138,
+	134, 148, 149, 150, 151, 147, 148, 149, 163, 164, 160, 161, 162, 163, 164, 173,
+	174, 175, 176, 177, 173, 174, 188, 189, 190, 186, 187, 188, 189, 203, 199, 200,
+	201, 202, 203, 199, 213, 214, 215, 216, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 77, 73, 87, 88, 89, 90, 86, 87,
+	88, 102, 103, 99, 100, 101, 102, 103, 112, 113, 114, 115, 116, 112, 113, 127,
+	128, 129, 125, 126, 127, 128, 142, 138, 139, 140, 141, 142, 138, 152, 153, 154,
+	155, 151, 152, 153, 167, 168, 164, 165, 166, 167, 168, 177, 178, 179, 180, 181,
+	177, 178, 192, 193, 194, 190, 191, 192, 193, 207, 203, 204, 205, 206, 207, 203,
+	217, 218, 219, 220, 216, 217, 218, 232, 233, 229, 230, 231, 232, 233, 242, 243,
+	244, 245, 246, 242, 243, 1, 2, 3, 255, 0, 1, 2, 16, 12, 13, 14,
+	15, 16, 12, 26, 27, 28, 29, 25, 26, 27, 41, 42, 38, 39, 40, 41,
+	42, 51, 52, 53, 54, 55, 51, 52, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 182, 183, 184, 185, 181, 182, 196, 197,
+	198, 194, 195, 196, 197, 211, 207, 208, 209, 210, 211, 207, 221, 222, 223, 224,
+	220, 221, 222, 236, 237, 233, 234, 235, 236, 237, 246, 247, 248, 249, 250, 246,
+	247, 5, 6, 7, 3, 4, 5, 6, 20, 16, 17, 18, 19, 20, 16, 30,
+	31, 32, 33, 29, 30, 31, 45, 46, 42, 43, 44, 45, 46, 55, 56, 57,
+	58, 59, 55, 56, 70, 71, 72, 68, 69, 70, 71, 85, 81, 82, 83, 84,
+	85, 81, 95, 96, 97, 98, 94, 95, 96, 110, 111, 107, 108, 109, 110, 111,
+	120, 121, 122, 123, 124, 120, 121, 135, 136, 137, 133, 134, 135, 136, 150, 146,
+	147, 148, 149, 150, 146, 160, 161, 162, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 23, 24, 20, 34, 35, 36, 37, 33,
+	34, 35, 49, 50, 46, 47, 48, 49, 50, 59, 60, 61, 62, 63, 59, 60,
+	74, 75, 76, 72, 73, 74, 75, 89, 85, 86, 87, 88, 89, 85, 99, 100,
+	101, 102, 98, 99, 100, 114, 115, 111, 112, 113, 114, 115, 124, 125, 126, 127,
+	128, 124, 125, 139, 140, 141, 137, 138, 139, 140, 154, 150, 151, 152, 153, 154,
+	150, 164, 165, 166, 167, 163, 164, 165, 179, 180, 176, 177, 178, 179, 180, 189,
+	190, 191, 192, 193, 189, 190, 204, 205, 206, 202, 203, 204, 205, 219, 215, 216,
+	217, 218, 219, 215, 229, 230, 231, 232, 228, 229, 230, 244, 245, 241, 242, 243,
+	244, 245, 254, 255, 0, 1, 2, 254, 192, 199, 206, 213, 220, 227, 234, 241,
+	248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90, 97,
+	104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202, 209,
+	216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58, 65,
+	72, 79, 86, 93, 100, 107, 114, 121, 128, 129, 130, 131, 132, 128, 129, 143,
+	144, 145, 141, 142, 143, 144, 158, 154, 155, 156, 157, 158, 154, 168, 169, 170,
+	171, 167, 168, 169, 183, 184, 180, 181, 182, 183, 184, 193, 194, 195, 196, 197,
+	193, 194, 208, 209, 210, 206, 207, 208, 209, 223, 219, 220, 221, 222, 223, 219,
+	233, 234, 235, 236, 232, 233, 234, 248, 249, 245, 246, 247, 248, 249, 2, 3,
+	4, 5, 6, 2, 3, 17, 18, 19, 15, 16, 17, 18, 32, 28, 29, 30,
+	31, 32, 28, 42, 43, 44, 45, 41, 42, 43, 57, 58, 54, 55, 56, 57,
+	58, 67, 68, 69, 70, 71, 67, 68, 82, 83, 84, 80, 81, 82, 83, 97,
+	93, 94, 95, 96, 97, 93, 107, 108, 0, 7, 14, 21, 28, 35, 42, 49,
+	56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161,
+	168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17,
+	24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129,
+	136, 143, 150, 157, 164, 171, 178, 185, 225, 226, 227, 223, 237, 238, 239, 240,
+	236, 237, 238, 252, 253, 249, 250, 251, 252, 253, 6, 7, 8, 9, 10, 6,
+	7, 21, 22, 23, 19, 20, 21, 22, 36, 32, 33, 34, 35, 36, 32, 46,
+	47, 48, 49, 45, 46, 47, 61, 62, 58, 59, 60, 61, 62, 71, 72, 73,
+	74, 75, 71, 72, 86, 87, 88, 84, 85, 86, 87, 101, 97, 98, 99, 100,
+	101, 97, 111, 112, 113, 114, 110, 111, 112, 126, 127, 123, 124, 125, 126, 127,
+	136, 137, 138, 139, 140, 136, 137, 151, 152, 153, 149, 150, 151, 152, 166, 162,
+	163, 164, 165, 166, 162, 176, 177, 178, 179, 175, 176, 177, 191, 192, 188, 189,
+	190, 191, 192, 201, 202, 203, 204, 205, 64, 71, 78, 85, 92, 99, 106, 113,
+	120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225,
+	232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81,
+	88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193,
+	200, 207, 214, 221, 228, 235, 242, 249, 66, 75, 76, 77, 78, 79, 75, 76,
+	90, 91, 92, 88, 89, 90, 91, 105, 101, 102, 103, 104, 105, 101, 115, 116,
+	117, 118, 114, 115, 116, 130, 131, 127, 128, 129, 130, 131, 140, 141, 142, 143,
+	144, 140, 141, 155, 156, 157, 153, 154, 155, 156, 170, 166, 167, 168, 169, 170,
+	166, 180, 181, 182, 183, 179, 180, 181, 195, 196, 192, 193, 194, 195, 196, 205,
+	206, 207, 208, 209, 205, 206, 220, 221, 222, 218, 219, 220, 221, 235, 231, 232,
+	233, 234, 235, 231, 245, 246, 247, 248, 244, 245, 246, 4, 5, 1, 2, 3,
+	4, 5, 14, 15, 16, 17, 18, 14, 15, 29, 30, 31, 27, 28, 29, 30,
+	44, 40, 41, 42, 43, 44, 40, 54, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 171, 172, 173, 174, 170, 184, 185, 186,
+	187, 183, 184, 185, 199, 200, 196, 197, 198, 199, 200, 209, 210, 211, 212, 213,
+	209, 210, 224, 225, 226, 222, 223, 224, 225, 239, 235, 236, 237, 238, 239, 235,
+	249, 250, 251, 252, 248, 249, 250, 8, 9, 5, 6, 7, 8, 9, 18, 19,
+	20, 21, 22, 18, 19, 33, 34, 35, 38, 3, 24, 253, 57, 0, 7, 14,
+	21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126,
+	133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238,
+	245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94,
+	101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118,
+	119, 120, 121, 130, 131, 132, 133, 134, 248, 34, 145, 146, 147, 143, 144, 248,
+	160, 156, 157, 158, 159, 248, 34, 170, 171, 172, 173, 169, 248, 185, 186, 182,
+	183, 184, 248, 34, 195, 196, 197, 198, 199, 248, 210, 211, 212, 208, 209, 248,
+	34, 225, 221, 222, 223, 224, 248, 235, 236, 237, 238, 234, 248, 34, 250, 251,
+	247, 248, 249, 248, 4, 5, 6, 7, 8, 248, 34, 19, 20, 21, 17, 18,
+	248, 34, 30, 31, 32, 33, 248, 34, 44, 45, 46, 47, 43, 248, 59, 60,
+	56, 57, 58, 248, 34, 69, 70, 71, 72, 73, 248, 84, 85, 86, 82, 83,
+	248, 242, 57, 99, 95, 96, 64, 71, 78, 85, 92, 99, 106, 113, 120, 127,
+	134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225, 232, 239,
+	246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81, 88, 95,
+	102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193, 200, 207,
+	214, 221, 228, 235, 242, 249, 213, 214, 215, 229, 225, 226, 227, 228, 248, 239,
+	240, 241, 242, 238, 248, 34, 254, 255, 251, 252, 253, 248, 8, 9, 10, 11,
+	12, 248, 34, 23, 24, 25, 21, 22, 248, 38, 34, 35, 36, 37, 248, 34,
+	48, 49, 50, 51, 47, 248, 63, 64, 60, 61, 62, 248, 34, 73, 74, 75,
+	76, 77, 248, 88, 89, 90, 86, 87, 248, 34, 103, 99, 100, 101, 102, 248,
+	113, 114, 115, 116, 112, 248, 34, 128, 129, 125, 126, 127, 248, 138, 139, 140,
+	141, 142, 248, 34, 153, 154, 155, 151, 152, 248, 168, 164, 165, 166, 167, 248,
+	47, 178, 179, 180, 181, 177, 248, 57, 193, 194, 190, 191, 192, 193, 128, 135,
+	142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233, 240, 247,
+	254, 5, 12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89, 96, 103,
+	110, 117, 124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201, 208, 215,
+	222, 229, 236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57, 67, 68,
+	64, 65, 66, 248, 34, 77, 78, 79, 80, 81, 248, 92, 93, 94, 90, 91,
+	248, 45, 107, 103, 104, 105, 106, 98, 101, 8, 116, 122, 13, 132, 133, 129,
+	96, 106, 142, 101, 0, 97, 101, 105, 155, 96, 113, 172, 168, 101, 0, 221,
+	98, 101, 8, 181, 122, 13, 197, 198, 194, 96, 106, 207, 101, 0, 97, 101,
+	105, 220, 96, 113, 237, 233, 101, 0, 221, 98, 101, 8, 246, 122, 13, 6,
+	7, 3, 96, 106, 16, 101, 0, 97, 101, 105, 29, 96, 24, 253, 57, 46,
+	42, 192, 199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34,
+	41, 48, 55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146,
+	153, 160, 167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2,
+	9, 16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114,
+	121, 159, 160, 161, 162, 176, 172, 173, 174, 175, 248, 34, 186, 187, 188, 189,
+	185, 248, 201, 202, 198, 199, 200, 113, 211, 212, 101, 0, 221, 97, 101, 105,
+	224, 96, 113, 241, 237, 101, 0, 98, 101, 8, 250, 208, 122, 10, 11, 7,
+	96, 106, 20, 101, 0, 221, 97, 101, 105, 33, 96, 113, 50, 46, 101, 0,
+	98, 101, 8, 59, 208, 122, 75, 76, 72, 96, 106, 85, 101, 0, 221, 97,
+	101, 105, 98, 96, 113, 115, 111, 101, 0, 98, 101, 8, 124, 210, 159, 140,
+	141, 137, 138, 139, 255, 0, 40, 24, 61, 0, 14, 15, 11, 12, 13, 248,
+	34, 24, 25, 26, 27, 28, 248, 39, 40, 41, 37, 38, 248, 45, 54, 50,
+	51, 52, 53, 98, 101, 8, 63, 122, 13, 79, 80, 76, 96, 106, 89, 101,
+	0, 97, 101, 105, 102, 96, 113, 119, 115, 101, 0, 221, 98, 101, 8, 128,
+	122, 13, 144, 145, 141, 96, 106, 154, 101, 0, 97, 101, 105, 167, 96, 113,
+	184, 180, 101, 0, 221, 98, 101, 8, 193, 122, 13, 209, 210, 206, 96, 106,
+	219, 101, 0, 97, 101, 105, 232, 96, 143, 249, 255, 0, 40, 231, 240, 232,
+	219, 1, 185, 63, 110, 106, 107, 108, 109, 123, 61, 8, 122, 209, 185, 133,
+	134, 135, 136, 253, 56, 241, 148, 149, 0, 106, 158, 101, 0, 223, 97, 101,
+	161, 56, 177, 174, 188, 253, 61, 8, 187, 98, 101, 161, 253, 56, 241, 213,
+	214, 0, 106, 223, 101, 0, 223, 97, 101, 161, 56, 177, 239, 253, 253, 61,
+	8, 252, 98, 101, 161, 253, 56, 241, 22, 23, 0, 106, 32, 101, 0, 223,
+	97, 101, 161, 56, 177, 48, 62, 253, 61, 8, 61, 98, 101, 161, 255, 56,
+	240, 87, 88, 135, 0, 244, 40, 24, 202, 203, 217, 218, 214, 215, 216, 223,
+	161, 61, 16, 230, 231, 208, 185, 242, 243, 244, 255, 56, 177, 243, 1, 61,
+	8, 0, 223, 98, 101, 161, 56, 241, 26, 27, 0, 221, 106, 36, 101, 0,
+	97, 101, 161, 255, 56, 177, 52, 66, 61, 8, 65, 223, 98, 101, 161, 56,
+	241, 91, 92, 0, 221, 106, 101, 101, 0, 97, 101, 161, 255, 56, 177, 117,
+	131, 61, 8, 130, 223, 98, 101, 161, 56, 241, 156, 157, 0, 221, 106, 166,
+	101, 0, 97, 101, 161, 255, 56, 143, 182, 0, 244, 40, 185, 56, 57, 53,
+	54, 55, 56, 70, 253, 61, 8, 69, 185, 31, 80, 81, 82, 83, 56, 241,
+	95, 96, 0, 221, 106, 105, 101, 0, 97, 101, 162, 239, 157, 234, 135, 234,
+	135, 234, 148, 234, 161, 234, 161, 234, 174, 234, 187, 234, 200, 234, 200, 234,
+	213, 234, 226, 234, 226, 234, 239, 234, 252, 234, 9, 234, 9, 234, 22, 151,
+	35, 31, 0, 245, 40, 24, 148, 149, 150, 164, 165, 161, 162, 163, 223, 161,
+	61, 16, 177, 178, 208, 185, 189, 190, 191, 255, 56, 177, 190, 204, 61, 8,
+	203, 222, 98, 101, 162, 157, 234, 230, 234, 230, 234, 243, 234, 0, 234, 13,
+	234, 13, 234, 26, 234, 39, 234, 39, 234, 52, 234, 65, 234, 78, 234, 78,
+	234, 91, 234, 104, 234, 104, 234, 117, 233, 130, 135, 255, 0, 40, 24, 45,
+	2, 3, 4, 0, 1, 169, 17, 253, 61, 8, 16, 185, 31, 27, 28, 29,
+	30, 56, 241, 42, 43, 0, 221, 106, 52, 101, 0, 97, 101, 162, 237, 157,
+	234, 82, 234, 82, 234, 95, 234, 108, 234, 108, 234, 121, 234, 134, 131, 2,
+	0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234,
+	199, 131, 2, 0, 221, 131, 2, 0, 223, 151, 237, 238, 0, 253, 40, 161,
+	253, 24, 61, 97, 111, 112, 108, 109, 110, 161, 253, 61, 16, 124, 125, 185,
+	15, 136, 137, 138, 56, 177, 137, 151, 253, 61, 8, 150, 98, 101, 162, 239,
+	157, 234, 177, 234, 177, 234, 190, 234, 203, 233, 216, 231, 232, 165, 1, 8,
+	215, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234,
+	12, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162,
+	237, 157, 129, 2, 135, 255, 0, 40, 24, 61, 191, 205, 206, 207, 203, 204,
+	169, 220, 253, 61, 8, 219, 185, 31, 230, 231, 232, 233, 56, 241, 245, 246,
+	0, 221, 106, 255, 101, 0, 97, 101, 162, 237, 157, 234, 29, 234, 29, 234,
+	42, 234, 55, 234, 55, 234, 68, 234, 81, 131, 2, 0, 221, 131, 2, 0,
+	221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 146, 131, 2, 0, 221,
+	131, 2, 0, 223, 143, 184, 0, 245, 40, 154, 45, 46, 42, 43, 44, 58,
+	59, 55, 205, 98, 234, 68, 0, 129, 207, 103, 161, 56, 177, 84, 98, 253,
+	61, 8, 97, 98, 101, 162, 237, 157, 234, 124, 234, 124, 234, 137, 234, 150,
+	234, 163, 234, 163, 234, 176, 234, 189, 234, 189, 234, 202, 234, 215, 131, 2,
+	0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 239, 157, 151,
+	24, 20, 0, 252, 40, 145, 137, 138, 103, 137, 150, 207, 98, 242, 167, 163,
+	241, 163, 177, 161, 56, 241, 192, 193, 0, 222, 106, 202, 101, 162, 157, 234,
+	219, 234, 232, 234, 232, 234, 245, 234, 2, 234, 2, 234, 15, 234, 28, 131,
+	221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157,
+	234, 93, 131, 221, 2, 0, 131, 221, 2, 0, 135, 255, 0, 40, 129, 192,
+	98, 232, 245, 250, 5, 6, 2, 234, 15, 0, 220, 129, 103, 161, 255, 56,
+	177, 31, 45, 61, 8, 44, 222, 98, 101, 162, 157, 234, 71, 234, 71, 234,
+	84, 234, 97, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131,
+	222, 2, 162, 157, 234, 162, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221,
+	2, 0, 131, 222, 2, 162, 157, 143, 227, 255, 0, 40, 161, 220, 253, 129,
+	103, 137, 97, 207, 98, 242, 114, 110, 241, 110, 124, 161, 56, 241, 139, 140,
+	0, 222, 106, 149, 101, 162, 157, 234, 166, 234, 179, 234, 179, 234, 192, 234,
+	205, 234, 205, 234, 218, 234, 231, 131, 221, 2, 0, 131, 221, 2, 0, 131,
+	221, 2, 0, 131, 222, 2, 162, 157, 234, 40, 131, 221, 2, 0, 131, 223,
+	2, 239, 63, 232, 109, 1, 135, 255, 0, 40, 129, 205, 103, 16, 196, 192,
+	177, 208, 209, 253, 56, 0, 161, 253, 61, 16, 221, 222, 129, 207, 103, 161,
+	56, 177, 234, 248, 253, 61, 8, 247, 98, 101, 162, 237, 157, 234, 18, 234,
+	18, 234, 31, 234, 44, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0,
+	221, 131, 2, 162, 237, 157, 234, 109, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 162, 239, 157, 135, 0, 253, 40, 161, 253, 137,
+	32, 202, 103, 130, 154, 138, 61, 173, 159, 0, 129, 207, 103, 169, 74, 56,
+	241, 86, 87, 0, 222, 106, 96, 101, 162, 157, 234, 113, 234, 126, 234, 126,
+	234, 139, 234, 152, 234, 152, 234, 165, 234, 178, 131, 221, 2, 0, 131, 221,
+	2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 234, 243, 131, 221, 2,
+	0, 131, 223, 2, 135, 0, 251, 40, 129, 58, 145, 142, 143, 160, 154, 249,
+	155, 156, 152, 138, 156, 173, 159, 8, 169, 129, 202, 103, 130, 154, 169, 195,
+	253, 61, 8, 194, 98, 101, 162, 237, 157, 234, 221, 234, 221, 234, 234, 234,
+	247, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162,
+	237, 157, 234, 56, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 0, 223, 143, 119, 0, 249, 40, 131, 255, 236, 249, 236, 8, 236,
+	18, 236, 33, 236, 43, 236, 58, 236, 73, 236, 83, 233, 98, 97, 96, 131,
+	222, 2, 162, 157, 234, 125, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221,
+	2, 0, 131, 222, 2, 162, 157, 234, 190, 131, 221, 2, 0, 98, 101, 135,
+	255, 0, 40, 137, 77, 185, 58, 131, 255, 236, 102, 236, 112, 236, 127, 236,
+	142, 236, 152, 236, 167, 236, 177, 236, 192, 131, 221, 2, 0, 131, 221, 2,
+	0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 234, 3, 131, 221, 2, 0,
+	131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 135, 255, 0, 40,
+	231, 240, 232, 66, 1, 132, 157, 255, 236, 196, 236, 211, 236, 221, 236, 236,
+	236, 246, 236, 5, 236, 20, 236, 30, 131, 2, 0, 221, 131, 2, 162, 237,
+	157, 234, 72, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131,
+	2, 162, 237, 157, 234, 137, 131, 2, 0, 223, 97, 101, 135, 0, 253, 40,
+	161, 253, 140, 34, 157, 255, 236, 49, 236, 59, 236, 74, 236, 89, 236, 99,
+	236, 114, 236, 124, 235, 139, 139, 140, 2, 0, 221, 131, 2, 0, 221, 131,
+	2, 0, 221, 131, 2, 162, 237, 157, 234, 206, 131, 2, 0, 221, 131, 2,
+	0, 221, 131, 2, 0, 221, 131, 2, 143, 254, 255, 0, 40, 140, 128, 157,
+	255, 236, 143, 236, 158, 236, 168, 236, 183, 236, 193, 236, 208, 236, 223, 236,
+	233, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 19, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 84, 131,
+	2, 0, 223, 151, 107, 108, 0, 249, 40, 130, 255, 236, 237, 236, 252, 236,
+	6, 236, 21, 236, 36, 236, 46, 236, 61, 236, 71, 234, 86, 0, 221, 131,
+	2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157,
+	234, 153, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2,
+	135, 255, 0, 40, 148, 66, 75, 157, 255, 236, 90, 236, 105, 236, 115, 236,
+	130, 236, 140, 236, 155, 236, 170, 236, 180, 131, 2, 0, 221, 131, 2, 162,
+	237, 157, 234, 222, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 162, 237, 157, 234, 31, 131, 2, 0, 223, 143, 54, 0, 249, 40,
+	131, 255, 236, 184, 236, 199, 236, 209, 236, 224, 236, 239, 236, 249, 236, 8,
+	236, 18, 97, 101, 231, 240, 232, 19, 1, 162, 237, 157, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 100, 131,
+	2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 222, 162, 157, 135, 255, 0,
+	40, 156, 9, 12, 13, 22, 255, 236, 37, 236, 52, 236, 62, 236, 77, 236,
+	87, 236, 102, 236, 117, 236, 127, 131, 221, 2, 0, 131, 222, 2, 162, 157,
+	234, 169, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222,
+	2, 162, 157, 234, 234, 131, 221, 2, 0, 135, 255, 0, 40, 132, 150, 255,
+	236, 131, 236, 146, 236, 156, 236, 171, 236, 186, 236, 196, 236, 211, 236, 221,
+	132, 1, 236, 237, 236, 247, 236, 6, 236, 21, 236, 31, 236, 46, 236, 56,
+	236, 71, 232, 86, 143, 97, 255, 0, 40, 161, 214, 253, 132, 1, 236, 226,
+	236, 241, 236, 251, 236, 10, 236, 25, 236, 35, 236, 50, 236, 60, 236, 75,
+	236, 90, 236, 100, 236, 115, 236, 125, 236, 140, 236, 155, 236, 165, 235, 180,
+	143, 194, 255, 0, 40, 132, 96, 1, 236, 64, 236, 79, 236, 94, 236, 104,
+	236, 119, 236, 129, 236, 144, 236, 159, 236, 169, 236, 184, 236, 194, 236, 209,
+	236, 224, 236, 234, 236, 249, 236, 3, 236, 18, 159, 33, 42, 43, 255, 0,
+	40, 130, 198, 98, 132, 1, 236, 173, 236, 188, 236, 198, 236, 213, 236, 228,
+	236, 238, 236, 253, 236, 7, 236, 22, 236, 37, 236, 47, 236, 62, 236, 72,
+	236, 87, 236, 102, 236, 112, 234, 127, 239, 140, 240, 232, 226, 0, 135, 255,
+	0, 40, 140, 1, 111, 1, 236, 11, 236, 26, 236, 41, 236, 51, 236, 66,
+	236, 76, 236, 91, 236, 106, 236, 116, 236, 131, 236, 141, 236, 156, 236, 171,
+	236, 181, 236, 196, 236, 206, 236, 221, 151, 236, 245, 0, 249, 40, 131, 255,
+	236, 119, 236, 134, 236, 149, 236, 159, 236, 174, 236, 184, 236, 199, 236, 214,
+	132, 111, 1, 236, 225, 236, 240, 236, 250, 236, 9, 236, 19, 236, 34, 236,
+	49, 236, 59, 233, 74, 143, 86, 0, 246, 40, 148, 203, 204, 1, 236, 214,
+	236, 229, 236, 244, 236, 254, 236, 13, 236, 23, 236, 38, 236, 53, 236, 63,
+	236, 78, 236, 88, 236, 103, 236, 118, 236, 128, 236, 143, 236, 153, 236, 168,
+	143, 183, 255, 0, 40, 132, 150, 255, 236, 66, 236, 81, 236, 96, 236, 106,
+	236, 121, 236, 131, 236, 146, 236, 161, 132, 1, 236, 172, 236, 187, 236, 197,
+	236, 212, 236, 222, 236, 237, 236, 252, 236, 6, 232, 21, 143, 32, 255, 0,
+	40, 161, 214, 253, 132, 1, 236, 161, 236, 176, 236, 191, 236, 201, 236, 216,
+	236, 226, 236, 241, 236, 0, 236, 10, 236, 25, 236, 35, 236, 50, 236, 65,
+	236, 75, 236, 90, 236, 100, 235, 115, 143, 129, 255, 0, 40, 231, 240, 232,
+	243, 0, 132, 96, 1, 236, 4, 236, 14, 236, 29, 236, 39, 236, 54, 236,
+	69, 236, 79, 236, 94, 236, 104, 236, 119, 236, 134, 236, 144, 236, 159, 236,
+	169, 236, 184, 236, 199, 236, 209, 159, 224, 238, 234, 255, 0, 40, 130, 166,
+	154, 132, 1, 236, 108, 236, 123, 236, 138, 236, 148, 236, 163, 236, 173, 236,
+	188, 236, 203, 236, 213, 236, 228, 236, 238, 236, 253, 236, 12, 236, 22, 236,
+	37, 236, 47, 234, 62, 143, 75, 255, 0, 40, 140, 192, 111, 1, 236, 207,
+	236, 217, 236, 232, 236, 242, 236, 1, 236, 16, 236, 26, 236, 41, 236, 51,
+	236, 66, 236, 81, 236, 91, 236, 106, 236, 116, 236, 131, 236, 146, 236, 156,
+	151, 171, 185, 0, 249, 40, 131, 255, 236, 59, 236, 69, 236, 84, 236, 94,
+	236, 109, 236, 124, 236, 134, 236, 149, 132, 111, 1, 236, 160, 236, 175, 236,
+	185, 236, 200, 236, 215, 236, 225, 236, 240, 236, 250, 233, 9, 143, 21, 0,
+	242, 40, 162, 99, 131, 150, 255, 236, 163, 236, 178, 236, 193, 236, 203, 236,
+	218, 236, 228, 236, 243, 236, 2, 132, 1, 236, 13, 236, 28, 236, 38, 236,
+	53, 236, 63, 236, 78, 236, 93, 236, 103, 143, 118, 255, 0, 40, 132, 159,
+	255, 236, 6, 236, 16, 236, 31, 236, 41, 236, 56, 236, 71, 236, 81, 236,
+	96, 247, 106, 107, 232, 231, 0, 130, 100, 1, 236, 107, 236, 122, 236, 132,
+	236, 147, 236, 162, 236, 172, 236, 187, 236, 197, 129, 198, 143, 223, 255, 0,
+	40, 161, 214, 253, 132, 1, 236, 101, 236, 111, 236, 126, 236, 136, 236, 151,
+	236, 166, 236, 176, 236, 191, 236, 201, 236, 216, 236, 231, 236, 241, 236, 0,
+	236, 10, 236, 25, 236, 40, 235, 50, 143, 64, 255, 0, 40, 132, 100, 1,
+	236, 195, 236, 205, 236, 220, 236, 235, 236, 245, 236, 4, 236, 14, 236, 29,
+	236, 44, 236, 54, 236, 69, 236, 79, 236, 94, 236, 109, 236, 119, 236, 134,
+	236, 144, 129, 198, 135, 255, 0, 40, 130, 150, 255, 236, 47, 236, 57, 236,
+	72, 236, 87, 236, 97, 236, 112, 236, 122, 236, 137, 132, 1, 236, 148, 236,
+	163, 236, 178, 236, 188, 236, 203, 236, 213, 236, 228, 236, 243, 234, 253, 143,
+	10, 255, 0, 40, 140, 127, 111, 1, 236, 142, 236, 152, 236, 167, 236, 182,
+	236, 192, 236, 207, 236, 217, 236, 232, 236, 247, 236, 1, 236, 16, 236, 26,
+	236, 41, 236, 56, 236, 66, 236, 81, 236, 91, 151, 106, 120, 0, 255, 40,
+	199, 221, 0, 40, 97, 96, 140, 95, 98, 1, 236, 110, 236, 125, 236, 135,
+	236, 150, 236, 160, 236, 175, 236, 190, 162, 99, 239, 212, 240, 232, 156, 0,
+	135, 255, 0, 40, 199, 221, 0, 246, 40, 140, 194, 1, 236, 204, 236, 219,
+	236, 229, 236, 244, 236, 3, 236, 13, 236, 28, 236, 38, 143, 53, 255, 0,
+	40, 199, 221, 0, 249, 40, 162, 100, 140, 42, 98, 1, 236, 57, 236, 72,
+	236, 82, 236, 97, 236, 107, 236, 122, 236, 137, 162, 99, 135, 255, 0, 40,
+	199, 221, 0, 253, 40, 0, 132, 111, 1, 236, 151, 236, 166, 236, 176, 236,
+	191, 236, 206, 236, 216, 236, 231, 235, 241, 143, 255, 0, 255, 40, 199, 221,
+	0, 40, 131, 110, 1, 236, 245, 236, 4, 236, 19, 236, 29, 236, 44, 236,
+	54, 236, 69, 236, 84, 161, 157, 135, 255, 0, 40, 199, 221, 0, 246, 40,
+	97, 96, 132, 1, 236, 98, 236, 113, 236, 123, 236, 138, 236, 153, 236, 163,
+	236, 178, 234, 188, 143, 201, 255, 0, 40, 231, 240, 232, 156, 0, 199, 221,
+	0, 246, 40, 132, 1, 236, 192, 236, 207, 236, 222, 236, 232, 236, 247, 236,
+	1, 236, 16, 236, 31, 151, 41, 55, 255, 0, 40, 199, 221, 0, 246, 40,
+	98, 96, 132, 1, 236, 45, 236, 60, 236, 70, 236, 85, 236, 100, 236, 110,
+	236, 125, 162, 239, 157, 143, 152, 0, 255, 40, 199, 221, 0, 40, 140, 129,
+	111, 1, 236, 139, 236, 154, 236, 169, 236, 179, 236, 194, 236, 204, 236, 219,
+	236, 234, 143, 244, 0, 255, 40, 199, 221, 0, 40, 162, 230, 157, 140, 238,
+	1, 236, 248, 236, 7, 236, 17, 236, 32, 236, 47, 236, 57, 236, 72, 162,
+	239, 157, 135, 0, 255, 40, 199, 221, 0, 40, 0, 214, 132, 1, 236, 86,
+	236, 101, 236, 116, 236, 126, 236, 141, 236, 151, 236, 166, 235, 181, 143, 190,
+	255, 0, 40, 199, 221, 0, 255, 40, 231, 232, 172, 0, 131, 110, 1, 236,
+	185, 236, 195, 236, 210, 236, 220, 236, 235, 236, 250, 236, 4, 236, 19, 161,
+	157, 135, 255, 0, 40, 199, 221, 0, 246, 40, 97, 96, 132, 1, 236, 33,
+	236, 48, 236, 63, 236, 73, 236, 88, 236, 98, 236, 113, 234, 128, 143, 141,
+	255, 0, 40, 199, 221, 0, 246, 40, 132, 1, 236, 132, 236, 142, 236, 157,
+	236, 167, 236, 182, 236, 197, 236, 207, 236, 222, 151, 232, 246, 255, 0, 40,
+	199, 221, 0, 254, 40, 162, 157, 132, 111, 1, 236, 236, 236, 251, 236, 10,
+	236, 20, 236, 35, 236, 45, 236, 60, 233, 75, 143, 87, 0, 255, 40, 199,
+	221, 0, 40, 140, 64, 111, 1, 236, 79, 236, 89, 236, 104, 236, 114, 236,
+	129, 236, 144, 236, 154, 236, 169, 143, 179, 0, 255, 40, 199, 221, 0, 40,
+	130, 111, 1, 236, 173, 236, 183, 236, 198, 236, 213, 236, 223, 236, 238, 236,
+	248, 236, 7, 232, 22, 239, 33, 232, 157, 0, 135, 255, 0, 40, 199, 221,
+	0, 253, 40, 0, 132, 111, 1, 236, 26, 236, 36, 236, 51, 236, 61, 236,
+	76, 236, 91, 236, 101, 235, 116, 143, 130, 0, 255, 40, 199, 221, 0, 40,
+	131, 96, 1, 236, 120, 236, 130, 236, 145, 236, 160, 236, 170, 236, 185, 236,
+	195, 236, 210, 159, 225, 234, 235, 255, 0, 40, 199, 221, 0, 254, 40, 162,
+	157, 196, 206, 255, 236, 238, 236, 253, 236, 12, 236, 22, 236, 37, 236, 47,
+	236, 62, 131, 223, 2, 135, 0, 255, 40, 199, 221, 0, 40, 132, 111, 1,
+	236, 67, 236, 77, 236, 92, 236, 107, 236, 117, 236, 132, 236, 142, 236, 157,
+	151, 172, 181, 0, 255, 40, 199, 221, 0, 40, 194, 213, 253, 132, 111, 1,
+	236, 176, 236, 186, 236, 201, 236, 211, 236, 226, 236, 241, 236, 251, 233, 10,
+	143, 22, 0, 255, 40, 231, 232, 158, 0, 199, 221, 0, 246, 40, 140, 255,
+	1, 236, 14, 236, 24, 236, 39, 236, 54, 236, 64, 236, 79, 236, 89, 236,
+	104, 143, 119, 255, 0, 40, 199, 221, 0, 246, 40, 130, 1, 236, 108, 236,
+	123, 236, 133, 236, 148, 236, 158, 236, 173, 236, 188, 236, 198, 232, 213, 143,
+	224, 255, 0, 40, 199, 221, 0, 254, 40, 162, 157, 131, 38, 254, 132, 1,
+	236, 227, 236, 242, 236, 1, 236, 11, 236, 26, 236, 36, 235, 51, 143, 65,
+	255, 0, 40, 199, 221, 0, 246, 40, 131, 1, 236, 55, 236, 70, 236, 80,
+	236, 95, 236, 105, 236, 120, 236, 135, 236, 145, 159, 15, 160, 174, 170, 0,
+	255, 40, 199, 221, 0, 40, 161, 102, 252, 132, 1, 236, 164, 236, 174, 236,
+	189, 236, 204, 236, 214, 236, 229, 236, 239, 234, 254, 143, 11, 255, 0, 40,
+	199, 221, 0, 255, 40, 231, 232, 173, 0, 132, 111, 1, 236, 2, 236, 17,
+	236, 27, 236, 42, 236, 52, 236, 67, 236, 82, 236, 92, 151, 107, 121, 0,
+	255, 40, 199, 221, 0, 40, 194, 213, 253, 132, 111, 1, 236, 111, 236, 121,
+	236, 136, 236, 151, 236, 161, 236, 176, 236, 186, 233, 201, 143, 213, 0, 255,
+	40, 199, 221, 0, 40, 140, 190, 111, 1, 236, 205, 236, 220, 236, 230, 236,
+	245, 236, 255, 236, 14, 236, 29, 236, 39, 143, 54, 0, 255, 40, 199, 221,
+	0, 40, 130, 100, 1, 236, 43, 236, 58, 236, 68, 236, 83, 236, 98, 236,
+	108, 236, 123, 236, 133, 129, 198, 143, 159, 255, 0, 40, 199, 221, 0, 253,
+	40, 0, 132, 111, 1, 236, 152, 236, 167, 236, 177, 236, 192, 236, 202, 236,
+	217, 236, 232, 235, 242, 143, 0, 0, 255, 40, 199, 221, 0, 40, 131, 100,
+	1, 236, 246, 236, 5, 236, 15, 236, 30, 236, 45, 236, 55, 236, 70, 236,
+	80, 129, 198, 231, 240, 232, 122, 0, 135, 255, 0, 40, 199, 221, 0, 246,
+	40, 161, 252, 132, 111, 1, 236, 99, 236, 114, 236, 124, 236, 139, 236, 149,
+	236, 164, 236, 179, 234, 189, 143, 202, 0, 255, 40, 199, 221, 0, 41, 196,
+	206, 255, 236, 207, 236, 222, 236, 232, 236, 247, 236, 1, 236, 16, 236, 31,
+	236, 41, 143, 56, 255, 0, 40, 199, 221, 0, 246, 40, 97, 96, 140, 31,
+	1, 236, 46, 236, 61, 236, 71, 236, 86, 236, 96, 236, 111, 236, 126, 162,
+	47, 99, 143, 148, 0, 255, 40, 199, 221, 0, 40, 140, 130, 111, 1, 236,
+	140, 236, 155, 236, 165, 236, 180, 236, 195, 236, 205, 236, 220, 236, 230, 239,
+	245, 232, 38, 3, 24, 253, 57, 0, 7, 14, 21, 28, 35, 42, 49, 56,
+	63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161, 168,
+	175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17, 24,
+	31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129, 136,
+	143, 150, 157, 164, 171, 178, 185, 121, 117, 118, 119, 120, 121, 130, 131, 132,
+	133, 134, 248, 34, 145, 146, 147, 143, 144, 248, 160, 156, 157, 158, 159, 248,
+	34, 170, 171, 172, 173, 169, 248, 185, 186, 182, 183, 184, 248, 34, 195, 196,
+	197, 198, 199, 248, 210, 211, 212, 208, 209, 248, 34, 225, 221, 222, 223, 224,
+	248, 235, 236, 237, 238, 234, 248, 34, 250, 251, 247, 248, 249, 248, 4, 5,
+	6, 7, 8, 248, 34, 19, 20, 21, 17, 18, 248, 34, 30, 31, 32, 33,
+	248, 34, 44, 45, 46, 47, 43, 248, 59, 60, 56, 57, 58, 248, 34, 69,
+	70, 71, 72, 73, 248, 84, 85, 86, 82, 83, 248, 242, 57, 99, 95, 96,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	213, 214, 215, 229, 225, 226, 227, 228, 248, 239, 240, 241, 242, 238, 248, 34,
+	254, 255, 251, 252, 253, 248, 8, 9, 10, 11, 12, 248, 34, 23, 24, 25,
+	21, 22, 248, 38, 34, 35, 36, 37, 248, 34, 48, 49, 50, 51, 47, 248,
+	63, 64, 60, 61, 62, 248, 34, 73, 74, 75, 76, 77, 248, 88, 89, 90,
+	86, 87, 248, 34, 103, 99, 100, 101, 102, 248, 113, 114, 115, 116, 112, 248,
+	34, 128, 129, 125, 126, 127, 248, 138, 139, 140, 141, 142, 248, 34, 153, 154,
+	155, 151, 152, 248, 168, 164, 165, 166, 167, 248, 47, 178, 179, 180, 181, 177,
+	248, 57, 193, 194, 190, 191, 192, 193, 128, 135, 142, 149, 156, 163, 170, 177,
+	184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33,
+	40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145,
+	152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1,
+	8, 15, 22, 29, 36, 43, 50, 57, 67, 68, 64, 65, 66, 248, 34, 77,
+	78, 79, 80, 81, 248, 92, 93, 94, 90, 91, 248, 45, 107, 103, 104, 105,
+	106, 98, 101, 8, 116, 122, 13, 132, 133, 129, 96, 106, 142, 101, 0, 97,
+	101, 105, 155, 96, 113, 172, 168, 101, 0, 221, 98, 101, 8, 181, 122, 13,
+	197, 198, 194, 96, 106, 207, 101, 0, 97, 101, 105, 220, 96, 113, 237, 233,
+	101, 0, 221, 98, 101, 8, 246, 122, 13, 6, 7, 3, 96, 106, 16, 101,
+	0, 97, 101, 105, 29, 96, 24, 253, 57, 46, 42, 192, 199, 206, 213, 220,
+	227, 234, 241, 248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76,
+	83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188,
+	195, 202, 209, 216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44,
+	51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121, 159, 160, 161, 162, 176,
+	172, 173, 174, 175, 248, 34, 186, 187, 188, 189, 185, 248, 201, 202, 198, 199,
+	200, 113, 211, 212, 101, 0, 221, 97, 101, 105, 224, 96, 113, 241, 237, 101,
+	0, 98, 101, 8, 250, 208, 122, 10, 11, 7, 96, 106, 20, 101, 0, 221,
+	97, 101, 105, 33, 96, 113, 50, 46, 101, 0, 98, 101, 8, 59, 208, 122,
+	75, 76, 72, 96, 106, 85, 101, 0, 221, 97, 101, 105, 98, 96, 113, 115,
+	111, 101, 0, 98, 101, 8, 124, 210, 159, 140, 141, 137, 138, 139, 255, 0,
+	40, 24, 61, 0, 14, 15, 11, 12, 13, 248, 34, 24, 25, 26, 27, 28,
+	248, 39, 40, 41, 37, 38, 248, 45, 54, 50, 51, 52, 53, 98, 101, 8,
+	63, 122, 13, 79, 80, 76, 96, 106, 89, 101, 0, 97, 101, 105, 102, 96,
+	113, 119, 115, 101, 0, 221, 98, 101, 8, 128, 122, 13, 144, 145, 141, 96,
+	106, 154, 101, 0, 97, 101, 105, 167, 96, 113, 184, 180, 101, 0, 221, 98,
+	101, 8, 193, 122, 13, 209, 210, 206, 96, 106, 219, 101, 0, 97, 101, 105,
+	232, 96, 143, 249, 255, 0, 40, 231, 240, 232, 219, 1, 185, 63, 110, 106,
+	107, 108, 109, 123, 61, 8, 122, 209, 185, 133, 134, 135, 136, 253, 56, 241,
+	148, 149, 0, 106, 158, 101, 0, 223, 97, 101, 161, 56, 177, 174, 188, 253,
+	61, 8, 187, 98, 101, 161, 253, 56, 241, 213, 214, 0, 106, 223, 101, 0,
+	223, 97, 101, 161, 56, 177, 239, 253, 253, 61, 8, 252, 98, 101, 161, 253,
+	56, 241, 22, 23, 0, 106, 32, 101, 0, 223, 97, 101, 161, 56, 177, 48,
+	62, 253, 61, 8, 61, 98, 101, 161, 255, 56, 240, 87, 88, 135, 0, 244,
+	40, 24, 202, 203, 217, 218, 214, 215, 216, 223, 161, 61, 16, 230, 231, 208,
+	185, 242, 243, 244, 255, 56, 177, 243, 1, 61, 8, 0, 223, 98, 101, 161,
+	56, 241, 26, 27, 0, 221, 106, 36, 101, 0, 97, 101, 161, 255, 56, 177,
+	52, 66, 61, 8, 65, 223, 98, 101, 161, 56, 241, 91, 92, 0, 221, 106,
+	101, 101, 0, 97, 101, 161, 255, 56, 177, 117, 131, 61, 8, 130, 223, 98,
+	101, 161, 56, 241, 156, 157, 0, 221, 106, 166, 101, 0, 97, 101, 161, 255,
+	56, 143, 182, 0, 244, 40, 185, 56, 57, 53, 54, 55, 56, 70, 253, 61,
+	8, 69, 185, 31, 80, 81, 82, 83, 56, 241, 95, 96, 0, 221, 106, 105,
+	101, 0, 97, 101, 162, 239, 157, 234, 135, 234, 135, 234, 148, 234, 161, 234,
+	161, 234, 174, 234, 187, 234, 200, 234, 200, 234, 213, 234, 226, 234, 226, 234,
+	239, 234, 252, 234, 9, 234, 9, 234, 22, 151, 35, 31, 0, 245, 40, 24,
+	148, 149, 150, 164, 165, 161, 162, 163, 223, 161, 61, 16, 177, 178, 208, 185,
+	189, 190, 191, 255, 56, 177, 190, 204, 61, 8, 203, 222, 98, 101, 162, 157,
+	234, 230, 234, 230, 234, 243, 234, 0, 234, 13, 234, 13, 234, 26, 234, 39,
+	234, 39, 234, 52, 234, 65, 234, 78, 234, 78, 234, 91, 234, 104, 234, 104,
+	234, 117, 233, 130, 135, 255, 0, 40, 24, 45, 2, 3, 4, 0, 1, 169,
+	17, 253, 61, 8, 16, 185, 31, 27, 28, 29, 30, 56, 241, 42, 43, 0,
+	221, 106, 52, 101, 0, 97, 101, 162, 237, 157, 234, 82, 234, 82, 234, 95,
+	234, 108, 234, 108, 234, 121, 234, 134, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 199, 131, 2, 0, 221, 131,
+	2, 0, 223, 151, 237, 238, 0, 253, 40, 161, 253, 24, 61, 97, 111, 112,
+	108, 109, 110, 161, 253, 61, 16, 124, 125, 185, 15, 136, 137, 138, 56, 177,
+	137, 151, 253, 61, 8, 150, 98, 101, 162, 239, 157, 234, 177, 234, 177, 234,
+	190, 234, 203, 233, 216, 231, 232, 0, 38, 3, 24, 253, 57, 0, 7, 14,
+	21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126,
+	133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238,
+	245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94,
+	101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118,
+	119, 120, 121, 130, 131, 132, 133, 134, 248, 34, 145, 146, 147, 143, 144, 248,
+	160, 156, 157, 158, 159, 248, 34, 170, 171, 172, 173, 169, 248, 185, 186, 182,
+	183, 184, 248, 34, 195, 196, 197, 198, 199, 248, 210, 211, 212, 208, 209, 248,
+	34, 225, 221, 222, 223, 224, 248, 235, 236, 237, 238, 234, 248, 34, 250, 251,
+	247, 248, 249, 248, 4, 5, 6, 7, 8, 248, 34, 19, 20, 21, 17, 18,
+	248, 34, 30, 31, 32, 33, 248, 34, 44, 45, 46, 47, 43, 248, 59, 60,
+	56, 57, 58, 248, 34, 69, 70, 71, 72, 73, 248, 84, 85, 86, 82, 83,
+	248, 242, 57, 99, 95, 96, 64, 71, 78, 85, 92, 99, 106, 113, 120, 127,
+	134, 141, 148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225, 232, 239,
+	246, 253, 4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81, 88, 95,
+	102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193, 200, 207,
+	214, 221, 228, 235, 242, 249, 213, 214, 215, 229, 225, 226, 227, 228, 248, 239,
+	240, 241, 242, 238, 248, 34, 254, 255, 251, 252, 253, 248, 8, 9, 10, 11,
+	12, 248, 34, 23, 24, 25, 21, 22, 248, 38, 34, 35, 36, 37, 248, 34,
+	48, 49, 50, 51, 47, 248, 63, 64, 60, 61, 62, 248, 34, 73, 74, 75,
+	76, 77, 248, 88, 89, 90, 86, 87, 248, 34, 103, 99, 100, 101, 102, 248,
+	113, 114, 115, 116, 112, 248, 34, 128, 129, 125, 126, 127, 248, 138, 139, 140,
+	141, 142, 248, 34, 153, 154, 155, 151, 152, 248, 168, 164, 165, 166, 167, 248,
+	47, 178, 179, 180, 181, 177, 248, 57, 193, 194, 190, 191, 192, 193, 128, 135,
+	142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233, 240, 247,
+	254, 5, 12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89, 96, 103,
+	110, 117, 124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201, 208, 215,
+	222, 229, 236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57, 67, 68,
+	64, 65, 66, 248, 34, 77, 78, 79, 80, 81, 248, 92, 93, 94, 90, 91,
+	248, 45, 107, 103, 104, 105, 106, 98, 101, 8, 116, 122, 13, 132, 133, 129,
+	96, 106, 142, 101, 0, 97, 101, 105, 155, 96, 113, 172, 168, 101, 0, 221,
+	98, 101, 8, 181, 122, 13, 197, 198, 194, 96, 106, 207, 101, 0, 97, 101,
+	105, 220, 96, 113, 237, 233, 101, 0, 221, 98, 101, 8, 246, 122, 13, 6,
+	7, 3, 96, 106, 16, 101, 0, 97, 101, 105, 29, 96, 24, 253, 57, 46,
+	42, 192, 199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34,
+	41, 48, 55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146,
+	153, 160, 167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2,
+	9, 16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114,
+	121, 159, 160, 161, 162, 176, 172, 173, 174, 175, 248, 34, 186, 187, 188, 189,
+	185, 248, 201, 202, 198, 199, 200, 113, 211, 212, 101, 0, 221, 97, 101, 105,
+	224, 96, 113, 241, 237, 101, 0, 98, 101, 8, 250, 208, 122, 10, 11, 7,
+	96, 106, 20, 101, 0, 221, 97, 101, 105, 33, 96, 113, 50, 46, 101, 0,
+	98, 101, 8, 59, 208, 122, 75, 76, 72, 96, 106, 85, 101, 0, 221, 97,
+	101, 105, 98, 96, 113, 115, 111, 101, 0, 98, 101, 8, 124, 210, 159, 140,
+	141, 137, 138, 139, 255, 0, 40, 24, 61, 0, 14, 15, 11, 12, 13, 248,
+	34, 24, 25, 26, 27, 28, 248, 39, 40, 41, 37, 38, 248, 45, 54, 50,
+	51, 52, 53, 98, 101, 8, 63, 122, 13, 79, 80, 76, 96, 106, 89, 101,
+	0, 97, 101, 105, 102, 96, 113, 119, 115, 101, 0, 221, 98, 101, 8, 128,
+	122, 13, 144, 145, 141, 96, 106, 154, 101, 0, 97, 101, 105, 167, 96, 113,
+	184, 180, 101, 0, 221, 98, 101, 8, 193, 122, 13, 209, 210, 206, 96, 106,
+	219, 101, 0, 97, 101, 105, 232, 96, 143, 249, 255, 0, 40, 231, 240, 232,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	121, 117, 118, 119, 120, 121, 130, 131, 132, 133, 134, 130, 131, 145, 146, 147,
+	143, 144, 145, 146, 160, 156, 157, 158, 159, 160, 156, 170, 171, 172, 173, 169,
+	170, 171, 185, 186, 182, 183, 184, 185, 186, 195, 196, 197, 198, 199, 195, 196,
+	210, 211, 212, 208, 209, 210, 211, 225, 221, 222, 223, 224, 225, 221, 235, 236,
+	237, 238, 234, 235, 236, 250, 251, 247, 248, 249, 250, 251, 4, 5, 6, 7,
+	8, 4, 5, 19, 20, 21, 17, 18, 19, 20, 34, 30, 31, 32, 33, 34,
+	30, 44, 45, 46, 47, 43, 44, 45, 59, 60, 56, 57, 58, 59, 60, 69,
+	70, 71, 72, 73, 69, 70, 84, 85, 86, 82, 83, 84, 85, 99, 95, 96,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	213, 214, 215, 229, 225, 226, 227, 228, 229, 225, 239, 240, 241, 242, 238, 239,
+	240, 254, 255, 251, 252, 253, 254, 255, 8, 9, 10, 11, 12, 8, 9, 23,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	121, 117, 118, 119, 120, 121, 130, 131, 132, 133, 134, 130, 131, 145, 146, 147,
+	143, 144, 145, 146, 160, 156, 157, 158, 159, 160, 156, 170, 171, 172, 173, 169,
+	170, 171, 185, 186, 182, 183, 184, 185, 186, 195, 196, 197, 198, 199, 195, 196,
+	210, 211, 212, 208, 209, 210, 211, 225, 221, 222, 223, 224, 225, 221, 235, 236,
+	237, 238, 234, 235, 236, 250, 251, 247, 248, 249, 250, 251, 4, 5, 6, 7,
+	8, 4, 5, 19, 20, 21, 17, 18, 19, 20, 34, 30, 31, 32, 33, 34,
+	30, 44, 45, 46, 47, 43, 44, 45, 59, 60, 56, 57, 58, 59, 60, 69,
+	70, 71, 72, 73, 69, 70, 84, 85, 86, 82, 83, 84, 85, 99, 95, 96,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	121, 117, 118, 119, 120, 121, 130, 131, 132, 133, 134, 130, 131, 145, 146, 147,
+	143, 144, 145, 146, 160, 156, 157, 158, 159, 160, 156, 170, 171, 172, 173, 169,
+	170, 171, 185, 186, 182, 183, 184, 185, 186, 195, 196, 197, 198, 199, 195, 196,
+	210, 211, 212, 208, 209, 210, 211, 225, 221, 222, 223, 224, 225, 221, 235, 236,
+	237, 238, 234, 235, 236, 250, 251, 247, 248, 249, 250, 251, 4, 5, 6, 7,
+	8, 4, 5, 19, 20, 21, 17, 18, 19, 20, 34, 30, 31, 32, 33, 34,
+	30, 44, 45, 46, 47, 43, 44, 45, 59, 60, 56, 57, 58, 59, 60, 69,
+	70, 71, 72, 73, 69, 70, 84, 85, 86, 82, 83, 84, 85, 99, 95, 96,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	213, 214, 215, 229, 225, 226, 227, 228, 229, 225, 239, 240, 241, 242, 238, 239,
+	240, 254, 255, 251, 252, 253, 254, 255, 8, 9, 10, 11, 12, 8, 9, 23,
+	24, 25, 21, 22, 23, 24, 38, 34, 35, 36, 37, 38, 34, 48, 49, 50,
+	51, 47, 48, 49, 63, 64, 60, 61, 62, 63, 64, 73, 74, 75, 76, 77,
+	73, 74, 88, 89, 90, 86, 87, 88, 89, 103, 99, 100, 101, 102, 103, 99,
+	113, 114, 115, 116, 112, 113, 114, 128, 129, 125, 126, 127, 128, 129, 138, 139,
+	140, 141, 142, 138, 139, 153, 154, 155, 151, 152, 153, 154, 168, 164, 165, 166,
+	167, 168, 164, 178, 179, 180, 181, 177, 178, 179, 193, 194, 190, 191, 192, 193,
+	128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233,
+	240, 247, 254, 5, 12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89,
+	96, 103, 110, 117, 124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201,
+	208, 215, 222, 229, 236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57,
+	67, 68, 64, 65, 66, 67, 68, 77, 78, 79, 80, 81, 77, 78, 92, 93,
+	94, 90, 91, 92, 93, 107, 103, 104, 105, 106, 107, 103, 117, 118, 119, 120,
+	116, 117, 118, 132, 133, 129, 130, 131, 132, 133, 142, 143, 144, 145, 146, 142,
+	143, 157, 158, 159, 155, 156, 157, 158, 172, 168, 169, 170, 171, 172, 168, 182,
+	183, 184, 185, 181, 182, 183, 197, 198, 194, 195, 196, 197, 198, 207, 208, 209,
+	210, 211, 207, 208, 222, 223, 224, 220, 221, 222, 223, 237, 233, 234, 235, 236,
+	237, 233, 247, 248, 249, 250, 246, 247, 248, 6, 7, 3, 4, 5, 6, 7,
+	16, 17, 18, 19, 20, 16, 17, 31, 32, 33, 29, 30, 31, 32, 46, 42,
+	192, 199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34, 41,
+	48, 55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153,
+	160, 167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2, 9,
+	16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121,
+	159, 160, 161, 162, 176, 172, 173, 174, 175, 176, 172, 186, 187, 188, 189, 185,
+	186, 187, 201, 202, 198, 199, 200, 201, 202, 211, 212, 213, 214, 215, 211, 212,
+	226, 227, 228, 224, 225, 226, 227, 241, 237, 238, 239, 240, 241, 237, 251, 252,
+	253, 254, 250, 251, 252, 10, 11, 7, 8, 9, 10, 11, 20, 21, 22, 23,
+	24, 20, 21, 35, 36, 37, 33, 34, 35, 36, 50, 46, 47, 48, 49, 50,
+	46, 60, 61, 62, 63, 59, 60, 61, 75, 76, 72, 73, 74, 75, 76, 85,
+	86, 87, 88, 89, 85, 86, 100, 101, 102, 98, 99, 100, 101, 115, 111, 112,
+	113, 114, 115, 111, 125, 126, 127, 128, 124, 125, 126, 140, 141, 137, 138, 139,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	0, 14, 15, 11, 12, 13, 14, 15, 24, 25, 26, 27, 28, 24, 25, 39,
+	40, 41, 37, 38, 39, 40, 54, 50, 51, 52, 53, 54, 50, 64, 65, 66,
+	67, 63, 64, 65, 79, 80, 76, 77, 78, 79, 80, 89, 90, 91, 92, 93,
+	89, 90, 104, 105, 106, 102, 103, 104, 105, 119, 115, 116, 117, 118, 119, 115,
+	129, 130, 131, 132, 128, 129, 130, 144, 145, 141, 142, 143, 144, 145, 154, 155,
+	156, 157, 158, 154, 155, 169, 170, 171, 167, 168, 169, 170, 184, 180, 181, 182,
+	183, 184, 180, 194, 195, 196, 197, 193, 194, 195, 209, 210, 206, 207, 208, 209,
+	210, 219, 220, 221, 222, 223, 219, 220, 234, 235, 236, 232, 233, 234, 235, 249,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	110, 106, 107, 108, 109, 123, 119, 120, 121, 122, 123, 119, 133, 134, 135, 136,
+	132, 133, 134, 148, 149, 145, 146, 147, 148, 149, 158, 159, 160, 161, 162, 158,
+	159, 173, 174, 175, 171, 172, 173, 174, 188, 184, 185, 186, 187, 188, 184, 198,
+	199, 200, 201, 197, 198, 199, 213, 214, 210, 211, 212, 213, 214, 223, 224, 225,
+	226, 227, 223, 224, 238, 239, 240, 236, 237, 238, 239, 253, 249, 250, 251, 252,
+	253, 249, 7, 8, 9, 10, 6, 7, 8, 22, 23, 19, 20, 21, 22, 23,
+	32, 33, 34, 35, 36, 32, 33, 47, 48, 49, 45, 46, 47, 48, 62, 58,
+	59, 60, 61, 62, 58, 72, 73, 74, 75, 71, 72, 73, 87, 88, 84, 85,
+	128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233,
+	240, 247, 254, 5, 12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89,
+	96, 103, 110, 117, 124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201,
+	208, 215, 222, 229, 236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57,
+	202, 203, 217, 218, 214, 215, 216, 217, 218, 227, 228, 229, 230, 231, 227, 228,
+	242, 243, 244, 240, 241, 242, 243, 1, 253, 254, 255, 0, 1, 253, 11, 12,
+	13, 14, 10, 11, 12, 26, 27, 23, 24, 25, 26, 27, 36, 37, 38, 39,
+	40, 36, 37, 51, 52, 53, 49, 50, 51, 52, 66, 62, 63, 64, 65, 66,
+	62, 76, 77, 78, 79, 75, 76, 77, 91, 92, 88, 89, 90, 91, 92, 101,
+	102, 103, 104, 105, 101, 102, 116, 117, 118, 114, 115, 116, 117, 131, 127, 128,
+	129, 130, 131, 127, 141, 142, 143, 144, 140, 141, 142, 156, 157, 153, 154, 155,
+	156, 157, 166, 167, 168, 169, 170, 166, 167, 181, 182, 183, 179, 180, 181, 182,
+	192, 199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34, 41,
+	48, 55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153,
+	160, 167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2, 9,
+	16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121,
+	56, 57, 53, 54, 55, 56, 70, 66, 67, 68, 69, 70, 66, 80, 81, 82,
+	83, 79, 80, 81, 95, 96, 92, 93, 94, 95, 96, 105, 106, 107, 108, 109,
+	105, 106, 120, 121, 122, 118, 119, 120, 121, 135, 131, 132, 133, 134, 135, 131,
+	145, 146, 147, 148, 144, 145, 146, 160, 161, 157, 158, 159, 160, 161, 170, 171,
+	172, 173, 174, 170, 171, 185, 186, 187, 183, 184, 185, 186, 200, 196, 197, 198,
+	199, 200, 196, 210, 211, 212, 213, 209, 210, 211, 225, 226, 222, 223, 224, 225,
+	226, 235, 236, 237, 238, 239, 235, 236, 250, 251, 252, 248, 249, 250, 251, 9,
+	5, 6, 7, 8, 9, 5, 19, 20, 21, 22, 18, 19, 20, 34, 35, 31,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	148, 149, 150, 164, 165, 161, 162, 163, 164, 165, 174, 175, 176, 177, 178, 174,
+	175, 189, 190, 191, 187, 188, 189, 190, 204, 200, 201, 202, 203, 204, 200, 214,
+	215, 216, 217, 213, 214, 215, 229, 230, 226, 227, 228, 229, 230, 239, 240, 241,
+	242, 243, 239, 240, 254, 255, 0, 252, 253, 254, 255, 13, 9, 10, 11, 12,
+	13, 9, 23, 24, 25, 26, 22, 23, 24, 38, 39, 35, 36, 37, 38, 39,
+	48, 49, 50, 51, 52, 48, 49, 63, 64, 65, 61, 62, 63, 64, 78, 74,
+	75, 76, 77, 78, 74, 88, 89, 90, 91, 87, 88, 89, 103, 104, 100, 101,
+	102, 103, 104, 113, 114, 115, 116, 117, 113, 114, 128, 129, 130, 126, 127, 128,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	2, 3, 4, 0, 1, 2, 3, 17, 13, 14, 15, 16, 17, 13, 27, 28,
+	29, 30, 26, 27, 28, 42, 43, 39, 40, 41, 42, 43, 52, 53, 54, 55,
+	56, 52, 53, 67, 68, 69, 65, 66, 67, 68, 82, 78, 79, 80, 81, 82,
+	78, 92, 93, 94, 95, 91, 92, 93, 107, 108, 104, 105, 106, 107, 108, 117,
+	118, 119, 120, 121, 117, 118, 132, 133, 134, 130, 131, 132, 133, 147, 143, 144,
+	145, 146, 147, 143, 157, 158, 159, 160, 156, 157, 158, 172, 173, 169, 170, 171,
+	172, 173, 182, 183, 184, 185, 186, 182, 183, 197, 198, 199, 195, 196, 197, 198,
+	212, 208, 209, 210, 211, 212, 208, 222, 223, 224, 225, 221, 222, 223, 237, 238,
+	128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233,
+	240, 247, 254, 5, 12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89,
+	96, 103, 110, 117, 124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201,
+	208, 215, 222, 229, 236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57,
+	99, 95, 96, 97, 111, 112, 108, 109, 110, 111, 112, 121, 122, 123, 124, 125,
+	121, 122, 136, 137, 138, 134, 135, 136, 137, 151, 147, 148, 149, 150, 151, 147,
+	161, 162, 163, 164, 160, 161, 162, 176, 177, 173, 174, 175, 176, 177, 186, 187,
+	188, 189, 190, 186, 187, 201, 202, 203, 199, 200, 201, 202, 216, 212, 213, 214,
+	215, 216, 212, 226, 227, 228, 229, 225, 226, 227, 241, 242, 238, 239, 240, 241,
+	242, 251, 252, 253, 254, 255, 251, 252, 10, 11, 12, 8, 9, 10, 11, 25,
+	21, 22, 23, 24, 25, 21, 35, 36, 37, 38, 34, 35, 36, 50, 51, 47,
+	48, 49, 50, 51, 60, 61, 62, 63, 64, 60, 61, 75, 76, 77, 73, 74,
+	192, 199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34, 41,
+	48, 55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153,
+	160, 167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2, 9,
+	16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121,
+	191, 205, 206, 207, 203, 204, 205, 206, 220, 216, 217, 218, 219, 220, 216, 230,
+	231, 232, 233, 229, 230, 231, 245, 246, 242, 243, 244, 245, 246, 255, 0, 1,
+	2, 3, 255, 0, 14, 15, 16, 12, 13, 14, 15, 29, 25, 26, 27, 28,
+	29, 25, 39, 40, 41, 42, 38, 39, 40, 54, 55, 51, 52, 53, 54, 55,
+	64, 65, 66, 67, 68, 64, 65, 79, 80, 81, 77, 78, 79, 80, 94, 90,
+	91, 92, 93, 94, 90, 104, 105, 106, 107, 103, 104, 105, 119, 120, 116, 117,
+	118, 119, 120, 129, 130, 131, 132, 133, 129, 130, 144, 145, 146, 142, 143, 144,
+	145, 159, 155, 156, 157, 158, 159, 155, 169, 170, 171, 172, 168, 169, 170, 184,
+	0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105,
+	112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+	224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73,
+	80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185,
+	45, 46, 42, 43, 44, 58, 59, 55, 56, 57, 58, 59, 68, 69, 70, 71,
+	72, 68, 69, 83, 84, 85, 81, 82, 83, 84, 98, 94, 95, 96, 97, 98,
+	94, 108, 109, 110, 111, 107, 108, 109, 123, 124, 120, 121, 122, 123, 124, 133,
+	134, 135, 136, 137, 133, 134, 148, 149, 150, 146, 147, 148, 149, 163, 159, 160,
+	161, 162, 163, 159, 173, 174, 175, 176, 172, 173, 174, 188, 189, 185, 186, 187,
+	188, 189, 198, 199, 200, 201, 202, 198, 199, 213, 214, 215, 211, 212, 213, 214,
+	228, 224, 225, 226, 227, 228, 224, 238, 239, 240, 241, 237, 238, 239, 253, 254,
+	250, 251, 252, 253, 254, 7, 8, 9, 10, 11, 7, 8, 22, 23, 24, 20,
+	64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169,
+	176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25,
+	32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137,
+	144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249,
+	38, 3, 24, 253, 57, 0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70,
+	77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182,
+	189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38,
+	45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150,
+	157, 164, 171, 178, 185, 121, 117, 118, 119, 120, 121, 130, 131, 132, 133, 134,
+	248, 34, 145, 146, 147, 143, 144, 248, 160, 156, 157, 158, 159, 248, 34, 170,
+	171, 172, 173, 169, 248, 185, 186, 182, 183, 184, 248, 34, 195, 196, 197, 198,
+	199, 248, 210, 211, 212, 208, 209, 248, 34, 225, 221, 222, 223, 224, 248, 235,
+	236, 237, 238, 234, 248, 34, 250, 251, 247, 248, 249, 248, 4, 5, 6, 7,
+	8, 248, 34, 19, 20, 21, 17, 18, 248, 34, 30, 31, 32, 33, 248, 34,
+	44, 45, 46, 47, 43, 248, 59, 60, 56, 57, 58, 248, 34, 69, 70, 71,
+	72, 73, 248, 84, 85, 86, 82, 83, 248, 242, 57, 99, 95, 96, 64, 71,
+	78, 85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169, 176, 183,
+	190, 197, 204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25, 32, 39,
+	46, 53, 60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137, 144, 151,
+	158, 165, 172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249, 213, 214,
+	215, 229, 225, 226, 227, 228, 248, 239, 240, 241, 242, 238, 248, 34, 254, 255,
+	251, 252, 253, 248, 8, 9, 10, 11, 12, 248, 34, 23, 24, 25, 21, 22,
+	248, 38, 34, 35, 36, 37, 248, 34, 48, 49, 50, 51, 47, 248, 63, 64,
+	60, 61, 62, 248, 34, 73, 74, 75, 76, 77, 248, 88, 89, 90, 86, 87,
+	248, 34, 103, 99, 100, 101, 102, 248, 113, 114, 115, 116, 112, 248, 34, 128,
+	129, 125, 126, 127, 248, 138, 139, 140, 141, 142, 248, 34, 153, 154, 155, 151,
+	152, 248, 168, 164, 165, 166, 167, 248, 47, 178, 179, 180, 181, 177, 248, 57,
+	193, 194, 190, 191, 192, 193, 128, 135, 142, 149, 156, 163, 170, 177, 184, 191,
+	198, 205, 212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33, 40, 47,
+	54, 61, 68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145, 152, 159,
+	166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1, 8, 15,
+	22, 29, 36, 43, 50, 57, 67, 68, 64, 65, 66, 248, 34, 77, 78, 79,
+	80, 81, 248, 92, 93, 94, 90, 91, 248, 45, 107, 103, 104, 105, 106, 98,
+	101, 8, 116, 122, 13, 132, 133, 129, 96, 106, 142, 101, 0, 97, 101, 105,
+	155, 96, 113, 172, 168, 101, 0, 221, 98, 101, 8, 181, 122, 13, 197, 198,
+	194, 96, 106, 207, 101, 0, 97, 101, 105, 220, 96, 113, 237, 233, 101, 0,
+	221, 98, 101, 8, 246, 122, 13, 6, 7, 3, 96, 106, 16, 101, 0, 97,
+	101, 105, 29, 96, 24, 253, 57, 46, 42, 192, 199, 206, 213, 220, 227, 234,
+	241, 248, 255, 6, 13, 20, 27, 34, 41, 48, 55, 62, 69, 76, 83, 90,
+	97, 104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174, 181, 188, 195, 202,
+	209, 216, 223, 230, 237, 244, 251, 2, 9, 16, 23, 30, 37, 44, 51, 58,
+	65, 72, 79, 86, 93, 100, 107, 114, 121, 159, 160, 161, 162, 176, 172, 173,
+	174, 175, 248, 34, 186, 187, 188, 189, 185, 248, 201, 202, 198, 199, 200, 113,
+	211, 212, 101, 0, 221, 97, 101, 105, 224, 96, 113, 241, 237, 101, 0, 98,
+	101, 8, 250, 208, 122, 10, 11, 7, 96, 106, 20, 101, 0, 221, 97, 101,
+	105, 33, 96, 113, 50, 46, 101, 0, 98, 101, 8, 59, 208, 122, 75, 76,
+	72, 96, 106, 85, 101, 0, 221, 97, 101, 105, 98, 96, 113, 115, 111, 101,
+	0, 98, 101, 8, 124, 210, 159, 140, 141, 137, 138, 139, 255, 0, 40, 24,
+	61, 0, 14, 15, 11, 12, 13, 248, 34, 24, 25, 26, 27, 28, 248, 39,
+	40, 41, 37, 38, 248, 45, 54, 50, 51, 52, 53, 98, 101, 8, 63, 122,
+	13, 79, 80, 76, 96, 106, 89, 101, 0, 97, 101, 105, 102, 96, 113, 119,
+	115, 101, 0, 221, 98, 101, 8, 128, 122, 13, 144, 145, 141, 96, 106, 154,
+	101, 0, 97, 101, 105, 167, 96, 113, 184, 180, 101, 0, 221, 98, 101, 8,
+	193, 122, 13, 209, 210, 206, 96, 106, 219, 101, 0, 97, 101, 105, 232, 96,
+	143, 249, 255, 0, 40, 231, 240, 232, 219, 1, 185, 63, 110, 106, 107, 108,
+	109, 123, 61, 8, 122, 209, 185, 133, 134, 135, 136, 253, 56, 241, 148, 149,
+	0, 106, 158, 101, 0, 223, 97, 101, 161, 56, 177, 174, 188, 253, 61, 8,
+	187, 98, 101, 161, 253, 56, 241, 213, 214, 0, 106, 223, 101, 0, 223, 97,
+	101, 161, 56, 177, 239, 253, 253, 61, 8, 252, 98, 101, 161, 253, 56, 241,
+	22, 23, 0, 106, 32, 101, 0, 223, 97, 101, 161, 56, 177, 48, 62, 253,
+	61, 8, 61, 98, 101, 161, 255, 56, 240, 87, 88, 135, 0, 244, 40, 24,
+	202, 203, 217, 218, 214, 215, 216, 223, 161, 61, 16, 230, 231, 208, 185, 242,
+	243, 244, 255, 56, 177, 243, 1, 61, 8, 0, 223, 98, 101, 161, 56, 241,
+	26, 27, 0, 221, 106, 36, 101, 0, 97, 101, 161, 255, 56, 177, 52, 66,
+	61, 8, 65, 223, 98, 101, 161, 56, 241, 91, 92, 0, 221, 106, 101, 101,
+	0, 97, 101, 161, 255, 56, 177, 117, 131, 61, 8, 130, 223, 98, 101, 161,
+	56, 241, 156, 157, 0, 221, 106, 166, 101, 0, 97, 101, 161, 255, 56, 143,
+	182, 0, 244, 40, 185, 56, 57, 53, 54, 55, 56, 70, 253, 61, 8, 69,
+	185, 31, 80, 81, 82, 83, 56, 241, 95, 96, 0, 221, 106, 105, 101, 0,
+	97, 101, 162, 239, 157, 234, 135, 234, 135, 234, 148, 234, 161, 234, 161, 234,
+	174, 234, 187, 234, 200, 234, 200, 234, 213, 234, 226, 234, 226, 234, 239, 234,
+	252, 234, 9, 234, 9, 234, 22, 151, 35, 31, 0, 245, 40, 24, 148, 149,
+	150, 164, 165, 161, 162, 163, 223, 161, 61, 16, 177, 178, 208, 185, 189, 190,
+	191, 255, 56, 177, 190, 204, 61, 8, 203, 222, 98, 101, 162, 157, 234, 230,
+	234, 230, 234, 243, 234, 0, 234, 13, 234, 13, 234, 26, 234, 39, 234, 39,
+	234, 52, 234, 65, 234, 78, 234, 78, 234, 91, 234, 104, 234, 104, 234, 117,
+	233, 130, 135, 255, 0, 40, 24, 45, 2, 3, 4, 0, 1, 169, 17, 253,
+	61, 8, 16, 185, 31, 27, 28, 29, 30, 56, 241, 42, 43, 0, 221, 106,
+	52, 101, 0, 97, 101, 162, 237, 157, 234, 82, 234, 82, 234, 95, 234, 108,
+	234, 108, 234, 121, 234, 134, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2,
+	0, 221, 131, 2, 162, 237, 157, 234, 199, 131, 2, 0, 221, 131, 2, 0,
+	223, 151, 237, 238, 0, 253, 40, 161, 253, 24, 61, 97, 111, 112, 108, 109,
+	110, 161, 253, 61, 16, 124, 125, 185, 15, 136, 137, 138, 56, 177, 137, 151,
+	253, 61, 8, 150, 98, 101, 162, 239, 157, 234, 177, 234, 177, 234, 190, 234,
+	203, 233, 216, 231, 232, 165, 1, 8, 215, 221, 131, 2, 0, 221, 131, 2,
+	0, 221, 131, 2, 162, 237, 157, 234, 12, 131, 2, 0, 221, 131, 2, 0,
+	221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 129, 2, 135, 255, 0, 40,
+	24, 61, 191, 205, 206, 207, 203, 204, 169, 220, 253, 61, 8, 219, 185, 31,
+	230, 231, 232, 233, 56, 241, 245, 246, 0, 221, 106, 255, 101, 0, 97, 101,
+	162, 237, 157, 234, 29, 234, 29, 234, 42, 234, 55, 234, 55, 234, 68, 234,
+	81, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162,
+	237, 157, 234, 146, 131, 2, 0, 221, 131, 2, 0, 223, 143, 184, 0, 245,
+	40, 154, 45, 46, 42, 43, 44, 58, 59, 55, 205, 98, 234, 68, 0, 129,
+	207, 103, 161, 56, 177, 84, 98, 253, 61, 8, 97, 98, 101, 162, 237, 157,
+	234, 124, 234, 124, 234, 137, 234, 150, 234, 163, 234, 163, 234, 176, 234, 189,
+	234, 189, 234, 202, 234, 215, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2,
+	0, 221, 131, 2, 162, 239, 157, 151, 24, 20, 0, 252, 40, 145, 137, 138,
+	103, 137, 150, 207, 98, 242, 167, 163, 241, 163, 177, 161, 56, 241, 192, 193,
+	0, 222, 106, 202, 101, 162, 157, 234, 219, 234, 232, 234, 232, 234, 245, 234,
+	2, 234, 2, 234, 15, 234, 28, 131, 221, 2, 0, 131, 221, 2, 0, 131,
+	221, 2, 0, 131, 222, 2, 162, 157, 234, 93, 131, 221, 2, 0, 131, 221,
+	2, 0, 135, 255, 0, 40, 129, 192, 98, 232, 245, 250, 5, 6, 2, 234,
+	15, 0, 220, 129, 103, 161, 255, 56, 177, 31, 45, 61, 8, 44, 222, 98,
+	101, 162, 157, 234, 71, 234, 71, 234, 84, 234, 97, 131, 221, 2, 0, 131,
+	221, 2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 234, 162, 131, 221,
+	2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 143,
+	227, 255, 0, 40, 161, 220, 253, 129, 103, 137, 97, 207, 98, 242, 114, 110,
+	241, 110, 124, 161, 56, 241, 139, 140, 0, 222, 106, 149, 101, 162, 157, 234,
+	166, 234, 179, 234, 179, 234, 192, 234, 205, 234, 205, 234, 218, 234, 231, 131,
+	221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157,
+	234, 40, 131, 221, 2, 0, 131, 223, 2, 239, 63, 232, 109, 1, 135, 255,
+	0, 40, 129, 205, 103, 16, 196, 192, 177, 208, 209, 253, 56, 0, 161, 253,
+	61, 16, 221, 222, 129, 207, 103, 161, 56, 177, 234, 248, 253, 61, 8, 247,
+	98, 101, 162, 237, 157, 234, 18, 234, 18, 234, 31, 234, 44, 131, 2, 0,
+	221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 109,
+	131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 239,
+	157, 135, 0, 253, 40, 161, 253, 137, 32, 202, 103, 130, 154, 138, 61, 173,
+	159, 0, 129, 207, 103, 169, 74, 56, 241, 86, 87, 0, 222, 106, 96, 101,
+	162, 157, 234, 113, 234, 126, 234, 126, 234, 139, 234, 152, 234, 152, 234, 165,
+	234, 178, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222,
+	2, 162, 157, 234, 243, 131, 221, 2, 0, 131, 223, 2, 135, 0, 251, 40,
+	129, 58, 145, 142, 143, 160, 154, 249, 155, 156, 152, 138, 156, 173, 159, 8,
+	169, 129, 202, 103, 130, 154, 169, 195, 253, 61, 8, 194, 98, 101, 162, 237,
+	157, 234, 221, 234, 221, 234, 234, 234, 247, 131, 2, 0, 221, 131, 2, 0,
+	221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 56, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 223, 143, 119, 0, 249,
+	40, 131, 255, 236, 249, 236, 8, 236, 18, 236, 33, 236, 43, 236, 58, 236,
+	73, 236, 83, 233, 98, 97, 96, 131, 222, 2, 162, 157, 234, 125, 131, 221,
+	2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 234,
+	190, 131, 221, 2, 0, 98, 101, 135, 255, 0, 40, 137, 77, 185, 58, 131,
+	255, 236, 102, 236, 112, 236, 127, 236, 142, 236, 152, 236, 167, 236, 177, 236,
+	192, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0, 131, 222, 2,
+	162, 157, 234, 3, 131, 221, 2, 0, 131, 221, 2, 0, 131, 221, 2, 0,
+	131, 221, 2, 0, 135, 255, 0, 40, 231, 240, 232, 66, 1, 132, 157, 255,
+	236, 196, 236, 211, 236, 221, 236, 236, 236, 246, 236, 5, 236, 20, 236, 30,
+	131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 72, 131, 2, 0, 221, 131,
+	2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 137, 131, 2,
+	0, 223, 97, 101, 135, 0, 253, 40, 161, 253, 140, 34, 157, 255, 236, 49,
+	236, 59, 236, 74, 236, 89, 236, 99, 236, 114, 236, 124, 235, 139, 139, 140,
+	2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157,
+	234, 206, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2,
+	143, 254, 255, 0, 40, 140, 128, 157, 255, 236, 143, 236, 158, 236, 168, 236,
+	183, 236, 193, 236, 208, 236, 223, 236, 233, 131, 2, 0, 221, 131, 2, 162,
+	237, 157, 234, 19, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 162, 237, 157, 234, 84, 131, 2, 0, 223, 151, 107, 108, 0, 249,
+	40, 130, 255, 236, 237, 236, 252, 236, 6, 236, 21, 236, 36, 236, 46, 236,
+	61, 236, 71, 234, 86, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221, 131,
+	2, 0, 221, 131, 2, 162, 237, 157, 234, 153, 131, 2, 0, 221, 131, 2,
+	0, 221, 131, 2, 0, 221, 131, 2, 135, 255, 0, 40, 148, 66, 75, 157,
+	255, 236, 90, 236, 105, 236, 115, 236, 130, 236, 140, 236, 155, 236, 170, 236,
+	180, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 222, 131, 2, 0, 221,
+	131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 162, 237, 157, 234, 31, 131,
+	2, 0, 223, 143, 54, 0, 249, 40, 131, 255, 236, 184, 236, 199, 236, 209,
+	236, 224, 236, 239, 236, 249, 236, 8, 236, 18, 97, 101, 231, 240, 232, 19,
+	1, 162, 237, 157, 131, 2, 0, 221, 131, 2, 0, 221, 131, 2, 0, 221,
+	131, 2, 162, 237, 157, 234, 100, 131, 2, 0, 221, 131, 2, 0, 221, 131,
+	2, 0, 222, 162, 157, 135, 255, 0, 40, 156, 9, 12, 13, 22, 255, 236,
+	37, 236, 52, 236, 62, 236, 77, 236, 87, 236, 102, 236, 117, 236, 127, 131,
+	221, 2, 0, 131, 222, 2, 162, 157, 234, 169, 131, 221, 2, 0, 131, 221,
+	2, 0, 131, 221, 2, 0, 131, 222, 2, 162, 157, 234, 234, 131, 221, 2,
+	0, 135, 255, 0, 40, 132, 150, 255, 236, 131, 236, 146, 236, 156, 236, 171,
+	236, 186, 236, 196, 236, 211, 236, 221, 132, 1, 236, 237, 236, 247, 236, 6,
+	236, 21, 236, 31, 236, 46, 236, 56, 236, 71, 232, 86, 143, 97, 255, 0,
+	40, 161, 214, 253, 132, 1, 236, 226, 236, 241, 236, 251, 236, 10, 236, 25,
+	236, 35, 236, 50, 236, 60, 236, 75, 236, 90, 236, 100, 236, 115, 236, 125,
+	236, 140, 236, 155, 236, 165, 235, 180, 143, 194, 255, 0, 40, 132, 96, 1,
+	236, 64, 236, 79, 236, 94, 236, 104, 236, 119, 236, 129, 236, 144, 236, 159,
+	236, 169, 236, 184, 236, 194, 236, 209, 236, 224, 236, 234, 236, 249, 236, 3,
+	236, 18, 159, 33, 42, 43, 255, 0, 40, 130, 198, 98, 132, 1, 236, 173,
+	236, 188, 236, 198, 236, 213, 236, 228, 236, 238, 236, 253, 236, 7, 236, 22,
+	236, 37, 236, 47, 236, 62, 236, 72, 236, 87, 236, 102, 236, 112, 234, 127,
+	239, 140, 240, 232, 226, 0, 135, 255, 0, 40, 140, 1, 111, 1, 236, 11,
+	236, 26, 236, 41, 236, 51, 236, 66, 236, 76, 236, 91, 236, 106, 236, 116,
+	236, 131, 236, 141, 236, 156, 236, 171, 236, 181, 236, 196, 236, 206, 236, 221,
+	151, 236, 245, 0, 249, 40, 131, 255, 236, 119, 236, 134, 236, 149, 236, 159,
+	236, 174, 236, 184, 236, 199, 236, 214, 132, 111, 1, 236, 225, 236, 240, 236,
+	250, 236, 9, 236, 19, 236, 34, 236, 49, 236, 59, 233, 74, 143, 86, 0,
+	246, 40, 148, 203, 204, 1, 236, 214, 236, 229, 236, 244, 236, 254, 236, 13,
+	236, 23, 236, 38, 236, 53, 236, 63, 236, 78, 236, 88, 236, 103, 236, 118,
+	236, 128, 236, 143, 236, 153, 236, 168, 143, 183, 255, 0, 40, 132, 150, 255,
+	236, 66, 236, 81, 236, 96, 236, 106, 236, 121, 236, 131, 236, 146, 236, 161,
+	132, 1, 236, 172, 236, 187, 236, 197, 236, 212, 236, 222, 236, 237, 236, 252,
+	236, 6, 232, 21, 143, 32, 255, 0, 40, 161, 214, 253, 132, 1, 236, 161,
+	236, 176, 236, 191, 236, 201, 236, 216, 236, 226, 236, 241, 236, 0, 236, 10,
+	236, 25, 236, 35, 236, 50, 236, 65, 236, 75, 236, 90, 236, 100, 235, 115,
+	143, 129, 255, 0, 40, 231, 240, 232, 219, 0, 132, 96, 1, 236, 4, 236,
+	14, 236, 29, 236, 39, 236, 54, 236, 69, 236, 79, 236, 94, 236, 104, 236,
+	119, 236, 134, 236, 144, 236, 159, 236, 169, 236, 184, 236, 199, 236, 209, 159,
+	224, 238, 234, 255, 0, 40, 130, 166, 154, 132, 1, 236, 108, 236, 123, 236,
+	138, 236, 148, 236, 163, 236, 173, 236, 188, 236, 203, 236, 213, 236, 228, 236,
+	238, 236, 253, 236, 12, 236, 22, 236, 37, 236, 47, 234, 62, 143, 75, 255,
+	0, 40, 140, 192, 111, 1, 236, 207, 236, 217, 236, 232, 236, 242, 236, 1,
+	236, 16, 236, 26, 236, 41, 236, 51, 236, 66, 236, 81, 236, 91, 236, 106,
+	236, 116, 236, 131, 236, 146, 236, 156, 151, 171, 185, 0, 249, 40, 131, 255,
+	236, 59, 236, 69, 236, 84, 236, 94, 236, 109, 236, 124, 236, 134, 236, 149,
+	132, 111, 1, 236, 160, 236, 175, 236, 185, 236, 200, 236, 215, 236, 225, 236,
+	240, 236, 250, 233, 9, 143, 21, 0, 242, 40, 162, 99, 131, 150, 255, 236,
+	163, 236, 178, 236, 193, 236, 203, 236, 218, 236, 228, 236, 243, 236, 2, 132,
+	1, 236, 13, 236, 28, 236, 38, 236, 53, 236, 63, 236, 78, 236, 93, 236,
+	103, 239, 118, 240, 232, 0, 38, 3, 24, 253, 57, 0, 7, 14, 21, 28,
+	35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140,
+	147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252,
+	3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108,
+	115, 122, 129, 136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118, 119, 120,
+	121, 130, 131, 132, 133, 134, 248, 34, 145, 146, 147, 143, 144, 248, 160, 156,
+	157, 158, 159, 248, 34, 170, 171, 172, 173, 169, 248, 185, 186, 182, 183, 184,
+	248, 34, 195, 196, 197, 198, 199, 248, 210, 211, 212, 208, 209, 248, 34, 225,
+	221, 222, 223, 224, 248, 235, 236, 237, 238, 234, 248, 34, 250, 251, 247, 248,
+	249, 248, 4, 5, 6, 7, 8, 248, 34, 19, 20, 21, 17, 18, 248, 34,
+	30, 31, 32, 33, 248, 34, 44, 45, 46, 47, 43, 248, 59, 60, 56, 57,
+	58, 248, 34, 69, 70, 71, 72, 73, 248, 84, 85, 86, 82, 83, 248, 242,
+	57, 99, 95, 96, 64, 71, 78, 85, 92, 99, 106, 113, 120, 127, 134, 141,
+	148, 155, 162, 169, 176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253,
+	4, 11, 18, 25, 32, 39, 46, 53, 60, 67, 74, 81, 88, 95, 102, 109,
+	116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186, 193, 200, 207, 214, 221,
+	228, 235, 242, 249, 213, 214, 215, 229, 225, 226, 227, 228, 248, 239, 240, 241,
+	242, 238, 248, 34, 254, 255, 251, 252, 253, 248, 8, 9, 10, 11, 12, 248,
+	34, 23, 24, 25, 21, 22, 248, 38, 34, 35, 36, 37, 248, 34, 48, 49,
+	50, 51, 47, 248, 63, 64, 60, 61, 62, 248, 34, 73, 74, 75, 76, 77,
+	248, 88, 89, 90, 86, 87, 248, 34, 103, 99, 100, 101, 102, 248, 113, 114,
+	115, 116, 112, 248, 34, 128, 129, 125, 126, 127, 248, 138, 139, 140, 141, 142,
+	248, 34, 153, 154, 155, 151, 152, 248, 168, 164, 165, 166, 167, 248, 47, 178,
+	179, 180, 181, 177, 248, 57, 193, 194, 190, 191, 192, 193, 128, 135, 142, 149,
+	156, 163, 170, 177, 184, 191, 198, 205, 212, 219, 226, 233, 240, 247, 254, 5,
+	12, 19, 26, 33, 40, 47, 54, 61, 68, 75, 82, 89, 96, 103, 110, 117,
+	124, 131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229,
+	236, 243, 250, 1, 8, 15, 22, 29, 36, 43, 50, 57, 67, 68, 64, 65,
+	66, 248, 34, 77, 78, 79, 80, 81, 248, 92, 93, 94, 90, 91, 248, 45,
+	107, 103, 104, 105, 106, 98, 101, 8, 116, 122, 13, 132, 133, 129, 96, 106,
+	142, 101, 0, 97, 101, 105, 155, 96, 113, 172, 168, 101, 0, 221, 98, 101,
+	8, 181, 122, 13, 197, 198, 194, 96, 106, 207, 101, 0, 97, 101, 105, 220,
+	96, 113, 237, 233, 101, 0, 221, 98, 101, 8, 246, 122, 13, 6, 7, 3,
+	96, 106, 16, 101, 0, 97, 101, 105, 29, 96, 24, 253, 57, 46, 42, 192,
+	199, 206, 213, 220, 227, 234, 241, 248, 255, 6, 13, 20, 27, 34, 41, 48,
+	55, 62, 69, 76, 83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153, 160,
+	167, 174, 181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251, 2, 9, 16,
+	23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121, 159,
+	160, 161, 162, 176, 172, 173, 174, 175, 248, 34, 186, 187, 188, 189, 185, 248,
+	201, 202, 198, 199, 200, 113, 211, 212, 101, 0, 221, 97, 101, 105, 224, 96,
+	113, 241, 237, 101, 0, 98, 101, 8, 250, 208, 122, 10, 11, 7, 96, 106,
+	20, 101, 0, 221, 97, 101, 105, 33, 96, 113, 50, 46, 101, 0, 98, 101,
+	8, 59, 208, 122, 75, 76, 72, 96, 106, 85, 101, 0, 221, 97, 101, 105,
+	98, 96, 113, 115, 111, 101, 0, 98, 101, 8, 124, 210, 159, 140, 141, 137,
+	138, 139, 255, 0, 40, 24, 61, 0, 14, 15, 11, 12, 13, 248, 34, 24,
+	25, 26, 27, 28, 248, 39, 40, 41, 37, 38, 248, 45, 54, 50, 51, 52,
+	53, 98, 101, 8, 63, 122, 13, 79, 80, 76, 96, 106, 89, 101, 0, 97,
+	101, 105, 102, 96, 113, 119, 115, 101, 0, 221, 98, 101, 8, 128, 122, 13,
+	144, 145, 141, 96, 106, 154, 101, 0, 97, 101, 105, 167, 96, 113, 184, 180,
+	101, 0, 221, 98, 101, 8, 193, 122, 13, 209, 210, 206, 96, 106, 219, 101,
+	0, 97, 101, 105, 232, 96, 143, 249, 255, 0, 40, 231, 240, 232, 233, 1,
+	24, 253, 57, 0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84,
+	91, 98, 105, 112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196,
+	203, 210, 217, 224, 231, 238, 245, 252, 3, 10, 17, 24, 31, 38, 45, 52,
+	59, 66, 73, 80, 87, 94, 101, 108, 115, 122, 129, 136, 143, 150, 157, 164,
+	171, 178, 185, 121, 117, 118, 119, 120, 121, 130, 131, 132, 133, 134, 248, 34,
+	145, 146, 147, 143, 144, 248, 160, 156, 157, 158, 159, 248, 34, 170, 171, 172,
+	173, 169, 248, 185, 186, 182, 183, 184, 248, 34, 195, 196, 197, 198, 199, 248,
+	210, 211, 212, 208, 209, 248, 34, 225, 221, 222, 223, 224, 248, 235, 236, 237,
+	238, 234, 248, 34, 250, 251, 247, 248, 249, 248, 4, 5, 6, 7, 8, 248,
+	34, 19, 20, 21, 17, 18, 248, 34, 30, 31, 32, 33, 248, 34, 44, 45,
+	46, 47, 43, 248, 59, 60, 56, 57, 58, 248, 34, 69, 70, 71, 72, 73,
+	248, 84, 85, 86, 82, 83, 248, 242, 57, 99, 95, 96, 64, 71, 78, 85,
+	92, 99, 106, 113, 120, 127, 134, 141, 148, 155, 162, 169, 176, 183, 190, 197,
+	204, 211, 218, 225, 232, 239, 246, 253, 4, 11, 18, 25, 32, 39, 46, 53,
+	60, 67, 74, 81, 88, 95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165,
+	172, 179, 186, 193, 200, 207, 214, 221, 228, 235, 242, 249, 213, 214, 215, 229,
+	225, 226, 227, 228, 248, 239, 240, 241, 242, 238, 248, 34, 254, 255, 251, 252,
+	253, 248, 8, 9, 10, 11, 12, 248, 34, 23, 24, 25, 21, 22, 248, 38,
+	34, 35, 36, 37, 248, 34, 48, 49, 50, 51, 47, 248, 63, 64, 60, 61,
+	62, 248, 34, 73, 74, 75, 76, 77, 248, 88, 89, 90, 86, 87, 248, 34,
+	103, 99, 100, 101, 102, 248, 113, 114, 115, 116, 112, 248, 34, 128, 129, 125,
+	126, 127, 248, 138, 139, 140, 141, 142, 248, 34, 153, 154, 155, 151, 152, 248,
+	168, 164, 165, 166, 167, 248, 47, 178, 179, 180, 181, 177, 248, 57, 193, 194,
+	190, 191, 192, 193, 128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205,
+	212, 219, 226, 233, 240, 247, 254, 5, 12, 19, 26, 33, 40, 47, 54, 61,
+	68, 75, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145, 152, 159, 166, 173,
+	180, 187, 194, 201, 208, 215, 222, 229, 236, 243, 250, 1, 8, 15, 22, 29,
+	36, 43, 50, 57, 67, 68, 64, 65, 66, 248, 34, 77, 78, 79, 80, 81,
+	248, 92, 93, 94, 90, 91, 248, 45, 107, 103, 104, 105, 106, 98, 101, 8,
+	116, 122, 13, 132, 133, 129, 96, 106, 142, 101, 0, 97, 101, 105, 155, 96,
+	113, 172, 168, 101, 0, 223, 239, 182, 232, 0, 0, 7, 14, 21, 28, 35,
+	42, 49, 56, 63, 70, 77, 84, 91, 98, 105, 112, 119, 126, 133, 140, 147,
+	154, 161, 168, 175, 182, 189, 196, 203, 210, 217, 224, 231, 238, 245, 252, 3,
+	10, 17, 24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115,
+	122, 129, 136, 143, 150, 157, 164, 171, 178, 185, 121, 117, 118, 119, 120, 121,
+	130, 131, 132, 133, 134, 130, 131, 145, 146, 147, 143, 144, 145, 146, 160, 156,
+	157, 158, 159, 160, 156, 170, 171, 172, 173, 169, 170, 171, 185, 186, 182, 183,
+	184, 185, 186, 195, 196, 197, 198, 199, 195, 196, 210, 211, 212, 208, 209, 210,
+	211, 225, 221, 222, 223, 224, 225, 221, 235, 236, 237, 238, 234, 235, 236, 250,
+	251, 247, 248, 249, 250, 251, 4, 5, 6, 7
+};
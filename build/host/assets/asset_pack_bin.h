@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+#define asset_pack_size (44810)
+extern const uint8_t asset_pack[44810];
@@ -0,0 +1,14 @@
+#include <wonderful.h>
+#include <stdint.h>
+const uint8_t __wf_rom gfx_baize_mono_tiles[144] __attribute__((aligned(2))) = {
+	0x0, 0x7, 0xe, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x3, 0xa, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0x79, 0x75, 0x76, 0x77, 0x78, 0x79, 0x82, 0x83, 0x84, 0x85, 0x86, 0x82, 0x83, 0x91, 0x92, 0x93, 0x8f, 0x90, 0x91, 0x92, 0xa0, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0x9c, 0xaa, 0xab, 0xac, 0xad, 0xa9, 0xaa, 0xab, 0xb9, 0xba, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc3, 0xc4, 0xd2, 0xd3, 0xd4, 0xd0, 0xd1, 0xd2, 0xd3, 0xe1, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xdd, 0xeb, 0xec, 0xed, 0xee, 0xea, 0xeb, 0xec, 0xfa, 0xfb, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0x4, 0x5, 0x6, 0x7
+};
+const uint8_t __wf_rom gfx_baize_mono_palette[32] __attribute__((aligned(2))) = {
+	0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+const uint8_t __wf_rom gfx_baize_tiles[288] __attribute__((aligned(2))) = {
+	0x0, 0x7, 0xe, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x3, 0xa, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0x79, 0x75, 0x76, 0x77, 0x78, 0x79, 0x82, 0x83, 0x84, 0x85, 0x86, 0x82, 0x83, 0x91, 0x92, 0x93, 0x8f, 0x90, 0x91, 0x92, 0xa0, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0x9c, 0xaa, 0xab, 0xac, 0xad, 0xa9, 0xaa, 0xab, 0xb9, 0xba, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc3, 0xc4, 0xd2, 0xd3, 0xd4, 0xd0, 0xd1, 0xd2, 0xd3, 0xe1, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xdd, 0xeb, 0xec, 0xed, 0xee, 0xea, 0xeb, 0xec, 0xfa, 0xfb, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0x4, 0x5, 0x6, 0x7, 0x8, 0x4, 0x5, 0x13, 0x14, 0x15, 0x11, 0x12, 0x13, 0x14, 0x22, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x1e, 0x2c, 0x2d, 0x2e, 0x2f, 0x2b, 0x2c, 0x2d, 0x3b, 0x3c, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x45, 0x46, 0x47, 0x48, 0x49, 0x45, 0x46, 0x54, 0x55, 0x56, 0x52, 0x53, 0x54, 0x55, 0x63, 0x5f, 0x60, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6, 0xfd, 0x4, 0xb, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xf2, 0xf9, 0xd5, 0xd6, 0xd7, 0xe5, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe1, 0xef, 0xf0, 0xf1, 0xf2, 0xee, 0xef, 0xf0, 0xfe, 0xff, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0x8, 0x9, 0xa, 0xb, 0xc, 0x8, 0x9, 0x17
+};
+const uint8_t __wf_rom gfx_baize_palette[32] __attribute__((aligned(2))) = {
+	0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
@@ -0,0 +1,7 @@
+#pragma once
+#include <wonderful.h>
+#include <stdint.h>
+extern const uint8_t __wf_rom gfx_baize_mono_tiles[144];
+extern const uint8_t __wf_rom gfx_baize_mono_palette[32];
+extern const uint8_t __wf_rom gfx_baize_tiles[288];
+extern const uint8_t __wf_rom gfx_baize_palette[32];
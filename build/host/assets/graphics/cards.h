@@ -0,0 +1,7 @@
+#pragma once
+#include <wonderful.h>
+#include <stdint.h>
+extern const uint8_t __wf_rom gfx_cards_mono_tiles[4096];
+extern const uint8_t __wf_rom gfx_cards_mono_palette[32];
+extern const uint8_t __wf_rom gfx_cards_tiles[8192];
+extern const uint8_t __wf_rom gfx_cards_palette[32];
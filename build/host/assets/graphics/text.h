@@ -0,0 +1,7 @@
+#pragma once
+#include <wonderful.h>
+#include <stdint.h>
+extern const uint8_t __wf_rom gfx_text_mono_tiles[1024];
+extern const uint8_t __wf_rom gfx_text_mono_palette[32];
+extern const uint8_t __wf_rom gfx_text_tiles[2048];
+extern const uint8_t __wf_rom gfx_text_palette[32];
@@ -0,0 +1,9 @@
+#pragma once
+#include <wonderful.h>
+#include <stdint.h>
+extern const uint8_t __wf_rom gfx_title_screen_mono_tiles[8064];
+extern const uint16_t __wf_rom gfx_title_screen_mono_map[504];
+extern const uint8_t __wf_rom gfx_title_screen_mono_palette[32];
+extern const uint8_t __wf_rom gfx_title_screen_tiles[16128];
+extern const uint16_t __wf_rom gfx_title_screen_map[504];
+extern const uint8_t __wf_rom gfx_title_screen_palette[32];
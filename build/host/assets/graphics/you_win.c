@@ -0,0 +1,14 @@
+#include <wonderful.h>
+#include <stdint.h>
+const uint8_t __wf_rom gfx_you_win_mono_tiles[512] __attribute__((aligned(2))) = {
+	0x0, 0x7, 0xe, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x3, 0xa, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0x79, 0x75, 0x76, 0x77, 0x78, 0x79, 0x82, 0x83, 0x84, 0x85, 0x86, 0x82, 0x83, 0x91, 0x92, 0x93, 0x8f, 0x90, 0x91, 0x92, 0xa0, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0x9c, 0xaa, 0xab, 0xac, 0xad, 0xa9, 0xaa, 0xab, 0xb9, 0xba, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc3, 0xc4, 0xd2, 0xd3, 0xd4, 0xd0, 0xd1, 0xd2, 0xd3, 0xe1, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xdd, 0xeb, 0xec, 0xed, 0xee, 0xea, 0xeb, 0xec, 0xfa, 0xfb, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0x4, 0x5, 0x6, 0x7, 0x8, 0x4, 0x5, 0x13, 0x14, 0x15, 0x11, 0x12, 0x13, 0x14, 0x22, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x1e, 0x2c, 0x2d, 0x2e, 0x2f, 0x2b, 0x2c, 0x2d, 0x3b, 0x3c, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x45, 0x46, 0x47, 0x48, 0x49, 0x45, 0x46, 0x54, 0x55, 0x56, 0x52, 0x53, 0x54, 0x55, 0x63, 0x5f, 0x60, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6, 0xfd, 0x4, 0xb, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xf2, 0xf9, 0xd5, 0xd6, 0xd7, 0xe5, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe1, 0xef, 0xf0, 0xf1, 0xf2, 0xee, 0xef, 0xf0, 0xfe, 0xff, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0x8, 0x9, 0xa, 0xb, 0xc, 0x8, 0x9, 0x17, 0x18, 0x19, 0x15, 0x16, 0x17, 0x18, 0x26, 0x22, 0x23, 0x24, 0x25, 0x26, 0x22, 0x30, 0x31, 0x32, 0x33, 0x2f, 0x30, 0x31, 0x3f, 0x40, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x49, 0x4a, 0x58, 0x59, 0x5a, 0x56, 0x57, 0x58, 0x59, 0x67, 0x63, 0x64, 0x65, 0x66, 0x67, 0x63, 0x71, 0x72, 0x73, 0x74, 0x70, 0x71, 0x72, 0x80, 0x81, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8a, 0x8b, 0x99, 0x9a, 0x9b, 0x97, 0x98, 0x99, 0x9a, 0xa8, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa4, 0xb2, 0xb3, 0xb4, 0xb5, 0xb1, 0xb2, 0xb3, 0xc1, 0xc2, 0xbe, 0xbf, 0xc0, 0xc1, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xf0, 0xf7, 0xfe, 0x5, 0xc, 0x13, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xf3, 0xfa, 0x1, 0x8, 0xf, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x43, 0x44, 0x40, 0x41, 0x42, 0x43, 0x44, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x4d, 0x4e, 0x5c, 0x5d, 0x5e, 0x5a, 0x5b, 0x5c, 0x5d, 0x6b, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x67, 0x75, 0x76, 0x77, 0x78, 0x74, 0x75, 0x76, 0x84, 0x85, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x8e, 0x8f, 0x9d, 0x9e, 0x9f, 0x9b, 0x9c, 0x9d, 0x9e, 0xac, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xa8, 0xb6
+};
+const uint8_t __wf_rom gfx_you_win_mono_palette[32] __attribute__((aligned(2))) = {
+	0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+const uint8_t __wf_rom gfx_you_win_tiles[1024] __attribute__((aligned(2))) = {
+	0x0, 0x7, 0xe, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x3, 0xa, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0x79, 0x75, 0x76, 0x77, 0x78, 0x79, 0x82, 0x83, 0x84, 0x85, 0x86, 0x82, 0x83, 0x91, 0x92, 0x93, 0x8f, 0x90, 0x91, 0x92, 0xa0, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0x9c, 0xaa, 0xab, 0xac, 0xad, 0xa9, 0xaa, 0xab, 0xb9, 0xba, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc3, 0xc4, 0xd2, 0xd3, 0xd4, 0xd0, 0xd1, 0xd2, 0xd3, 0xe1, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xdd, 0xeb, 0xec, 0xed, 0xee, 0xea, 0xeb, 0xec, 0xfa, 0xfb, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0x4, 0x5, 0x6, 0x7, 0x8, 0x4, 0x5, 0x13, 0x14, 0x15, 0x11, 0x12, 0x13, 0x14, 0x22, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x1e, 0x2c, 0x2d, 0x2e, 0x2f, 0x2b, 0x2c, 0x2d, 0x3b, 0x3c, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x45, 0x46, 0x47, 0x48, 0x49, 0x45, 0x46, 0x54, 0x55, 0x56, 0x52, 0x53, 0x54, 0x55, 0x63, 0x5f, 0x60, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6, 0xfd, 0x4, 0xb, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xf2, 0xf9, 0xd5, 0xd6, 0xd7, 0xe5, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe1, 0xef, 0xf0, 0xf1, 0xf2, 0xee, 0xef, 0xf0, 0xfe, 0xff, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0x8, 0x9, 0xa, 0xb, 0xc, 0x8, 0x9, 0x17, 0x18, 0x19, 0x15, 0x16, 0x17, 0x18, 0x26, 0x22, 0x23, 0x24, 0x25, 0x26, 0x22, 0x30, 0x31, 0x32, 0x33, 0x2f, 0x30, 0x31, 0x3f, 0x40, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x49, 0x4a, 0x58, 0x59, 0x5a, 0x56, 0x57, 0x58, 0x59, 0x67, 0x63, 0x64, 0x65, 0x66, 0x67, 0x63, 0x71, 0x72, 0x73, 0x74, 0x70, 0x71, 0x72, 0x80, 0x81, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8a, 0x8b, 0x99, 0x9a, 0x9b, 0x97, 0x98, 0x99, 0x9a, 0xa8, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa4, 0xb2, 0xb3, 0xb4, 0xb5, 0xb1, 0xb2, 0xb3, 0xc1, 0xc2, 0xbe, 0xbf, 0xc0, 0xc1, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xf0, 0xf7, 0xfe, 0x5, 0xc, 0x13, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xf3, 0xfa, 0x1, 0x8, 0xf, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x43, 0x44, 0x40, 0x41, 0x42, 0x43, 0x44, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x4d, 0x4e, 0x5c, 0x5d, 0x5e, 0x5a, 0x5b, 0x5c, 0x5d, 0x6b, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x67, 0x75, 0x76, 0x77, 0x78, 0x74, 0x75, 0x76, 0x84, 0x85, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x8e, 0x8f, 0x9d, 0x9e, 0x9f, 0x9b, 0x9c, 0x9d, 0x9e, 0xac, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xa8, 0xb6, 0xb7, 0xb8, 0xb9, 0xb5, 0xb6, 0xb7, 0xc5, 0xc6, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xcf, 0xd0, 0xde, 0xdf, 0xe0, 0xdc, 0xdd, 0xde, 0xdf, 0xed, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xe9, 0xf7, 0xf8, 0xf9, 0xfa, 0xf6, 0xf7, 0xf8, 0x6, 0x7, 0x3, 0x4, 0x5, 0x6, 0x7, 0x10, 0x11, 0x12, 0x13, 0x14, 0x10, 0x11, 0x1f, 0x20, 0x21, 0x1d, 0x1e, 0x1f, 0x20, 0x2e, 0x2a, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xf1, 0xf8, 0xff, 0x6, 0xd, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xed, 0xf4, 0xfb, 0x2, 0x9, 0x10, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x9f, 0xa0, 0xa1, 0xa2, 0xb0, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xac, 0xba, 0xbb, 0xbc, 0xbd, 0xb9, 0xba, 0xbb, 0xc9, 0xca, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd3, 0xd4, 0xe2, 0xe3, 0xe4, 0xe0, 0xe1, 0xe2, 0xe3, 0xf1, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xed, 0xfb, 0xfc, 0xfd, 0xfe, 0xfa, 0xfb, 0xfc, 0xa, 0xb, 0x7, 0x8, 0x9, 0xa, 0xb, 0x14, 0x15, 0x16, 0x17, 0x18, 0x14, 0x15, 0x23, 0x24, 0x25, 0x21, 0x22, 0x23, 0x24, 0x32, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x2e, 0x3c, 0x3d, 0x3e, 0x3f, 0x3b, 0x3c, 0x3d, 0x4b, 0x4c, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x55, 0x56, 0x57, 0x58, 0x59, 0x55, 0x56, 0x64, 0x65, 0x66, 0x62, 0x63, 0x64, 0x65, 0x73, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x6f, 0x7d, 0x7e, 0x7f, 0x80, 0x7c, 0x7d, 0x7e, 0x8c, 0x8d, 0x89, 0x8a, 0x8b, 0x0, 0x7, 0xe, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x3, 0xa, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0x0, 0xe, 0xf, 0xb, 0xc, 0xd, 0xe, 0xf, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x18, 0x19, 0x27, 0x28, 0x29, 0x25, 0x26, 0x27, 0x28, 0x36, 0x32, 0x33, 0x34, 0x35, 0x36, 0x32, 0x40, 0x41, 0x42, 0x43, 0x3f, 0x40, 0x41, 0x4f, 0x50, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x59, 0x5a, 0x68, 0x69, 0x6a, 0x66, 0x67, 0x68, 0x69, 0x77, 0x73, 0x74, 0x75, 0x76, 0x77, 0x73, 0x81, 0x82, 0x83, 0x84, 0x80, 0x81, 0x82, 0x90, 0x91, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9a, 0x9b, 0xa9, 0xaa, 0xab, 0xa7, 0xa8, 0xa9, 0xaa, 0xb8, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb4, 0xc2, 0xc3, 0xc4, 0xc5, 0xc1, 0xc2, 0xc3, 0xd1, 0xd2, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xdb, 0xdc, 0xea, 0xeb, 0xec, 0xe8, 0xe9, 0xea, 0xeb, 0xf9, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6, 0xfd, 0x4, 0xb, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xf2, 0xf9
+};
+const uint8_t __wf_rom gfx_you_win_palette[32] __attribute__((aligned(2))) = {
+	0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
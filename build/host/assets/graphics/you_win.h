@@ -0,0 +1,7 @@
+#pragma once
+#include <wonderful.h>
+#include <stdint.h>
+extern const uint8_t __wf_rom gfx_you_win_mono_tiles[512];
+extern const uint8_t __wf_rom gfx_you_win_mono_palette[32];
+extern const uint8_t __wf_rom gfx_you_win_tiles[1024];
+extern const uint8_t __wf_rom gfx_you_win_palette[32];
@@ -0,0 +1,177 @@
+#include <stdint.h>
+
+const uint8_t __attribute__((aligned(2))) solution_book[] = {
+	32, 0, 0, 0, 87, 0, 8, 12, 9, 42, 27, 28, 140, 88, 113, 117,
+	124, 172, 106, 108, 172, 35, 42, 33, 44, 124, 124, 44, 60, 60, 147, 41,
+	50, 114, 103, 99, 108, 6, 28, 60, 54, 19, 20, 52, 60, 97, 108, 12,
+	101, 70, 6, 3, 144, 25, 21, 16, 149, 25, 177, 59, 48, 176, 59, 60,
+	156, 73, 64, 140, 88, 83, 131, 72, 144, 64, 70, 73, 76, 164, 90, 12,
+	60, 179, 91, 84, 180, 91, 164, 10, 12, 176, 91, 160, 90, 1, 0, 90,
+	0, 8, 9, 10, 123, 80, 80, 92, 12, 92, 135, 88, 117, 118, 70, 116,
+	124, 148, 121, 117, 7, 12, 12, 172, 10, 176, 43, 33, 37, 117, 167, 42,
+	32, 135, 18, 24, 16, 129, 104, 96, 128, 104, 103, 167, 106, 108, 188, 107,
+	54, 156, 57, 33, 35, 39, 50, 18, 135, 72, 66, 130, 72, 76, 19, 20,
+	22, 166, 74, 131, 72, 76, 64, 132, 24, 164, 26, 28, 49, 52, 20, 161,
+	58, 49, 92, 92, 92, 108, 108, 108, 100, 54, 60, 2, 0, 80, 0, 12,
+	8, 12, 9, 10, 123, 124, 140, 24, 28, 81, 83, 92, 76, 145, 105, 99,
+	108, 86, 81, 92, 21, 133, 5, 69, 8, 176, 64, 107, 96, 101, 176, 75,
+	70, 179, 75, 132, 23, 24, 18, 130, 24, 20, 164, 42, 36, 164, 116, 42,
+	22, 35, 38, 134, 56, 54, 134, 24, 161, 122, 114, 113, 161, 122, 151, 57,
+	135, 56, 55, 48, 60, 49, 54, 60, 135, 40, 151, 41, 39, 60, 35, 3,
+	0, 64, 0, 76, 92, 8, 9, 10, 43, 44, 12, 124, 64, 76, 76, 69,
+	128, 24, 28, 22, 28, 44, 124, 140, 24, 21, 188, 123, 124, 28, 113, 76,
+	36, 36, 36, 4, 82, 150, 9, 2, 4, 128, 56, 146, 57, 60, 156, 57,
+	140, 56, 48, 172, 106, 96, 97, 108, 108, 108, 150, 89, 160, 90, 60, 83,
+	124, 87, 92, 4, 0, 89, 0, 60, 60, 8, 73, 26, 27, 16, 21, 23,
+	28, 103, 97, 128, 120, 113, 129, 8, 145, 65, 73, 69, 76, 36, 52, 128,
+	104, 98, 97, 129, 104, 166, 90, 134, 88, 144, 89, 92, 81, 76, 172, 74,
+	70, 36, 166, 42, 32, 44, 92, 144, 89, 37, 117, 128, 40, 33, 146, 57,
+	28, 60, 50, 52, 116, 163, 122, 179, 75, 67, 179, 75, 148, 116, 121, 124,
+	7, 4, 148, 9, 108, 124, 7, 3, 115, 7, 147, 9, 5, 7, 3, 12,
+	5, 0, 87, 0, 28, 8, 9, 10, 123, 124, 87, 181, 107, 5, 6, 4,
+	12, 32, 156, 57, 48, 160, 106, 96, 160, 49, 58, 60, 130, 56, 37, 38,
+	33, 35, 147, 25, 19, 147, 41, 38, 163, 115, 26, 44, 130, 24, 178, 27,
+	19, 28, 113, 117, 115, 124, 103, 87, 183, 75, 71, 183, 91, 132, 104, 100,
+	97, 132, 104, 108, 86, 182, 91, 12, 128, 88, 82, 81, 92, 162, 74, 82,
+	69, 165, 101, 106, 70, 182, 75, 69, 166, 74, 76, 6, 0, 84, 0, 60,
+	8, 9, 10, 43, 44, 2, 12, 52, 163, 10, 12, 32, 33, 145, 41, 38,
+	44, 166, 58, 50, 162, 122, 114, 163, 10, 144, 121, 112, 124, 176, 27, 124,
+	71, 23, 167, 90, 87, 44, 44, 124, 124, 183, 27, 44, 44, 18, 178, 18,
+	27, 16, 176, 75, 64, 176, 27, 114, 124, 60, 124, 60, 55, 156, 57, 172,
+	106, 103, 167, 106, 97, 108, 129, 72, 65, 65, 52, 83, 99, 147, 105, 103,
+	134, 88, 86, 7, 0, 77, 0, 28, 8, 9, 122, 123, 124, 114, 177, 123,
+	124, 92, 135, 24, 28, 101, 103, 67, 71, 161, 74, 65, 76, 65, 52, 53,
+	60, 55, 60, 140, 12, 44, 8, 7, 38, 36, 22, 28, 178, 91, 87, 92,
+	92, 183, 27, 28, 140, 44, 24, 172, 28, 28, 60, 58, 177, 107, 97, 177,
+	43, 12, 12, 32, 32, 37, 33, 82, 48, 83, 131, 88, 76, 76, 148, 105,
+	132, 104, 180, 107, 8, 0, 71, 0, 76, 124, 8, 9, 10, 27, 28, 86,
+	92, 124, 22, 161, 122, 116, 117, 124, 55, 172, 74, 67, 71, 71, 163, 74,
+	148, 20, 9, 2, 7, 39, 135, 56, 55, 7, 176, 16, 27, 28, 19, 177,
+	107, 145, 105, 97, 108, 145, 41, 44, 60, 177, 97, 91, 81, 84, 36, 148,
+	89, 36, 52, 177, 49, 43, 44, 161, 106, 108, 166, 58, 44, 50, 54, 9,
+	0, 98, 0, 8, 9, 106, 75, 97, 96, 101, 99, 70, 70, 76, 92, 71,
+	71, 52, 4, 3, 145, 9, 4, 84, 180, 11, 32, 130, 88, 178, 91, 92,
+	130, 88, 82, 21, 133, 120, 117, 133, 8, 5, 16, 133, 120, 112, 128, 24,
+	21, 28, 183, 27, 16, 21, 18, 145, 41, 33, 145, 57, 49, 145, 57, 49,
+	50, 135, 56, 60, 60, 147, 121, 115, 147, 121, 113, 177, 123, 124, 135, 40,
+	39, 135, 40, 76, 76, 76, 92, 28, 108, 108, 96, 38, 134, 40, 35, 76,
+	76, 132, 36, 40, 39, 10, 0, 95, 0, 76, 8, 9, 10, 123, 124, 160,
+	122, 124, 81, 92, 28, 176, 123, 54, 48, 115, 167, 90, 87, 82, 130, 88,
+	149, 57, 53, 149, 57, 50, 18, 28, 60, 76, 140, 56, 147, 105, 179, 107,
+	103, 23, 103, 103, 128, 40, 39, 135, 72, 66, 76, 180, 107, 148, 105, 166,
+	10, 182, 27, 150, 25, 20, 160, 26, 177, 1, 11, 161, 76, 74, 65, 161,
+	10, 76, 4, 3, 147, 9, 163, 10, 179, 43, 7, 32, 176, 75, 148, 41,
+	36, 148, 41, 44, 37, 44, 181, 43, 11, 0, 79, 0, 92, 8, 9, 10,
+	123, 124, 124, 113, 124, 178, 27, 28, 23, 81, 130, 88, 86, 92, 188, 91,
+	21, 181, 59, 19, 21, 163, 26, 18, 28, 44, 129, 104, 97, 129, 8, 5,
+	101, 108, 96, 134, 72, 69, 70, 69, 76, 37, 76, 100, 132, 8, 92, 156,
+	9, 176, 43, 44, 92, 181, 43, 37, 44, 39, 183, 43, 103, 146, 57, 130,
+	104, 54, 150, 57, 178, 59, 76, 71, 52, 49, 60, 12, 0, 102, 0, 108,
+	8, 9, 10, 123, 117, 116, 124, 112, 124, 71, 135, 104, 103, 39, 44, 148,
+	105, 97, 161, 90, 86, 92, 166, 90, 92, 92, 145, 73, 129, 72, 70, 71,
+	76, 167, 74, 65, 180, 11, 148, 89, 5, 181, 21, 107, 108, 101, 97, 6,
+	5, 181, 11, 160, 42, 96, 38, 44, 44, 92, 92, 124, 124, 28, 188, 27,
+	18, 178, 91, 82, 178, 91, 81, 117, 177, 123, 116, 180, 27, 28, 84, 133,
+	24, 117, 23, 16, 21, 112, 23, 128, 104, 150, 25, 22, 28, 60, 28, 49,
+	118, 55, 60, 28, 49, 13, 0, 73, 0, 8, 9, 122, 123, 116, 124, 128,
+	88, 84, 92, 99, 112, 103, 148, 25, 23, 167, 103, 7, 103, 26, 28, 156,
+	60, 41, 39, 55, 151, 57, 60, 156, 89, 86, 149, 69, 53, 57, 60, 181,
+	43, 35, 133, 104, 164, 106, 134, 8, 2, 6, 5, 176, 43, 38, 182, 11,
+	134, 6, 32, 24, 182, 27, 19, 129, 72, 33, 66, 65, 130, 72, 64, 76,
+	76, 76, 14, 0, 75, 0, 124, 8, 9, 90, 92, 28, 75, 69, 76, 28,
+	70, 161, 74, 76, 100, 36, 172, 106, 108, 166, 58, 131, 40, 35, 44, 32,
+	44, 156, 9, 2, 146, 98, 9, 3, 12, 60, 140, 56, 60, 144, 105, 96,
+	48, 76, 66, 52, 60, 60, 140, 87, 88, 92, 92, 12, 64, 20, 23, 23,
+	28, 92, 60, 101, 54, 19, 21, 113, 115, 19, 129, 113, 120, 113, 124, 65,
+	116, 15, 0, 82, 0, 12, 8, 9, 42, 43, 39, 44, 84, 80, 92, 164,
+	42, 36, 44, 50, 82, 165, 58, 54, 60, 60, 149, 105, 181, 59, 99, 147,
+	25, 97, 100, 22, 20, 28, 44, 100, 108, 96, 22, 145, 73, 70, 150, 41,
+	130, 8, 178, 27, 18, 114, 21, 28, 1, 129, 8, 3, 12, 160, 122, 108,
+	156, 121, 114, 112, 124, 92, 76, 156, 73, 76, 67, 167, 90, 80, 160, 90,
+	82, 69, 69, 76, 162, 74, 67, 16, 0, 75, 0, 12, 8, 9, 10, 11,
+	101, 5, 65, 64, 96, 176, 59, 163, 106, 99, 108, 108, 70, 76, 150, 73,
+	20, 103, 108, 38, 33, 44, 44, 32, 44, 44, 18, 16, 22, 32, 18, 28,
+	124, 76, 76, 20, 148, 89, 12, 28, 81, 145, 41, 130, 88, 100, 98, 86,
+	81, 92, 81, 49, 117, 183, 59, 55, 50, 60, 108, 54, 49, 131, 120, 92,
+	92, 117, 115, 133, 120, 124, 17, 0, 78, 0, 124, 28, 12, 124, 8, 9,
+	10, 11, 2, 71, 64, 80, 179, 91, 132, 88, 92, 92, 87, 133, 40, 181,
+	53, 27, 23, 130, 24, 28, 22, 16, 161, 58, 49, 150, 57, 60, 108, 172,
+	58, 48, 99, 96, 48, 60, 99, 131, 104, 108, 44, 164, 42, 36, 44, 44,
+	108, 70, 76, 172, 42, 33, 44, 66, 28, 172, 74, 76, 64, 172, 122, 140,
+	120, 76, 116, 124, 132, 120, 164, 122, 18, 0, 69, 0, 28, 8, 9, 12,
+	10, 12, 59, 60, 60, 124, 172, 122, 124, 115, 87, 151, 57, 55, 151, 9,
+	48, 54, 48, 99, 96, 48, 99, 108, 163, 106, 99, 131, 88, 108, 70, 69,
+	76, 44, 67, 163, 74, 76, 36, 32, 132, 24, 108, 86, 124, 60, 19, 145,
+	89, 92, 161, 90, 92, 28, 37, 124, 44, 38, 134, 24, 22, 134, 24, 44,
+	18, 19, 0, 83, 0, 8, 9, 10, 123, 124, 188, 43, 44, 145, 9, 12,
+	2, 80, 70, 66, 76, 117, 69, 71, 67, 36, 84, 82, 179, 91, 80, 149,
+	121, 115, 112, 147, 25, 16, 144, 89, 80, 144, 89, 92, 21, 60, 60, 156,
+	57, 48, 144, 97, 105, 103, 55, 60, 97, 99, 101, 181, 37, 27, 28, 101,
+	134, 22, 40, 33, 36, 129, 40, 39, 135, 24, 44, 18, 130, 24, 20, 20,
+	148, 57, 21, 49, 145, 49, 53, 49, 20, 0, 72, 0, 28, 124, 124, 8,
+	9, 10, 43, 44, 140, 40, 44, 44, 92, 160, 42, 21, 16, 20, 23, 19,
+	18, 98, 65, 49, 52, 99, 97, 177, 107, 108, 140, 88, 182, 75, 64, 71,
+	70, 76, 166, 74, 84, 92, 132, 84, 92, 53, 8, 4, 132, 120, 118, 134,
+	54, 8, 180, 11, 44, 172, 10, 4, 37, 38, 50, 48, 176, 59, 128, 48,
+	120, 32, 114, 124, 21, 0, 74, 0, 8, 9, 10, 11, 4, 54, 3, 12,
+	176, 59, 48, 176, 91, 146, 89, 92, 81, 80, 144, 73, 64, 144, 48, 32,
+	73, 76, 147, 105, 97, 108, 156, 44, 105, 101, 161, 58, 53, 165, 55, 58,
+	131, 71, 72, 76, 132, 36, 40, 36, 32, 164, 42, 44, 114, 116, 36, 130,
+	24, 146, 25, 19, 147, 25, 22, 118, 131, 120, 118, 124, 124, 140, 24, 28,
+	28, 20, 22, 0, 78, 0, 8, 9, 10, 12, 123, 113, 124, 60, 12, 124,
+	2, 116, 55, 12, 16, 80, 96, 32, 160, 42, 98, 96, 18, 21, 28, 28,
+	161, 106, 99, 100, 134, 86, 72, 70, 134, 24, 69, 69, 70, 150, 73, 129,
+	72, 71, 132, 52, 56, 60, 60, 60, 164, 58, 131, 40, 163, 42, 36, 38,
+	35, 36, 35, 132, 88, 163, 90, 12, 12, 124, 28, 118, 124, 87, 92, 92,
+	83, 167, 26, 21, 23, 0, 87, 0, 8, 9, 106, 91, 92, 160, 90, 92,
+	81, 92, 37, 33, 36, 44, 156, 89, 165, 42, 133, 40, 162, 66, 74, 49,
+	48, 67, 76, 140, 72, 66, 146, 9, 76, 100, 108, 98, 108, 101, 6, 133,
+	8, 12, 150, 121, 118, 124, 3, 6, 5, 128, 56, 48, 128, 112, 120, 167,
+	26, 135, 72, 180, 59, 52, 180, 59, 53, 60, 131, 24, 19, 131, 24, 163,
+	92, 44, 42, 39, 167, 26, 19, 44, 44, 35, 130, 24, 162, 26, 18, 24,
+	0, 83, 0, 60, 8, 9, 106, 107, 108, 160, 106, 99, 108, 70, 86, 140,
+	56, 54, 134, 24, 22, 28, 28, 22, 21, 145, 33, 9, 130, 8, 7, 4,
+	12, 108, 12, 48, 60, 50, 49, 180, 59, 131, 72, 147, 73, 66, 67, 148,
+	121, 115, 115, 108, 118, 115, 124, 163, 90, 179, 91, 80, 132, 120, 183, 43,
+	167, 39, 42, 183, 43, 38, 32, 144, 41, 39, 71, 135, 88, 151, 89, 80,
+	133, 72, 37, 66, 130, 72, 25, 0, 83, 0, 8, 9, 10, 59, 60, 60,
+	145, 57, 60, 48, 83, 83, 163, 10, 101, 99, 3, 163, 106, 108, 108, 86,
+	177, 43, 44, 76, 112, 146, 121, 130, 120, 82, 82, 80, 133, 69, 69, 24,
+	21, 133, 72, 76, 148, 41, 60, 12, 67, 146, 73, 116, 116, 118, 7, 6,
+	118, 135, 23, 24, 28, 156, 9, 108, 6, 16, 28, 28, 28, 33, 92, 44,
+	124, 112, 39, 36, 116, 151, 39, 41, 60, 60, 60, 35, 44, 26, 0, 86,
+	0, 60, 8, 12, 9, 10, 75, 76, 76, 92, 130, 50, 56, 49, 60, 60,
+	60, 3, 124, 5, 112, 96, 97, 103, 103, 101, 54, 67, 67, 131, 24, 76,
+	36, 20, 132, 24, 19, 35, 131, 24, 147, 25, 178, 27, 21, 161, 42, 145,
+	89, 81, 145, 121, 129, 120, 113, 129, 120, 145, 121, 115, 183, 91, 162, 90,
+	87, 165, 42, 39, 167, 90, 82, 83, 162, 90, 149, 41, 37, 149, 41, 181,
+	107, 108, 38, 134, 40, 44, 37, 27, 0, 96, 0, 8, 9, 10, 11, 12,
+	180, 11, 2, 176, 27, 144, 89, 80, 112, 144, 22, 25, 28, 22, 20, 22,
+	65, 161, 42, 129, 72, 71, 65, 65, 52, 115, 117, 113, 131, 72, 71, 67,
+	65, 148, 84, 41, 36, 135, 56, 52, 132, 56, 53, 133, 56, 178, 59, 48,
+	144, 57, 160, 42, 144, 32, 41, 44, 160, 42, 96, 44, 82, 60, 83, 108,
+	35, 178, 82, 123, 149, 121, 117, 116, 116, 87, 132, 88, 151, 89, 164, 90,
+	183, 107, 92, 101, 188, 91, 101, 181, 107, 103, 99, 28, 0, 68, 0, 8,
+	9, 42, 107, 114, 124, 70, 70, 76, 76, 76, 164, 42, 37, 53, 35, 147,
+	41, 44, 36, 82, 188, 107, 100, 4, 1, 4, 44, 162, 122, 124, 116, 87,
+	92, 60, 84, 92, 39, 44, 2, 2, 128, 16, 24, 18, 28, 16, 160, 97,
+	106, 108, 99, 96, 86, 124, 172, 26, 22, 166, 58, 53, 48, 165, 26, 49,
+	60, 54, 60, 29, 0, 100, 0, 8, 9, 74, 43, 44, 69, 76, 162, 66,
+	74, 69, 20, 52, 5, 48, 54, 52, 180, 107, 96, 176, 107, 98, 96, 103,
+	108, 22, 92, 16, 28, 151, 25, 23, 145, 33, 9, 161, 90, 81, 161, 106,
+	6, 150, 41, 39, 151, 89, 87, 92, 151, 41, 44, 28, 76, 76, 76, 124,
+	28, 76, 4, 124, 53, 52, 100, 108, 38, 44, 44, 82, 86, 38, 82, 84,
+	165, 5, 10, 6, 3, 147, 9, 166, 122, 115, 163, 122, 6, 112, 160, 42,
+	130, 120, 114, 117, 130, 8, 2, 112, 130, 120, 112, 30, 0, 86, 0, 28,
+	76, 8, 9, 42, 43, 44, 128, 56, 60, 81, 160, 90, 81, 84, 92, 165,
+	58, 53, 176, 32, 43, 37, 181, 11, 44, 2, 188, 11, 5, 181, 11, 12,
+	37, 50, 130, 56, 50, 19, 147, 105, 97, 103, 99, 131, 104, 115, 118, 80,
+	92, 60, 188, 11, 5, 181, 107, 108, 134, 118, 120, 117, 124, 124, 151, 9,
+	135, 24, 23, 135, 8, 16, 19, 16, 28, 23, 22, 44, 33, 35, 66, 19,
+	65, 70, 76, 134, 70, 31, 0, 83, 0, 124, 8, 9, 10, 27, 28, 5,
+	12, 124, 7, 3, 176, 43, 44, 21, 22, 49, 48, 16, 48, 96, 147, 89,
+	80, 144, 121, 115, 124, 113, 147, 121, 135, 88, 183, 91, 92, 76, 134, 88,
+	80, 144, 41, 39, 71, 92, 37, 44, 82, 133, 56, 53, 133, 24, 20, 132,
+	24, 21, 65, 165, 106, 97, 161, 42, 33, 98, 101, 161, 58, 50, 53, 162,
+	106, 98, 162, 58, 50, 60, 147, 73, 67, 147, 73, 76
+};
@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+#define solution_book_size (2764)
+extern const uint8_t solution_book[2764];
@@ -0,0 +1,719 @@
+#include <stdint.h>
+
+const uint8_t __attribute__((aligned(2))) zobrist_keys[] = {
+	77, 201, 234, 87, 172, 171, 174, 214, 97, 98, 190, 120, 24, 27, 177, 42,
+	209, 225, 145, 51, 132, 6, 211, 250, 37, 187, 122, 218, 234, 232, 213, 46,
+	206, 192, 212, 234, 168, 12, 106, 43, 55, 3, 24, 53, 136, 200, 161, 154,
+	80, 179, 163, 213, 52, 180, 245, 218, 173, 67, 19, 226, 94, 117, 178, 198,
+	18, 219, 39, 139, 48, 197, 241, 120, 123, 70, 171, 74, 105, 222, 226, 110,
+	62, 123, 211, 144, 100, 88, 44, 9, 244, 183, 51, 198, 210, 157, 96, 169,
+	95, 151, 138, 225, 15, 243, 68, 223, 61, 64, 131, 101, 31, 57, 24, 189,
+	66, 4, 75, 253, 195, 94, 162, 37, 62, 54, 59, 161, 192, 45, 110, 56,
+	75, 54, 28, 71, 129, 226, 115, 251, 16, 163, 83, 99, 136, 185, 4, 241,
+	210, 216, 132, 160, 189, 38, 78, 72, 209, 222, 161, 31, 108, 113, 6, 171,
+	217, 188, 83, 192, 157, 32, 208, 78, 124, 26, 183, 18, 128, 178, 228, 206,
+	154, 69, 39, 78, 208, 140, 30, 116, 82, 28, 31, 21, 24, 196, 49, 36,
+	97, 130, 235, 138, 114, 57, 92, 174, 171, 212, 63, 7, 190, 133, 243, 72,
+	28, 106, 207, 48, 154, 31, 28, 108, 205, 37, 10, 18, 20, 124, 198, 128,
+	118, 173, 223, 167, 142, 205, 89, 28, 58, 240, 235, 152, 204, 170, 116, 59,
+	154, 198, 130, 107, 114, 121, 98, 89, 212, 120, 202, 223, 60, 167, 198, 138,
+	172, 13, 0, 154, 182, 206, 13, 237, 187, 191, 191, 207, 127, 176, 80, 49,
+	208, 57, 183, 204, 214, 174, 40, 90, 207, 108, 187, 177, 30, 185, 126, 88,
+	176, 232, 250, 100, 134, 124, 114, 4, 151, 183, 177, 55, 246, 177, 41, 41,
+	221, 177, 248, 253, 188, 227, 175, 147, 80, 222, 210, 148, 92, 130, 15, 44,
+	190, 227, 201, 84, 193, 235, 124, 127, 163, 226, 147, 162, 192, 85, 58, 6,
+	161, 3, 204, 220, 93, 178, 185, 203, 36, 248, 191, 67, 89, 233, 223, 43,
+	67, 230, 96, 8, 247, 14, 185, 129, 68, 102, 144, 172, 104, 123, 78, 171,
+	89, 102, 74, 224, 57, 19, 163, 60, 59, 151, 71, 134, 11, 96, 185, 224,
+	183, 172, 180, 91, 102, 95, 103, 10, 195, 27, 246, 208, 132, 50, 64, 98,
+	12, 145, 0, 230, 156, 8, 12, 112, 115, 242, 225, 210, 164, 96, 83, 121,
+	231, 170, 186, 189, 20, 236, 33, 244, 101, 16, 194, 253, 194, 31, 19, 70,
+	215, 235, 130, 152, 75, 76, 245, 122, 85, 251, 244, 188, 218, 25, 87, 80,
+	236, 13, 236, 222, 196, 234, 101, 181, 154, 181, 144, 15, 107, 216, 92, 61,
+	35, 131, 108, 108, 199, 57, 27, 125, 22, 78, 89, 94, 187, 14, 237, 132,
+	230, 248, 117, 130, 18, 236, 77, 144, 85, 228, 56, 148, 140, 1, 242, 158,
+	77, 51, 190, 6, 230, 151, 41, 218, 12, 82, 113, 242, 148, 124, 39, 222,
+	142, 109, 9, 7, 146, 162, 175, 125, 236, 107, 73, 182, 182, 104, 160, 253,
+	77, 205, 108, 230, 79, 7, 111, 135, 12, 69, 92, 151, 178, 148, 68, 224,
+	187, 86, 143, 40, 119, 165, 82, 137, 169, 90, 121, 98, 223, 153, 167, 108,
+	49, 244, 26, 108, 159, 98, 5, 97, 180, 98, 138, 103, 26, 28, 66, 80,
+	186, 234, 235, 107, 100, 157, 40, 193, 230, 240, 10, 130, 77, 131, 221, 94,
+	247, 214, 62, 56, 103, 183, 232, 190, 197, 111, 132, 168, 27, 114, 231, 138,
+	105, 41, 32, 240, 15, 14, 163, 84, 126, 99, 60, 153, 55, 147, 38, 191,
+	119, 247, 72, 197, 36, 46, 105, 175, 50, 133, 16, 223, 201, 255, 98, 57,
+	4, 124, 230, 181, 215, 231, 190, 54, 85, 44, 202, 162, 85, 1, 95, 15,
+	15, 11, 207, 1, 88, 240, 125, 245, 131, 105, 172, 37, 109, 228, 23, 187,
+	160, 147, 214, 180, 209, 190, 246, 178, 167, 36, 185, 192, 145, 96, 155, 97,
+	245, 140, 161, 188, 42, 39, 210, 42, 17, 86, 221, 168, 222, 148, 241, 65,
+	11, 192, 39, 30, 24, 176, 252, 34, 135, 166, 2, 43, 174, 84, 157, 133,
+	106, 230, 24, 206, 0, 47, 108, 136, 6, 17, 9, 188, 82, 92, 26, 91,
+	90, 151, 146, 2, 166, 19, 70, 95, 223, 58, 97, 59, 130, 76, 96, 155,
+	186, 250, 248, 204, 205, 190, 85, 166, 107, 215, 14, 32, 90, 137, 154, 166,
+	194, 226, 135, 1, 141, 89, 36, 70, 231, 127, 166, 111, 138, 54, 3, 171,
+	3, 28, 144, 119, 107, 135, 24, 246, 49, 22, 71, 56, 81, 53, 170, 138,
+	113, 25, 14, 76, 193, 162, 47, 107, 58, 98, 142, 113, 30, 231, 230, 4,
+	156, 40, 172, 216, 35, 78, 79, 234, 38, 211, 238, 114, 3, 171, 194, 185,
+	18, 23, 245, 120, 57, 121, 240, 152, 146, 72, 53, 109, 161, 58, 202, 64,
+	174, 52, 93, 244, 138, 100, 211, 11, 75, 242, 0, 143, 15, 135, 114, 184,
+	134, 123, 241, 250, 134, 249, 187, 101, 163, 172, 237, 75, 127, 192, 79, 49,
+	63, 223, 72, 225, 104, 15, 71, 175, 157, 47, 239, 155, 243, 162, 138, 189,
+	57, 117, 66, 211, 171, 98, 70, 33, 98, 240, 125, 79, 154, 211, 72, 223,
+	231, 209, 69, 98, 187, 230, 82, 215, 89, 172, 61, 251, 66, 203, 99, 152,
+	39, 131, 116, 192, 207, 46, 25, 82, 207, 80, 222, 143, 172, 215, 53, 253,
+	204, 253, 206, 191, 23, 243, 158, 110, 73, 38, 117, 175, 119, 113, 60, 124,
+	190, 231, 79, 176, 162, 61, 184, 219, 36, 103, 142, 93, 177, 93, 63, 188,
+	213, 152, 163, 166, 41, 19, 147, 98, 18, 89, 48, 30, 251, 96, 80, 183,
+	220, 246, 164, 210, 131, 76, 149, 195, 161, 41, 166, 42, 104, 179, 221, 29,
+	176, 48, 172, 221, 205, 176, 249, 44, 29, 170, 227, 70, 109, 106, 162, 71,
+	90, 44, 22, 87, 148, 135, 57, 193, 81, 145, 164, 200, 214, 30, 93, 11,
+	53, 216, 118, 184, 45, 120, 121, 13, 115, 235, 229, 109, 246, 133, 247, 193,
+	18, 247, 98, 24, 18, 30, 146, 150, 250, 163, 86, 127, 174, 123, 31, 206,
+	123, 200, 63, 12, 131, 142, 42, 83, 62, 16, 167, 93, 46, 114, 177, 75,
+	84, 154, 100, 219, 35, 246, 233, 77, 21, 89, 152, 22, 200, 14, 228, 170,
+	150, 113, 158, 76, 192, 232, 50, 215, 117, 23, 127, 207, 29, 150, 165, 159,
+	110, 53, 162, 129, 201, 75, 253, 38, 107, 173, 1, 127, 157, 239, 49, 31,
+	124, 129, 137, 122, 207, 161, 98, 30, 162, 248, 55, 1, 211, 49, 91, 58,
+	131, 131, 78, 208, 28, 144, 226, 7, 108, 103, 198, 233, 217, 74, 85, 128,
+	158, 181, 193, 8, 71, 62, 63, 240, 60, 98, 13, 233, 185, 211, 18, 236,
+	235, 185, 208, 122, 189, 12, 80, 208, 158, 79, 63, 233, 248, 112, 93, 25,
+	121, 64, 7, 95, 93, 68, 15, 86, 255, 216, 19, 110, 89, 125, 138, 180,
+	233, 57, 5, 159, 85, 187, 56, 63, 252, 224, 19, 34, 186, 176, 133, 159,
+	19, 106, 206, 27, 245, 75, 0, 7, 138, 117, 163, 193, 99, 34, 94, 77,
+	170, 219, 82, 171, 153, 148, 219, 244, 29, 0, 86, 79, 87, 17, 233, 101,
+	118, 132, 185, 191, 77, 126, 215, 105, 2, 53, 205, 69, 52, 146, 205, 142,
+	81, 130, 234, 173, 161, 76, 187, 73, 118, 234, 192, 37, 17, 240, 72, 41,
+	52, 189, 19, 222, 46, 84, 24, 159, 224, 2, 38, 38, 125, 74, 52, 41,
+	64, 242, 12, 175, 162, 182, 217, 25, 164, 197, 177, 206, 102, 234, 162, 54,
+	177, 237, 45, 22, 252, 151, 232, 216, 23, 44, 249, 136, 234, 207, 8, 2,
+	16, 192, 69, 101, 211, 120, 178, 117, 103, 181, 168, 111, 69, 85, 137, 89,
+	117, 86, 24, 23, 94, 235, 9, 167, 143, 171, 46, 214, 32, 14, 182, 104,
+	185, 9, 57, 135, 126, 45, 193, 103, 105, 69, 183, 15, 100, 202, 88, 4,
+	46, 217, 156, 191, 50, 101, 152, 179, 13, 47, 241, 88, 37, 129, 6, 223,
+	52, 240, 102, 235, 4, 58, 109, 153, 82, 7, 153, 251, 139, 119, 22, 181,
+	120, 101, 2, 7, 110, 85, 5, 62, 122, 56, 179, 1, 164, 47, 53, 177,
+	68, 29, 245, 140, 170, 215, 236, 196, 102, 172, 46, 157, 215, 78, 235, 92,
+	175, 61, 7, 147, 54, 25, 238, 226, 146, 243, 209, 24, 163, 184, 215, 242,
+	2, 146, 184, 189, 62, 58, 232, 80, 201, 236, 85, 162, 207, 166, 84, 230,
+	169, 142, 34, 35, 146, 109, 5, 44, 105, 196, 90, 183, 194, 227, 37, 21,
+	236, 26, 227, 130, 83, 172, 99, 214, 71, 41, 218, 222, 126, 19, 162, 229,
+	152, 147, 125, 94, 127, 86, 210, 109, 209, 27, 169, 196, 56, 79, 186, 29,
+	214, 199, 241, 223, 51, 254, 101, 6, 162, 158, 219, 141, 5, 149, 251, 63,
+	168, 102, 57, 230, 30, 120, 108, 151, 9, 49, 153, 21, 117, 18, 185, 68,
+	206, 160, 7, 184, 225, 158, 214, 207, 100, 172, 92, 157, 140, 41, 213, 18,
+	190, 189, 122, 75, 216, 8, 99, 133, 100, 38, 119, 107, 153, 214, 199, 120,
+	243, 69, 130, 192, 77, 92, 176, 143, 113, 116, 14, 3, 145, 100, 134, 125,
+	123, 159, 151, 147, 167, 39, 97, 111, 205, 175, 41, 57, 5, 61, 209, 150,
+	29, 114, 73, 159, 152, 217, 91, 144, 172, 41, 125, 134, 8, 185, 95, 74,
+	87, 17, 162, 18, 115, 251, 147, 65, 173, 5, 77, 225, 113, 47, 232, 126,
+	178, 108, 192, 27, 185, 212, 146, 220, 219, 64, 179, 70, 111, 198, 174, 251,
+	30, 204, 5, 79, 253, 156, 72, 38, 214, 228, 51, 143, 66, 253, 130, 134,
+	55, 235, 112, 252, 60, 12, 217, 195, 115, 95, 129, 169, 196, 182, 128, 207,
+	104, 23, 83, 242, 215, 185, 117, 135, 240, 127, 167, 57, 92, 143, 123, 29,
+	148, 27, 151, 254, 166, 57, 87, 161, 119, 136, 24, 138, 124, 154, 210, 249,
+	114, 169, 52, 249, 159, 48, 65, 239, 246, 50, 4, 227, 59, 203, 2, 206,
+	169, 241, 217, 123, 191, 152, 114, 248, 173, 140, 192, 199, 103, 183, 253, 28,
+	143, 79, 49, 232, 143, 34, 217, 249, 43, 37, 157, 108, 215, 7, 60, 207,
+	180, 198, 30, 183, 80, 91, 198, 150, 70, 197, 34, 232, 99, 253, 193, 161,
+	245, 152, 215, 83, 177, 122, 228, 185, 232, 124, 250, 224, 59, 64, 130, 67,
+	217, 154, 33, 123, 100, 66, 41, 71, 22, 79, 219, 131, 74, 187, 6, 173,
+	221, 9, 151, 55, 235, 147, 52, 3, 175, 210, 126, 184, 250, 116, 75, 39,
+	16, 18, 86, 115, 218, 25, 157, 147, 169, 112, 110, 36, 20, 151, 31, 165,
+	170, 161, 90, 168, 61, 108, 156, 113, 48, 244, 109, 127, 101, 12, 153, 252,
+	15, 159, 173, 127, 9, 60, 207, 69, 238, 232, 135, 235, 195, 87, 222, 197,
+	80, 58, 224, 235, 165, 204, 227, 121, 94, 255, 154, 14, 38, 235, 83, 127,
+	157, 109, 210, 68, 141, 236, 88, 37, 201, 77, 227, 33, 100, 117, 19, 67,
+	219, 148, 67, 154, 87, 150, 200, 243, 22, 220, 66, 193, 182, 127, 202, 194,
+	40, 220, 163, 42, 219, 99, 248, 117, 90, 220, 228, 73, 205, 88, 145, 159,
+	169, 243, 156, 37, 253, 69, 216, 198, 14, 219, 151, 2, 85, 153, 58, 199,
+	253, 24, 30, 22, 221, 157, 59, 117, 61, 237, 135, 214, 13, 77, 43, 79,
+	72, 55, 213, 247, 22, 229, 191, 118, 24, 99, 177, 201, 209, 47, 144, 95,
+	100, 126, 46, 23, 181, 208, 176, 196, 38, 227, 101, 10, 230, 124, 46, 118,
+	223, 231, 238, 143, 245, 228, 176, 49, 34, 30, 228, 136, 242, 45, 43, 111,
+	184, 127, 56, 88, 191, 223, 37, 174, 150, 159, 148, 175, 5, 117, 174, 176,
+	66, 170, 211, 191, 239, 110, 234, 153, 116, 122, 203, 82, 118, 114, 57, 141,
+	109, 154, 139, 205, 206, 196, 10, 102, 103, 107, 240, 236, 137, 142, 3, 210,
+	96, 19, 141, 217, 144, 252, 196, 7, 219, 167, 128, 146, 38, 24, 11, 73,
+	1, 105, 246, 107, 42, 87, 21, 124, 18, 246, 255, 8, 140, 108, 132, 49,
+	70, 226, 163, 62, 83, 101, 139, 31, 163, 164, 6, 23, 42, 8, 198, 177,
+	43, 121, 173, 104, 15, 39, 135, 54, 188, 105, 179, 158, 190, 159, 22, 131,
+	14, 142, 207, 76, 169, 1, 204, 28, 117, 149, 212, 3, 200, 196, 53, 190,
+	94, 52, 52, 211, 161, 14, 68, 226, 73, 242, 147, 17, 36, 81, 134, 148,
+	213, 48, 253, 138, 102, 82, 23, 176, 43, 86, 44, 17, 63, 0, 198, 230,
+	191, 152, 255, 254, 43, 183, 231, 176, 106, 113, 92, 134, 18, 159, 87, 6,
+	200, 28, 1, 67, 4, 188, 157, 115, 74, 159, 182, 71, 197, 57, 173, 31,
+	111, 116, 45, 170, 223, 81, 178, 144, 251, 79, 178, 139, 125, 149, 228, 139,
+	216, 2, 44, 48, 131, 6, 156, 190, 5, 77, 195, 247, 180, 228, 23, 82,
+	116, 77, 167, 126, 240, 88, 57, 118, 3, 186, 201, 249, 167, 21, 190, 31,
+	98, 255, 89, 124, 184, 73, 6, 53, 160, 195, 23, 122, 177, 208, 19, 206,
+	211, 252, 176, 52, 134, 161, 123, 78, 195, 232, 36, 115, 125, 4, 163, 41,
+	139, 157, 188, 108, 173, 195, 189, 30, 233, 41, 206, 127, 144, 198, 153, 228,
+	21, 190, 62, 85, 11, 178, 119, 221, 144, 53, 238, 77, 254, 119, 210, 224,
+	232, 253, 145, 107, 62, 40, 182, 209, 166, 174, 141, 130, 74, 212, 119, 220,
+	149, 97, 46, 249, 123, 184, 135, 150, 95, 255, 149, 80, 224, 116, 179, 0,
+	23, 61, 199, 171, 133, 159, 218, 192, 16, 180, 100, 246, 3, 8, 54, 124,
+	152, 229, 240, 27, 25, 33, 63, 239, 119, 150, 156, 104, 158, 96, 19, 176,
+	94, 29, 25, 92, 103, 178, 238, 137, 118, 203, 237, 171, 215, 68, 227, 66,
+	139, 140, 79, 101, 100, 122, 10, 15, 167, 146, 157, 72, 163, 247, 232, 163,
+	141, 236, 133, 30, 231, 189, 151, 193, 178, 152, 67, 243, 152, 139, 230, 138,
+	18, 108, 33, 41, 35, 230, 198, 144, 98, 164, 86, 204, 239, 233, 135, 3,
+	242, 160, 244, 41, 231, 126, 189, 0, 183, 227, 88, 67, 32, 168, 235, 186,
+	55, 53, 22, 50, 143, 66, 165, 98, 85, 57, 108, 148, 54, 142, 148, 123,
+	255, 88, 21, 160, 58, 18, 93, 106, 215, 240, 92, 203, 244, 116, 129, 253,
+	27, 50, 236, 176, 204, 96, 70, 227, 3, 27, 161, 196, 131, 20, 224, 31,
+	91, 61, 127, 179, 17, 145, 90, 206, 141, 26, 103, 19, 86, 144, 238, 246,
+	164, 6, 108, 184, 248, 197, 171, 47, 50, 32, 137, 181, 85, 54, 106, 160,
+	165, 69, 188, 50, 129, 172, 31, 251, 6, 243, 126, 223, 169, 66, 216, 34,
+	15, 138, 35, 123, 254, 136, 47, 70, 166, 127, 50, 81, 101, 168, 16, 198,
+	139, 92, 144, 176, 107, 64, 45, 219, 155, 38, 35, 23, 3, 147, 255, 13,
+	76, 21, 110, 12, 207, 183, 57, 22, 79, 178, 200, 56, 239, 228, 169, 254,
+	85, 219, 184, 132, 60, 163, 148, 101, 101, 35, 152, 207, 127, 53, 104, 181,
+	28, 31, 54, 203, 182, 245, 102, 18, 30, 40, 218, 86, 178, 223, 229, 104,
+	91, 49, 109, 177, 248, 5, 141, 255, 65, 102, 119, 185, 94, 255, 82, 226,
+	194, 81, 149, 10, 20, 115, 5, 181, 71, 42, 152, 119, 207, 150, 206, 40,
+	68, 115, 246, 184, 107, 201, 71, 165, 158, 108, 58, 209, 138, 187, 149, 9,
+	248, 59, 112, 98, 159, 38, 238, 196, 161, 22, 133, 7, 41, 229, 125, 15,
+	101, 4, 203, 200, 134, 248, 185, 160, 18, 157, 135, 106, 128, 161, 151, 189,
+	51, 47, 87, 125, 11, 110, 145, 142, 195, 171, 91, 201, 146, 47, 81, 56,
+	35, 73, 207, 169, 150, 35, 138, 93, 42, 2, 229, 38, 58, 46, 160, 82,
+	169, 244, 143, 187, 164, 50, 68, 230, 44, 215, 0, 98, 158, 0, 72, 100,
+	211, 164, 37, 239, 140, 200, 66, 44, 133, 54, 61, 223, 19, 228, 88, 68,
+	190, 167, 143, 67, 66, 188, 127, 88, 153, 220, 2, 81, 241, 195, 174, 88,
+	185, 208, 196, 154, 208, 234, 173, 26, 75, 156, 0, 89, 239, 248, 178, 27,
+	184, 109, 72, 209, 39, 123, 31, 67, 90, 110, 2, 35, 254, 62, 234, 183,
+	100, 90, 133, 246, 128, 100, 247, 228, 211, 118, 139, 4, 155, 92, 117, 32,
+	104, 84, 41, 247, 250, 109, 35, 105, 52, 217, 25, 151, 75, 234, 222, 43,
+	0, 209, 105, 36, 164, 26, 114, 215, 87, 198, 252, 16, 204, 43, 250, 142,
+	173, 15, 250, 187, 234, 135, 245, 187, 174, 143, 16, 106, 220, 57, 75, 7,
+	100, 181, 97, 110, 66, 57, 110, 65, 65, 118, 129, 78, 197, 170, 101, 105,
+	187, 255, 145, 91, 136, 28, 179, 232, 57, 122, 105, 239, 238, 127, 233, 197,
+	100, 150, 141, 168, 196, 115, 98, 82, 233, 68, 69, 159, 165, 159, 215, 204,
+	180, 38, 71, 219, 252, 150, 166, 205, 64, 49, 90, 240, 89, 37, 63, 120,
+	115, 41, 29, 14, 170, 129, 80, 205, 24, 76, 208, 113, 17, 118, 61, 114,
+	174, 53, 24, 67, 120, 56, 23, 240, 116, 77, 30, 244, 44, 166, 170, 139,
+	251, 122, 134, 50, 247, 230, 245, 70, 162, 7, 68, 191, 58, 87, 187, 201,
+	20, 148, 212, 200, 223, 30, 145, 16, 58, 8, 22, 90, 242, 179, 49, 249,
+	245, 30, 189, 38, 196, 116, 28, 41, 198, 71, 16, 87, 114, 174, 253, 162,
+	139, 88, 79, 241, 36, 129, 152, 81, 186, 30, 56, 118, 237, 237, 3, 200,
+	114, 241, 124, 2, 59, 20, 13, 22, 190, 225, 207, 37, 2, 229, 241, 230,
+	106, 205, 104, 144, 136, 248, 124, 177, 126, 24, 208, 227, 49, 170, 42, 251,
+	231, 125, 247, 99, 130, 163, 48, 5, 98, 143, 93, 57, 122, 236, 128, 158,
+	93, 82, 242, 226, 33, 102, 141, 191, 37, 191, 96, 122, 7, 21, 1, 221,
+	55, 208, 144, 11, 124, 39, 81, 35, 195, 48, 106, 240, 186, 116, 51, 120,
+	232, 194, 35, 194, 55, 101, 173, 245, 242, 159, 126, 120, 114, 204, 145, 219,
+	221, 82, 224, 161, 0, 71, 207, 220, 247, 255, 196, 177, 170, 21, 123, 233,
+	237, 25, 12, 242, 213, 175, 1, 87, 168, 235, 156, 61, 92, 192, 222, 189,
+	118, 36, 123, 223, 12, 136, 66, 197, 141, 7, 43, 28, 224, 165, 137, 231,
+	58, 67, 140, 181, 47, 164, 136, 128, 9, 203, 172, 21, 143, 0, 120, 21,
+	91, 173, 84, 184, 36, 175, 4, 146, 84, 182, 229, 251, 163, 8, 205, 232,
+	175, 197, 240, 114, 45, 1, 231, 34, 204, 201, 154, 154, 189, 43, 198, 183,
+	69, 238, 135, 36, 162, 126, 171, 240, 189, 82, 145, 112, 30, 36, 29, 2,
+	113, 93, 72, 117, 66, 2, 46, 162, 81, 29, 168, 46, 208, 81, 71, 141,
+	174, 47, 209, 136, 188, 158, 179, 9, 78, 82, 224, 54, 90, 15, 152, 169,
+	3, 119, 16, 166, 27, 44, 248, 182, 102, 161, 25, 220, 252, 186, 151, 238,
+	24, 245, 206, 32, 238, 207, 220, 51, 62, 5, 10, 238, 104, 223, 31, 123,
+	49, 125, 161, 158, 242, 179, 231, 145, 254, 199, 161, 148, 241, 107, 148, 39,
+	4, 206, 169, 247, 48, 15, 76, 3, 197, 130, 227, 215, 24, 82, 213, 80,
+	51, 197, 83, 168, 105, 100, 76, 206, 41, 196, 237, 26, 189, 22, 126, 239,
+	73, 173, 157, 152, 179, 225, 167, 139, 27, 245, 166, 133, 185, 171, 178, 59,
+	187, 39, 114, 182, 217, 225, 34, 162, 117, 100, 46, 61, 5, 40, 183, 197,
+	158, 147, 68, 54, 37, 49, 215, 34, 220, 152, 141, 90, 247, 238, 91, 219,
+	21, 235, 46, 118, 211, 200, 207, 194, 25, 18, 99, 65, 169, 82, 36, 71,
+	49, 150, 83, 99, 155, 97, 34, 35, 115, 244, 55, 141, 79, 24, 140, 4,
+	45, 202, 50, 119, 214, 223, 152, 224, 135, 46, 46, 151, 248, 24, 34, 13,
+	38, 195, 154, 137, 249, 16, 51, 238, 15, 171, 162, 9, 174, 200, 175, 196,
+	19, 216, 248, 138, 46, 237, 164, 174, 110, 161, 39, 83, 139, 111, 76, 70,
+	245, 32, 16, 188, 178, 66, 213, 185, 19, 68, 226, 33, 195, 4, 98, 69,
+	254, 161, 182, 186, 250, 129, 163, 191, 180, 96, 8, 60, 219, 239, 193, 51,
+	6, 144, 107, 201, 211, 187, 10, 214, 11, 246, 99, 175, 154, 37, 253, 229,
+	157, 226, 134, 104, 23, 6, 118, 46, 237, 184, 38, 56, 112, 129, 86, 8,
+	204, 68, 101, 215, 114, 157, 99, 128, 20, 54, 121, 138, 105, 233, 199, 59,
+	156, 233, 191, 27, 154, 65, 15, 55, 132, 174, 177, 56, 180, 46, 68, 161,
+	93, 35, 197, 182, 74, 203, 127, 71, 97, 92, 204, 124, 225, 255, 64, 31,
+	95, 40, 39, 23, 105, 152, 186, 183, 114, 140, 78, 114, 210, 47, 211, 219,
+	6, 40, 15, 123, 33, 71, 251, 95, 110, 233, 240, 212, 128, 253, 116, 242,
+	34, 167, 93, 213, 62, 40, 131, 86, 124, 206, 26, 67, 214, 33, 125, 64,
+	85, 237, 181, 108, 154, 158, 251, 242, 206, 95, 59, 164, 207, 253, 157, 55,
+	125, 98, 175, 140, 173, 179, 254, 124, 232, 155, 227, 251, 71, 43, 69, 155,
+	113, 94, 151, 251, 253, 189, 119, 27, 185, 24, 197, 117, 208, 41, 152, 12,
+	33, 141, 231, 61, 0, 171, 58, 68, 13, 214, 14, 58, 42, 203, 47, 249,
+	239, 234, 27, 9, 76, 41, 128, 252, 152, 102, 147, 204, 184, 225, 70, 168,
+	128, 171, 74, 250, 189, 127, 101, 72, 244, 34, 199, 21, 56, 157, 162, 194,
+	250, 98, 191, 177, 74, 141, 225, 225, 174, 8, 92, 217, 202, 117, 117, 81,
+	172, 15, 69, 6, 244, 82, 171, 81, 206, 46, 76, 69, 4, 94, 36, 210,
+	54, 172, 122, 101, 72, 253, 114, 47, 133, 97, 163, 107, 204, 139, 235, 245,
+	37, 121, 219, 22, 154, 94, 3, 70, 50, 6, 209, 151, 153, 170, 244, 85,
+	138, 179, 90, 212, 127, 225, 93, 199, 6, 164, 53, 21, 92, 175, 19, 151,
+	32, 154, 243, 189, 27, 82, 72, 24, 222, 88, 108, 83, 69, 104, 137, 214,
+	37, 5, 183, 139, 44, 133, 97, 9, 14, 32, 71, 1, 13, 199, 148, 77,
+	87, 187, 212, 123, 8, 140, 123, 123, 213, 167, 171, 85, 221, 248, 115, 11,
+	201, 63, 100, 249, 103, 48, 57, 173, 93, 42, 135, 237, 91, 73, 93, 17,
+	96, 217, 184, 182, 234, 122, 5, 31, 6, 58, 84, 187, 140, 101, 136, 190,
+	144, 46, 14, 245, 62, 233, 90, 43, 0, 82, 223, 185, 47, 2, 112, 32,
+	149, 180, 139, 38, 185, 175, 62, 83, 125, 87, 240, 95, 178, 99, 228, 246,
+	155, 193, 209, 40, 170, 148, 183, 12, 219, 220, 119, 58, 141, 89, 119, 252,
+	238, 183, 152, 255, 220, 104, 197, 197, 211, 74, 5, 115, 124, 184, 183, 145,
+	32, 111, 185, 177, 206, 0, 249, 23, 254, 188, 251, 203, 76, 123, 224, 48,
+	136, 117, 181, 206, 202, 244, 140, 96, 192, 179, 172, 60, 234, 51, 72, 240,
+	240, 22, 148, 48, 117, 181, 3, 251, 195, 39, 7, 56, 60, 30, 26, 67,
+	18, 84, 110, 27, 100, 224, 99, 236, 51, 34, 138, 157, 117, 244, 73, 224,
+	214, 89, 32, 6, 59, 116, 73, 174, 220, 223, 4, 153, 195, 138, 20, 93,
+	69, 16, 221, 69, 79, 182, 109, 29, 61, 112, 36, 223, 44, 237, 92, 117,
+	80, 51, 218, 247, 136, 26, 189, 135, 62, 23, 109, 185, 155, 133, 209, 106,
+	234, 221, 59, 22, 9, 206, 83, 221, 64, 52, 197, 54, 166, 240, 226, 153,
+	253, 56, 60, 57, 108, 58, 91, 122, 7, 40, 192, 191, 135, 57, 210, 226,
+	182, 229, 179, 25, 180, 241, 167, 197, 252, 227, 188, 73, 189, 42, 162, 109,
+	39, 70, 70, 54, 166, 245, 217, 46, 144, 143, 202, 29, 12, 152, 45, 203,
+	90, 167, 168, 125, 155, 172, 57, 65, 14, 47, 244, 225, 132, 125, 174, 230,
+	107, 200, 195, 10, 12, 160, 28, 10, 66, 143, 176, 93, 174, 196, 69, 199,
+	134, 83, 215, 133, 245, 46, 83, 155, 211, 199, 51, 47, 215, 10, 248, 174,
+	198, 29, 245, 91, 224, 157, 249, 241, 130, 100, 250, 138, 87, 177, 34, 11,
+	179, 133, 7, 252, 139, 158, 141, 154, 133, 174, 193, 2, 173, 180, 51, 213,
+	190, 234, 110, 215, 226, 219, 28, 77, 146, 234, 126, 26, 132, 233, 181, 34,
+	134, 238, 33, 111, 62, 248, 209, 12, 117, 27, 18, 73, 43, 119, 235, 69,
+	44, 87, 206, 74, 25, 112, 89, 133, 52, 179, 26, 192, 74, 121, 243, 89,
+	199, 102, 158, 237, 228, 90, 148, 9, 128, 235, 219, 219, 117, 162, 220, 115,
+	60, 70, 220, 21, 145, 158, 106, 62, 237, 129, 169, 218, 71, 192, 30, 184,
+	204, 25, 212, 98, 122, 206, 80, 220, 21, 122, 98, 118, 37, 22, 56, 29,
+	187, 130, 107, 224, 5, 254, 169, 151, 17, 76, 72, 165, 244, 116, 141, 53,
+	221, 150, 100, 249, 66, 99, 95, 28, 121, 48, 220, 246, 16, 42, 182, 106,
+	170, 192, 123, 81, 189, 23, 188, 4, 152, 103, 53, 79, 27, 217, 4, 155,
+	8, 152, 208, 4, 224, 239, 227, 237, 15, 90, 235, 147, 26, 13, 242, 237,
+	114, 125, 114, 38, 28, 58, 93, 82, 243, 210, 198, 86, 95, 99, 134, 31,
+	137, 191, 80, 174, 121, 168, 153, 141, 114, 82, 76, 170, 19, 76, 66, 32,
+	147, 6, 195, 81, 123, 189, 62, 19, 83, 89, 166, 86, 53, 133, 2, 44,
+	135, 119, 39, 232, 108, 9, 37, 220, 232, 74, 30, 220, 105, 73, 43, 189,
+	42, 110, 198, 84, 203, 55, 111, 185, 0, 120, 89, 173, 172, 28, 126, 201,
+	249, 162, 152, 87, 90, 192, 51, 59, 6, 153, 44, 36, 128, 82, 140, 86,
+	46, 161, 91, 71, 177, 106, 177, 92, 2, 58, 9, 77, 230, 171, 96, 35,
+	232, 109, 146, 245, 31, 14, 201, 189, 90, 163, 94, 29, 192, 127, 133, 239,
+	62, 160, 214, 79, 22, 151, 244, 225, 61, 189, 219, 17, 99, 238, 249, 169,
+	89, 75, 141, 18, 234, 227, 32, 199, 196, 6, 228, 176, 154, 69, 175, 55,
+	148, 40, 145, 60, 245, 46, 247, 41, 193, 244, 20, 73, 231, 95, 27, 38,
+	148, 187, 20, 241, 71, 28, 167, 170, 208, 194, 212, 108, 119, 170, 89, 101,
+	252, 45, 251, 82, 158, 125, 210, 223, 110, 64, 95, 156, 167, 242, 5, 254,
+	111, 99, 119, 74, 34, 220, 64, 101, 64, 203, 80, 166, 92, 15, 42, 88,
+	60, 244, 241, 33, 103, 11, 185, 241, 173, 226, 101, 202, 21, 79, 63, 176,
+	155, 188, 101, 98, 96, 122, 32, 107, 150, 66, 229, 233, 237, 235, 67, 119,
+	178, 144, 247, 77, 2, 103, 208, 67, 218, 19, 48, 169, 159, 201, 43, 194,
+	115, 246, 22, 216, 255, 54, 202, 221, 213, 245, 166, 249, 59, 141, 148, 196,
+	226, 51, 75, 243, 89, 22, 208, 51, 84, 244, 126, 18, 238, 87, 118, 82,
+	203, 174, 240, 137, 63, 155, 25, 25, 0, 174, 179, 101, 25, 97, 7, 30,
+	107, 57, 163, 182, 44, 4, 72, 224, 10, 125, 115, 249, 3, 186, 156, 76,
+	77, 74, 74, 160, 76, 71, 112, 201, 128, 87, 173, 242, 110, 14, 242, 83,
+	81, 41, 199, 85, 199, 117, 71, 173, 56, 51, 9, 60, 239, 255, 169, 87,
+	101, 83, 209, 98, 91, 48, 7, 95, 125, 151, 141, 152, 204, 107, 38, 102,
+	3, 114, 168, 192, 151, 219, 230, 19, 125, 164, 31, 218, 149, 117, 146, 252,
+	37, 28, 49, 246, 31, 9, 15, 99, 41, 169, 185, 199, 135, 252, 2, 161,
+	14, 26, 222, 44, 225, 21, 106, 28, 202, 75, 21, 132, 252, 178, 239, 128,
+	36, 61, 177, 160, 110, 43, 170, 101, 173, 154, 56, 56, 123, 204, 200, 70,
+	216, 248, 183, 183, 78, 77, 55, 93, 33, 55, 68, 39, 209, 185, 168, 149,
+	152, 203, 201, 208, 229, 87, 237, 222, 77, 112, 40, 246, 253, 39, 20, 252,
+	136, 202, 156, 101, 46, 41, 123, 101, 33, 201, 131, 11, 50, 222, 93, 38,
+	31, 207, 225, 46, 94, 183, 70, 247, 136, 150, 1, 20, 224, 57, 192, 252,
+	222, 199, 116, 132, 185, 58, 110, 141, 5, 203, 30, 13, 122, 38, 190, 91,
+	130, 17, 84, 113, 48, 46, 225, 159, 67, 23, 201, 254, 51, 51, 2, 88,
+	33, 220, 239, 210, 20, 250, 22, 4, 126, 224, 214, 177, 210, 196, 251, 214,
+	162, 175, 91, 98, 213, 106, 83, 226, 113, 39, 56, 110, 90, 113, 16, 48,
+	167, 230, 94, 249, 34, 152, 200, 148, 68, 227, 95, 126, 191, 105, 211, 196,
+	237, 116, 127, 149, 156, 202, 191, 7, 170, 136, 106, 35, 53, 195, 129, 61,
+	6, 89, 11, 185, 115, 242, 85, 151, 62, 89, 107, 10, 152, 154, 217, 72,
+	253, 76, 222, 10, 253, 38, 112, 171, 106, 244, 85, 90, 198, 6, 192, 127,
+	10, 208, 7, 156, 41, 194, 210, 166, 34, 49, 100, 44, 66, 164, 68, 226,
+	164, 59, 87, 175, 21, 105, 80, 76, 44, 220, 47, 111, 89, 217, 232, 1,
+	56, 115, 189, 66, 245, 175, 154, 119, 39, 198, 231, 110, 246, 203, 78, 82,
+	174, 131, 57, 237, 8, 140, 201, 116, 44, 123, 93, 236, 176, 140, 35, 36,
+	42, 107, 1, 227, 24, 207, 237, 2, 127, 193, 220, 218, 198, 0, 147, 28,
+	227, 46, 244, 237, 23, 36, 39, 109, 101, 152, 21, 189, 73, 210, 62, 205,
+	178, 199, 136, 249, 173, 22, 160, 206, 119, 194, 207, 66, 215, 153, 174, 234,
+	189, 198, 24, 11, 26, 132, 34, 106, 10, 240, 154, 110, 167, 160, 238, 35,
+	26, 80, 189, 8, 229, 105, 118, 245, 192, 109, 16, 49, 20, 1, 166, 169,
+	22, 15, 18, 89, 174, 174, 232, 6, 48, 129, 145, 116, 11, 206, 67, 210,
+	138, 130, 221, 219, 204, 30, 18, 26, 9, 247, 189, 96, 199, 188, 203, 21,
+	46, 208, 62, 40, 83, 79, 86, 181, 173, 48, 62, 235, 56, 65, 91, 136,
+	198, 17, 250, 239, 199, 99, 146, 21, 114, 73, 191, 100, 250, 184, 184, 63,
+	137, 121, 90, 60, 188, 103, 7, 30, 68, 70, 227, 172, 113, 46, 95, 65,
+	25, 219, 186, 54, 85, 115, 224, 214, 16, 93, 221, 201, 207, 233, 146, 45,
+	218, 2, 205, 101, 49, 34, 82, 119, 219, 108, 151, 81, 125, 9, 134, 61,
+	9, 50, 147, 105, 224, 169, 144, 245, 118, 239, 55, 245, 90, 72, 252, 19,
+	1, 225, 31, 196, 222, 126, 196, 63, 241, 60, 227, 179, 47, 175, 211, 91,
+	180, 94, 253, 232, 1, 27, 84, 38, 251, 90, 185, 3, 136, 255, 35, 52,
+	65, 150, 137, 49, 193, 75, 119, 107, 6, 114, 234, 195, 179, 110, 244, 56,
+	98, 208, 104, 17, 208, 47, 246, 103, 22, 164, 131, 227, 86, 221, 36, 119,
+	49, 9, 67, 125, 99, 199, 193, 144, 213, 157, 147, 173, 225, 10, 3, 27,
+	14, 238, 189, 49, 48, 110, 241, 3, 75, 92, 216, 232, 131, 241, 120, 137,
+	199, 158, 83, 126, 66, 120, 228, 188, 52, 23, 104, 78, 19, 159, 88, 221,
+	142, 145, 233, 25, 34, 200, 208, 80, 200, 53, 65, 115, 180, 249, 251, 234,
+	18, 89, 107, 44, 118, 108, 110, 174, 70, 45, 243, 31, 11, 221, 33, 49,
+	43, 177, 151, 90, 50, 105, 226, 58, 208, 72, 70, 143, 62, 20, 209, 141,
+	53, 241, 134, 69, 69, 128, 163, 239, 144, 157, 198, 106, 106, 228, 236, 151,
+	154, 154, 85, 103, 185, 163, 208, 84, 170, 222, 83, 84, 73, 164, 87, 223,
+	102, 165, 12, 80, 246, 225, 160, 80, 153, 240, 94, 223, 223, 215, 247, 40,
+	249, 133, 135, 147, 197, 24, 42, 4, 220, 240, 97, 161, 65, 211, 61, 112,
+	11, 91, 231, 128, 200, 215, 71, 27, 247, 69, 106, 214, 61, 185, 73, 68,
+	202, 49, 170, 30, 227, 237, 248, 74, 97, 110, 208, 191, 143, 250, 158, 241,
+	232, 176, 46, 247, 81, 174, 71, 7, 247, 21, 51, 163, 17, 51, 63, 240,
+	223, 31, 254, 221, 125, 235, 187, 222, 119, 72, 87, 217, 59, 187, 111, 59,
+	223, 26, 31, 77, 93, 18, 209, 102, 16, 146, 200, 215, 117, 234, 212, 116,
+	184, 233, 221, 218, 237, 147, 177, 154, 235, 150, 64, 177, 133, 67, 41, 208,
+	137, 106, 106, 243, 20, 167, 89, 121, 233, 56, 219, 250, 74, 151, 12, 37,
+	184, 27, 84, 75, 137, 138, 76, 204, 231, 4, 173, 254, 31, 180, 8, 152,
+	26, 120, 233, 95, 143, 13, 170, 109, 194, 139, 100, 175, 76, 77, 134, 253,
+	59, 60, 213, 177, 82, 181, 24, 220, 107, 145, 224, 156, 173, 119, 123, 87,
+	42, 166, 87, 8, 3, 148, 193, 110, 67, 158, 122, 212, 218, 14, 229, 113,
+	101, 254, 250, 215, 190, 85, 245, 142, 127, 116, 18, 172, 17, 67, 33, 177,
+	176, 217, 38, 177, 184, 123, 13, 40, 165, 56, 61, 104, 17, 25, 22, 42,
+	235, 252, 189, 207, 155, 59, 52, 116, 56, 101, 163, 155, 250, 201, 135, 23,
+	102, 42, 167, 57, 115, 6, 155, 65, 249, 173, 251, 11, 187, 233, 210, 182,
+	105, 117, 90, 151, 210, 11, 16, 231, 7, 36, 45, 43, 241, 249, 29, 122,
+	96, 215, 84, 97, 60, 253, 173, 140, 153, 243, 70, 82, 227, 37, 135, 10,
+	62, 109, 93, 41, 35, 7, 167, 27, 194, 74, 32, 147, 62, 184, 112, 213,
+	165, 57, 148, 140, 213, 18, 179, 127, 1, 56, 222, 160, 46, 86, 27, 156,
+	97, 69, 3, 45, 118, 177, 71, 240, 2, 58, 71, 203, 33, 236, 234, 172,
+	86, 38, 184, 220, 143, 199, 35, 214, 38, 108, 156, 116, 234, 197, 2, 218,
+	21, 82, 71, 213, 119, 95, 184, 223, 220, 126, 140, 94, 151, 88, 165, 251,
+	76, 137, 69, 70, 186, 45, 226, 26, 16, 0, 253, 181, 15, 87, 30, 170,
+	112, 105, 15, 127, 96, 44, 5, 214, 36, 161, 171, 2, 3, 86, 108, 167,
+	117, 58, 40, 152, 6, 109, 188, 115, 8, 147, 134, 61, 155, 123, 27, 19,
+	79, 144, 108, 241, 93, 126, 205, 15, 158, 69, 215, 160, 44, 148, 240, 68,
+	214, 221, 210, 152, 34, 240, 103, 174, 115, 154, 16, 92, 92, 102, 133, 164,
+	27, 173, 146, 1, 99, 7, 13, 210, 115, 156, 202, 46, 241, 152, 220, 213,
+	144, 233, 145, 158, 97, 176, 212, 215, 45, 161, 206, 122, 88, 157, 129, 115,
+	237, 20, 125, 69, 189, 36, 248, 27, 74, 234, 158, 242, 129, 9, 32, 213,
+	169, 50, 24, 86, 111, 107, 234, 89, 172, 164, 119, 132, 125, 135, 161, 108,
+	26, 34, 143, 213, 124, 37, 67, 8, 74, 242, 126, 241, 241, 31, 195, 201,
+	15, 55, 144, 237, 87, 244, 69, 133, 176, 63, 46, 66, 220, 214, 215, 62,
+	154, 175, 138, 69, 102, 19, 69, 31, 178, 51, 24, 24, 37, 236, 161, 211,
+	215, 93, 130, 42, 43, 36, 41, 70, 221, 218, 34, 55, 193, 208, 80, 227,
+	197, 0, 89, 208, 69, 196, 122, 248, 188, 179, 180, 190, 125, 220, 167, 48,
+	201, 36, 43, 174, 144, 83, 254, 156, 22, 98, 3, 135, 118, 33, 123, 131,
+	92, 201, 231, 13, 122, 84, 74, 109, 152, 244, 101, 223, 3, 72, 46, 95,
+	148, 1, 226, 83, 252, 135, 193, 105, 3, 71, 251, 126, 206, 173, 126, 213,
+	13, 216, 42, 24, 152, 106, 64, 38, 49, 157, 124, 73, 220, 219, 128, 129,
+	129, 194, 153, 197, 197, 16, 250, 68, 52, 197, 180, 218, 157, 227, 94, 0,
+	235, 156, 136, 89, 193, 229, 174, 8, 138, 86, 195, 86, 227, 24, 83, 190,
+	196, 222, 173, 116, 190, 22, 210, 33, 188, 0, 185, 3, 11, 188, 124, 86,
+	85, 34, 74, 254, 245, 53, 27, 250, 71, 175, 30, 8, 60, 22, 50, 99,
+	6, 94, 69, 31, 196, 76, 61, 36, 214, 200, 20, 57, 241, 66, 197, 161,
+	188, 161, 247, 58, 92, 157, 200, 22, 77, 226, 0, 169, 201, 5, 106, 28,
+	160, 127, 178, 198, 99, 91, 129, 161, 181, 188, 66, 215, 63, 199, 95, 154,
+	3, 218, 186, 53, 190, 34, 171, 177, 64, 128, 109, 106, 50, 67, 216, 150,
+	205, 193, 119, 73, 42, 20, 137, 152, 172, 44, 141, 251, 160, 247, 8, 157,
+	158, 125, 106, 252, 50, 106, 229, 200, 131, 4, 192, 209, 75, 137, 81, 251,
+	151, 2, 105, 133, 74, 177, 77, 2, 120, 196, 241, 56, 167, 76, 166, 15,
+	126, 56, 107, 0, 76, 178, 253, 139, 86, 190, 49, 139, 75, 37, 159, 35,
+	208, 252, 242, 33, 100, 191, 112, 179, 106, 200, 17, 55, 228, 99, 141, 205,
+	156, 176, 203, 95, 112, 170, 220, 18, 153, 222, 207, 117, 119, 139, 139, 77,
+	165, 213, 75, 160, 154, 3, 28, 133, 141, 100, 135, 168, 70, 54, 202, 198,
+	167, 126, 84, 128, 135, 181, 147, 255, 214, 51, 65, 173, 43, 127, 77, 236,
+	31, 225, 175, 54, 121, 239, 0, 155, 206, 13, 30, 91, 61, 147, 87, 206,
+	133, 137, 53, 186, 231, 172, 160, 107, 217, 12, 178, 185, 109, 73, 3, 253,
+	58, 204, 250, 17, 132, 168, 200, 71, 232, 60, 216, 9, 138, 66, 226, 198,
+	179, 255, 219, 88, 133, 8, 156, 194, 35, 161, 29, 50, 223, 197, 9, 65,
+	198, 57, 241, 79, 226, 121, 240, 113, 4, 214, 76, 167, 130, 80, 5, 140,
+	136, 114, 181, 228, 186, 168, 110, 22, 198, 169, 72, 172, 190, 154, 118, 151,
+	110, 109, 14, 192, 95, 220, 214, 185, 81, 163, 252, 41, 218, 110, 77, 15,
+	177, 141, 89, 240, 134, 101, 22, 252, 117, 7, 113, 36, 122, 2, 107, 151,
+	232, 4, 163, 19, 151, 147, 249, 20, 146, 122, 231, 247, 200, 239, 19, 14,
+	157, 17, 176, 14, 92, 76, 245, 156, 131, 10, 164, 154, 89, 136, 120, 101,
+	96, 222, 1, 250, 70, 110, 122, 248, 127, 103, 236, 3, 62, 223, 123, 111,
+	112, 187, 30, 135, 72, 250, 98, 94, 125, 161, 84, 36, 64, 113, 16, 191,
+	92, 18, 61, 150, 135, 132, 167, 186, 28, 114, 223, 12, 18, 233, 12, 177,
+	165, 95, 249, 169, 195, 106, 186, 195, 242, 251, 171, 82, 24, 14, 96, 151,
+	105, 236, 203, 66, 138, 170, 156, 215, 108, 182, 116, 27, 176, 102, 151, 58,
+	144, 191, 96, 30, 121, 208, 197, 59, 28, 163, 156, 184, 3, 153, 25, 179,
+	255, 154, 14, 135, 55, 74, 123, 222, 137, 196, 131, 80, 128, 224, 76, 42,
+	110, 206, 203, 125, 205, 129, 199, 132, 242, 109, 61, 235, 211, 216, 226, 150,
+	207, 27, 227, 114, 66, 147, 196, 34, 148, 233, 61, 165, 243, 215, 227, 25,
+	221, 73, 173, 0, 214, 31, 65, 155, 235, 242, 203, 175, 32, 190, 73, 227,
+	166, 88, 55, 69, 87, 57, 90, 106, 15, 50, 105, 131, 251, 147, 56, 0,
+	216, 161, 184, 90, 185, 85, 243, 158, 251, 252, 197, 124, 150, 87, 5, 168,
+	77, 75, 5, 92, 155, 174, 254, 88, 173, 137, 156, 40, 89, 218, 135, 140,
+	95, 246, 84, 142, 16, 220, 124, 3, 143, 157, 44, 135, 225, 143, 51, 135,
+	70, 68, 53, 47, 152, 52, 5, 112, 179, 165, 93, 4, 6, 37, 152, 173,
+	218, 130, 46, 142, 224, 81, 200, 144, 218, 143, 119, 196, 156, 118, 22, 132,
+	62, 172, 127, 18, 130, 231, 251, 24, 103, 37, 121, 229, 45, 20, 97, 251,
+	63, 195, 127, 229, 211, 155, 29, 190, 96, 81, 152, 161, 250, 147, 52, 221,
+	191, 127, 53, 166, 158, 240, 145, 49, 191, 220, 196, 255, 86, 220, 50, 238,
+	202, 151, 176, 2, 46, 34, 114, 25, 21, 90, 206, 251, 51, 168, 16, 33,
+	56, 149, 204, 182, 173, 102, 27, 169, 10, 45, 26, 124, 55, 75, 213, 14,
+	46, 229, 204, 81, 218, 48, 65, 96, 23, 45, 16, 141, 142, 160, 227, 158,
+	23, 171, 176, 180, 62, 100, 145, 155, 21, 9, 201, 85, 96, 255, 153, 233,
+	26, 31, 199, 24, 136, 115, 160, 159, 96, 87, 246, 171, 77, 154, 86, 66,
+	130, 42, 241, 178, 18, 11, 133, 99, 65, 102, 2, 158, 164, 203, 143, 139,
+	249, 41, 149, 45, 44, 248, 227, 157, 191, 34, 39, 190, 103, 31, 109, 20,
+	71, 48, 181, 71, 185, 179, 9, 214, 70, 147, 162, 239, 195, 185, 139, 4,
+	90, 227, 207, 5, 136, 46, 63, 205, 31, 101, 41, 53, 154, 178, 219, 40,
+	30, 102, 147, 143, 118, 33, 74, 137, 68, 127, 244, 97, 10, 129, 141, 45,
+	92, 116, 61, 40, 231, 87, 96, 80, 137, 207, 15, 9, 54, 105, 44, 239,
+	83, 158, 89, 35, 90, 53, 237, 2, 89, 200, 130, 44, 61, 129, 179, 196,
+	151, 21, 27, 38, 163, 47, 147, 209, 144, 167, 133, 56, 203, 212, 139, 2,
+	130, 144, 67, 122, 203, 65, 41, 2, 163, 172, 22, 104, 34, 222, 208, 13,
+	40, 48, 134, 212, 73, 20, 228, 66, 159, 219, 199, 205, 101, 56, 48, 224,
+	155, 148, 161, 0, 194, 93, 111, 116, 9, 23, 61, 101, 7, 200, 86, 60,
+	44, 15, 157, 79, 16, 250, 103, 33, 66, 53, 151, 26, 253, 96, 222, 123,
+	189, 248, 242, 79, 47, 73, 79, 12, 218, 168, 49, 72, 175, 31, 112, 216,
+	205, 223, 55, 171, 234, 162, 4, 73, 134, 4, 104, 118, 186, 0, 231, 169,
+	2, 236, 252, 119, 188, 254, 231, 165, 36, 39, 58, 28, 43, 226, 15, 67,
+	78, 108, 17, 86, 194, 161, 138, 8, 251, 60, 235, 202, 97, 66, 245, 3,
+	29, 192, 159, 220, 51, 56, 18, 183, 25, 39, 144, 242, 32, 248, 28, 56,
+	44, 222, 13, 68, 200, 24, 204, 6, 98, 30, 126, 63, 91, 39, 246, 106,
+	245, 26, 191, 109, 37, 77, 222, 82, 152, 179, 46, 244, 118, 244, 233, 105,
+	101, 231, 132, 187, 241, 206, 98, 202, 207, 66, 40, 228, 23, 74, 75, 98,
+	243, 93, 60, 106, 114, 235, 203, 209, 32, 89, 26, 56, 95, 119, 242, 20,
+	51, 240, 46, 25, 71, 135, 54, 34, 40, 219, 29, 169, 148, 144, 98, 93,
+	172, 242, 114, 225, 223, 138, 194, 91, 243, 157, 180, 89, 54, 134, 89, 139,
+	217, 100, 124, 200, 234, 179, 11, 216, 241, 62, 162, 96, 175, 164, 253, 200,
+	251, 41, 103, 241, 55, 57, 80, 159, 140, 52, 164, 150, 86, 46, 130, 22,
+	178, 57, 80, 58, 33, 135, 170, 145, 70, 55, 150, 232, 89, 239, 162, 225,
+	221, 190, 123, 53, 45, 206, 167, 22, 28, 42, 33, 3, 141, 156, 53, 234,
+	191, 27, 38, 109, 119, 62, 100, 100, 226, 91, 255, 150, 67, 129, 231, 205,
+	36, 11, 48, 132, 78, 248, 205, 47, 172, 117, 74, 136, 179, 76, 13, 25,
+	62, 235, 245, 163, 151, 170, 214, 204, 245, 140, 12, 41, 60, 103, 220, 170,
+	1, 112, 69, 225, 195, 131, 235, 167, 74, 137, 226, 37, 207, 150, 181, 237,
+	89, 118, 231, 178, 175, 113, 163, 217, 228, 134, 79, 69, 141, 217, 248, 7,
+	201, 138, 231, 133, 86, 130, 108, 227, 101, 3, 233, 23, 71, 172, 50, 199,
+	90, 166, 250, 197, 130, 118, 4, 183, 104, 103, 81, 3, 118, 102, 50, 216,
+	8, 109, 97, 11, 104, 179, 207, 254, 25, 80, 244, 28, 34, 87, 16, 72,
+	88, 253, 114, 28, 52, 74, 226, 56, 38, 174, 58, 69, 121, 173, 50, 15,
+	215, 166, 41, 9, 238, 93, 152, 131, 124, 230, 158, 140, 212, 132, 120, 90,
+	5, 21, 166, 22, 198, 63, 221, 84, 212, 76, 149, 151, 179, 169, 245, 255,
+	146, 118, 190, 18, 36, 76, 231, 81, 181, 146, 17, 180, 86, 67, 169, 78,
+	215, 182, 181, 190, 224, 14, 133, 5, 76, 197, 114, 47, 129, 170, 180, 140,
+	19, 72, 116, 37, 40, 187, 185, 34, 6, 137, 74, 174, 211, 224, 44, 18,
+	200, 62, 238, 72, 51, 83, 216, 105, 108, 95, 126, 20, 5, 164, 229, 45,
+	87, 94, 204, 181, 212, 139, 210, 254, 0, 220, 163, 90, 177, 94, 90, 5,
+	23, 103, 7, 159, 69, 98, 82, 15, 200, 154, 70, 32, 167, 139, 227, 144,
+	236, 118, 116, 211, 56, 223, 146, 232, 194, 86, 197, 221, 204, 132, 184, 148,
+	92, 157, 9, 0, 45, 149, 226, 71, 78, 206, 160, 189, 58, 211, 66, 41,
+	168, 255, 144, 23, 218, 136, 218, 4, 122, 165, 253, 237, 179, 243, 11, 115,
+	173, 52, 207, 162, 128, 102, 12, 207, 174, 170, 84, 56, 238, 185, 38, 13,
+	131, 136, 121, 153, 87, 42, 94, 165, 253, 177, 139, 98, 71, 111, 55, 130,
+	168, 173, 40, 148, 166, 65, 32, 178, 44, 73, 143, 248, 217, 254, 242, 36,
+	237, 138, 21, 30, 105, 212, 71, 70, 140, 235, 159, 37, 155, 248, 46, 197,
+	37, 37, 143, 93, 176, 239, 80, 156, 3, 67, 115, 181, 202, 252, 122, 127,
+	219, 59, 150, 60, 141, 227, 73, 134, 177, 204, 59, 253, 7, 114, 24, 17,
+	203, 40, 75, 244, 34, 12, 18, 187, 73, 28, 80, 168, 5, 93, 244, 208,
+	79, 197, 206, 49, 124, 110, 141, 197, 253, 145, 25, 96, 46, 5, 229, 22,
+	206, 95, 83, 126, 123, 54, 248, 160, 96, 169, 215, 96, 61, 144, 135, 42,
+	221, 211, 139, 200, 5, 126, 245, 236, 127, 12, 138, 37, 221, 17, 190, 228,
+	127, 241, 49, 246, 112, 219, 208, 203, 207, 214, 104, 199, 247, 90, 154, 107,
+	53, 248, 81, 56, 94, 40, 188, 237, 165, 92, 76, 126, 105, 79, 200, 78,
+	155, 211, 140, 163, 228, 67, 10, 6, 63, 127, 170, 128, 185, 235, 242, 38,
+	27, 57, 59, 11, 247, 141, 21, 239, 226, 22, 195, 139, 205, 111, 251, 202,
+	204, 21, 81, 71, 56, 64, 252, 216, 229, 96, 150, 79, 32, 165, 218, 242,
+	255, 53, 160, 105, 112, 172, 227, 140, 6, 200, 215, 212, 77, 195, 52, 151,
+	131, 248, 241, 228, 19, 91, 223, 167, 237, 180, 30, 219, 172, 87, 225, 189,
+	230, 24, 135, 117, 203, 230, 233, 69, 51, 240, 39, 95, 195, 212, 25, 133,
+	99, 139, 188, 79, 107, 5, 192, 4, 253, 140, 193, 137, 146, 106, 144, 179,
+	147, 203, 140, 102, 236, 89, 36, 0, 96, 16, 42, 232, 19, 235, 238, 238,
+	117, 200, 30, 66, 93, 154, 20, 249, 50, 225, 190, 33, 62, 32, 131, 78,
+	252, 90, 26, 122, 158, 137, 253, 25, 217, 162, 13, 177, 50, 142, 134, 175,
+	82, 211, 94, 182, 72, 12, 160, 234, 92, 66, 6, 142, 58, 206, 241, 143,
+	1, 113, 236, 112, 135, 226, 73, 39, 107, 238, 56, 120, 177, 46, 66, 219,
+	155, 126, 28, 76, 252, 144, 32, 186, 131, 216, 215, 175, 224, 206, 53, 204,
+	148, 118, 215, 200, 86, 87, 185, 230, 159, 222, 45, 70, 96, 76, 54, 66,
+	29, 62, 251, 252, 161, 163, 34, 252, 202, 38, 140, 162, 224, 201, 251, 236,
+	99, 227, 55, 45, 14, 146, 38, 250, 157, 129, 143, 36, 163, 51, 53, 67,
+	99, 1, 101, 77, 39, 239, 107, 68, 224, 111, 109, 8, 40, 152, 182, 23,
+	81, 180, 204, 82, 50, 56, 152, 76, 93, 226, 85, 56, 18, 10, 222, 7,
+	220, 2, 25, 21, 221, 151, 17, 157, 40, 101, 166, 82, 9, 111, 102, 94,
+	138, 223, 103, 227, 225, 235, 68, 10, 221, 143, 40, 112, 180, 249, 176, 91,
+	23, 37, 77, 212, 96, 81, 16, 109, 62, 61, 176, 128, 21, 104, 224, 101,
+	228, 112, 189, 116, 52, 43, 146, 142, 14, 23, 109, 181, 200, 69, 23, 230,
+	127, 17, 102, 219, 187, 70, 118, 48, 139, 7, 138, 236, 118, 7, 29, 35,
+	111, 87, 131, 253, 216, 103, 177, 122, 93, 211, 3, 159, 201, 60, 104, 72,
+	17, 93, 214, 177, 75, 69, 252, 52, 65, 23, 250, 54, 72, 164, 83, 246,
+	133, 65, 134, 217, 158, 194, 107, 39, 66, 141, 61, 184, 136, 248, 44, 59,
+	86, 248, 136, 35, 247, 228, 198, 172, 187, 167, 95, 123, 143, 141, 184, 122,
+	107, 89, 34, 10, 108, 36, 236, 96, 220, 29, 91, 104, 172, 157, 243, 119,
+	111, 238, 133, 140, 171, 207, 74, 24, 244, 97, 78, 118, 76, 37, 103, 244,
+	75, 8, 27, 9, 2, 212, 89, 106, 174, 49, 238, 75, 35, 95, 173, 54,
+	103, 65, 103, 52, 2, 39, 50, 85, 139, 146, 159, 43, 236, 83, 29, 224,
+	92, 45, 126, 6, 118, 90, 108, 185, 135, 239, 114, 118, 134, 82, 193, 91,
+	142, 227, 164, 67, 228, 192, 124, 37, 212, 212, 99, 17, 40, 68, 213, 20,
+	0, 90, 83, 54, 169, 229, 125, 255, 237, 109, 212, 58, 121, 93, 91, 90,
+	227, 213, 120, 15, 33, 95, 83, 173, 58, 147, 84, 16, 67, 214, 65, 196,
+	231, 233, 176, 47, 129, 4, 14, 99, 142, 220, 80, 208, 174, 84, 238, 179,
+	115, 170, 14, 86, 179, 241, 81, 235, 0, 155, 152, 121, 252, 97, 237, 53,
+	181, 15, 135, 163, 45, 95, 64, 12, 31, 99, 26, 243, 195, 72, 66, 80,
+	174, 169, 30, 50, 91, 93, 72, 2, 234, 12, 132, 53, 38, 202, 59, 55,
+	57, 142, 154, 129, 247, 4, 229, 219, 10, 240, 0, 20, 74, 20, 55, 74,
+	181, 2, 126, 191, 1, 57, 59, 154, 12, 150, 119, 94, 183, 74, 126, 58,
+	67, 183, 50, 150, 238, 82, 140, 219, 198, 250, 230, 107, 185, 115, 114, 35,
+	91, 194, 169, 205, 234, 205, 185, 73, 232, 8, 146, 112, 207, 21, 109, 0,
+	5, 48, 64, 248, 133, 11, 93, 54, 115, 226, 145, 114, 156, 6, 43, 149,
+	96, 112, 231, 74, 181, 96, 143, 57, 89, 229, 172, 102, 26, 179, 240, 186,
+	51, 15, 231, 62, 211, 22, 33, 63, 238, 125, 148, 162, 58, 196, 28, 136,
+	151, 2, 234, 3, 43, 170, 160, 52, 249, 129, 94, 29, 105, 46, 89, 97,
+	67, 168, 17, 214, 47, 128, 46, 128, 122, 79, 66, 85, 172, 36, 13, 137,
+	96, 254, 142, 158, 225, 6, 25, 105, 99, 66, 101, 113, 23, 144, 0, 252,
+	214, 229, 66, 46, 234, 137, 251, 45, 169, 22, 26, 196, 14, 204, 33, 95,
+	158, 212, 167, 178, 4, 32, 178, 78, 253, 14, 230, 92, 65, 236, 5, 58,
+	103, 127, 60, 118, 111, 146, 204, 195, 79, 15, 170, 97, 174, 18, 60, 40,
+	218, 116, 89, 231, 91, 87, 136, 241, 170, 23, 10, 151, 245, 151, 24, 106,
+	70, 123, 39, 100, 193, 34, 176, 226, 21, 71, 230, 59, 119, 76, 151, 147,
+	27, 190, 43, 57, 143, 212, 247, 147, 188, 7, 166, 69, 148, 103, 105, 47,
+	121, 45, 231, 112, 125, 188, 64, 60, 218, 58, 46, 82, 96, 60, 211, 59,
+	175, 91, 189, 215, 171, 60, 216, 229, 45, 156, 232, 171, 123, 99, 193, 181,
+	44, 186, 103, 172, 29, 224, 96, 63, 44, 100, 9, 79, 170, 104, 22, 18,
+	75, 162, 107, 63, 154, 28, 126, 47, 108, 119, 72, 113, 126, 223, 28, 139,
+	231, 247, 145, 14, 241, 245, 204, 61, 72, 13, 34, 205, 173, 42, 226, 29,
+	54, 120, 67, 78, 20, 186, 240, 9, 237, 156, 244, 200, 121, 58, 75, 54,
+	155, 109, 130, 113, 227, 99, 19, 186, 84, 114, 130, 27, 176, 206, 211, 236,
+	114, 2, 181, 53, 111, 25, 154, 42, 52, 123, 78, 95, 32, 215, 62, 149,
+	109, 233, 132, 180, 153, 234, 130, 28, 81, 164, 236, 123, 162, 143, 184, 3,
+	4, 22, 212, 91, 78, 171, 139, 251, 223, 171, 167, 82, 17, 30, 95, 92,
+	63, 90, 49, 76, 4, 185, 167, 137, 167, 206, 103, 174, 190, 170, 211, 161,
+	124, 31, 4, 68, 169, 109, 148, 58, 25, 209, 3, 83, 169, 84, 60, 13,
+	221, 216, 143, 114, 247, 190, 19, 187, 177, 42, 106, 85, 79, 87, 188, 23,
+	69, 197, 234, 55, 100, 14, 8, 135, 198, 109, 93, 94, 180, 82, 95, 143,
+	48, 230, 53, 196, 105, 147, 136, 102, 123, 170, 84, 232, 54, 106, 101, 222,
+	71, 231, 81, 23, 251, 65, 155, 92, 137, 78, 35, 160, 112, 68, 179, 247,
+	46, 118, 156, 120, 66, 109, 96, 61, 230, 145, 206, 41, 255, 175, 183, 133,
+	187, 140, 70, 121, 179, 162, 230, 178, 139, 204, 174, 176, 148, 154, 204, 78,
+	59, 255, 80, 110, 224, 91, 67, 71, 31, 242, 214, 171, 117, 50, 48, 199,
+	138, 171, 160, 238, 34, 90, 227, 129, 81, 129, 74, 190, 65, 26, 122, 34,
+	216, 81, 115, 71, 252, 168, 64, 132, 51, 106, 179, 186, 233, 88, 89, 41,
+	171, 64, 203, 74, 68, 9, 24, 121, 220, 30, 38, 126, 98, 196, 69, 2,
+	198, 249, 242, 227, 195, 147, 134, 37, 188, 143, 47, 8, 80, 25, 214, 194,
+	110, 44, 127, 62, 119, 179, 162, 165, 177, 120, 73, 138, 222, 73, 190, 14,
+	156, 169, 56, 55, 185, 43, 108, 99, 52, 110, 116, 37, 205, 247, 229, 190,
+	163, 175, 150, 3, 210, 54, 54, 26, 36, 12, 111, 65, 113, 86, 144, 189,
+	30, 150, 155, 92, 114, 103, 80, 229, 13, 38, 116, 222, 183, 193, 0, 12,
+	44, 94, 243, 146, 87, 244, 226, 223, 131, 200, 98, 172, 122, 149, 40, 91,
+	153, 198, 121, 121, 204, 15, 242, 116, 105, 60, 121, 148, 243, 247, 124, 205,
+	114, 120, 213, 35, 255, 189, 180, 23, 186, 162, 104, 129, 133, 172, 202, 50,
+	40, 218, 29, 140, 4, 241, 64, 220, 180, 22, 98, 142, 46, 237, 42, 90,
+	201, 243, 106, 246, 192, 127, 99, 170, 173, 188, 248, 118, 123, 175, 200, 76,
+	232, 158, 219, 125, 139, 164, 213, 206, 137, 204, 219, 50, 172, 236, 19, 34,
+	143, 46, 78, 175, 192, 131, 96, 57, 204, 126, 10, 10, 133, 88, 168, 255,
+	249, 217, 168, 99, 242, 115, 111, 106, 186, 78, 63, 6, 142, 80, 231, 18,
+	85, 114, 43, 230, 197, 90, 83, 132, 64, 37, 122, 14, 9, 5, 146, 16,
+	16, 175, 82, 86, 200, 119, 165, 117, 166, 86, 223, 176, 195, 207, 124, 27,
+	161, 62, 25, 210, 167, 236, 97, 76, 253, 191, 83, 79, 203, 118, 44, 45,
+	17, 161, 93, 221, 110, 0, 137, 70, 172, 150, 26, 182, 171, 253, 35, 125,
+	224, 0, 69, 80, 76, 97, 118, 251, 131, 166, 160, 220, 219, 245, 100, 198,
+	52, 143, 40, 67, 51, 236, 10, 11, 213, 73, 24, 135, 68, 118, 119, 74,
+	123, 39, 75, 51, 137, 249, 41, 163, 37, 103, 10, 31, 146, 52, 51, 46,
+	130, 72, 139, 92, 175, 91, 249, 134, 73, 64, 17, 28, 229, 50, 23, 183,
+	64, 242, 60, 120, 58, 174, 228, 40, 203, 165, 85, 25, 157, 244, 126, 16,
+	139, 78, 75, 19, 6, 107, 216, 41, 26, 146, 175, 179, 108, 175, 114, 124,
+	195, 79, 120, 26, 99, 230, 132, 99, 39, 193, 87, 22, 222, 149, 25, 32,
+	111, 205, 233, 70, 109, 75, 198, 151, 56, 67, 211, 139, 162, 110, 50, 149,
+	241, 24, 46, 196, 73, 86, 55, 225, 118, 5, 48, 116, 25, 24, 65, 231,
+	56, 29, 9, 76, 15, 119, 107, 154, 10, 68, 215, 101, 129, 22, 158, 39,
+	230, 192, 134, 76, 203, 31, 211, 7, 30, 246, 99, 225, 14, 64, 175, 107,
+	249, 250, 118, 246, 205, 3, 16, 12, 217, 26, 93, 129, 154, 80, 195, 98,
+	178, 138, 210, 18, 112, 133, 25, 51, 203, 17, 71, 117, 244, 116, 185, 120,
+	7, 35, 220, 146, 121, 195, 37, 193, 92, 36, 17, 80, 49, 92, 201, 231,
+	214, 88, 172, 69, 45, 14, 105, 24, 155, 237, 58, 12, 191, 14, 189, 96,
+	74, 79, 59, 236, 195, 249, 155, 63, 210, 139, 212, 84, 165, 137, 123, 112,
+	66, 9, 170, 40, 227, 205, 205, 89, 187, 102, 74, 238, 85, 169, 55, 241,
+	59, 96, 188, 135, 38, 185, 219, 124, 249, 231, 16, 116, 78, 130, 17, 117,
+	162, 124, 84, 238, 2, 132, 193, 89, 226, 228, 127, 65, 115, 184, 156, 1,
+	122, 244, 192, 68, 253, 178, 188, 19, 140, 81, 137, 57, 80, 210, 163, 100,
+	164, 121, 210, 195, 55, 69, 49, 16, 252, 150, 96, 42, 195, 94, 94, 47,
+	128, 220, 79, 116, 143, 246, 44, 116, 209, 29, 81, 181, 36, 162, 133, 75,
+	68, 229, 234, 7, 69, 84, 11, 51, 4, 200, 248, 105, 120, 127, 246, 111,
+	244, 193, 60, 163, 213, 210, 73, 91, 220, 9, 123, 67, 124, 135, 83, 106,
+	98, 78, 61, 77, 90, 255, 222, 122, 192, 85, 136, 3, 88, 122, 58, 47,
+	96, 6, 88, 110, 106, 20, 18, 188, 133, 79, 122, 45, 192, 101, 209, 245,
+	244, 39, 72, 244, 79, 42, 109, 230, 125, 144, 185, 39, 102, 110, 113, 163,
+	56, 206, 0, 89, 59, 37, 58, 88, 213, 37, 52, 143, 82, 130, 94, 122,
+	88, 124, 134, 232, 30, 148, 160, 198, 239, 255, 68, 80, 83, 126, 150, 56,
+	93, 218, 208, 28, 144, 75, 244, 244, 51, 223, 72, 205, 228, 88, 116, 3,
+	208, 6, 123, 133, 0, 244, 143, 81, 103, 211, 251, 78, 172, 12, 114, 166,
+	191, 20, 24, 27, 120, 247, 112, 40, 215, 106, 98, 229, 171, 7, 35, 175,
+	64, 8, 22, 53, 175, 59, 208, 119, 93, 156, 25, 100, 20, 229, 208, 165,
+	13, 12, 53, 151, 183, 93, 34, 224, 221, 231, 9, 217, 164, 145, 180, 91,
+	228, 217, 142, 249, 29, 95, 251, 116, 177, 226, 6, 252, 185, 129, 74, 42,
+	103, 12, 206, 53, 134, 94, 16, 124, 166, 9, 212, 143, 22, 20, 249, 210,
+	75, 41, 14, 255, 88, 223, 205, 126, 171, 4, 241, 97, 57, 199, 236, 109,
+	60, 42, 120, 84, 195, 214, 207, 118, 200, 233, 233, 14, 32, 244, 206, 73,
+	37, 79, 29, 126, 249, 31, 201, 40, 34, 118, 241, 109, 184, 224, 151, 37,
+	120, 3, 145, 233, 103, 151, 50, 246, 8, 132, 26, 63, 101, 203, 237, 156,
+	5, 77, 174, 149, 66, 163, 214, 221, 61, 20, 98, 62, 175, 195, 84, 224,
+	95, 232, 2, 124, 187, 3, 42, 0, 53, 49, 245, 75, 92, 28, 175, 87,
+	142, 15, 188, 48, 40, 114, 255, 152, 213, 103, 243, 161, 113, 139, 61, 108,
+	216, 126, 43, 119, 160, 38, 254, 6, 21, 177, 98, 135, 21, 79, 79, 249,
+	35, 15, 17, 5, 121, 214, 90, 186, 83, 64, 37, 242, 196, 165, 206, 31,
+	159, 79, 190, 165, 153, 174, 254, 229, 111, 71, 159, 53, 22, 243, 43, 115,
+	242, 131, 111, 164, 186, 214, 44, 214, 39, 168, 141, 211, 3, 23, 166, 183,
+	160, 249, 143, 221, 93, 247, 198, 117, 171, 91, 141, 206, 183, 35, 249, 218,
+	240, 34, 120, 47, 3, 219, 224, 79, 35, 185, 146, 196, 248, 143, 100, 229,
+	21, 3, 237, 231, 146, 154, 127, 182, 132, 248, 146, 224, 229, 207, 198, 79,
+	248, 187, 126, 81, 248, 231, 62, 70, 152, 249, 244, 194, 27, 56, 61, 229,
+	132, 89, 241, 5, 100, 18, 248, 246, 254, 239, 41, 98, 181, 2, 22, 165,
+	181, 146, 82, 205, 215, 219, 139, 127, 79, 12, 214, 154, 224, 253, 167, 48,
+	205, 215, 104, 44, 37, 252, 188, 228, 153, 86, 52, 28, 170, 128, 0, 74,
+	160, 89, 168, 24, 174, 93, 22, 96, 159, 199, 218, 223, 107, 229, 5, 98,
+	223, 173, 181, 11, 216, 73, 204, 127, 195, 102, 17, 40, 71, 144, 233, 157,
+	87, 209, 197, 83, 160, 241, 7, 212, 153, 115, 79, 108, 103, 66, 190, 197,
+	94, 55, 166, 179, 248, 114, 244, 220, 13, 46, 192, 7, 173, 110, 48, 66,
+	191, 194, 88, 179, 56, 144, 225, 202, 43, 101, 59, 228, 228, 109, 86, 155,
+	177, 20, 178, 139, 67, 84, 174, 237, 208, 221, 226, 195, 124, 174, 74, 147,
+	254, 234, 44, 22, 167, 135, 30, 229, 18, 215, 165, 136, 17, 72, 182, 122,
+	171, 8, 50, 197, 184, 125, 194, 0, 66, 26, 222, 161, 41, 10, 91, 48,
+	102, 86, 222, 114, 143, 135, 75, 186, 146, 88, 250, 157, 38, 15, 230, 11,
+	199, 238, 87, 138, 0, 149, 105, 134, 228, 35, 240, 45, 98, 83, 26, 24,
+	121, 113, 177, 28, 246, 78, 87, 97, 242, 156, 176, 153, 69, 165, 253, 207,
+	15, 37, 242, 17, 102, 27, 46, 255, 167, 109, 26, 180, 112, 223, 112, 204,
+	95, 35, 72, 36, 142, 186, 89, 36, 74, 18, 6, 114, 205, 71, 174, 185,
+	166, 51, 172, 91, 10, 52, 203, 102, 207, 241, 4, 9, 113, 16, 150, 112,
+	157, 78, 149, 225, 126, 157, 159, 64, 38, 152, 48, 213, 188, 92, 179, 0,
+	238, 204, 185, 15, 124, 232, 166, 242, 168, 138, 134, 218, 97, 103, 162, 113,
+	6, 97, 133, 148, 212, 23, 18, 44, 160, 180, 252, 179, 148, 100, 124, 136,
+	131, 58, 50, 153, 242, 131, 36, 18, 63, 217, 10, 201, 9, 117, 131, 215,
+	152, 58, 99, 157, 128, 183, 56, 188, 100, 190, 212, 243, 104, 129, 25, 231,
+	178, 180, 169, 49, 141, 18, 193, 224, 101, 171, 138, 144, 86, 91, 43, 121,
+	182, 220, 115, 90, 196, 132, 68, 29, 106, 7, 84, 54, 246, 154, 154, 97,
+	20, 49, 76, 106, 67, 35, 182, 97, 44, 36, 28, 30, 96, 197, 164, 201,
+	100, 81, 21, 112, 120, 51, 14, 157, 200, 199, 66, 55, 181, 242, 197, 152,
+	124, 126, 251, 244, 38, 207, 162, 253, 165, 253, 141, 44, 25, 147, 27, 244,
+	133, 244, 102, 73, 190, 240, 53, 105, 207, 62, 105, 51, 119, 70, 170, 130,
+	229, 171, 252, 134, 133, 70, 128, 99, 141, 182, 74, 1, 64, 149, 252, 164,
+	42, 67, 197, 252, 58, 6, 165, 192, 107, 183, 44, 108, 107, 235, 244, 162,
+	71, 0, 171, 204, 214, 116, 213, 56, 209, 1, 176, 95, 148, 204, 203, 174,
+	56, 192, 125, 60, 165, 194, 42, 11, 90, 40, 183, 60, 4, 148, 60, 238,
+	26, 97, 57, 235, 119, 16, 82, 36, 121, 168, 196, 173, 156, 23, 185, 33,
+	25, 81, 24, 106, 132, 97, 83, 103, 149, 98, 31, 103, 83, 97, 253, 226,
+	56, 225, 51, 148, 114, 51, 134, 234, 198, 197, 228, 177, 104, 60, 222, 2,
+	225, 134, 56, 111, 115, 187, 119, 131, 159, 206, 37, 247, 100, 53, 55, 144,
+	9, 75, 234, 165, 204, 180, 232, 125, 244, 47, 81, 5, 195, 75, 88, 53,
+	179, 143, 38, 184, 59, 176, 203, 83, 125, 153, 84, 156, 192, 230, 28, 224,
+	226, 204, 95, 228, 99, 194, 179, 165, 28, 95, 6, 98, 46, 246, 84, 149,
+	38, 79, 183, 121, 239, 38, 43, 154, 20, 139, 33, 32, 21, 117, 35, 57,
+	117, 36, 190, 167, 77, 8, 38, 5, 26, 129, 214, 65, 224, 181, 68, 175,
+	156, 138, 237, 6, 35, 121, 116, 64, 235, 175, 95, 37, 250, 80, 246, 196,
+	78, 230, 203, 211, 47, 72, 76, 79, 107, 170, 112, 15, 213, 41, 133, 93,
+	202, 68, 65, 239, 230, 131, 212, 60, 242, 163, 170, 57, 24, 118, 78, 215,
+	30, 33, 34, 40, 222, 52, 59, 236, 78, 128, 182, 222, 49, 165, 87, 217,
+	233, 234, 195, 147, 102, 9, 73, 61, 212, 45, 221, 144, 135, 91, 145, 153,
+	23, 188, 221, 238, 184, 103, 177, 114, 251, 91, 143, 150, 99, 165, 240, 195,
+	109, 119, 201, 60, 159, 17, 191, 86, 249, 208, 25, 37, 58, 16, 217, 255,
+	117, 228, 25, 102, 254, 78, 122, 8, 172, 107, 16, 117, 94, 36, 223, 116,
+	244, 34, 193, 154, 219, 74, 96, 109, 6, 0, 88, 227, 234, 132, 78, 136,
+	227, 248, 174, 66, 122, 17, 232, 43, 185, 246, 47, 17, 229, 137, 236, 16,
+	173, 72, 221, 187, 233, 216, 212, 75, 45, 129, 251, 201, 130, 197, 17, 130,
+	146, 194, 154, 238, 54, 231, 211, 111, 44, 251, 144, 117, 150, 132, 92, 52,
+	209, 200, 12, 61, 154, 225, 193, 38, 131, 48, 167, 68, 216, 58, 87, 244,
+	158, 88, 138, 114, 18, 14, 169, 10, 71, 47, 0, 70, 211, 56, 245, 62,
+	164, 144, 13, 164, 168, 110, 58, 213, 63, 121, 11, 133, 9, 105, 177, 175,
+	97, 0, 145, 208, 207, 93, 54, 227, 136, 152, 122, 57, 29, 26, 30, 39,
+	83, 206, 228, 111, 196, 125, 244, 51, 162, 223, 216, 53, 52, 158, 189, 235,
+	41, 115, 29, 87, 53, 221, 125, 214, 216, 48, 178, 214, 12, 105, 134, 133,
+	191, 102, 94, 92, 155, 17, 176, 129, 26, 59, 229, 243, 121, 122, 76, 196,
+	248, 128, 108, 43, 97, 117, 8, 213, 211, 46, 35, 175, 79, 94, 220, 149,
+	229, 153, 163, 220, 106, 171, 114, 92, 69, 19, 226, 42, 0, 103, 218, 121,
+	61, 206, 117, 146, 100, 7, 253, 93, 108, 196, 46, 95, 29, 240, 195, 115,
+	93, 137, 202, 181, 141, 62, 202, 120, 0, 161, 107, 220, 133, 81, 53, 161,
+	231, 116, 187, 107, 244, 88, 213, 161, 177, 111, 176, 83, 210, 114, 138, 150,
+	250, 137, 219, 194, 8, 145, 118, 207, 195, 107, 164, 183, 13, 195, 94, 97,
+	210, 205, 216, 158, 3, 2, 59, 107, 126, 144, 23, 100, 50, 117, 27, 85,
+	108, 53, 24, 76, 246, 150, 7, 28, 218, 18, 253, 53, 41, 56, 101, 99,
+	57, 57, 111, 72, 61, 157, 65, 70, 14, 254, 38, 201, 221, 154, 1, 202,
+	112, 136, 18, 210, 62, 246, 133, 224, 255, 58, 1, 150, 80, 200, 142, 154,
+	210, 219, 25, 51, 131, 99, 16, 4, 211, 241, 96, 4, 62, 3, 9, 81,
+	169, 138, 177, 92, 59, 23, 119, 209, 147, 176, 157, 65, 212, 193, 122, 6,
+	116, 176, 77, 150, 245, 42, 39, 40, 105, 101, 68, 98, 189, 113, 207, 51
+};
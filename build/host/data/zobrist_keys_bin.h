@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+#define zobrist_keys_size (11440)
+extern const uint8_t zobrist_keys[11440];
@@ -0,0 +1,51 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// bytes of c_heap the arena hands out. it holds the buffers which only
+// some of the game states need, so they can share the space rather than
+// each keeping their own for good
+#define ARENA_SIZE 512
+
+// scopes follow the game states, each one being entered from the one
+// above it. entering a scope frees everything allocated since it was
+// entered from above, including anything in the scopes below it
+enum arena_scopes {
+  ARENA_SCOPE_TITLE = 0,
+  ARENA_SCOPE_GAME,
+  ARENA_SCOPE_WON,
+  ARENA_SCOPES
+};
+
+// blocks carved out of the arena, which each allocate from themselves and
+// keep their own high-water mark. ARENA_ROOT is the whole of the arena
+enum arena_names {
+  ARENA_ROOT = 0,
+  ARENA_DEADEND,
+  ARENA_COUNT
+};
+
+#define ARENA_NAME_LENGTH 8
+
+typedef struct {
+    uint8_t *base;
+    // 0 while the block isn't open
+    uint16_t size;
+    // bytes in use
+    uint16_t top;
+    // most bytes ever in use, for the host tools and debugging
+    uint16_t high;
+} arena_t;
+
+extern arena_t arenas[ARENA_COUNT];
+extern const char __wf_rom arena_names[ARENA_COUNT][ARENA_NAME_LENGTH];
+
+// everything allocated from an arena after a mark is freed by releasing it
+#define arena_mark(arena) (arenas[arena].top)
+
+void arena_enter(uint8_t scope);
+uint8_t arena_open(uint8_t arena, uint16_t size);
+void* arena_alloc(uint8_t arena, uint16_t size);
+void arena_release(uint8_t arena, uint16_t mark);
@@ -0,0 +1,59 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// the graphics, tilemaps and music are packed into one archive in rom by
+// tools/mkpack.c from the list in assets/pack.txt, which also writes
+// asset_pack.h with an ASSET_ id for each of them
+//
+// the pack starts with an asset_header_t, then a directory for each set
+// of assets, then the assets themselves. each set is the same list of
+// ids, which lets each video backend have its own variant of an asset.
+// an asset which isn't in a set is empty in its directory
+enum asset_codecs {
+  // read in place, or copied with the general dma where there is one
+  ASSET_RAW = 0,
+  // blocks of ASSET_BLOCK_SIZE bytes each compressed on their own, each
+  // one after its compressed length as a little endian word
+  ASSET_LZSA2,
+  ASSET_CODECS
+};
+
+// bytes copied or unpacked by each step of a load
+#define ASSET_BLOCK_SIZE 1024
+
+// the pack is read with near offsets, so has to fit in a segment
+#define ASSET_PACK_LIMIT 0x10000
+
+typedef struct {
+    // assets in each set
+    uint8_t count;
+    uint8_t sets;
+} asset_header_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t codec;
+    // bytes once unpacked
+    uint16_t size;
+    // from the start of the pack
+    uint16_t offset;
+} asset_entry_t;
+
+// a load under way, which can be stepped through a block at a time
+typedef struct {
+    const uint8_t __far* source;
+    uint8_t* dest;
+    // bytes still to unpack
+    uint16_t left;
+    uint8_t codec;
+} asset_loader_t;
+
+void asset_select(uint8_t set);
+const void __far* asset_data(uint8_t id);
+uint16_t asset_size(uint8_t id);
+void asset_load_start(asset_loader_t* loader, uint8_t id, void* dest);
+uint8_t asset_load_step(asset_loader_t* loader);
+void asset_load(uint8_t id, void* dest);
@@ -0,0 +1,17 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "solution.h"
+
+enum autoplay_modes {
+  AUTOPLAY_OFF = 0,
+  AUTOPLAY_ATTRACT,
+  AUTOPLAY_SHOW_ME
+};
+
+extern uint8_t autoplay_mode;
+
+void autoplay_start(uint8_t mode, const solution_reader_t *reader);
+uint8_t autoplay_update();
@@ -3,19 +3,51 @@
 
 #pragma once
 #include <wonderful.h>
+#include "variant.h"
 
-#define FREECELLS 4
-#define FOUNDATIONS 4
-#define CASCADES 8
+// longest a cascade can get, the renderer copes with any length
+#define CASCADE_MAX_CARDS 32
 
 #define NO_CARD 0xff
 
+// number of moves which can be undone, must be a power of two
+#define UNDO_JOURNAL_SIZE 64
+
 enum cursor_areas {
   AREA_FREECELLS = 0,
   AREA_FOUNDATIONS,
   AREA_CASCADES,
 }; 
 
+// where each area of the board is, in tiles. cards are 3 tiles wide
+#if FREECELLS > 4
+// a row of freecells, with the foundations on a row of their own below
+#define LAYOUT_FREECELLS_TX 2
+#define LAYOUT_FREECELLS_TY 0
+#define LAYOUT_FOUNDATIONS_TX 8
+#define LAYOUT_FOUNDATIONS_TY 4
+#define LAYOUT_CASCADES_TX 2
+#define LAYOUT_CASCADES_TY 9
+#elif CASCADES > 8
+// more cascades than fit across the screen, which scrolls across to follow the cursor
+#define LAYOUT_FREECELLS_TX 1
+#define LAYOUT_FREECELLS_TY 0
+#define LAYOUT_FOUNDATIONS_TX (1 + ((CASCADES - FOUNDATIONS) * 3))
+#define LAYOUT_FOUNDATIONS_TY 0
+#define LAYOUT_CASCADES_TX 1
+#define LAYOUT_CASCADES_TY 5
+#else
+#define LAYOUT_FREECELLS_TX 1
+#define LAYOUT_FREECELLS_TY 0
+#define LAYOUT_FOUNDATIONS_TX 15
+#define LAYOUT_FOUNDATIONS_TY 0
+#define LAYOUT_CASCADES_TX 2
+#define LAYOUT_CASCADES_TY 5
+#endif
+
+// tiles from the left of the board to the right of the last cascade
+#define LAYOUT_WIDTH_TILES (LAYOUT_CASCADES_TX + (CASCADES * 3))
+
 // x and y pixel locations of cursor areas
 extern const uint8_t __wf_rom cursor_area_tx[];
 extern const uint8_t __wf_rom cursor_area_ty[];
@@ -44,20 +76,33 @@ extern uint8_t foundation_counts[FOUNDATIONS];
 extern uint8_t deck[52];
 extern uint8_t deck_count;
 
-extern uint8_t cascades[CASCADES][32];
+extern uint8_t cascades[CASCADES][CASCADE_MAX_CARDS];
 extern uint8_t cascade_counts[CASCADES];
 
+extern uint16_t move_count;
+
 void initialise_cards_array();
 void initialise_cascades();
 void initialise_freecells();
 void initialise_foundations();
 void initialise_deck();
-void shuffle_deck();
+void deal_game(uint32_t number);
 
 uint8_t move_top_of_deck_to_cascade(uint8_t cascade);
-uint8_t can_move_card_onto_card(uint8_t card, uint8_t cascade);
+uint8_t move_top_of_deck_to_freecell(uint8_t freecell);
 uint8_t check_if_game_won();
 
+void move_cursor_to(uint8_t location, uint8_t card);
+void location_position(uint8_t location, uint8_t card, int16_t *x, int16_t *y);
+void redraw_location(uint8_t location, uint8_t card);
+void fly_card_to(uint8_t card, int16_t x, int16_t y, uint8_t location, uint8_t frames);
+void move_cursor_up_down(uint8_t up);
+void move_cursor_left_right(uint8_t right);
+
 void take_card();
 void place_card();
 void return_card();
+uint8_t fly_move(uint8_t source, uint8_t dest);
+
+void clear_undo_journal();
+uint8_t undo_last_move();
@@ -0,0 +1,37 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "solution.h"
+
+// deepest line of moves the search will look down
+#define DEADEND_MAX_DEPTH 6
+
+// positions searched before giving up with DEADEND_UNKNOWN
+#define DEADEND_NODE_LIMIT 400
+
+// number of sources tried per call to deadend_update
+#define DEADEND_STEPS_PER_FRAME 16
+
+// number of positions remembered so they aren't searched twice
+// must be a power of two
+#define DEADEND_SEEN_SIZE 128
+
+enum deadend_results {
+  DEADEND_IDLE = 0,
+  DEADEND_SEARCHING,
+  // a won position was found
+  DEADEND_WINNABLE,
+  // the search ran out of depth, positions or memory
+  DEADEND_UNKNOWN,
+  // there isn't a single legal move
+  DEADEND_NO_MOVES,
+  // every position which can be reached has been tried
+  // and none of them are won
+  DEADEND_STUCK
+};
+
+void deadend_reset();
+uint8_t deadend_update();
+solution_move_t deadend_winning_move();
@@ -0,0 +1,23 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+enum deal_filters {
+  DEAL_FILTER_ALL = 0,
+  DEAL_FILTER_SOLVABLE,
+  DEAL_FILTER_EASY,
+  DEAL_FILTER_MEDIUM,
+  DEAL_FILTER_HARD,
+  DEAL_FILTER_COUNT
+};
+
+// length of each deal filter name, including the terminator
+#define DEAL_FILTER_NAME_LENGTH 10
+
+extern uint8_t deal_filter;
+extern const char __wf_rom deal_filter_names[DEAL_FILTER_COUNT][DEAL_FILTER_NAME_LENGTH];
+
+uint8_t get_deal_difficulty(uint16_t seed);
+uint16_t find_deal_seed(uint16_t seed);
@@ -3,17 +3,66 @@
 
 #pragma once
 #include <wonderful.h>
+#include <ws.h>
+#include "card.h"
+
+// graphics backends built into the game, both unless a build leaves one
+// out. a colour only build needs a wonderswan color to run on
+#ifndef DRAW_COLOR
+#define DRAW_COLOR 1
+#endif
+#ifndef DRAW_MONO
+#define DRAW_MONO 1
+#endif
+
+#if !DRAW_COLOR && !DRAW_MONO
+#error at least one of DRAW_COLOR and DRAW_MONO has to be built in
+#endif
 
 #define BAIZE_PALETTE 1
 #define CHECKERBOARD_PALETTE 2
 #define CARDS_PALETTE 12
 
+#define TITLE_SCREEN_TILES 0x10
+#define TEXT_TILES 0xA0
 #define YOU_WIN_TILES 0xE0
+#define YOU_WIN_SPRITES 32
 #define CURSOR_TILES 0x5
 #define BAIZE_TILES 0x7
 #define CHECKERBOARD_TILES 0x1
 
-extern uint8_t camera_y;
+// letters shown in the bottom right corner of the game screen, two to a
+// row, e.g. how the other player in a race is getting on
+#define HUD_SPRITES 4
+
+// rows a card takes up when nothing is on top of it
+#define CARD_ROWS 4
+
+// rows from one card in a cascade to the next, spread out while the
+// whole cascade fits on screen and bunched up once it doesn't
+#define CASCADE_PITCH_SPREAD 2
+#define CASCADE_PITCH_BUNCHED 1
+
+// rect sizes for the blit kernels in blit.s, which work on 32 tile
+// wide tilemaps in iram
+#define BLIT_SIZE(width, height) ((width) | ((height) << 8))
+
+// fill a rect of a tilemap with one tile
+void blit_fill_rect(uint16_t __wf_iram* dest, uint16_t tile, uint16_t size);
+// copy rows of width tiles, packed one after another, into a rect of a
+// tilemap. a source overlapping the start of dest repeats down the tilemap
+void blit_copy_rect(uint16_t __wf_iram* dest, const uint16_t __wf_iram* src, uint16_t size);
+
+extern uint16_t camera_y;
+extern uint8_t hud_count;
+
+// layouts wider than the screen pan across to follow the cursor
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+extern uint8_t camera_x;
+void pan_board(uint8_t left_column);
+#else
+#define camera_x 0
+#endif
 
 void init_video();
 
@@ -21,28 +70,34 @@ void hide_screen();
 void show_title_screen();
 void show_game_screen();
 
-void copy_title_screen_gfx();
-void copy_checkerboard_gfx();
-void copy_card_tile_gfx();
-void copy_you_win_gfx();
-void copy_text_gfx();
-void copy_baize_gfx();
+void load_tiles(uint16_t tile, uint8_t asset);
 void copy_palettes();
 
 void clear_card_layer();
 void draw_checkerboard();
 void draw_baize();
-void draw_empty_freecells();
-void draw_empty_foundations();
+void draw_empty_foundation(uint8_t i);
+
+void draw_board();
+void scroll_board(uint8_t top_row);
+void draw_cascade(uint8_t cascade, uint8_t from);
+uint8_t cascade_card_row(uint8_t cascade, uint8_t index);
 
 void draw_title_screen();
 void draw_menu();
+void draw_menu_text(uint8_t x, uint8_t y, const char __wf_rom* text);
+void draw_menu_char(uint8_t x, uint8_t y, char c);
 
 void set_up_you_win_sprites();
 
+void invalidate_view();
 void reset_drawn_cursor();
 void draw_cursor();
-void copy_card_tiles_to_sprites(uint8_t x, uint8_t y);
+void draw_cursor_at(uint8_t tx, uint8_t ty);
+void copy_card_tiles_to_sprites(uint8_t card);
 void clear_card_tiles(uint8_t x, uint8_t y);
 void draw_card_tiles(uint8_t card, uint8_t x, uint8_t y, uint8_t full_card);
 void draw_empty_card(uint8_t x, uint8_t y);
+void card_sprite_tiles(uint8_t card, uint16_t* tiles);
+void draw_flights(uint8_t first, uint8_t shown);
+void draw_hud(const char __wf_rom* text);
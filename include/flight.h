@@ -0,0 +1,55 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include <ws.h>
+
+// cards can fly from one place on the board to another as a group of
+// sprites, while the game carries on underneath them. the place they're
+// going is only drawn once they land
+#define FLIGHT_SLOTS 8
+
+// sprites in each flying card, 3 across and 4 down
+#define FLIGHT_TILES 12
+
+// frames flights take, dealt cards need to land before the next
+// card goes to the same cascade
+#define FLIGHT_DEAL_FRAMES 8
+#define FLIGHT_MOVE_FRAMES 10
+
+// a flight which doesn't land anywhere, e.g. one going off the screen
+#define FLIGHT_NOWHERE 0xfe
+
+// 32 sprites can be on one line of the screen. the cursor and the card
+// in hand take up 4 of them and the corner letters 2, and flights set
+// off at least a frame apart so they're spread down the screen, but even
+// all of them side by side has to fit. the "you win" text takes the
+// first 32 sprites
+#if (FLIGHT_SLOTS * 3) + 4 + 2 > 32 || 32 + (FLIGHT_SLOTS * FLIGHT_TILES) > 128
+#error too many flight slots for the sprite hardware
+#endif
+
+typedef struct {
+    // NO_CARD when the slot is free
+    uint8_t card;
+    // where the card is drawn once it lands, as a solution location
+    uint8_t location;
+    uint16_t tiles[FLIGHT_TILES];
+} flight_t;
+
+// where a flight is in board pixels, and whether it has set off yet,
+// going by its tweens
+#define flight_x(slot) (tweens[TWEEN_FLIGHT_X(slot)].value)
+#define flight_y(slot) (tweens[TWEEN_FLIGHT_Y(slot)].value)
+#define flight_waiting(slot) (tweens[TWEEN_FLIGHT_X(slot)].delay > 0)
+
+extern flight_t flights[FLIGHT_SLOTS];
+extern uint8_t flights_active;
+
+void flight_reset();
+uint8_t flight_launch(uint8_t card, uint8_t location, int16_t from_x, int16_t from_y, int16_t to_x, int16_t to_y, uint8_t frames, uint8_t curve, uint8_t delay);
+void flight_update();
+void flight_land_all();
+uint8_t flight_carrying(uint8_t card);
+void flight_land_card(uint8_t card);
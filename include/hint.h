@@ -0,0 +1,21 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// number of best moves kept, pressing for a hint again shows the next one
+#define HINT_RANKED 4
+
+// number of sources scored per call to hint_update
+#define HINT_SOURCES_PER_FRAME 4
+
+// how long a hint stays up, and how often it flicks between
+// the source and destination
+#define HINT_FRAMES (75 * 3)
+#define HINT_BLINK_FRAMES 16
+
+void hint_update();
+uint8_t hint_show();
+void hint_hide();
+void hint_draw();
@@ -0,0 +1,31 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// the keypad is sampled from the hblank timer interrupt every this many
+// lines, which is about four times a frame
+#define INPUT_SAMPLE_LINES 40
+#define INPUT_SAMPLES_PER_FRAME 4
+
+// presses and releases waiting for the game loop, a power of two
+#define INPUT_QUEUE_SIZE 16
+
+#define INPUT_RELEASE 0
+#define INPUT_PRESS 1
+
+typedef struct {
+    // one of the WS_KEY_ bits
+    uint16_t key;
+    // the sample the key changed on
+    uint16_t time;
+    uint8_t type;
+} input_event_t;
+
+// keys held down, going by the events the game loop has had so far
+extern uint16_t input_held;
+
+void input_start();
+uint16_t input_update();
+void input_set_repeat(uint16_t keys, uint8_t delay_frames, uint8_t rate_frames);
@@ -0,0 +1,33 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "telemetry.h"
+
+// the serial port as a link cable to another wonderswan, see race.h. the
+// port can't be shared with telemetry, and WWitch keeps it for itself
+#if TELEMETRY || defined(__WONDERFUL_WWITCH__)
+#define LINK 0
+#else
+#define LINK 1
+#endif
+
+// bytes waiting to be sent and waiting to be read, powers of two. at
+// 38400 baud around 50 bytes go each way a frame
+#define LINK_TX_SIZE 64
+#define LINK_RX_SIZE 64
+
+#if LINK
+// bytes lost as they came in, either to the port overrunning or the
+// buffer being full
+extern uint8_t link_errors;
+
+void link_open();
+void link_close();
+void link_start();
+uint8_t link_put(const uint8_t *bytes, uint8_t length);
+uint8_t link_get(uint8_t *byte);
+#else
+#define link_start()
+#endif
@@ -0,0 +1,36 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// pcm streams are made from unsigned 8 bit samples by tools/mkpcm.c
+//
+// header (6 bytes):
+//   u8   sound dma control bits, the rate and where the samples go,
+//        written as they are like the 0xFB command in the music
+//   u8   flags
+//   u16  sample count, low word
+//   u16  sample count, high word
+// followed by either the samples, or two 4 bit delta codes a byte,
+// low nibble first, see pcm_deltas in src/pcm.c
+
+#define PCM_HEADER_SIZE 6
+
+// the samples are packed as 4 bit deltas
+#define PCM_FLAG_DELTA 0x01
+
+// sound dma control bits
+#define PCM_SDMA_ENABLE 0x80
+#define PCM_SDMA_HYPER_VOICE 0x10
+#define PCM_SDMA_REPEAT 0x08
+
+// iram ring packed streams are unpacked into, in two halves
+// each half has to last longer than a frame at the stream's rate
+#define PCM_RING_HALF 192
+#define PCM_RING_SIZE (PCM_RING_HALF * 2)
+
+uint8_t pcm_play(const uint8_t __far* stream);
+void pcm_stop();
+void pcm_update();
+uint8_t pcm_playing();
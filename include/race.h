@@ -0,0 +1,85 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "link.h"
+#include "solution.h"
+
+// two players race through the same deal over the link cable. neither
+// side sends its board, just a record for each move, which plays it on
+// a copy of the other player's board kept to show how far they've got.
+// now and then the whole board's hash is sent to check the copy by
+//
+// each record is a type byte followed by a fixed number of bytes
+enum race_records {
+  // RACE_VERSION, a number picked at random, and the deal the side
+  // wants to play, little endian. the side with the higher number gets
+  // its deal, or the higher deal if the numbers are the same
+  RACE_HELLO = 0xE1,
+  // the move in the solution book's format, then the card
+  RACE_MOVE,
+  // how many moves have been sent, little endian, and the board hash
+  // once they've all been made
+  RACE_CHECK,
+  // how many moves the win took
+  RACE_WIN,
+  // the player has left the race
+  RACE_QUIT
+};
+
+#define RACE_FIRST_RECORD RACE_HELLO
+#define RACE_LAST_RECORD RACE_QUIT
+
+// bytes in each record, including its type
+#define RACE_RECORD_LENGTHS { 8, 2 + sizeof(solution_move_t), 7, 3, 1 }
+
+// both sides have to be playing by the same rules
+#define RACE_VERSION ((VARIANT << 4) | FREECELLS)
+
+// moves between each board hash being sent
+#define RACE_CHECK_MOVES 8
+
+// frames between hellos while waiting for the other side, which might
+// not have been listening for the last one
+#define RACE_HELLO_FRAMES 32
+
+enum race_states {
+  RACE_OFF = 0,
+  // waiting for the other side's hello
+  RACE_LINKING,
+  // both sides have agreed on a deal, which hasn't been dealt yet
+  RACE_READY,
+  RACE_RACING,
+  RACE_WON,
+  RACE_LOST,
+  // the other player left before anyone won
+  RACE_ABANDONED
+};
+
+#if LINK
+extern uint8_t race_state;
+// set once the copy of the other player's board stops matching theirs
+extern uint8_t race_desynced;
+// set once a record to the other player has been lost, so their copy
+// of this board stops matching it
+extern uint8_t race_send_failed;
+extern uint32_t race_seed;
+// cards the other player has put on the foundations
+extern uint8_t race_opponent_cards;
+
+void race_link(uint32_t seed, uint16_t nonce);
+void race_deal();
+void race_leave();
+void race_update();
+void race_move(uint8_t source, uint8_t dest, uint8_t card);
+void race_won();
+#else
+// without the link there's never a race
+#define race_state RACE_OFF
+#define race_deal()
+#define race_leave()
+#define race_update()
+#define race_move(source, dest, card)
+#define race_won()
+#endif
@@ -0,0 +1,36 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// number of game records the log can hold before it gets compacted
+// two headers and two copies of the log have to fit in an eeprom
+#if defined(SAVE_EEPROM_WORDS) && (SAVE_EEPROM_WORDS - 16) / 4 < 240
+#define SAVE_LOG_RECORDS ((SAVE_EEPROM_WORDS - 16) / 4)
+#else
+#define SAVE_LOG_RECORDS 240
+#endif
+
+// number of slots in the seed -> record index
+// must be a power of two larger than SAVE_LOG_RECORDS
+#define SAVE_INDEX_SIZE 256
+
+// returned by save_get_best_moves for seeds which haven't been won
+#define SAVE_NO_BEST 0xffff
+
+typedef struct {
+    uint16_t games_played;
+    uint16_t games_won;
+    uint16_t current_streak;
+    uint16_t best_streak;
+} save_stats_t;
+
+extern save_stats_t save_stats;
+
+void save_init();
+// records only have room for deal numbers up to 0xffff
+void save_record_game(uint16_t seed, uint16_t moves, uint8_t won);
+uint16_t save_get_best_moves(uint16_t seed);
+// called on frames with time to spare
+void save_update();
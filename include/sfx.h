@@ -0,0 +1,21 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "vgm.h"
+
+// wavetable channel (0-3) the effects borrow from the music
+#define SFX_CHANNEL 2
+
+enum sfx_effects {
+  SFX_NONE = 0,
+  SFX_PICK_UP,
+  SFX_PLACE,
+  SFX_INVALID,
+  SFX_AUTOPLAY,
+  SFX_COUNT
+};
+
+void sfx_play(uint8_t effect);
+void sfx_update(vgmswan_state_t *music);
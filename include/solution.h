@@ -0,0 +1,47 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "variant.h"
+
+// a move is packed into one byte
+// the high nibble is where the card comes from, the low nibble where it goes
+// the cascades come first, then the freecells, and 12 is the foundations
+// in standard freecell that's 0-7 for the cascades and 8-11 for the freecells
+#define SOLUTION_FREECELL_0 CASCADES
+#define SOLUTION_FOUNDATION ((CASCADES + FREECELLS) <= 12 ? 12 : (CASCADES + FREECELLS))
+
+#if SOLUTION_FOUNDATION < 15
+typedef uint8_t solution_move_t;
+
+#define SOLUTION_MOVE(source, dest) (((source) << 4) | (dest))
+#define SOLUTION_MOVE_SOURCE(move) ((move) >> 4)
+#define SOLUTION_MOVE_DEST(move) ((move) & 0xf)
+
+// returned by solution_next_move once a solution has been played out
+#define SOLUTION_END 0xff
+#else
+// too many places for a nibble each, so moves take a byte for each
+typedef uint16_t solution_move_t;
+
+#define SOLUTION_MOVE(source, dest) (((source) << 8) | (dest))
+#define SOLUTION_MOVE_SOURCE(move) ((move) >> 8)
+#define SOLUTION_MOVE_DEST(move) ((move) & 0xff)
+
+#define SOLUTION_END 0xffff
+#endif
+
+// the book is a game count followed by one entry per game:
+// the seed and move count as little endian words, then one byte per move.
+// it is only ever read forwards, so it can hold any number of games
+typedef struct {
+    const uint8_t __far* ptr;
+    uint16_t games_left;
+    uint16_t moves_left;
+} solution_reader_t;
+
+void solution_book_open(solution_reader_t *reader);
+uint8_t solution_next_game(solution_reader_t *reader, uint16_t *seed);
+uint8_t solution_find_game(solution_reader_t *reader, uint32_t seed);
+solution_move_t solution_next_move(solution_reader_t *reader);
@@ -0,0 +1,76 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// frame timings and game events are sent out of the serial port when
+// built with make TELEMETRY=1, for build/host/teledump to decode
+#ifndef TELEMETRY
+#define TELEMETRY 0
+#endif
+
+#if TELEMETRY && defined(__WONDERFUL_WWITCH__)
+#error telemetry needs the serial port, which WWitch keeps for itself
+#endif
+
+// bytes waiting to be sent, a power of two. at 38400 baud around 50
+// bytes go out each frame
+#define TELEMETRY_BUFFER_SIZE 128
+
+// scanlines from one vblank to the next, which sections are timed in
+#define TELEMETRY_LINES 159
+
+// each record is a type byte followed by a fixed number of bytes
+enum telemetry_records {
+  // sequence number, vblanks missed since the last frame, records dropped
+  // since the last frame as the buffer was full
+  TELEMETRY_FRAME = 0xF1,
+  // one of telemetry_sections, scanlines it took
+  TELEMETRY_SECTION,
+  // scanlines the music driver's tick took, bytes of the track it read
+  TELEMETRY_MUSIC,
+  // solution book source and destination, card
+  TELEMETRY_MOVE,
+  // the deal number, 4 bytes little endian
+  TELEMETRY_GAME
+};
+
+#define TELEMETRY_FIRST_RECORD TELEMETRY_FRAME
+#define TELEMETRY_LAST_RECORD TELEMETRY_GAME
+
+// bytes in each record, including its type
+#define TELEMETRY_RECORD_LENGTHS { 4, 3, 3, 4, 5 }
+
+// the parts of a frame which are timed, in the order they run
+enum telemetry_sections {
+  // music, sound effects and samples, just after vblank
+  TELEMETRY_SOUND = 0,
+  TELEMETRY_INPUT,
+  // tweens and cards in flight
+  TELEMETRY_MOTION,
+  // whatever the game state does
+  TELEMETRY_LOGIC,
+  // sprites for cards in flight
+  TELEMETRY_SPRITES,
+  TELEMETRY_SECTIONS
+};
+
+#if TELEMETRY
+void telemetry_start();
+void telemetry_frame(uint8_t vblanks);
+void telemetry_section(uint8_t section);
+void telemetry_music_begin(const void __far *ptr);
+void telemetry_music_end(const void __far *ptr);
+void telemetry_move(uint8_t source, uint8_t dest, uint8_t card);
+void telemetry_game(uint32_t seed);
+#else
+// without telemetry built in none of it costs anything
+#define telemetry_start()
+#define telemetry_frame(vblanks)
+#define telemetry_section(section)
+#define telemetry_music_begin(ptr)
+#define telemetry_music_end(ptr)
+#define telemetry_move(source, dest, card)
+#define telemetry_game(seed)
+#endif
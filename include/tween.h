@@ -0,0 +1,57 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "flight.h"
+
+// a tween moves a value from one number to another over a fixed number
+// of frames, following one of the easing curves in rom
+enum tween_curves {
+  TWEEN_LINEAR = 0,
+  // fast to begin with and slowing down as it gets there
+  TWEEN_EASE_OUT,
+  // goes a little past where it's going and comes back
+  TWEEN_OVERSHOOT,
+  TWEEN_CURVES
+};
+
+// every tween has its own slot, and they're all moved on together once
+// a frame by tween_update. flights have one for each of x and y
+enum tween_slots {
+  TWEEN_CURSOR_X = 0,
+  TWEEN_CURSOR_Y,
+  TWEEN_CAMERA_X,
+  TWEEN_CAMERA_Y,
+  TWEEN_FLIGHTS,
+  TWEEN_SLOTS = TWEEN_FLIGHTS + (FLIGHT_SLOTS * 2)
+};
+
+#define TWEEN_FLIGHT_X(slot) (TWEEN_FLIGHTS + ((slot) << 1))
+#define TWEEN_FLIGHT_Y(slot) (TWEEN_FLIGHT_X(slot) + 1)
+
+// steps in each easing table, a tween goes through all of them
+#define TWEEN_STEPS 16
+// a tween's phase once it has got where it's going
+#define TWEEN_END (TWEEN_STEPS << 8)
+
+typedef struct {
+    int16_t from;
+    int16_t to;
+    int16_t value;
+    // 8.8 position in the easing table, and how far it goes each frame
+    uint16_t phase;
+    uint16_t speed;
+    // frames left before it sets off
+    uint8_t delay;
+    uint8_t curve;
+} tween_t;
+
+extern tween_t tweens[TWEEN_SLOTS];
+
+#define tween_done(slot) (tweens[slot].phase >= TWEEN_END)
+
+void tween_start(uint8_t slot, int16_t from, int16_t to, uint8_t frames, uint8_t curve, uint8_t delay);
+void tween_set(uint8_t slot, int16_t value);
+void tween_stop(uint8_t slot);
+void tween_update();
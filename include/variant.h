@@ -0,0 +1,85 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// rules the game is built with, picked at build time with e.g.
+// make VARIANT=bakers_game so each build only has its own rules in it
+#define VARIANT_FREECELL 0
+// freecell building down in suit rather than in alternate colours
+#define VARIANT_BAKERS_GAME 1
+// eight freecells, half of them dealt into, and building in suit
+#define VARIANT_EIGHT_OFF 2
+// ten cascades, two cards dealt into the freecells, and building in suit
+#define VARIANT_SEAHAVEN_TOWERS 3
+
+#ifndef VARIANT
+#define VARIANT VARIANT_FREECELL
+#endif
+
+#if VARIANT == VARIANT_FREECELL || VARIANT == VARIANT_BAKERS_GAME
+#define CASCADES 8
+// fewer freecells make a harder game, e.g. make FREECELLS=2
+#ifndef VARIANT_FREECELLS
+#define VARIANT_FREECELLS 4
+#endif
+#define FREECELLS VARIANT_FREECELLS
+#define DEALT_FREECELLS 0
+#define BUILD_IN_SUIT (VARIANT == VARIANT_BAKERS_GAME)
+#define EMPTY_CASCADE_KINGS_ONLY 0
+#elif VARIANT == VARIANT_EIGHT_OFF
+#define CASCADES 8
+#define FREECELLS 8
+#define DEALT_FREECELLS 4
+#define BUILD_IN_SUIT 1
+#define EMPTY_CASCADE_KINGS_ONLY 1
+#elif VARIANT == VARIANT_SEAHAVEN_TOWERS
+#define CASCADES 10
+#define FREECELLS 4
+#define DEALT_FREECELLS 2
+#define BUILD_IN_SUIT 1
+#define EMPTY_CASCADE_KINGS_ONLY 1
+#else
+#error unknown VARIANT
+#endif
+
+#define FOUNDATIONS 4
+
+#if FREECELLS < 1 || FREECELLS > 8 || DEALT_FREECELLS > FREECELLS
+#error the variant needs between 1 and 8 freecells
+#endif
+
+// the solution book and deal catalogue are made for standard freecell
+#define VARIANT_STANDARD (VARIANT == VARIANT_FREECELL && FREECELLS == 4)
+
+// check if you can move card1 onto card2
+static inline uint8_t can_move_card_onto_card(uint8_t card1, uint8_t card2)
+{
+    // new card's value should be 1 less than the cascade card's
+    if (((card1 & 0xf) + 1) != (card2 & 0xf))
+    {
+        return 0;
+    }
+
+#if BUILD_IN_SUIT
+    // the upper nibble is the suit, which has to match
+    return ((card1 ^ card2) & 0xf0) == 0;
+#else
+    // lowest bit of the upper nibble says if the card is
+    // black or red, so if that bit is different for both cards
+    // then when xor'ed that bit should be 1
+    return ((card1 ^ card2) & 0x10) == 0x10;
+#endif
+}
+
+// check if a card can be put in an empty cascade
+static inline uint8_t can_move_card_to_empty_cascade(uint8_t card)
+{
+#if EMPTY_CASCADE_KINGS_ONLY
+    return (card & 0xf) == 12;
+#else
+    (void) card;
+    return 1;
+#endif
+}
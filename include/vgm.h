@@ -25,14 +25,29 @@
 #pragma once
 #include <stdint.h>
 
+// sound ports from 0x80 to 0x94
+#define VGMSWAN_SOUND_PORT_FIRST 0x80
+#define VGMSWAN_SOUND_PORT_COUNT 0x15
+
 typedef struct {
     const uint8_t __far* ptr;
     uint16_t start_offset;
     uint8_t flags;
+    // channel + 1 of a channel being played by something else, or 0
+    // while it's muted, what the track writes to it is kept here instead
+    uint8_t muted_channel;
+    uint8_t muted_ports[VGMSWAN_SOUND_PORT_COUNT];
+    uint8_t muted_wave[16];
 } vgmswan_state_t;
 
 #define VGMSWAN_PLAYBACK_FINISHED 0xFFFF
 
 void vgmswan_init(vgmswan_state_t *state, const void __far* ptr);
+// like vgmswan_init, without setting up the sound output
+void vgmswan_start(vgmswan_state_t *state, const void __far* ptr);
 // return: amount of HBLANK lines to wait
 uint16_t vgmswan_play(vgmswan_state_t *state);
+// hand a channel (0-3) over to something else until it's unmuted
+// the track keeps playing, so it's back in step when it gets it back
+void vgmswan_mute_channel(vgmswan_state_t *state, uint8_t channel);
+void vgmswan_unmute_channel(vgmswan_state_t *state);
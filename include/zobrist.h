@@ -0,0 +1,44 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+#include "zobrist_keys_bin.h"
+
+// the board hash is the xor of one key for each card and the thing it's on
+// a card in a cascade is keyed on the card underneath it rather than the
+// cascade number, and all freecells share one key, so positions which only
+// differ in the order of the cascades or freecells hash the same
+//
+// card values never use 13-15 in the low nibble, so those are used
+// for the locations which aren't another card
+#define ZOBRIST_CASCADE_BOTTOM 0x0d
+#define ZOBRIST_FREECELL 0x0e
+#define ZOBRIST_FOUNDATION 0x0f
+
+// number of recent positions remembered for repetition detection
+#define ZOBRIST_HISTORY_SIZE 16
+
+// the keys are a row for each of the 52 cards, with a column for each
+// card it can be on followed by the three other locations. card values
+// have gaps in them, so tables turn them into rows and columns
+#define ZOBRIST_CARDS 52
+#define ZOBRIST_LOCATIONS (ZOBRIST_CARDS + 3)
+
+extern const uint16_t __wf_rom zobrist_rows[64];
+extern const uint8_t __wf_rom zobrist_columns[64];
+
+#define ZOBRIST_KEY(card, location) (((const uint32_t __wf_rom*) zobrist_keys)[zobrist_rows[card] + zobrist_columns[location]])
+
+extern uint32_t board_hash;
+extern uint8_t board_repeated;
+
+// add or remove a card at a location, which are the same operation
+static inline void zobrist_toggle(uint8_t card, uint8_t location)
+{
+    board_hash ^= ZOBRIST_KEY(card, location);
+}
+
+void zobrist_reset();
+uint8_t zobrist_seen_recently(uint32_t hash);
+uint8_t zobrist_record_position();
@@ -0,0 +1,118 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// a bump allocator over a block of iram. nothing is freed on its own,
+// instead everything allocated after a mark goes at once when the mark
+// is released, so there's nothing to fragment. the game states release
+// their scope's marks as they change, see arena_enter
+//
+// named blocks are carved out of the arena for each part of the game
+// which wants one, which keeps track of how much each of them uses
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wonderful.h>
+#include "arena.h"
+
+// words, so that everything allocated is word aligned
+static uint16_t arena_memory[ARENA_SIZE >> 1];
+
+arena_t arenas[ARENA_COUNT] = {
+    { (uint8_t*) arena_memory, ARENA_SIZE, 0, 0 }
+};
+
+const char __wf_rom arena_names[ARENA_COUNT][ARENA_NAME_LENGTH] = {
+    "root",
+    "deadend"
+};
+
+static uint8_t arena_scope;
+
+// the root's mark from when each scope was entered
+static uint16_t scope_marks[ARENA_SCOPES];
+
+// move on to a game state's scope
+void arena_enter(uint8_t scope)
+{
+    uint8_t i;
+
+    if (scope > arena_scope)
+    {
+        // going further in keeps everything allocated so far
+        for (i = arena_scope + 1; i <= scope; i++)
+        {
+            scope_marks[i] = arenas[ARENA_ROOT].top;
+        }
+    }
+    else
+    {
+        arena_release(ARENA_ROOT, scope_marks[scope]);
+    }
+
+    arena_scope = scope;
+}
+
+// carve a named block out of the root for the current scope, or empty
+// it if it's already open and big enough
+// returns 0 if there isn't room, in which case allocations from it fail
+uint8_t arena_open(uint8_t arena, uint16_t size)
+{
+    arena_t *block = &arenas[arena];
+
+    if (block->size < size)
+    {
+        block->base = arena_alloc(ARENA_ROOT, size);
+        block->size = (block->base != NULL) ? size : 0;
+    }
+
+    block->top = 0;
+
+    return block->size != 0;
+}
+
+// returns NULL if there isn't room
+void* arena_alloc(uint8_t arena, uint16_t size)
+{
+    arena_t *block = &arenas[arena];
+    uint8_t *ptr;
+
+    size = (size + 1) & ~1;
+
+    if (size > block->size - block->top)
+    {
+        return NULL;
+    }
+
+    ptr = block->base + block->top;
+    block->top += size;
+
+    if (block->top > block->high)
+    {
+        block->high = block->top;
+    }
+
+    return ptr;
+}
+
+// free everything allocated since mark. releasing the root closes the
+// blocks which were carved out after the mark
+void arena_release(uint8_t arena, uint16_t mark)
+{
+    uint8_t i;
+
+    arenas[arena].top = mark;
+
+    if (arena != ARENA_ROOT)
+    {
+        return;
+    }
+
+    for (i = 1; i < ARENA_COUNT; i++)
+    {
+        if (arenas[i].size != 0 && arenas[i].base >= arenas[ARENA_ROOT].base + mark)
+        {
+            arenas[i].size = 0;
+            arenas[i].top = 0;
+        }
+    }
+}
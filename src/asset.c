@@ -0,0 +1,109 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// loads assets out of the pack built by tools/mkpack.c, see asset.h
+//
+// raw assets are copied with the general dma on colour hardware, or by
+// the cpu on mono hardware which doesn't have one, and lzsa2 assets are
+// unpacked a block at a time. either way a load can be done all at once,
+// or a block each step so a big one can be spread over several frames
+
+#include <stdint.h>
+#include <string.h>
+#include <ws.h>
+#include <wonderful.h>
+#include <wsx/lzsa.h>
+#include "asset.h"
+
+#include "asset_pack_bin.h"
+
+#ifdef __WONDERFUL_WWITCH__
+#define ws_gdma_copy memcpy
+#endif
+
+#define ASSET_HEADER ((const asset_header_t __far*) asset_pack)
+
+// the first entry of the selected set's directory
+static uint16_t asset_first;
+
+static const asset_entry_t __far* asset_entry(uint8_t id)
+{
+    return (const asset_entry_t __far*) (asset_pack + sizeof(asset_header_t)) + asset_first + id;
+}
+
+// use a set's variant of each asset from now on
+void asset_select(uint8_t set)
+{
+    asset_first = set * ASSET_HEADER->count;
+}
+
+// where an asset is in the pack, for raw assets which are read in place
+const void __far* asset_data(uint8_t id)
+{
+    return asset_pack + asset_entry(id)->offset;
+}
+
+// bytes in an asset once it's unpacked
+uint16_t asset_size(uint8_t id)
+{
+    return asset_entry(id)->size;
+}
+
+void asset_load_start(asset_loader_t* loader, uint8_t id, void* dest)
+{
+    const asset_entry_t __far* entry = asset_entry(id);
+
+    loader->source = asset_pack + entry->offset;
+    loader->dest = dest;
+    loader->left = entry->size;
+    loader->codec = entry->codec;
+}
+
+// copy or unpack the next block of a load
+// returns 0 once there's nothing left to do
+uint8_t asset_load_step(asset_loader_t* loader)
+{
+    uint16_t length = (loader->left < ASSET_BLOCK_SIZE) ? loader->left : ASSET_BLOCK_SIZE;
+
+    if (length == 0)
+    {
+        return 0;
+    }
+
+    if (loader->codec == ASSET_LZSA2)
+    {
+        wsx_lzsa2_decompress(loader->dest, loader->source + 2);
+        loader->source += 2 + *((const uint16_t __far*) loader->source);
+    }
+    else
+    {
+        if (ws_system_is_color_active())
+        {
+            ws_gdma_copy(loader->dest, loader->source, length);
+        }
+        else
+        {
+            memcpy(loader->dest, loader->source, length);
+        }
+
+        loader->source += length;
+    }
+
+    loader->dest += length;
+    loader->left -= length;
+
+    return loader->left > 0;
+}
+
+// load an asset all at once
+void asset_load(uint8_t id, void* dest)
+{
+    asset_loader_t loader;
+
+    asset_load_start(&loader, id, dest);
+
+    while (asset_load_step(&loader))
+    {
+        // each step does a block
+    }
+}
@@ -0,0 +1,90 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// plays back a solution from the solution book on the game board
+// the cursor goes to each card in turn, which then flies across to where
+// it's going as an undone move does. the only cost per move is decoding
+// one byte
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "autoplay.h"
+#include "card.h"
+#include "flight.h"
+#include "sfx.h"
+
+// frames the cursor spends moving to a card before it flies off
+#define AUTOPLAY_MOVE_FRAMES 12
+
+enum autoplay_phases {
+  AUTOPLAY_PICK_UP = 0,
+  AUTOPLAY_FLYING
+};
+
+uint8_t autoplay_mode;
+
+static solution_reader_t autoplay_reader;
+static solution_move_t autoplay_move;
+static uint8_t autoplay_phase;
+static uint8_t autoplay_timer;
+
+static void next_move()
+{
+    autoplay_move = solution_next_move(&autoplay_reader);
+    autoplay_phase = AUTOPLAY_PICK_UP;
+    autoplay_timer = AUTOPLAY_MOVE_FRAMES;
+
+    if (autoplay_move != SOLUTION_END)
+    {
+        move_cursor_to(SOLUTION_MOVE_SOURCE(autoplay_move), NO_CARD);
+    }
+}
+
+// start playing the game the reader is positioned at
+// the board should have been freshly dealt for that game's seed
+void autoplay_start(uint8_t mode, const solution_reader_t *reader)
+{
+    autoplay_mode = mode;
+    autoplay_reader = *reader;
+
+    next_move();
+}
+
+// returns 0 once the whole solution has been played
+uint8_t autoplay_update()
+{
+    uint8_t card;
+
+    if (autoplay_timer > 0)
+    {
+        autoplay_timer--;
+        return 1;
+    }
+
+    if (autoplay_move == SOLUTION_END)
+    {
+        return 0;
+    }
+
+    if (autoplay_phase == AUTOPLAY_PICK_UP)
+    {
+        // the cursor follows the card and waits for it to land
+        card = fly_move(SOLUTION_MOVE_SOURCE(autoplay_move), SOLUTION_MOVE_DEST(autoplay_move));
+        move_cursor_to(SOLUTION_MOVE_DEST(autoplay_move), card);
+        autoplay_phase = AUTOPLAY_FLYING;
+        autoplay_timer = FLIGHT_MOVE_FRAMES;
+
+        // the title screen's attract mode plays without sound effects
+        if (autoplay_mode == AUTOPLAY_SHOW_ME)
+        {
+            sfx_play(SFX_AUTOPLAY);
+        }
+    }
+    else
+    {
+        next_move();
+    }
+
+    return 1;
+}
@@ -0,0 +1,96 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// string instruction kernels for the tilemap fills and copies the
+// renderer does on every card move. tilemaps are 32 tiles wide, and
+// rects are passed as the width in the low byte and the number of rows
+// in the high byte, see BLIT_SIZE in draw.h
+//
+// arguments come in ax, dx and cx. the tilemaps and sprite table are
+// all in iram, which ds points at, so es is pointed there too
+
+#include <wonderful.h>
+
+// WS_SCREEN_WIDTH_TILES from ws.h
+#define TILEMAP_WIDTH 32
+
+	.arch	i186
+	.code16
+	.intel_syntax noprefix
+
+	.section .fartext.s.blit, "ax"
+
+// void blit_fill_rect(uint16_t *dest, uint16_t tile, uint16_t size)
+	.align 2
+	.global blit_fill_rect
+blit_fill_rect:
+	push	di
+	push	es
+	push	ds
+	pop	es
+
+	mov	di, ax
+	mov	ax, dx
+
+	// dl counts rows, dh is the width and bx skips to the next row
+	mov	dl, ch
+	mov	dh, cl
+	xor	ch, ch
+	mov	bx, TILEMAP_WIDTH
+	sub	bx, cx
+	shl	bx, 1
+
+	cld
+	test	dl, dl
+	jz	2f
+
+1:
+	mov	cl, dh
+	rep	stosw
+	add	di, bx
+	dec	dl
+	jnz	1b
+
+2:
+	pop	es
+	pop	di
+	IA16_RET
+
+// void blit_copy_rect(uint16_t *dest, const uint16_t *src, uint16_t size)
+// the source rows are packed together, width tiles each. a source which
+// overlaps the start of dest repeats itself down the tilemap
+	.align 2
+	.global blit_copy_rect
+blit_copy_rect:
+	push	si
+	push	di
+	push	es
+	push	ds
+	pop	es
+
+	mov	di, ax
+	mov	si, dx
+
+	mov	dl, ch
+	mov	dh, cl
+	xor	ch, ch
+	mov	bx, TILEMAP_WIDTH
+	sub	bx, cx
+	shl	bx, 1
+
+	cld
+	test	dl, dl
+	jz	2f
+
+1:
+	mov	cl, dh
+	rep	movsw
+	add	di, bx
+	dec	dl
+	jnz	1b
+
+2:
+	pop	es
+	pop	di
+	pop	si
+	IA16_RET
@@ -7,7 +7,13 @@
 #include <wonderful.h>
 #include "card.h"
 #include "draw.h"
+#include "flight.h"
 #include "main.h"
+#include "race.h"
+#include "solution.h"
+#include "telemetry.h"
+#include "tween.h"
+#include "zobrist.h"
 
 uint8_t cursor_area;
 
@@ -34,11 +40,24 @@ uint8_t foundation_counts[FOUNDATIONS];
 uint8_t deck[52];
 uint8_t deck_count;
 
-uint8_t cascades[CASCADES][32];
+uint8_t cascades[CASCADES][CASCADE_MAX_CARDS];
 uint8_t cascade_counts[CASCADES];
 
-const uint8_t __wf_rom cursor_area_tx[] = { 1, 15, 2};
-const uint8_t __wf_rom cursor_area_ty[] = { 0, 0,  5};
+// number of cards placed this game
+uint16_t move_count;
+
+// most recent moves, in the solution book's format
+// the card is kept too as foundation moves don't say which foundation
+static solution_move_t undo_moves[UNDO_JOURNAL_SIZE];
+static uint8_t undo_cards[UNDO_JOURNAL_SIZE];
+static uint8_t undo_pos;
+static uint8_t undo_count;
+
+const uint8_t __wf_rom cursor_area_tx[] = { LAYOUT_FREECELLS_TX, LAYOUT_FOUNDATIONS_TX, LAYOUT_CASCADES_TX };
+const uint8_t __wf_rom cursor_area_ty[] = { LAYOUT_FREECELLS_TY, LAYOUT_FOUNDATIONS_TY, LAYOUT_CASCADES_TY };
+
+// number of cards across each area
+static const uint8_t __wf_rom cursor_area_size[] = { FREECELLS, FOUNDATIONS, CASCADES };
 
 /*
 const char* __wf_rom value_names[13] = {
@@ -56,9 +75,9 @@ void initialise_cascades()
 {
     uint8_t i, j;
    
-    for (i = 0; i < 8; i++)
+    for (i = 0; i < CASCADES; i++)
     {
-        for (j = 0; j < 32; j++)
+        for (j = 0; j < CASCADE_MAX_CARDS; j++)
         {
             cascades[i][j] = 0xff;
         }
@@ -67,6 +86,14 @@ void initialise_cascades()
     }
 }
 
+// zobrist location for a card going on top of a cascade
+static uint8_t cascade_location(uint8_t cascade)
+{
+    return (cascade_counts[cascade] > 0)
+        ? cascades[cascade][cascade_counts[cascade] - 1]
+        : ZOBRIST_CASCADE_BOTTOM;
+}
+
 uint8_t move_top_of_deck_to_cascade(uint8_t cascade)
 {
     // sanity check number of cards left in deck
@@ -88,12 +115,41 @@ uint8_t move_top_of_deck_to_cascade(uint8_t cascade)
     deck_count--;
    
     // update the top card of the cascade and keep count
+    zobrist_toggle(card, cascade_location(cascade));
     cascades[cascade][cascade_counts[cascade]] = card;
     cascade_counts[cascade]++;
+
+    // the dealt position is the first one the game can go back to
+    if (deck_count == 0)
+    {
+        zobrist_record_position();
+    }
    
     return 1;
 }
 
+// some variants deal the last few cards into the freecells
+uint8_t move_top_of_deck_to_freecell(uint8_t freecell)
+{
+    uint8_t card;
+
+    if (deck_count <= 0 || freecell >= FREECELLS)
+    {
+        return 0;
+    }
+
+    card = deck[--deck_count];
+    zobrist_toggle(card, ZOBRIST_FREECELL);
+    freecells[freecell][0] = card;
+
+    if (deck_count == 0)
+    {
+        zobrist_record_position();
+    }
+
+    return 1;
+}
+
 // initialise deck from cards array
 // and reset deck count
 void initialise_deck()
@@ -114,7 +170,7 @@ void initialise_freecells()
     uint8_t i;
 
 	// clear freecells and foundations
-	for (i = 0; i < 4; i++)
+	for (i = 0; i < FREECELLS; i++)
 	{
 		freecells[i][0] = NO_CARD;
 	}
@@ -125,7 +181,7 @@ void initialise_foundations()
     uint8_t i, j;
 
 	// clear freecells and foundations
-	for (i = 0; i < 4; i++)
+	for (i = 0; i < FOUNDATIONS; i++)
 	{
         foundation_counts[i] = 0;
 
@@ -137,24 +193,61 @@ void initialise_foundations()
 }
 
 
-void shuffle_deck()
+// microsoft freecell's deal numbers, so games 1 to 32000 are the same
+// deals players look solutions up by. any 32 bit number is a deal too
+//
+// the deck starts in microsoft's order, clubs, diamonds, hearts then
+// spades for each value from ace to king, and each card is picked from
+// the ones left with rand() % left then swapped to the end of them.
+// picked cards collect at the top of the deck in the order they're
+// picked, which is the order they go round the cascades in
+static const uint8_t __wf_rom deal_suits[4] = { 1, 2, 0, 3 };
+
+// rand() % left without dividing. rand() is only 15 bits, so
+// multiplying by ceil(2^k / left) with k = 15 + ceil(log2(left)) and
+// shifting down by k is exactly rand() / left. the multiplier always
+// fits in 16 bits, and k is at least 16 so the shift starts by taking
+// the top word of the product
+static const uint16_t __wf_rom deal_reciprocals[53] = {
+    0, 0, 32768, 43691, 32768, 52429, 43691, 37450, 32768, 58255, 52429, 47663,
+    43691, 40330, 37450, 34953, 32768, 61681, 58255, 55189, 52429, 49933, 47663, 45591,
+    43691, 41944, 40330, 38837, 37450, 36158, 34953, 33826, 32768, 63551, 61681, 59919,
+    58255, 56680, 55189, 53774, 52429, 51151, 49933, 48771, 47663, 46604, 45591, 44621,
+    43691, 42800, 41944, 41121, 40330
+};
+
+static const uint8_t __wf_rom deal_reciprocal_shifts[53] = {
+    0, 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5
+};
+
+// fill the deck with the cards for a deal, ready to be dealt from the top
+void deal_game(uint32_t number)
 {
-    uint8_t i;
-    uint8_t tmp;
+    uint32_t state = number;
     uint16_t rnd;
-   
-    // fisher–yates shuffle
-    for (i = 0; i < deck_count; i++)
+    uint8_t left, pick, card;
+
+    for (left = 0; left < 52; left++)
     {
-        // get random location to swap with
-        rnd = i + (rand() % (deck_count - i));
-       
-        // swap card at index i
-        // with the card at index rnd
-        tmp = deck[rnd];
-        deck[rnd] = deck[i];
-        deck[i] = tmp;
+        deck[left] = (left >> 2) | (deal_suits[left & 3] << 4);
+    }
+
+    // the last card left is the only one it could pick
+    for (left = 52; left > 1; left--)
+    {
+        state = (state * 214013) + 2531011;
+        rnd = (state >> 16) & 0x7fff;
+
+        pick = rnd - ((uint16_t) (((uint32_t) rnd * deal_reciprocals[left]) >> 16) >> deal_reciprocal_shifts[left]) * left;
+
+        card = deck[pick];
+        deck[pick] = deck[left - 1];
+        deck[left - 1] = card;
     }
+
+    deck_count = 52;
 }
 
 void initialise_cards_array()
@@ -175,27 +268,6 @@ void initialise_cards_array()
     }
 }
 
-// check if you can move card1 onto card2
-uint8_t can_move_card_onto_card(uint8_t card1, uint8_t card2)
-{   
-    // new card's value should be 1 less than the cascade card's
-    if (((card1 & 0xf) + 1) != (card2 & 0xf))
-    {
-        return 0;
-    }
-   
-    // lowest bit of the upper nibble says if the card is
-    // black or red, so if that bit is different for both cards
-    // then when xor'ed that bit should be 1
-    if (((card1 ^ card2) & 0x10) != 0x10)
-    {
-        return 0;
-    }
-   
-    // no problems found
-    return 1;
-}
-
 // game is essentially won if there are no cards "stuck" in the cascades
 // e.g. a black 2 under a red 9
 uint8_t check_if_game_won()
@@ -219,37 +291,271 @@ uint8_t check_if_game_won()
     return 1;
 }
 
+void clear_undo_journal()
+{
+    undo_pos = 0;
+    undo_count = 0;
+}
+
+static void journal_move(uint8_t source, uint8_t dest, uint8_t card)
+{
+    // putting a card back where it came from isn't worth undoing
+    if (source == dest)
+    {
+        return;
+    }
+
+    telemetry_move(source, dest, card);
+    race_move(source, dest, card);
+
+    undo_moves[undo_pos] = SOLUTION_MOVE(source, dest);
+    undo_cards[undo_pos] = card;
+    undo_pos = (undo_pos + 1) & (UNDO_JOURNAL_SIZE - 1);
+
+    if (undo_count < UNDO_JOURNAL_SIZE)
+    {
+        undo_count++;
+    }
+}
+
+// where the card in hand was picked up from, as a solution book location
+static uint8_t card_in_hand_source()
+{
+    return (card_in_hand_area == AREA_CASCADES)
+        ? card_in_hand_x
+        : (SOLUTION_FREECELL_0 + card_in_hand_x);
+}
+
+// point the cursor at a cascade, freecell or the foundation for a card
+void move_cursor_to(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        cursor_area = AREA_CASCADES;
+        cursor_x = location;
+        cursor_y = (cascade_counts[location] > 0) ? (cascade_counts[location] - 1) : 0;
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        cursor_area = AREA_FOUNDATIONS;
+        cursor_x = card >> 4;
+        cursor_y = 0;
+    }
+    else
+    {
+        cursor_area = AREA_FREECELLS;
+        cursor_x = location - SOLUTION_FREECELL_0;
+        cursor_y = 0;
+    }
+}
+
+// board pixels of the top card of a cascade, freecell or the foundation for a card
+void location_position(uint8_t location, uint8_t card, int16_t *x, int16_t *y)
+{
+    if (location < CASCADES)
+    {
+        *x = (cursor_area_tx[AREA_CASCADES] + (location * 3)) << 3;
+        *y = cascade_card_row(location, (cascade_counts[location] > 0) ? (cascade_counts[location] - 1) : 0) << 3;
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        *x = (cursor_area_tx[AREA_FOUNDATIONS] + ((card >> 4) * 3)) << 3;
+        *y = cursor_area_ty[AREA_FOUNDATIONS] << 3;
+    }
+    else
+    {
+        *x = (cursor_area_tx[AREA_FREECELLS] + ((location - SOLUTION_FREECELL_0) * 3)) << 3;
+        *y = cursor_area_ty[AREA_FREECELLS] << 3;
+    }
+}
+
+// draw whatever is now on top of a cascade, freecell or the foundation for a card
+void redraw_location(uint8_t location, uint8_t card)
+{
+    uint8_t count;
+
+    if (location < CASCADES)
+    {
+        count = cascade_counts[location];
+        draw_cascade(location, (count > 1) ? (count - 2) : 0);
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        count = foundation_counts[card >> 4];
+
+        if (count > 0)
+        {
+            draw_card_tiles(
+                foundations[card >> 4][count - 1],
+                cursor_area_tx[AREA_FOUNDATIONS] + ((card >> 4) * 3),
+                cursor_area_ty[AREA_FOUNDATIONS],
+                1
+            );
+        }
+        else
+        {
+            draw_empty_foundation(card >> 4);
+        }
+    }
+    else
+    {
+        location -= SOLUTION_FREECELL_0;
+
+        if (freecells[location][0] != NO_CARD)
+        {
+            draw_card_tiles(freecells[location][0], cursor_area_tx[AREA_FREECELLS] + (location * 3), cursor_area_ty[AREA_FREECELLS], 1);
+        }
+        else
+        {
+            draw_empty_card(cursor_area_tx[AREA_FREECELLS] + (location * 3), cursor_area_ty[AREA_FREECELLS]);
+        }
+    }
+}
+
+// send a card flying from board pixels x, y to a location it has already
+// been put in, which is drawn once it lands. cards going up to the
+// foundations overshoot a little and settle back into place
+void fly_card_to(uint8_t card, int16_t x, int16_t y, uint8_t location, uint8_t frames)
+{
+    int16_t to_x, to_y;
+
+    location_position(location, card, &to_x, &to_y);
+
+    if (!flight_launch(card, location, x, y, to_x, to_y, frames,
+            (location == SOLUTION_FOUNDATION) ? TWEEN_OVERSHOOT : TWEEN_EASE_OUT, 0))
+    {
+        redraw_location(location, card);
+    }
+}
+
+// point the cursor at the bottom card of a cascade, or the top of anywhere else
+static void move_cursor_to_slot(uint8_t area, uint8_t x)
+{
+    cursor_area = area;
+    cursor_x = x;
+    cursor_y = (area == AREA_CASCADES && cascade_counts[x] > 0) ? (cascade_counts[x] - 1) : 0;
+}
+
+// move the cursor to the nearest card in the row of areas above or below,
+// going round to the other end of the board at the top or bottom
+void move_cursor_up_down(uint8_t up)
+{
+    uint8_t area, i, slot_tx, distance;
+    uint8_t row = cursor_area_ty[cursor_area];
+    uint8_t tx = cursor_area_tx[cursor_area] + (cursor_x * 3);
+    uint8_t next_row = row, wrap_row = row;
+    uint8_t best_distance = 0xff, best_area = cursor_area, best_x = cursor_x;
+
+    for (area = 0; area < 3; area++)
+    {
+        i = cursor_area_ty[area];
+
+        if (up)
+        {
+            if (i < row && (next_row == row || i > next_row)) next_row = i;
+            if (i > wrap_row) wrap_row = i;
+        }
+        else
+        {
+            if (i > row && (next_row == row || i < next_row)) next_row = i;
+            if (i < wrap_row) wrap_row = i;
+        }
+    }
+
+    if (next_row == row)
+    {
+        next_row = wrap_row;
+    }
+
+    for (area = 0; area < 3; area++)
+    {
+        if (cursor_area_ty[area] != next_row)
+        {
+            continue;
+        }
+
+        for (i = 0; i < cursor_area_size[area]; i++)
+        {
+            slot_tx = cursor_area_tx[area] + (i * 3);
+            distance = (slot_tx > tx) ? (slot_tx - tx) : (tx - slot_tx);
+
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best_area = area;
+                best_x = i;
+            }
+        }
+    }
+
+    move_cursor_to_slot(best_area, best_x);
+}
+
+// move the cursor to the next card along in the same row of areas,
+// going round to the other side at either end
+void move_cursor_left_right(uint8_t right)
+{
+    uint8_t area, i, slot_tx, distance;
+    uint8_t row = cursor_area_ty[cursor_area];
+    uint8_t tx = cursor_area_tx[cursor_area] + (cursor_x * 3);
+    uint8_t best_distance = 0xff, best_area = cursor_area, best_x = cursor_x;
+
+    for (area = 0; area < 3; area++)
+    {
+        if (cursor_area_ty[area] != row)
+        {
+            continue;
+        }
+
+        for (i = 0; i < cursor_area_size[area]; i++)
+        {
+            // slots behind the cursor wrap round to a long way ahead of it
+            slot_tx = cursor_area_tx[area] + (i * 3);
+            distance = right ? (uint8_t) (slot_tx - tx) : (uint8_t) (tx - slot_tx);
+
+            if (distance != 0 && distance < best_distance)
+            {
+                best_distance = distance;
+                best_area = area;
+                best_x = i;
+            }
+        }
+    }
+
+    move_cursor_to_slot(best_area, best_x);
+}
+
 void take_card()
 {
     uint8_t card;
+    int16_t x, y;
 
     reset_drawn_cursor();
 
     // take card from cascades
     if (cursor_area == AREA_CASCADES && cascade_counts[cursor_x] > 0)
     {
-        uint8_t old_cursor_x = cursor_x;
-        uint8_t old_cursor_y = cursor_y;
-
         card = cascades[cursor_x][cursor_y];
-        copy_card_tiles_to_sprites(cursor_area_tx[cursor_area] + (cursor_x * 3), cursor_area_ty[cursor_area] + cursor_y);
+        flight_land_card(card);
+        location_position(cursor_x, card, &x, &y);
+        copy_card_tiles_to_sprites(card);
         cascade_counts[cursor_x]--;
+        zobrist_toggle(card, cascade_location(cursor_x));
 
         // check if this is an ace, if it is move it to the foundations
         if ((card & 0xf) == 0)
         {
             foundations[card >> 4][0] = card;
             foundation_counts[card >> 4]++;
+            move_count++;
+
+            zobrist_toggle(card, ZOBRIST_FOUNDATION);
+            zobrist_record_position();
+            journal_move(cursor_x, SOLUTION_FOUNDATION, card);
 
             card_in_hand_tiles_count = 0;
 
-            clear_card_tiles(cursor_area_tx[cursor_area] + (cursor_x * 3), cursor_area_ty[cursor_area] + cursor_y);
-            draw_card_tiles(
-                card,
-                cursor_area_tx[AREA_FOUNDATIONS] + ((card >> 4) * 3), 
-                cursor_area_ty[AREA_FOUNDATIONS],
-                1
-            );
+            fly_card_to(card, x, y, SOLUTION_FOUNDATION, FLIGHT_MOVE_FRAMES);
         }
         else
         {
@@ -270,30 +576,44 @@ void take_card()
             // this means that we must clear the card tiles one frame after updating the sprite table
             draw_cursor();
             wait_for_vblank();
-            clear_card_tiles(cursor_area_tx[cursor_area] + (old_cursor_x * 3), cursor_area_ty[cursor_area] + old_cursor_y);
         }
 
-        // redraw bottom card of cascade
-        if (cascade_counts[cursor_x] > 0)
-        {
-            card = cascades[cursor_x][cursor_y];
-
-            draw_card_tiles(
-                card,
-                cursor_area_tx[cursor_area] + (cursor_x * 3), 
-                cursor_area_ty[cursor_area] + cursor_y,
-                1
-            );
-        }
+        // redraw the cascade from its new bottom card down
+        draw_cascade(cursor_x, cursor_y);
     }
 
     // take card from freecell
     else if (cursor_area == AREA_FREECELLS && freecells[cursor_x][0] != NO_CARD)
     {
-        copy_card_tiles_to_sprites(cursor_area_tx[cursor_area] + (cursor_x * 3), cursor_area_ty[cursor_area] + cursor_y);
+        card = freecells[cursor_x][0];
+        flight_land_card(card);
+
+#if DEALT_FREECELLS > 0
+        // aces dealt into the freecells go straight to the foundations too
+        if ((card & 0xf) == 0)
+        {
+            freecells[cursor_x][0] = NO_CARD;
+            foundations[card >> 4][0] = card;
+            foundation_counts[card >> 4]++;
+            move_count++;
 
-        card_in_hand = freecells[cursor_x][0];
+            zobrist_toggle(card, ZOBRIST_FREECELL);
+            zobrist_toggle(card, ZOBRIST_FOUNDATION);
+            zobrist_record_position();
+            journal_move(SOLUTION_FREECELL_0 + cursor_x, SOLUTION_FOUNDATION, card);
+
+            location_position(SOLUTION_FREECELL_0 + cursor_x, card, &x, &y);
+            draw_empty_card(cursor_area_tx[AREA_FREECELLS] + (cursor_x * 3), cursor_area_ty[AREA_FREECELLS]);
+            fly_card_to(card, x, y, SOLUTION_FOUNDATION, FLIGHT_MOVE_FRAMES);
+            return;
+        }
+#endif
+
+        copy_card_tiles_to_sprites(card);
+
+        card_in_hand = card;
         card_in_hand_area = AREA_FREECELLS;
+        zobrist_toggle(card_in_hand, ZOBRIST_FREECELL);
         card_in_hand_x = cursor_x;
         card_in_hand_y = cursor_y;
 
@@ -315,24 +635,29 @@ void place_card()
     if (cursor_area == AREA_CASCADES)
     {
         // check if the move is possible
-        if (cascade_counts[cursor_x] == 0 || can_move_card_onto_card(card_in_hand, cascades[cursor_x][cursor_y]))
+        if (
+            (cascade_counts[cursor_x] == 0)
+                ? can_move_card_to_empty_cascade(card_in_hand)
+                : can_move_card_onto_card(card_in_hand, cascades[cursor_x][cursor_y])
+        )
         {
             if (cascade_counts[cursor_x] > 0)
             {
                 cursor_y++;
             }
 
-            draw_card_tiles(
-                card_in_hand,
-                cursor_area_tx[cursor_area] + (cursor_x * 3), 
-                cursor_area_ty[cursor_area] + cursor_y,
-                1
-            );
+            zobrist_toggle(card_in_hand, cascade_location(cursor_x));
+            zobrist_record_position();
+            journal_move(card_in_hand_source(), cursor_x, card_in_hand);
 
             cascades[cursor_x][cursor_y] = card_in_hand;
             cascade_counts[cursor_x]++;
+            move_count++;
             card_in_hand = NO_CARD;
-            card_in_hand_tiles_count = 0;				
+            card_in_hand_tiles_count = 0;
+
+            // the card it went on is now covered up
+            draw_cascade(cursor_x, (cursor_y > 0) ? (cursor_y - 1) : 0);
         }
     }
 
@@ -347,6 +672,12 @@ void place_card()
         );
 
         freecells[cursor_x][0] = card_in_hand;
+        move_count++;
+
+        zobrist_toggle(card_in_hand, ZOBRIST_FREECELL);
+        zobrist_record_position();
+        journal_move(card_in_hand_source(), SOLUTION_FREECELL_0 + cursor_x, card_in_hand);
+
         card_in_hand = NO_CARD;
         card_in_hand_tiles_count = 0;
     }
@@ -370,6 +701,11 @@ void place_card()
 
             foundations[cursor_x][i] = card_in_hand;
             foundation_counts[cursor_x]++;
+            move_count++;
+
+            zobrist_toggle(card_in_hand, ZOBRIST_FOUNDATION);
+            zobrist_record_position();
+            journal_move(card_in_hand_source(), SOLUTION_FOUNDATION, card_in_hand);
 
             card_in_hand = NO_CARD;
             card_in_hand_tiles_count = 0;
@@ -382,6 +718,7 @@ void return_card()
     // returning cards to cascades
     if (card_in_hand_area == AREA_CASCADES)
     {
+        zobrist_toggle(card_in_hand, cascade_location(card_in_hand_x));
         cascades[card_in_hand_x][card_in_hand_y] = card_in_hand;
         cascade_counts[card_in_hand_x]++;
 
@@ -390,21 +727,152 @@ void return_card()
         {
             cursor_y = cascade_counts[cursor_x] - 1;
         }
+
+        draw_cascade(card_in_hand_x, (card_in_hand_y > 0) ? (card_in_hand_y - 1) : 0);
     }
 
     // returning card to freecell
     else if (card_in_hand_area == AREA_FREECELLS)
     {
+        zobrist_toggle(card_in_hand, ZOBRIST_FREECELL);
         freecells[card_in_hand_x][0] = card_in_hand;
-    }
 
-    draw_card_tiles(
-        card_in_hand,
-        cursor_area_tx[card_in_hand_area] + (card_in_hand_x * 3), 
-        cursor_area_ty[card_in_hand_area] + card_in_hand_y,
-        1
-    );
+        draw_card_tiles(
+            card_in_hand,
+            cursor_area_tx[AREA_FREECELLS] + (card_in_hand_x * 3),
+            cursor_area_ty[AREA_FREECELLS] + card_in_hand_y,
+            1
+        );
+    }
 
     card_in_hand = NO_CARD;
     card_in_hand_tiles_count = 0;
 }
+
+// take the top card off a cascade, freecell or foundation and redraw it
+static void lift_card(uint8_t location, uint8_t card)
+{
+    uint8_t count;
+
+    if (location < CASCADES)
+    {
+        count = --cascade_counts[location];
+        zobrist_toggle(card, cascade_location(location));
+
+        // the card underneath is now the bottom card
+        draw_cascade(location, (count > 0) ? (count - 1) : 0);
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        count = --foundation_counts[card >> 4];
+        foundations[card >> 4][count] = NO_CARD;
+        zobrist_toggle(card, ZOBRIST_FOUNDATION);
+
+        if (count > 0)
+        {
+            draw_card_tiles(
+                foundations[card >> 4][count - 1],
+                cursor_area_tx[AREA_FOUNDATIONS] + ((card >> 4) * 3),
+                cursor_area_ty[AREA_FOUNDATIONS],
+                1
+            );
+        }
+        else
+        {
+            draw_empty_foundation(card >> 4);
+        }
+    }
+    else
+    {
+        location -= SOLUTION_FREECELL_0;
+        freecells[location][0] = NO_CARD;
+        zobrist_toggle(card, ZOBRIST_FREECELL);
+
+        draw_empty_card(cursor_area_tx[AREA_FREECELLS] + (location * 3), cursor_area_ty[AREA_FREECELLS]);
+    }
+}
+
+// put a card on top of a cascade, into a freecell or onto its foundation
+// it isn't drawn there until it has flown across
+static void drop_card(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        zobrist_toggle(card, cascade_location(location));
+
+        cascades[location][cascade_counts[location]] = card;
+        cascade_counts[location]++;
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        foundations[card >> 4][foundation_counts[card >> 4]] = card;
+        foundation_counts[card >> 4]++;
+        zobrist_toggle(card, ZOBRIST_FOUNDATION);
+    }
+    else
+    {
+        freecells[location - SOLUTION_FREECELL_0][0] = card;
+        zobrist_toggle(card, ZOBRIST_FREECELL);
+    }
+}
+
+// carry out a move between two solution book locations, flying the card
+// across rather than carrying it over in the cursor's hand. the move is
+// taken to be a legal one, e.g. from the solution book
+// returns the card moved
+uint8_t fly_move(uint8_t source, uint8_t dest)
+{
+    uint8_t card;
+    int16_t x, y;
+
+    card = (source < CASCADES)
+        ? cascades[source][cascade_counts[source] - 1]
+        : freecells[source - SOLUTION_FREECELL_0][0];
+
+    location_position(source, card, &x, &y);
+    lift_card(source, card);
+    drop_card(dest, card);
+    move_count++;
+
+    zobrist_record_position();
+    journal_move(source, dest, card);
+    fly_card_to(card, x, y, dest, FLIGHT_MOVE_FRAMES);
+
+    return card;
+}
+
+// put the last card moved back where it came from
+// returns 0 if there was nothing to undo
+uint8_t undo_last_move()
+{
+    solution_move_t move;
+    uint8_t card;
+    int16_t x, y;
+
+    if (undo_count == 0 || card_in_hand != NO_CARD)
+    {
+        return 0;
+    }
+
+    undo_count--;
+    undo_pos = (undo_pos - 1) & (UNDO_JOURNAL_SIZE - 1);
+    move = undo_moves[undo_pos];
+    card = undo_cards[undo_pos];
+
+    // the card flies back from where it was
+    location_position(SOLUTION_MOVE_DEST(move), card, &x, &y);
+    lift_card(SOLUTION_MOVE_DEST(move), card);
+    drop_card(SOLUTION_MOVE_SOURCE(move), card);
+
+    // the other player in a race sees it as a move back again
+    race_move(SOLUTION_MOVE_DEST(move), SOLUTION_MOVE_SOURCE(move), card);
+    fly_card_to(card, x, y, SOLUTION_MOVE_SOURCE(move), FLIGHT_MOVE_FRAMES);
+
+    // keep the cursor on the bottom card of a cascade
+    if (cursor_area == AREA_CASCADES)
+    {
+        cursor_y = (cascade_counts[cursor_x] > 0) ? (cascade_counts[cursor_x] - 1) : 0;
+    }
+
+    return 1;
+}
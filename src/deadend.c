@@ -0,0 +1,413 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// looks for positions the player can't get out of
+// a depth limited search is run over a copy of the board, a few
+// sources at a time each frame, so it never holds up the game.
+// if every position it can reach has been tried without hitting
+// any of the limits and none of them are won then the game is stuck.
+// if it does find a win, the first move is kept for the hints
+
+#include <stdint.h>
+#include <string.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "arena.h"
+#include "card.h"
+#include "deadend.h"
+#include "solution.h"
+#include "zobrist.h"
+
+// the last destination tried for each source is the freecells,
+// after the foundation and each of the cascades
+#define DEST_FOUNDATION 0
+#define DEST_FREECELL (CASCADES + 1)
+
+#define SOURCE_COUNT (SOLUTION_FREECELL_0 + FREECELLS)
+
+#define SEEN_BYTES (DEADEND_SEEN_SIZE * 4)
+
+#if SEEN_BYTES > ARENA_SIZE
+#error the arena has no room for the positions the search remembers
+#endif
+
+// copy of the board being searched
+static uint8_t search_cascades[CASCADES][CASCADE_MAX_CARDS];
+static uint8_t search_cascade_counts[CASCADES];
+static uint8_t search_freecells[FREECELLS];
+static uint8_t search_foundation_counts[FOUNDATIONS];
+static uint32_t search_hash;
+
+// the position the current result belongs to
+static uint32_t root_hash;
+static uint8_t root_valid;
+static uint8_t root_has_moves;
+static solution_move_t winning_move;
+
+// set when the depth limit stopped a line from being searched
+static uint8_t limited;
+
+static uint8_t searching;
+static uint16_t nodes;
+
+// moves which led from the root to the current position
+// and the next source and destination to try at each depth
+static uint8_t depth;
+static solution_move_t path_moves[DEADEND_MAX_DEPTH];
+static uint8_t path_cards[DEADEND_MAX_DEPTH];
+static uint8_t next_source[DEADEND_MAX_DEPTH];
+static uint8_t next_dest[DEADEND_MAX_DEPTH];
+
+// hashes of positions which have already been searched, in the arena
+// for as long as the game lasts. NULL if there wasn't room for it
+static uint32_t *seen;
+static uint8_t seen_count;
+static uint8_t seen_full;
+
+static uint8_t top_card(uint8_t location)
+{
+    if (location < CASCADES)
+    {
+        return (search_cascade_counts[location] > 0)
+            ? search_cascades[location][search_cascade_counts[location] - 1]
+            : NO_CARD;
+    }
+
+    return search_freecells[location - SOLUTION_FREECELL_0];
+}
+
+// zobrist location for a card going on top of a cascade
+static uint8_t cascade_location(uint8_t cascade)
+{
+    return (search_cascade_counts[cascade] > 0)
+        ? search_cascades[cascade][search_cascade_counts[cascade] - 1]
+        : ZOBRIST_CASCADE_BOTTOM;
+}
+
+static void remove_card(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        search_cascade_counts[location]--;
+        search_hash ^= ZOBRIST_KEY(card, cascade_location(location));
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        search_foundation_counts[card >> 4]--;
+        search_hash ^= ZOBRIST_KEY(card, ZOBRIST_FOUNDATION);
+    }
+    else
+    {
+        search_freecells[location - SOLUTION_FREECELL_0] = NO_CARD;
+        search_hash ^= ZOBRIST_KEY(card, ZOBRIST_FREECELL);
+    }
+}
+
+static void add_card(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        search_hash ^= ZOBRIST_KEY(card, cascade_location(location));
+        search_cascades[location][search_cascade_counts[location]] = card;
+        search_cascade_counts[location]++;
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        search_foundation_counts[card >> 4]++;
+        search_hash ^= ZOBRIST_KEY(card, ZOBRIST_FOUNDATION);
+    }
+    else
+    {
+        search_freecells[location - SOLUTION_FREECELL_0] = card;
+        search_hash ^= ZOBRIST_KEY(card, ZOBRIST_FREECELL);
+    }
+}
+
+// where a card from source can go for one of the destinations
+// returns NO_CARD if it can't go there
+static uint8_t find_dest(uint8_t source, uint8_t card, uint8_t dest)
+{
+    uint8_t i;
+
+    if (dest == DEST_FOUNDATION)
+    {
+        return (search_foundation_counts[card >> 4] == (card & 0xf))
+            ? SOLUTION_FOUNDATION
+            : NO_CARD;
+    }
+
+    // aces can't be picked up, they go straight to the foundations
+    if ((card & 0xf) == 0)
+    {
+        return NO_CARD;
+    }
+
+    if (dest == DEST_FREECELL)
+    {
+        // moving between freecells doesn't change anything
+        if (source >= SOLUTION_FREECELL_0)
+        {
+            return NO_CARD;
+        }
+
+        for (i = 0; i < FREECELLS; i++)
+        {
+            if (search_freecells[i] == NO_CARD)
+            {
+                return SOLUTION_FREECELL_0 + i;
+            }
+        }
+
+        return NO_CARD;
+    }
+
+    dest -= 1;
+
+    if (dest == source)
+    {
+        return NO_CARD;
+    }
+
+    if (search_cascade_counts[dest] > 0)
+    {
+        return can_move_card_onto_card(card, top_card(dest)) ? dest : NO_CARD;
+    }
+
+    // moving the only card in a cascade to an empty one doesn't change anything
+    if (!can_move_card_to_empty_cascade(card) || (source < CASCADES && search_cascade_counts[source] == 1))
+    {
+        return NO_CARD;
+    }
+
+    // all empty cascades are the same, so only try the first
+    for (i = 0; i < dest; i++)
+    {
+        if (search_cascade_counts[i] == 0)
+        {
+            return NO_CARD;
+        }
+    }
+
+    return dest;
+}
+
+// same test as check_if_game_won, on the search's copy of the board
+static uint8_t search_won()
+{
+    uint8_t i, j;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        for (j = 1; j < search_cascade_counts[i]; j++)
+        {
+            if (can_move_card_onto_card(search_cascades[i][j], search_cascades[i][j - 1]) == 0)
+            {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+// returns 0 if the position has been searched already
+// or if there's no room left to remember it
+static uint8_t remember_position()
+{
+    uint8_t i = search_hash & (DEADEND_SEEN_SIZE - 1);
+
+    if (seen_full)
+    {
+        return 0;
+    }
+
+    while (seen[i] != 0)
+    {
+        if (seen[i] == search_hash)
+        {
+            return 0;
+        }
+
+        i = (i + 1) & (DEADEND_SEEN_SIZE - 1);
+    }
+
+    // keep the table from getting too full to probe quickly
+    if (seen_count >= (DEADEND_SEEN_SIZE * 3 / 4))
+    {
+        seen_full = 1;
+        return 0;
+    }
+
+    seen[i] = search_hash;
+    seen_count++;
+
+    return 1;
+}
+
+static void start_search()
+{
+    uint8_t i;
+
+    memcpy(search_cascades, cascades, sizeof(search_cascades));
+    memcpy(search_cascade_counts, cascade_counts, sizeof(search_cascade_counts));
+    memcpy(search_foundation_counts, foundation_counts, sizeof(search_foundation_counts));
+
+    for (i = 0; i < FREECELLS; i++)
+    {
+        search_freecells[i] = freecells[i][0];
+    }
+
+    search_hash = board_hash;
+    root_hash = board_hash;
+    root_valid = 1;
+    root_has_moves = 0;
+    winning_move = SOLUTION_END;
+    limited = 0;
+
+    // without any memory, the search can't be trusted past the first move
+    seen_count = 0;
+    seen_full = (seen == NULL);
+
+    if (seen != NULL)
+    {
+        memset(seen, 0, SEEN_BYTES);
+    }
+
+    remember_position();
+
+    depth = 0;
+    next_source[0] = 0;
+    next_dest[0] = 0;
+    nodes = 0;
+
+    searching = !search_won();
+}
+
+// first move of a winning line found by the last search of this position
+// returns SOLUTION_END if there isn't one
+solution_move_t deadend_winning_move()
+{
+    return (root_valid && board_hash == root_hash) ? winning_move : SOLUTION_END;
+}
+
+// forget the last result, e.g. when a new game is dealt
+// the game's arena scope has to have been entered first
+void deadend_reset()
+{
+    root_valid = 0;
+    searching = 0;
+
+    arena_open(ARENA_DEADEND, SEEN_BYTES);
+    seen = arena_alloc(ARENA_DEADEND, SEEN_BYTES);
+}
+
+// carry on searching the current position
+// a new search is started whenever the board changes, so this should
+// only be called while there's no card in hand
+// returns the result on the frame the search finishes, DEADEND_SEARCHING
+// while it's still going, and DEADEND_IDLE once there's nothing to do
+uint8_t deadend_update()
+{
+    uint8_t steps, source, card, dest, fresh;
+    solution_move_t move;
+
+    if (!root_valid || board_hash != root_hash)
+    {
+        start_search();
+    }
+
+    if (!searching)
+    {
+        return DEADEND_IDLE;
+    }
+
+    for (steps = 0; steps < DEADEND_STEPS_PER_FRAME; steps++)
+    {
+        source = next_source[depth];
+
+        // every move from this position has been tried
+        if (source >= SOURCE_COUNT)
+        {
+            if (depth == 0)
+            {
+                searching = 0;
+
+                if (!root_has_moves)
+                {
+                    return DEADEND_NO_MOVES;
+                }
+
+                return limited ? DEADEND_UNKNOWN : DEADEND_STUCK;
+            }
+
+            depth--;
+            remove_card(SOLUTION_MOVE_DEST(path_moves[depth]), path_cards[depth]);
+            add_card(SOLUTION_MOVE_SOURCE(path_moves[depth]), path_cards[depth]);
+            continue;
+        }
+
+        card = top_card(source);
+        dest = NO_CARD;
+
+        if (card != NO_CARD)
+        {
+            while (dest == NO_CARD && next_dest[depth] <= DEST_FREECELL)
+            {
+                dest = find_dest(source, card, next_dest[depth]++);
+            }
+        }
+
+        // this source has run out of moves
+        if (dest == NO_CARD)
+        {
+            next_source[depth]++;
+            next_dest[depth] = 0;
+            continue;
+        }
+
+        root_has_moves = 1;
+        nodes++;
+
+        move = SOLUTION_MOVE(source, dest);
+        remove_card(source, card);
+        add_card(dest, card);
+
+        if (search_won())
+        {
+            winning_move = (depth > 0) ? path_moves[0] : move;
+            searching = 0;
+            return DEADEND_WINNABLE;
+        }
+
+        fresh = remember_position();
+
+        // running out of memory or time means the result can't be trusted
+        if (seen_full || nodes >= DEADEND_NODE_LIMIT)
+        {
+            searching = 0;
+            return DEADEND_UNKNOWN;
+        }
+
+        // go back if this position has been searched already
+        // or is too deep to search, which leaves the result unknown
+        if (!fresh || depth + 1 >= DEADEND_MAX_DEPTH)
+        {
+            if (fresh)
+            {
+                limited = 1;
+            }
+
+            remove_card(dest, card);
+            add_card(source, card);
+            continue;
+        }
+
+        path_moves[depth] = move;
+        path_cards[depth] = card;
+        depth++;
+        next_source[depth] = 0;
+        next_dest[depth] = 0;
+    }
+
+    return DEADEND_SEARCHING;
+}
@@ -0,0 +1,69 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#include <stdint.h>
+#include <wonderful.h>
+#include "deals.h"
+#include "variant.h"
+
+// generated by "make -f Makefile.tools catalogue"
+// one difficulty nibble per seed, 0 if the solver found no solution
+// the catalogue is for standard freecell, other variants only have all deals
+#if VARIANT_STANDARD
+#include "deal_catalogue_bin.h"
+#endif
+
+uint8_t deal_filter;
+
+// names are padded so they overwrite each other in the menu
+const char __wf_rom deal_filter_names[DEAL_FILTER_COUNT][DEAL_FILTER_NAME_LENGTH] = {
+    "ALL DEALS",
+    "SOLVABLE ",
+    "EASY     ",
+    "MEDIUM   ",
+    "HARD     ",
+};
+
+// range of difficulties allowed by each filter
+static const uint8_t __wf_rom deal_filter_min[DEAL_FILTER_COUNT] = { 0, 1, 1, 6, 11 };
+static const uint8_t __wf_rom deal_filter_max[DEAL_FILTER_COUNT] = { 15, 15, 5, 10, 15 };
+
+uint8_t get_deal_difficulty(uint16_t seed)
+{
+#if VARIANT_STANDARD
+    uint8_t packed = deal_catalogue[seed >> 1];
+
+    // even seeds are in the low nibble
+    return (seed & 1) ? (packed >> 4) : (packed & 0xf);
+#else
+    (void) seed;
+    return 0;
+#endif
+}
+
+// find the first seed from the given one onwards which matches the deal filter
+uint16_t find_deal_seed(uint16_t seed)
+{
+    uint8_t difficulty;
+    uint16_t first = seed;
+
+    if (deal_filter == DEAL_FILTER_ALL || !VARIANT_STANDARD)
+    {
+        return seed;
+    }
+
+    do
+    {
+        difficulty = get_deal_difficulty(seed);
+
+        if (difficulty >= deal_filter_min[deal_filter] && difficulty <= deal_filter_max[deal_filter])
+        {
+            return seed;
+        }
+
+        seed++;
+    }
+    while (seed != first);
+
+    return first;
+}
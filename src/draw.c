@@ -2,56 +2,166 @@
 // Joe Kennedy - 2023
 
 #include <stdint.h>
-#include <string.h>
 #include <ws.h>
 #include <wonderful.h>
-#include <wsx/lzsa.h>
 
+#include "asset.h"
 #include "iram.h"
 #include "draw.h"
 #include "card.h"
+#include "flight.h"
+#include "tween.h"
 
-#include "graphics/baize.h"
-#include "graphics/cards.h"
-#include "graphics/text.h"
-#include "graphics/title_screen.h"
-#include "graphics/you_win.h"
+#include "asset_pack.h"
 
-#include "menu_tilemap_bin.h"
-
-uint8_t camera_y;
+uint16_t camera_y;
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+uint8_t camera_x;
+#endif
 static uint8_t drawn_cursor_x;
 static uint16_t drawn_cursor_y;
 
-#ifdef __WONDERFUL_WWITCH__
-#define ws_gdma_copy memcpy
+// frames the cursor and the camera take to catch up after moving
+#define CURSOR_GLIDE_FRAMES 6
+#define CAMERA_GLIDE_FRAMES 8
+
+// which of the scroll registers and sprites need writing again. frames
+// where nothing has moved leave the video hardware alone altogether
+#define VIEW_DIRTY_SCROLL 0x01
+#define VIEW_DIRTY_PAN 0x02
+#define VIEW_DIRTY_SPRITES 0x04
+#define VIEW_DIRTY_ALL 0x07
+static uint8_t view_dirty = VIEW_DIRTY_ALL;
+
+// number of card sprites following the cursor when it was last drawn
+static uint8_t drawn_card_sprites;
+
+// sprites for cards in flight, which come after the cursor's
+static uint8_t flying_sprites;
+
+// the corner letters, which go between the card in hand and the flights
+#define HUD_X ((WS_DISPLAY_WIDTH_TILES << 3) - 18)
+#define HUD_Y ((WS_DISPLAY_HEIGHT_TILES << 3) - 18)
+
+static ws_sprite_t hud_sprites[HUD_SPRITES];
+uint8_t hud_count;
+
+// screen_2 holds the board as a ring of rows which the scroll register
+// wraps around, so board row n is drawn into tilemap row n % 32. only
+// the rows on screen are kept up to date, which means cascades can be
+// longer than the tilemap and scrolling only draws the rows coming in
+#define VIEW_ROWS WS_DISPLAY_HEIGHT_TILES
+#define RING_OFFSET(x, row) ((x) + (((row) & (WS_SCREEN_HEIGHT_TILES - 1)) * WS_SCREEN_WIDTH_TILES))
+#define ROW_VISIBLE(row) ((uint8_t) ((row) - view_top) < VIEW_ROWS)
+// rows from row to the bottom of the tilemap, where the ring wraps
+#define RING_ROWS_LEFT(row) (WS_SCREEN_HEIGHT_TILES - ((row) & (WS_SCREEN_HEIGHT_TILES - 1)))
+
+#define BLANK_TILE WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE)
+
+// the baize pattern repeats every 3 tiles
+#define BAIZE_PATTERN_SIZE 24
+
+// first board row on screen
+static uint8_t view_top;
+
+// the camera glides between rows as long as the ring can hold the rows
+// on screen at both ends of the way, scrolling further jumps straight there
+#define CAMERA_GLIDE_ROWS (WS_SCREEN_HEIGHT_TILES - VIEW_ROWS - 1)
+
+// spacing each cascade was last drawn with, and the row below its last card
+static uint8_t drawn_pitch[CASCADES];
+static uint8_t drawn_end[CASCADES];
+
+typedef struct {
+	void (*init)(void);
+	void (*copy_palettes)(void);
+	// where a tile is in tile memory
+	void* (*tile_memory)(uint16_t tile);
+	// which of each asset in the pack is this backend's
+	uint8_t asset_set;
+} video_backend_t;
+
+#if DRAW_COLOR
+static void color_init(void)
+{
+	// 4bpp planar gfx, set black color
+	WS_DISPLAY_COLOR_MEM(0)[0] = 0x000;
+}
+
+static void color_copy_palettes(void)
+{
+	asset_load(ASSET_BAIZE_PALETTE, WS_DISPLAY_COLOR_MEM(BAIZE_PALETTE));
+	asset_load(ASSET_CARDS_PALETTE, WS_DISPLAY_COLOR_MEM(CARDS_PALETTE));
+	asset_load(ASSET_CARDS_PALETTE, WS_DISPLAY_COLOR_MEM(CHECKERBOARD_PALETTE));
+}
+
+static void* color_tile_memory(uint16_t tile)
+{
+	return WS_TILE_4BPP_MEM(tile);
+}
+
+static const video_backend_t __wf_rom video_color = {
+	color_init,
+	color_copy_palettes,
+	color_tile_memory,
+	ASSET_SET_COLOR
+};
+#endif
+
+#if DRAW_MONO
+static void mono_init(void)
+{
+	// mono gfx, set black color
+	outportw(WS_SCR_PAL_0_PORT, WS_DISPLAY_MONO_PALETTE(0, 0, 0, 0));
+
+	// initialize display LUT
+	// colors 7,6,5,4 used by baize
+	// colors 7,3,1,0 used by UI
+	ws_display_set_shade_lut(WS_DISPLAY_SHADE_LUT(0, 2, 4, 6, 12, 13, 14, 15));
+}
+
+static void mono_copy_palettes(void)
+{
+	outportw(WS_SCR_PAL_PORT(BAIZE_PALETTE), WS_DISPLAY_MONO_PALETTE(7, 6, 5, 4));
+	outportw(WS_SCR_PAL_PORT(CARDS_PALETTE), WS_DISPLAY_MONO_PALETTE(1, 7, 3, 0));
+	outportw(WS_SCR_PAL_PORT(CHECKERBOARD_PALETTE), WS_DISPLAY_MONO_PALETTE(7, 7, 3, 2));
+}
+
+static void* mono_tile_memory(uint16_t tile)
+{
+	return WS_TILE_MEM(tile);
+}
+
+static const video_backend_t __wf_rom video_mono = {
+	mono_init,
+	mono_copy_palettes,
+	mono_tile_memory,
+	ASSET_SET_MONO
+};
 #endif
 
-// #define FORCE_MONO
+// with only one backend built in, calls to it don't need to go through a pointer
+#if DRAW_COLOR && DRAW_MONO
+static const video_backend_t __wf_rom* video;
+#elif DRAW_COLOR
+#define video (&video_color)
+#else
+#define video (&video_mono)
+#endif
 
+// pick the colour backend if the hardware can do it, or mono if not
 void init_video()
 {
 	hide_screen();
 
-#ifndef FORCE_MONO
-	if (ws_system_set_mode(WS_MODE_COLOR_4BPP))
-#else
-	if (0)
+#if DRAW_COLOR && DRAW_MONO
+	video = ws_system_set_mode(WS_MODE_COLOR_4BPP) ? &video_color : &video_mono;
+#elif DRAW_COLOR
+	ws_system_set_mode(WS_MODE_COLOR_4BPP);
 #endif
-	{
-		// 4bpp planar gfx, set black color
-		WS_DISPLAY_COLOR_MEM(0)[0] = 0x000;
-	}
-	else
-	{
-		// mono gfx, set black color
-		outportw(WS_SCR_PAL_0_PORT, WS_DISPLAY_MONO_PALETTE(0, 0, 0, 0));
 
-		// initialize display LUT
-		// colors 7,6,5,4 used by baize
-		// colors 7,3,1,0 used by UI
-		ws_display_set_shade_lut(WS_DISPLAY_SHADE_LUT(0, 2, 4, 6, 12, 13, 14, 15));
-	}
+	video->init();
+	asset_select(video->asset_set);
 
 	// set base addresses for screens 1 and 2
 	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
@@ -87,75 +197,22 @@ void show_game_screen()
 	outportw(WS_DISPLAY_CTRL_PORT, WS_DISPLAY_CTRL_SCR1_ENABLE | WS_DISPLAY_CTRL_SCR2_ENABLE | WS_DISPLAY_CTRL_SPR_ENABLE);
 }
 
-void copy_checkerboard_gfx()
-{
-	if (ws_system_is_color_active())
-		ws_gdma_copy(WS_TILE_4BPP_MEM(0), gfx_cards_tiles, 0x10 * WS_DISPLAY_TILE_SIZE_4BPP);
-	else
-		memcpy(WS_TILE_MEM(0), gfx_cards_mono_tiles, 0x10 * WS_DISPLAY_TILE_SIZE);
-}
-
-void copy_title_screen_gfx()
-{
-	if (ws_system_is_color_active())
-		wsx_lzsa2_decompress(WS_TILE_4BPP_MEM(16), gfx_title_screen_tiles);
-	else
-		wsx_lzsa2_decompress(WS_TILE_MEM(16), gfx_title_screen_mono_tiles);
-}
-
-void copy_text_gfx()
-{
-	if (ws_system_is_color_active())
-		wsx_lzsa2_decompress(WS_TILE_4BPP_MEM(160), gfx_text_tiles);
-	else
-		wsx_lzsa2_decompress(WS_TILE_MEM(160), gfx_text_mono_tiles);
-}
-
-void copy_card_tile_gfx()
+// load an asset's tiles into tile memory from tile onwards, each
+// backend having its own
+void load_tiles(uint16_t tile, uint8_t asset)
 {
-	if (ws_system_is_color_active())
-		ws_gdma_copy(WS_TILE_4BPP_MEM(0), gfx_cards_tiles, 160 * WS_DISPLAY_TILE_SIZE_4BPP);
-	else
-		memcpy(WS_TILE_MEM(0), gfx_cards_mono_tiles, 160 * WS_DISPLAY_TILE_SIZE);
+	asset_load(asset, video->tile_memory(tile));
 }
 
-void copy_you_win_gfx()
-{
-	if (ws_system_is_color_active())
-		wsx_lzsa2_decompress(WS_TILE_4BPP_MEM(YOU_WIN_TILES), gfx_you_win_tiles);
-	else
-		wsx_lzsa2_decompress(WS_TILE_MEM(YOU_WIN_TILES), gfx_you_win_mono_tiles);
-}
-
-void copy_baize_gfx()
-{
-	if (ws_system_is_color_active())
-		ws_gdma_copy(WS_TILE_4BPP_MEM(BAIZE_TILES), gfx_baize_tiles, 9 * WS_DISPLAY_TILE_SIZE_4BPP);
-	else
-		memcpy(WS_TILE_MEM(BAIZE_TILES), gfx_baize_mono_tiles, 9 * WS_DISPLAY_TILE_SIZE);
-}
-
-
 // copy palettes to vram
 void copy_palettes()
 {
-    if (ws_system_is_color_active())
-    {
-        ws_gdma_copy(WS_DISPLAY_COLOR_MEM(BAIZE_PALETTE), gfx_baize_palette, 32);
-        ws_gdma_copy(WS_DISPLAY_COLOR_MEM(CARDS_PALETTE), gfx_cards_palette, 32);
-        ws_gdma_copy(WS_DISPLAY_COLOR_MEM(CHECKERBOARD_PALETTE), gfx_cards_palette, 32);
-    }
-    else
-    {
-        outportw(WS_SCR_PAL_PORT(BAIZE_PALETTE), WS_DISPLAY_MONO_PALETTE(7, 6, 5, 4));
-        outportw(WS_SCR_PAL_PORT(CARDS_PALETTE), WS_DISPLAY_MONO_PALETTE(1, 7, 3, 0));
-        outportw(WS_SCR_PAL_PORT(CHECKERBOARD_PALETTE), WS_DISPLAY_MONO_PALETTE(7, 7, 3, 2));
-    }
+	video->copy_palettes();
 }
 
 void clear_card_layer()
 {
-    ws_screen_fill_tiles(screen_2, WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE), 0, 0, WS_SCREEN_WIDTH_TILES, WS_SCREEN_HEIGHT_TILES);
+    blit_fill_rect(screen_2, BLANK_TILE, BLIT_SIZE(WS_SCREEN_WIDTH_TILES, WS_SCREEN_HEIGHT_TILES));
 }
 
 // draw the checkerboard background onto screen 1 page 2
@@ -163,10 +220,13 @@ void draw_checkerboard()
 {
     uint16_t index;
 
-	for (index = 0; index < WS_SCREEN_WIDTH_TILES * WS_SCREEN_HEIGHT_TILES; index++)
+	for (index = 0; index < WS_SCREEN_WIDTH_TILES * 2; index++)
 	{
 		screen_1_page_2[index] = (CHECKERBOARD_TILES + (index % 2) + (((index / 32) % 2) * 2)) | WS_SCREEN_ATTR_PALETTE(CHECKERBOARD_PALETTE);
 	}
+
+	// the first two rows repeat down the rest of the tilemap
+	blit_copy_rect(&screen_1_page_2[WS_SCREEN_WIDTH_TILES * 2], screen_1_page_2, BLIT_SIZE(WS_SCREEN_WIDTH_TILES, WS_SCREEN_HEIGHT_TILES - 2));
 }
 
 // draw the green baize background onto screen 1
@@ -174,60 +234,67 @@ void draw_baize()
 {
     uint16_t index;
 
-	for (index = 0; index < WS_SCREEN_WIDTH_TILES * WS_SCREEN_HEIGHT_TILES; index++)
+	for (index = 0; index < WS_SCREEN_WIDTH_TILES * 3; index++)
 	{
 		screen_1[index] = (BAIZE_TILES + (index % 3) + (((index / 32) % 3) * 3)) | WS_SCREEN_ATTR_PALETTE(BAIZE_PALETTE);
 	}
-}
 
-// draw dotted lines for empty freecellls
-void draw_empty_freecells()
-{
-    uint8_t i;
-
-	// draw freecells
-	for (i = 0; i < 4; i++)
-	{
-		draw_empty_card(cursor_area_tx[AREA_FREECELLS] + (i * 3), cursor_area_ty[AREA_FREECELLS]);
-	}
+	// the first three rows repeat down the rest of the tilemap
+	blit_copy_rect(&screen_1[WS_SCREEN_WIDTH_TILES * 3], screen_1, BLIT_SIZE(WS_SCREEN_WIDTH_TILES, WS_SCREEN_HEIGHT_TILES - 3));
 }
 
-// draw dotted lines for empty foundations
-void draw_empty_foundations()
+// draw dotted lines and the suit icon for an empty foundation
+void draw_empty_foundation(uint8_t i)
 {
-    uint8_t i, tx, ty;
-    uint16_t index;
+    uint8_t tx, ty;
 
-	// draw foundations
-	for (i = 0; i < 4; i++)
-	{
-        tx = cursor_area_tx[AREA_FOUNDATIONS] + (i * 3);
-        ty = cursor_area_ty[AREA_FOUNDATIONS];
+    tx = cursor_area_tx[AREA_FOUNDATIONS] + (i * 3);
+    ty = cursor_area_ty[AREA_FOUNDATIONS];
 
-		draw_empty_card(tx, ty);
+    draw_empty_card(tx, ty);
 
-		// draw suit icon for each foundations
-		index = (tx + 1) + ((ty + 1) << 5);
-		screen_2[index] = (0x58 + i) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-	}
+    // draw suit icon for each foundations
+    if (ROW_VISIBLE(ty + 1))
+    {
+        screen_2[RING_OFFSET(tx + 1, ty + 1)] = (0x58 + i) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+    }
 }
 
 void draw_title_screen()
 {
-    ws_screen_put_tiles(screen_2, gfx_title_screen_map, 0, 0, 28, 18);
+    ws_screen_put_tiles(screen_2, asset_data(ASSET_TITLE_SCREEN_MAP), 0, 0, 28, 18);
 }
 
 // draw menu into an offscreen page which will be swapped out for screen_2
 void draw_menu()
 {
+    const uint8_t __far* menu_tilemap = asset_data(ASSET_MENU_TILEMAP);
     uint16_t i;
 
-	for (i = 0; i < WS_DISPLAY_WIDTH_TILES * WS_DISPLAY_HEIGHT_TILES; i++)
+	for (i = 0; i < WS_SCREEN_WIDTH_TILES * WS_DISPLAY_HEIGHT_TILES; i++)
 	{
         screen_2_page_2[i] = menu_tilemap[i] | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
     }
 }
 
+// write text into the offscreen menu page
+// the text tiles are laid out in ascii order starting at 0x80 + ' '
+void draw_menu_text(uint8_t x, uint8_t y, const char __wf_rom* text)
+{
+    uint16_t index = x + (y << 5);
+
+    while (*text)
+    {
+        screen_2_page_2[index++] = (0x80 + *(text++)) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+    }
+}
+
+// write one character into the offscreen menu page
+void draw_menu_char(uint8_t x, uint8_t y, char c)
+{
+    screen_2_page_2[x + (y << 5)] = (0x80 + c) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+}
+
 // load "You Win" graphics into sprites
 void set_up_you_win_sprites()
 {
@@ -236,10 +303,10 @@ void set_up_you_win_sprites()
     // disable screen_2 to hide cards
     outportw(WS_DISPLAY_CTRL_PORT, WS_DISPLAY_CTRL_SCR1_ENABLE | WS_DISPLAY_CTRL_SPR_ENABLE);
     outportb(WS_SPR_FIRST_PORT, 0);
-    outportb(WS_SPR_COUNT_PORT, 32);
+    outportb(WS_SPR_COUNT_PORT, YOU_WIN_SPRITES);
 
     // 8x4 tiles image
-    for (i = 0; i < 32; i++)
+    for (i = 0; i < YOU_WIN_SPRITES; i++)
     {
         sprites[i].attr = (YOU_WIN_TILES + i) | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE) | WS_SPRITE_ATTR_PRIORITY;
         sprites[i].x = (10 + (i % 8)) << 3;
@@ -247,39 +314,79 @@ void set_up_you_win_sprites()
     }
 }
 
+// where the cursor is heading, in board pixels
+static void cursor_target(int16_t *x, int16_t *y)
+{
+	*x = (cursor_area_tx[cursor_area] + (cursor_x * 3)) << 3;
+	*y = ((cursor_area == AREA_CASCADES)
+			? cascade_card_row(cursor_x, cursor_y)
+			: (cursor_area_ty[cursor_area] + cursor_y)) << 3;
+}
+
+// put the cursor straight where it's heading
 void reset_drawn_cursor()
 {
-	drawn_cursor_x = (cursor_area_tx[cursor_area] + (cursor_x * 3)) << 3;
-	drawn_cursor_y = (cursor_area_ty[cursor_area] + cursor_y) << 3;
+	int16_t x, y;
+
+	cursor_target(&x, &y);
+	tween_set(TWEEN_CURSOR_X, x);
+	tween_set(TWEEN_CURSOR_Y, y);
+
+	drawn_cursor_x = x;
+	drawn_cursor_y = y;
+	view_dirty |= VIEW_DIRTY_SPRITES;
 }
 
-static uint16_t interpolate_value(uint16_t value, uint16_t target)
+// the scroll registers and sprites have been used for something else,
+// e.g. the menu, so they all get written next time the board is drawn
+void invalidate_view()
 {
-    if (value == target)
-        return target;
-    else if (value < target)
-        return (value * 3 + target + 3) >> 2;
-    else
-        return (value * 3 + target) >> 2;
+    view_dirty = VIEW_DIRTY_ALL;
 }
 
 void draw_cursor()
 {
     uint8_t i;
+    int16_t x, y;
 
     // update drawn cursor position
     uint16_t old_drawn_cursor_x = drawn_cursor_x;
     uint16_t old_drawn_cursor_y = drawn_cursor_y;
-    reset_drawn_cursor();
-    drawn_cursor_x = interpolate_value(old_drawn_cursor_x, drawn_cursor_x);
-    drawn_cursor_y = interpolate_value(old_drawn_cursor_y, drawn_cursor_y);
+
+    // a cursor which has moved glides over from wherever it has got to
+    cursor_target(&x, &y);
+
+    if (x != tweens[TWEEN_CURSOR_X].to)
+    {
+        tween_start(TWEEN_CURSOR_X, drawn_cursor_x, x, CURSOR_GLIDE_FRAMES, TWEEN_EASE_OUT, 0);
+    }
+
+    if (y != tweens[TWEEN_CURSOR_Y].to)
+    {
+        tween_start(TWEEN_CURSOR_Y, drawn_cursor_y, y, CURSOR_GLIDE_FRAMES, TWEEN_EASE_OUT, 0);
+    }
+
+    drawn_cursor_x = tweens[TWEEN_CURSOR_X].value;
+    drawn_cursor_y = tweens[TWEEN_CURSOR_Y].value;
+
+    // nothing to do once the cursor has stopped moving
+    if (drawn_cursor_x == old_drawn_cursor_x
+        && drawn_cursor_y == old_drawn_cursor_y
+        && card_in_hand_tiles_count == drawn_card_sprites
+        && !(view_dirty & VIEW_DIRTY_SPRITES))
+    {
+        return;
+    }
+
+    view_dirty &= ~VIEW_DIRTY_SPRITES;
+    drawn_card_sprites = card_in_hand_tiles_count;
 
     // number of sprites to render
     outportb(WS_SPR_FIRST_PORT, 0);
-    outportb(WS_SPR_COUNT_PORT, 2 + card_in_hand_tiles_count);
+    outportb(WS_SPR_COUNT_PORT, 2 + card_in_hand_tiles_count + hud_count + flying_sprites);
 
     // cursor position
-    sprites[0].x = drawn_cursor_x + 20;
+    sprites[0].x = drawn_cursor_x + 20 - camera_x;
     sprites[0].y = drawn_cursor_y + 8 - camera_y;
 
     sprites[1].x = sprites[0].x;
@@ -289,128 +396,516 @@ void draw_cursor()
     for (i = 0; i < card_in_hand_tiles_count; i++)
     {
         sprites[i + 2] = card_in_hand_tiles[i];
-        sprites[i + 2].x = (drawn_cursor_x + ((i % 3) << 3)) + 4;
+        sprites[i + 2].x = (drawn_cursor_x + ((i % 3) << 3)) + 4 - camera_x;
         sprites[i + 2].y = (drawn_cursor_y + ((i / 3) << 3)) + 6 - camera_y;
     }
+
+    // the corner letters stay put as the board scrolls
+    for (i = 0; i < hud_count; i++)
+    {
+        sprites[i + 2 + card_in_hand_tiles_count] = hud_sprites[i];
+    }
+}
+
+// write the sprites for the cards in flight from sprite first onwards,
+// and show the sprites from shown up to the last of them
+void draw_flights(uint8_t first, uint8_t shown)
+{
+    const flight_t *flight = flights;
+    ws_sprite_t *sprite = &sprites[first];
+    uint8_t i, count;
+    int16_t x, y;
+
+    for (i = 0; i < FLIGHT_SLOTS; i++, flight++)
+    {
+        if (flight->card == NO_CARD || flight_waiting(i))
+        {
+            continue;
+        }
+
+        for (count = 0; count < FLIGHT_TILES; count++, sprite++)
+        {
+            x = flight_x(i) + ((count % 3) << 3) - camera_x;
+            y = flight_y(i) + ((count / 3) << 3) - camera_y;
+
+            sprite->attr = flight->tiles[count];
+            sprite->x = x;
+
+            // sprite positions wrap around, so anything
+            // too far off the screen is put just below it
+            sprite->y = (x > -8 && x < 256 && y > -8 && y < (WS_DISPLAY_HEIGHT_TILES << 3))
+                ? y
+                : (WS_DISPLAY_HEIGHT_TILES << 3);
+        }
+    }
+
+    count = sprite - &sprites[first];
+
+    // nothing to write when nothing's flying
+    if (count == 0 && flying_sprites == 0)
+    {
+        return;
+    }
+
+    flying_sprites = count;
+
+    outportb(WS_SPR_FIRST_PORT, shown);
+    outportb(WS_SPR_COUNT_PORT, first + count - shown);
+}
+
+// show up to HUD_SPRITES letters in the corner, or none for an empty string
+// the text tiles are laid out in ascii order starting at 0x80 + ' '
+void draw_hud(const char __wf_rom* text)
+{
+    uint8_t i;
+
+    for (i = 0; i < HUD_SPRITES && text[i]; i++)
+    {
+        hud_sprites[i].attr = (0x80 + text[i]) | WS_SPRITE_ATTR_PRIORITY | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE);
+        hud_sprites[i].x = HUD_X + ((i & 1) << 3);
+        hud_sprites[i].y = HUD_Y + ((i >> 1) << 3);
+    }
+
+    hud_count = i;
+    view_dirty |= VIEW_DIRTY_SPRITES;
 }
 
-// copy card tiles for the card at the given location
-// into an array of sprites which will be used to move the card
-// around with the cursor
-void copy_card_tiles_to_sprites(uint8_t x, uint8_t y)
+// point the cursor sprites at a tile without moving the cursor
+void draw_cursor_at(uint8_t tx, uint8_t ty)
 {
+    // the cursor goes back to where it should be next time it's drawn
+    view_dirty |= VIEW_DIRTY_SPRITES;
+
+    sprites[0].x = (tx << 3) + 20 - camera_x;
+    sprites[0].y = (ty << 3) + 8 - camera_y;
+
+    sprites[1].x = sprites[0].x;
+    sprites[1].y = sprites[0].y + 8;
+}
+
+// copy a card's tiles into an array of sprites which will be used to
+// move the card around with the cursor. they're worked out from the card
+// rather than read off the tilemap, which might not have caught up with
+// a card that's still flying in
+void copy_card_tiles_to_sprites(uint8_t card)
+{
+	uint16_t tiles[FLIGHT_TILES];
 	uint8_t i;
-	uint8_t dest_offset = 0;
-	uint16_t source_offset = x + (y << 5);
-	card_in_hand_tiles_count = 12;
 
-	for (i = 0; i < 4; i++)
+	card_sprite_tiles(card, tiles);
+
+	for (i = 0; i < FLIGHT_TILES; i++)
 	{
-		card_in_hand_tiles[dest_offset].attr = screen_2[source_offset] | WS_SPRITE_ATTR_PRIORITY;
-		dest_offset++;
-		source_offset++;
+		card_in_hand_tiles[i].attr = tiles[i];
+	}
 
-		card_in_hand_tiles[dest_offset].attr = screen_2[source_offset] | WS_SPRITE_ATTR_PRIORITY;
-		dest_offset++;
-		source_offset++;
+	card_in_hand_tiles_count = FLIGHT_TILES;
+	view_dirty |= VIEW_DIRTY_SPRITES;
+}
 
-		card_in_hand_tiles[dest_offset].attr = screen_2[source_offset] | WS_SPRITE_ATTR_PRIORITY;
-		dest_offset++;
-		source_offset++;
+static void clear_card_row(uint16_t offset)
+{
+	screen_2[offset] = BLANK_TILE;
+	screen_2[offset + 1] = BLANK_TILE;
+	screen_2[offset + 2] = BLANK_TILE;
+}
 
-		source_offset += WS_SCREEN_WIDTH_TILES - 3;
+// the rows of a card at y which are on screen go from the returned row
+// up to end. the tilemap rows they're drawn into can wrap partway
+static uint8_t card_rows_on_screen(uint8_t y, uint8_t *end)
+{
+	*end = (y + CARD_ROWS < view_top + VIEW_ROWS) ? (y + CARD_ROWS) : (view_top + VIEW_ROWS);
+
+	return (y > view_top) ? y : view_top;
+}
+
+// work out one row of a card's tiles, row 0 being the top of the card
+static void card_row_tiles(uint8_t card, uint8_t row, uint16_t *tiles)
+{
+	uint8_t value = (card & 0xf);
+	uint8_t suit = (card >> 4);
+	uint16_t card_body = 0x10;
+
+	// top row
+	if (row == 0)
+	{
+		tiles[0] = (0x54) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+		tiles[1] = (0x50 + suit) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+		tiles[2] = (0x60 + value) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+		return;
+	}
+
+	// bottom row
+	if (row == CARD_ROWS - 1)
+	{
+		tiles[0] = (0x70 + value) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE) | WS_SCREEN_ATTR_FLIP_H | WS_SCREEN_ATTR_FLIP_V;
+		tiles[1] = (0x50 + suit) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE) | WS_SCREEN_ATTR_FLIP_H | WS_SCREEN_ATTR_FLIP_V;
+		tiles[2] = (0x57) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+		return;
+	}
+
+	// ace
+	if (value == 0)
+	{
+		card_body = 0x30 + (suit << 3);
+	}
+
+	// face cards
+	else if (value >= 10)
+	{
+		card_body = 0x18 + ((value - 10) << 3);
+	}
+
+	// body of card, three tiles a row
+	card_body += (row - 1) * 3;
+
+	tiles[0] = card_body | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+	tiles[1] = (card_body + 1) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+	tiles[2] = (card_body + 2) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+}
+
+// draw one row of a card's tiles
+static void draw_card_row(uint8_t card, uint16_t offset, uint8_t row)
+{
+	card_row_tiles(card, row, &screen_2[offset]);
+}
+
+// a whole card's tiles a row at a time, for drawing it with sprites
+void card_sprite_tiles(uint8_t card, uint16_t *tiles)
+{
+	uint8_t row;
+
+	for (row = 0; row < CARD_ROWS; row++, tiles += 3)
+	{
+		card_row_tiles(card, row, tiles);
+
+		tiles[0] |= WS_SPRITE_ATTR_PRIORITY;
+		tiles[1] |= WS_SPRITE_ATTR_PRIORITY;
+		tiles[2] |= WS_SPRITE_ATTR_PRIORITY;
 	}
 }
 
+static void draw_empty_card_row(uint16_t offset, uint8_t row)
+{
+	uint8_t tile = 0x80 + (row * 3);
+
+	screen_2[offset] = tile | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+	screen_2[offset + 1] = (tile + 1) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+	screen_2[offset + 2] = (tile + 2) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+}
+
 // remove tiles for the card at x, y
 void clear_card_tiles(uint8_t x, uint8_t y)
 {
-	uint8_t i;
-	uint16_t offset = x + (y << 5);
+	uint8_t row, end, run;
 
-	// body of card
-	for (i = 0; i < 4; i++)
+	for (row = card_rows_on_screen(y, &end); row < end; row += run)
 	{
-		screen_2[offset] = WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		screen_2[offset + 1] = WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		screen_2[offset + 2] = WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		offset += WS_SCREEN_WIDTH_TILES;
+		run = RING_ROWS_LEFT(row);
+		run = (run < end - row) ? run : (end - row);
+
+		blit_fill_rect(&screen_2[RING_OFFSET(x, row)], BLANK_TILE, BLIT_SIZE(3, run));
 	}
 }
 
 // draw tiles for the given card at x, y
 void draw_card_tiles(uint8_t card, uint8_t x, uint8_t y, uint8_t full_card)
 {
-	uint8_t i = 0;
-	uint8_t value = (card & 0xf);
-	uint8_t suit = (card >> 4);
-	uint16_t card_body = 0x10;
+	uint8_t i;
 
-	uint16_t offset = x + (y * WS_SCREEN_WIDTH_TILES);
+	// whether to draw the full card or just the top row
+	uint8_t rows = (full_card == 1) ? CARD_ROWS : 1;
 
-	// top row
-	screen_2[offset] = (0x54) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-    screen_2[offset + 1] = (0x50 + suit) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-	screen_2[offset + 2] = (0x60 + value) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+	for (i = 0; i < rows; i++, y++)
+	{
+		if (ROW_VISIBLE(y))
+		{
+			draw_card_row(card, RING_OFFSET(x, y), i);
+		}
+	}
+}
+
+// draw "empty" dotted line card for freecells and foundations
+void draw_empty_card(uint8_t x, uint8_t y)
+{
+	uint8_t row, end;
+
+	for (row = card_rows_on_screen(y, &end); row < end; row++)
+	{
+		draw_empty_card_row(RING_OFFSET(x, row), row - y);
+	}
+}
+
+// cascades are spread out while the whole of them fits on screen
+static uint8_t cascade_pitch(uint8_t cascade)
+{
+	uint8_t count = cascade_counts[cascade];
+
+	return (count == 0 || (cursor_area_ty[AREA_CASCADES] + ((count - 1) * CASCADE_PITCH_SPREAD) + CARD_ROWS) <= VIEW_ROWS)
+		? CASCADE_PITCH_SPREAD
+		: CASCADE_PITCH_BUNCHED;
+}
+
+// board row the top of a card in a cascade is on
+uint8_t cascade_card_row(uint8_t cascade, uint8_t index)
+{
+	return cursor_area_ty[AREA_CASCADES] + (index * cascade_pitch(cascade));
+}
+
+// board row below the bottom of a cascade's last card
+static uint8_t cascade_end(uint8_t cascade)
+{
+	return (cascade_counts[cascade] > 0)
+		? (cascade_card_row(cascade, cascade_counts[cascade] - 1) + CARD_ROWS)
+		: cursor_area_ty[AREA_CASCADES];
+}
 
-	offset += WS_SCREEN_WIDTH_TILES;
+// draw one row of a cascade, from whichever card is on top at that row
+static void draw_cascade_row(uint8_t cascade, uint8_t row)
+{
+	uint8_t count = cascade_counts[cascade];
+	uint8_t top = cursor_area_ty[AREA_CASCADES];
+	uint8_t pitch, index;
+	uint16_t offset = RING_OFFSET(cursor_area_tx[AREA_CASCADES] + (cascade * 3), row);
 
-    // whether to draw the full card or just the top row
-	if (full_card == 1)
+	// a card flying in isn't drawn until it lands
+	if (count > 0 && flight_carrying(cascades[cascade][count - 1]))
 	{
-		// ace
-		if (value == 0)
+		count--;
+	}
+
+	if (count > 0 && row >= top)
+	{
+		pitch = cascade_pitch(cascade);
+		row -= top;
+		index = row / pitch;
+
+		// everything past the last card's top row is part of the last card
+		if (index >= count)
 		{
-			card_body = 0x30 + (suit << 3);
+			index = count - 1;
 		}
 
-		// face cards
-		else if (value >= 10)
+		row -= index * pitch;
+
+		if (row < CARD_ROWS)
 		{
-			card_body = 0x18 + ((value - 10) << 3);
+			draw_card_row(cascades[cascade][index], offset, row);
+			return;
 		}
+	}
 
-		// body of card
-		for (i = 0; i < 2; i++)
-		{
-			screen_2[offset] = card_body | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-			card_body++;
+	clear_card_row(offset);
+}
+
+// draw a whole row of the board from the cards in play
+static void draw_board_row(uint8_t row)
+{
+	uint8_t i, card_row, count;
+	uint16_t offset = RING_OFFSET(0, row);
 
-			screen_2[offset + 1] = card_body | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-			card_body++;
+	blit_fill_rect(&screen_2[offset], BLANK_TILE, BLIT_SIZE(WS_SCREEN_WIDTH_TILES, 1));
 
-			screen_2[offset + 2] = card_body | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-			card_body++;
+	// freecells and foundations above the cascades
+	if (row < cursor_area_ty[AREA_CASCADES])
+	{
+		card_row = row - cursor_area_ty[AREA_FREECELLS];
 
-			offset += WS_SCREEN_WIDTH_TILES;
+		for (i = 0; i < FREECELLS && card_row < CARD_ROWS; i++)
+		{
+			offset = RING_OFFSET(cursor_area_tx[AREA_FREECELLS] + (i * 3), row);
+
+			if (freecells[i][0] != NO_CARD && !flight_carrying(freecells[i][0]))
+			{
+				draw_card_row(freecells[i][0], offset, card_row);
+			}
+			else
+			{
+				draw_empty_card_row(offset, card_row);
+			}
 		}
 
-		// bottom row
-		screen_2[offset] = (0x70 + value) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE) | WS_SCREEN_ATTR_FLIP_H | WS_SCREEN_ATTR_FLIP_V;
-		screen_2[offset + 1] = (0x50 + suit) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE) | WS_SCREEN_ATTR_FLIP_H | WS_SCREEN_ATTR_FLIP_V;
-		screen_2[offset + 2] = (0x57) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+		card_row = row - cursor_area_ty[AREA_FOUNDATIONS];
+
+		for (i = 0; i < FOUNDATIONS && card_row < CARD_ROWS; i++)
+		{
+			offset = RING_OFFSET(cursor_area_tx[AREA_FOUNDATIONS] + (i * 3), row);
+
+			count = foundation_counts[i];
+
+			if (count > 0 && flight_carrying(foundations[i][count - 1]))
+			{
+				count--;
+			}
+
+			if (count > 0)
+			{
+				draw_card_row(foundations[i][count - 1], offset, card_row);
+			}
+			else
+			{
+				draw_empty_card_row(offset, card_row);
+
+				// suit icon
+				if (card_row == 1)
+				{
+					screen_2[offset + 1] = (0x58 + i) | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
+				}
+			}
+		}
+
+		return;
 	}
 
+	for (i = 0; i < CASCADES; i++)
+	{
+		draw_cascade_row(i, row);
+	}
 }
 
-// draw "empty" dotted line card for freecells and foundations
-void draw_empty_card(uint8_t x, uint8_t y)
+// redraw a cascade from one of its cards down, after cards have been
+// put on or taken off the bottom. only the rows on screen are drawn
+void draw_cascade(uint8_t cascade, uint8_t from)
 {
-	uint8_t i = 0;
-	uint8_t tile = 0x80;
-	uint16_t offset = x + (y * WS_SCREEN_WIDTH_TILES);
+	uint8_t pitch = cascade_pitch(cascade);
+	uint8_t row, end, new_end;
+
+	// a change in spacing moves every card in the cascade
+	if (pitch != drawn_pitch[cascade])
+	{
+		drawn_pitch[cascade] = pitch;
+		from = 0;
+	}
+
+	row = cascade_card_row(cascade, from);
+
+	// rows the cascade has shrunk back from need clearing too
+	new_end = cascade_end(cascade);
+	end = (drawn_end[cascade] > new_end) ? drawn_end[cascade] : new_end;
+	drawn_end[cascade] = new_end;
+
+	if (row < view_top)
+	{
+		row = view_top;
+	}
+
+	if (end > view_top + VIEW_ROWS)
+	{
+		end = view_top + VIEW_ROWS;
+	}
 
-	for (i = 0; i < 4; i++)
+	for (; row < end; row++)
 	{
-		screen_2[offset] = tile | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		tile++;
+		draw_cascade_row(cascade, row);
+	}
+}
 
-		screen_2[offset + 1] = tile | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		tile++;
+// draw the board from the top, after a new deal
+void draw_board()
+{
+	uint8_t i;
 
-		screen_2[offset + 2] = tile | WS_SCREEN_ATTR_PALETTE(CARDS_PALETTE);
-		tile++;
+	view_top = 0;
+	view_dirty = VIEW_DIRTY_ALL;
 
-		offset += WS_SCREEN_WIDTH_TILES;
+	for (i = 0; i < CASCADES; i++)
+	{
+		drawn_pitch[i] = cascade_pitch(i);
+		drawn_end[i] = cascade_end(i);
 	}
+
+	for (i = 0; i < VIEW_ROWS; i++)
+	{
+		draw_board_row(i);
+	}
+
+	scroll_board(0);
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+	pan_board(0);
+#endif
 }
+
+// scroll so that top_row is at the top of the screen
+// only the rows coming into view are drawn, the rest of the ring
+// still holds the rows which were already on screen
+void scroll_board(uint8_t top_row)
+{
+	uint8_t row, end, camera_row, distance;
+
+	if (top_row != view_top || (view_dirty & VIEW_DIRTY_SCROLL))
+	{
+		if (top_row > view_top)
+		{
+			row = (top_row > view_top + VIEW_ROWS) ? top_row : (view_top + VIEW_ROWS);
+			end = top_row + VIEW_ROWS;
+		}
+		else
+		{
+			row = top_row;
+			end = (view_top < top_row + VIEW_ROWS) ? view_top : (top_row + VIEW_ROWS);
+		}
+
+		view_top = top_row;
+
+		for (; row < end; row++)
+		{
+			draw_board_row(row);
+		}
+
+		// rows from wherever the camera has got to
+		camera_row = camera_y >> 3;
+		distance = (top_row > camera_row) ? (top_row - camera_row) : (camera_row - top_row);
+
+		if (!(view_dirty & VIEW_DIRTY_SCROLL) && distance <= CAMERA_GLIDE_ROWS)
+		{
+			tween_start(TWEEN_CAMERA_Y, camera_y, top_row << 3, CAMERA_GLIDE_FRAMES, TWEEN_EASE_OUT, 0);
+		}
+		else
+		{
+			tween_set(TWEEN_CAMERA_Y, top_row << 3);
+		}
+	}
+
+	if (tweens[TWEEN_CAMERA_Y].value == camera_y && !(view_dirty & VIEW_DIRTY_SCROLL))
+	{
+		return;
+	}
+
+	camera_y = tweens[TWEEN_CAMERA_Y].value;
+	view_dirty = (view_dirty & ~VIEW_DIRTY_SCROLL) | VIEW_DIRTY_SPRITES;
+
+	// the baize looks the same every pattern height, so it doesn't
+	// need to scroll past the end of its own tilemap
+	outportb(WS_SCR1_SCRL_Y_PORT, camera_y % BAIZE_PATTERN_SIZE);
+	outportb(WS_SCR2_SCRL_Y_PORT, camera_y);
+}
+
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+// pan so that left_column is at the left of the screen. the board is
+// never wider than the tilemap, so there's nothing to draw
+void pan_board(uint8_t left_column)
+{
+	if (tweens[TWEEN_CAMERA_X].to != (left_column << 3) || (view_dirty & VIEW_DIRTY_PAN))
+	{
+		if (view_dirty & VIEW_DIRTY_PAN)
+		{
+			tween_set(TWEEN_CAMERA_X, left_column << 3);
+		}
+		else
+		{
+			tween_start(TWEEN_CAMERA_X, camera_x, left_column << 3, CAMERA_GLIDE_FRAMES, TWEEN_EASE_OUT, 0);
+		}
+	}
+
+	if (tweens[TWEEN_CAMERA_X].value == camera_x && !(view_dirty & VIEW_DIRTY_PAN))
+	{
+		return;
+	}
+
+	camera_x = tweens[TWEEN_CAMERA_X].value;
+	view_dirty = (view_dirty & ~VIEW_DIRTY_PAN) | VIEW_DIRTY_SPRITES;
+
+	outportb(WS_SCR1_SCRL_X_PORT, camera_x % BAIZE_PATTERN_SIZE);
+	outportb(WS_SCR2_SCRL_X_PORT, camera_x);
+}
+#endif
@@ -0,0 +1,147 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// a pool of cards flying across the board as sprites, for dealing,
+// aces going up to the foundations, undo and the "you win" screen
+//
+// each flight's position is a pair of tweens, which move along with the
+// rest of them in tween_update. the renderer writes every flight's
+// sprites in one go each frame, see draw_flights
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "card.h"
+#include "draw.h"
+#include "flight.h"
+#include "tween.h"
+
+flight_t flights[FLIGHT_SLOTS];
+uint8_t flights_active;
+
+// take everything off the board without landing it, for a new deal
+void flight_reset()
+{
+    uint8_t i;
+
+    for (i = 0; i < FLIGHT_SLOTS; i++)
+    {
+        flights[i].card = NO_CARD;
+        tween_stop(TWEEN_FLIGHT_X(i));
+        tween_stop(TWEEN_FLIGHT_Y(i));
+    }
+
+    flights_active = 0;
+}
+
+// send card from one place to another over frames along one of the
+// easing curves, after waiting for delay
+// returns 0 if every slot is taken, in which case the caller should put
+// the card where it's going straight away
+uint8_t flight_launch(uint8_t card, uint8_t location, int16_t from_x, int16_t from_y, int16_t to_x, int16_t to_y, uint8_t frames, uint8_t curve, uint8_t delay)
+{
+    flight_t *flight;
+    uint8_t i;
+
+    for (i = 0; i < FLIGHT_SLOTS && flights[i].card != NO_CARD; i++)
+    {
+    }
+
+    if (i == FLIGHT_SLOTS)
+    {
+        return 0;
+    }
+
+    flight = &flights[i];
+    flight->card = card;
+    flight->location = location;
+    tween_start(TWEEN_FLIGHT_X(i), from_x, to_x, frames, curve, delay);
+    tween_start(TWEEN_FLIGHT_Y(i), from_y, to_y, frames, curve, delay);
+
+    card_sprite_tiles(card, flight->tiles);
+    flights_active++;
+
+    return 1;
+}
+
+static void land(uint8_t i)
+{
+    flight_t *flight = &flights[i];
+    uint8_t card = flight->card;
+
+    tween_stop(TWEEN_FLIGHT_X(i));
+    tween_stop(TWEEN_FLIGHT_Y(i));
+
+    // the slot is freed first, the card isn't drawn while it's flying
+    flight->card = NO_CARD;
+    flights_active--;
+
+    if (flight->location != FLIGHT_NOWHERE)
+    {
+        redraw_location(flight->location, card);
+    }
+}
+
+// the slot a card is flying to somewhere on the board in, or
+// FLIGHT_SLOTS if it isn't
+static uint8_t flight_slot(uint8_t card)
+{
+    uint8_t i;
+
+    for (i = 0; flights_active > 0 && i < FLIGHT_SLOTS; i++)
+    {
+        if (flights[i].card == card && flights[i].location != FLIGHT_NOWHERE)
+        {
+            return i;
+        }
+    }
+
+    return FLIGHT_SLOTS;
+}
+
+// whether a card is still on its way to where it's been put, the
+// renderer leaves it out until it lands
+uint8_t flight_carrying(uint8_t card)
+{
+    return flight_slot(card) < FLIGHT_SLOTS;
+}
+
+// land one card straight away if it's in flight, e.g. when it's picked up
+void flight_land_card(uint8_t card)
+{
+    uint8_t i = flight_slot(card);
+
+    if (i < FLIGHT_SLOTS)
+    {
+        land(i);
+    }
+}
+
+// land the flights which have got where they're going, once the
+// tweens have been moved on for the frame
+void flight_update()
+{
+    uint8_t i;
+
+    for (i = 0; flights_active > 0 && i < FLIGHT_SLOTS; i++)
+    {
+        if (flights[i].card != NO_CARD && tween_done(TWEEN_FLIGHT_X(i)))
+        {
+            land(i);
+        }
+    }
+}
+
+// put every card in flight where it's going, e.g. before the menu opens
+void flight_land_all()
+{
+    uint8_t i;
+
+    for (i = 0; flights_active > 0 && i < FLIGHT_SLOTS; i++)
+    {
+        if (flights[i].card != NO_CARD)
+        {
+            land(i);
+        }
+    }
+}
@@ -0,0 +1,388 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// suggests a move when the player asks for one
+// the legal moves are scored a few sources at a time in the frames
+// between moves and only the best few are kept, so a hint is ready
+// as soon as it's asked for. a winning line found by the dead end
+// search beats anything the scores come up with
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "card.h"
+#include "deadend.h"
+#include "draw.h"
+#include "hint.h"
+#include "solution.h"
+#include "zobrist.h"
+
+#define SOURCE_COUNT (SOLUTION_FREECELL_0 + FREECELLS)
+
+// what makes a move look good or bad
+#define SCORE_WINNING_LINE 1000
+#define SCORE_FOUNDATION 100
+#define SCORE_EMPTIES_CASCADE 25
+#define SCORE_FREES_FREECELL 15
+#define SCORE_BUILDS 10
+#define SCORE_KING_TO_EMPTY_CASCADE 5
+#define SCORE_TO_EMPTY_CASCADE -15
+#define SCORE_TO_FREECELL -20
+#define SCORE_BREAKS_SEQUENCE -30
+#define SCORE_REPEATS -60
+
+// digging towards a card the foundations want next is worth more
+// the fewer cards there are left on top of it
+#define SCORE_UNBURY 40
+#define SCORE_UNBURY_PER_CARD 4
+
+#define NOT_BURIED 0xff
+
+// the position the ranking belongs to
+static uint32_t ranked_hash;
+static uint8_t ranked_valid;
+static uint8_t next_source;
+
+// best moves so far, best first
+static solution_move_t ranked_moves[HINT_RANKED];
+static int16_t ranked_scores[HINT_RANKED];
+static uint8_t ranked_count;
+
+// number of cards above the card nearest the top of each cascade
+// which can go on the foundations next
+static uint8_t burial[CASCADES];
+
+// the hint being shown
+static solution_move_t hint_move;
+static uint8_t hint_index;
+static uint8_t hint_frames;
+
+static uint8_t source_card(uint8_t source)
+{
+    if (source < CASCADES)
+    {
+        return (cascade_counts[source] > 0)
+            ? cascades[source][cascade_counts[source] - 1]
+            : NO_CARD;
+    }
+
+    return freecells[source - SOLUTION_FREECELL_0][0];
+}
+
+static void start_ranking()
+{
+    uint8_t i, j, card;
+
+    ranked_hash = board_hash;
+    ranked_valid = 1;
+    ranked_count = 0;
+    next_source = 0;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        burial[i] = NOT_BURIED;
+
+        for (j = cascade_counts[i]; j > 0; j--)
+        {
+            card = cascades[i][j - 1];
+
+            if (foundation_counts[card >> 4] == (card & 0xf))
+            {
+                burial[i] = cascade_counts[i] - j;
+                break;
+            }
+        }
+    }
+
+    // the board has changed under the hint
+    hint_frames = 0;
+}
+
+// zobrist location of a cascade, freecell or foundation
+// below is the card the moving card is on or is going on to
+static uint8_t zobrist_location(uint8_t location, uint8_t below)
+{
+    if (location < CASCADES)
+    {
+        return (below != NO_CARD) ? below : ZOBRIST_CASCADE_BOTTOM;
+    }
+
+    return (location == SOLUTION_FOUNDATION) ? ZOBRIST_FOUNDATION : ZOBRIST_FREECELL;
+}
+
+static int16_t score_move(uint8_t source, uint8_t dest, uint8_t card)
+{
+    int16_t score = 0;
+    uint8_t count, below;
+
+    below = (source < CASCADES && cascade_counts[source] > 1)
+        ? cascades[source][cascade_counts[source] - 2]
+        : NO_CARD;
+
+    // going back to where the board was a few moves ago gets nowhere
+    if (zobrist_seen_recently(
+        board_hash
+        ^ ZOBRIST_KEY(card, zobrist_location(source, below))
+        ^ ZOBRIST_KEY(card, zobrist_location(dest, (dest < CASCADES) ? source_card(dest) : NO_CARD))
+    ))
+    {
+        score += SCORE_REPEATS;
+    }
+
+    if (dest == SOLUTION_FOUNDATION)
+    {
+        score += SCORE_FOUNDATION;
+    }
+    else if (dest >= SOLUTION_FREECELL_0)
+    {
+        score += SCORE_TO_FREECELL;
+    }
+    else if (cascade_counts[dest] == 0)
+    {
+        score += ((card & 0xf) == 12) ? SCORE_KING_TO_EMPTY_CASCADE : SCORE_TO_EMPTY_CASCADE;
+    }
+    else
+    {
+        score += SCORE_BUILDS;
+    }
+
+    if (source < CASCADES)
+    {
+        count = cascade_counts[source];
+
+        if (count == 1)
+        {
+            score += SCORE_EMPTIES_CASCADE;
+        }
+
+        // the card is already sat on the card it should be on
+        else if (dest != SOLUTION_FOUNDATION && can_move_card_onto_card(card, cascades[source][count - 2]))
+        {
+            score += SCORE_BREAKS_SEQUENCE;
+        }
+
+        if (burial[source] != NOT_BURIED && burial[source] < (SCORE_UNBURY / SCORE_UNBURY_PER_CARD))
+        {
+            score += SCORE_UNBURY - (burial[source] * SCORE_UNBURY_PER_CARD);
+        }
+    }
+    else
+    {
+        score += SCORE_FREES_FREECELL;
+    }
+
+    return score;
+}
+
+// put a move into the ranking if it's better than what's there
+static void rank_move(solution_move_t move, int16_t score)
+{
+    uint8_t i;
+
+    if (ranked_count == HINT_RANKED && score <= ranked_scores[HINT_RANKED - 1])
+    {
+        return;
+    }
+
+    i = (ranked_count < HINT_RANKED) ? ranked_count++ : (HINT_RANKED - 1);
+
+    for (; i > 0 && ranked_scores[i - 1] < score; i--)
+    {
+        ranked_moves[i] = ranked_moves[i - 1];
+        ranked_scores[i] = ranked_scores[i - 1];
+    }
+
+    ranked_moves[i] = move;
+    ranked_scores[i] = score;
+}
+
+static void score_source(uint8_t source)
+{
+    uint8_t card, i;
+    uint8_t empty_tried = 0;
+
+    card = source_card(source);
+
+    if (card == NO_CARD)
+    {
+        return;
+    }
+
+    // aces go straight to the foundations when they're picked up
+    if ((card & 0xf) == 0)
+    {
+        rank_move(SOLUTION_MOVE(source, SOLUTION_FOUNDATION), score_move(source, SOLUTION_FOUNDATION, card));
+        return;
+    }
+
+    if (foundation_counts[card >> 4] == (card & 0xf))
+    {
+        rank_move(SOLUTION_MOVE(source, SOLUTION_FOUNDATION), score_move(source, SOLUTION_FOUNDATION, card));
+    }
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        if (i == source)
+        {
+            continue;
+        }
+
+        if (cascade_counts[i] == 0)
+        {
+            // all empty cascades are the same, and moving the
+            // only card in a cascade to one doesn't do anything
+            if (!empty_tried && !(source < CASCADES && cascade_counts[source] == 1) && can_move_card_to_empty_cascade(card))
+            {
+                rank_move(SOLUTION_MOVE(source, i), score_move(source, i, card));
+            }
+
+            empty_tried = 1;
+        }
+        else if (can_move_card_onto_card(card, cascades[i][cascade_counts[i] - 1]))
+        {
+            rank_move(SOLUTION_MOVE(source, i), score_move(source, i, card));
+        }
+    }
+
+    // moving between freecells doesn't do anything either
+    if (source < CASCADES)
+    {
+        for (i = 0; i < FREECELLS; i++)
+        {
+            if (freecells[i][0] == NO_CARD)
+            {
+                rank_move(SOLUTION_MOVE(source, SOLUTION_FREECELL_0 + i), score_move(source, SOLUTION_FREECELL_0 + i, card));
+                break;
+            }
+        }
+    }
+}
+
+// score a few more moves for the current position
+// should only be called while there's no card in hand
+void hint_update()
+{
+    uint8_t i;
+
+    if (!ranked_valid || board_hash != ranked_hash)
+    {
+        start_ranking();
+    }
+
+    for (i = 0; i < HINT_SOURCES_PER_FRAME && next_source < SOURCE_COUNT; i++)
+    {
+        score_source(next_source++);
+    }
+}
+
+// put the cursor on the best move's card and point out where it goes
+// asking again while a hint is up moves on to the next best move
+// returns 0 if there's nothing to suggest
+uint8_t hint_show()
+{
+    solution_move_t move;
+    uint8_t i;
+
+    if (card_in_hand != NO_CARD)
+    {
+        return 0;
+    }
+
+    // finish off the ranking now rather than making the player wait
+    hint_update();
+
+    while (next_source < SOURCE_COUNT)
+    {
+        score_source(next_source++);
+    }
+
+    // a win the dead end search has found goes to the top
+    move = deadend_winning_move();
+
+    if (move != SOLUTION_END && !(ranked_count > 0 && ranked_moves[0] == move))
+    {
+        for (i = 0; i < ranked_count && ranked_moves[i] != move; i++);
+
+        if (i == ranked_count)
+        {
+            i = (ranked_count < HINT_RANKED) ? ranked_count++ : (HINT_RANKED - 1);
+        }
+
+        for (; i > 0; i--)
+        {
+            ranked_moves[i] = ranked_moves[i - 1];
+            ranked_scores[i] = ranked_scores[i - 1];
+        }
+
+        ranked_moves[0] = move;
+        ranked_scores[0] = SCORE_WINNING_LINE;
+    }
+
+    if (ranked_count == 0)
+    {
+        return 0;
+    }
+
+    hint_index = (hint_frames > 0) ? ((hint_index + 1) % ranked_count) : 0;
+    hint_move = ranked_moves[hint_index];
+    hint_frames = HINT_FRAMES;
+
+    move_cursor_to(SOLUTION_MOVE_SOURCE(hint_move), NO_CARD);
+
+    return 1;
+}
+
+void hint_hide()
+{
+    hint_frames = 0;
+}
+
+// flick the cursor sprites between the hint's card and where it goes
+// this should be called after the cursor has been drawn
+void hint_draw()
+{
+    uint8_t dest;
+
+    if (hint_frames == 0)
+    {
+        return;
+    }
+
+    // the hint goes away as soon as the board changes
+    if (card_in_hand != NO_CARD || board_hash != ranked_hash)
+    {
+        hint_frames = 0;
+        return;
+    }
+
+    hint_frames--;
+
+    if (((hint_frames / HINT_BLINK_FRAMES) & 1) == 0)
+    {
+        return;
+    }
+
+    dest = SOLUTION_MOVE_DEST(hint_move);
+
+    if (dest < CASCADES)
+    {
+        draw_cursor_at(
+            cursor_area_tx[AREA_CASCADES] + (dest * 3),
+            cascade_card_row(dest, (cascade_counts[dest] > 0) ? (cascade_counts[dest] - 1) : 0)
+        );
+    }
+    else if (dest == SOLUTION_FOUNDATION)
+    {
+        draw_cursor_at(
+            cursor_area_tx[AREA_FOUNDATIONS] + ((source_card(SOLUTION_MOVE_SOURCE(hint_move)) >> 4) * 3),
+            cursor_area_ty[AREA_FOUNDATIONS]
+        );
+    }
+    else
+    {
+        draw_cursor_at(
+            cursor_area_tx[AREA_FREECELLS] + ((dest - SOLUTION_FREECELL_0) * 3),
+            cursor_area_ty[AREA_FREECELLS]
+        );
+    }
+}
@@ -0,0 +1,159 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the keypad is sampled a few times a frame from the hblank timer
+// interrupt, which queues up a press or release for each key that has
+// changed. the game loop drains the queue once a frame, so a key which
+// is pressed and let go again within a frame still counts, as do keys
+// pressed while a frame runs long
+//
+// the interrupt only ever writes the head of the queue and the game
+// loop only ever writes the tail, so neither has to wait for the other
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+
+#ifdef __WONDERFUL_WWITCH__
+#include <sys/bios.h>
+#endif
+
+#include "input.h"
+
+#define INPUT_QUEUE_MASK (INPUT_QUEUE_SIZE - 1)
+
+static input_event_t input_events[INPUT_QUEUE_SIZE];
+static volatile uint8_t input_head;
+static volatile uint8_t input_tail;
+
+// samples taken so far, which events are timestamped with
+static volatile uint16_t input_time;
+// keys down as of the last sample, only used by the interrupt
+static uint16_t input_sampled;
+
+uint16_t input_held;
+
+// keys which repeat while held, the one pressed last repeating
+static uint16_t repeat_keys;
+static uint16_t repeat_delay;
+static uint16_t repeat_rate;
+static uint16_t repeat_key;
+static uint16_t repeat_due;
+
+static void input_sample()
+{
+    uint16_t keys, changed, key;
+    uint8_t next;
+
+#ifdef __WONDERFUL_WWITCH__
+    keys = key_press_check();
+#else
+    keys = ws_keypad_scan();
+#endif
+
+    input_time++;
+    changed = keys ^ input_sampled;
+
+    for (key = 1; changed != 0; key <<= 1)
+    {
+        if (!(changed & key))
+        {
+            continue;
+        }
+
+        changed &= ~key;
+        next = (input_head + 1) & INPUT_QUEUE_MASK;
+
+        // with the queue full, the rest of the keys are left
+        // as they were to be picked up by a later sample
+        if (next == input_tail)
+        {
+            return;
+        }
+
+        input_events[input_head].key = key;
+        input_events[input_head].time = input_time;
+        input_events[input_head].type = (keys & key) ? INPUT_PRESS : INPUT_RELEASE;
+        input_sampled ^= key;
+
+        // the event is only seen by the game loop once the head moves on
+        input_head = next;
+    }
+}
+
+#ifndef __WONDERFUL_WWITCH__
+__attribute__((interrupt)) void __far input_int_handler(void)
+{
+    input_sample();
+    ws_int_ack(WS_INT_ACK_HBLANK_TIMER);
+}
+#endif
+
+// start sampling the keypad from the hblank timer interrupt, with the
+// cpu's interrupts disabled
+void input_start()
+{
+#ifndef __WONDERFUL_WWITCH__
+    ws_int_set_handler(WS_INT_HBLANK_TIMER, input_int_handler);
+    ws_timer_hblank_start_repeat(INPUT_SAMPLE_LINES);
+    ws_int_enable(WS_INT_ENABLE_HBLANK_TIMER);
+#endif
+}
+
+// keys which repeat after being held for delay_frames, every rate_frames
+void input_set_repeat(uint16_t keys, uint8_t delay_frames, uint8_t rate_frames)
+{
+    repeat_keys = keys;
+    repeat_delay = delay_frames * INPUT_SAMPLES_PER_FRAME;
+    repeat_rate = rate_frames * INPUT_SAMPLES_PER_FRAME;
+    repeat_key = 0;
+}
+
+// drain the queue, once a frame
+// returns the keys pressed or repeated since the last call
+uint16_t input_update()
+{
+    input_event_t *event;
+    uint16_t pushed = 0;
+
+#ifdef __WONDERFUL_WWITCH__
+    // there's no interrupt to sample from, so once a frame will do
+    input_sample();
+#endif
+
+    while (input_tail != input_head)
+    {
+        event = &input_events[input_tail];
+
+        if (event->type == INPUT_PRESS)
+        {
+            pushed |= event->key;
+            input_held |= event->key;
+
+            if (event->key & repeat_keys)
+            {
+                repeat_key = event->key;
+                repeat_due = event->time + repeat_delay;
+            }
+        }
+        else
+        {
+            input_held &= ~event->key;
+
+            if (event->key == repeat_key)
+            {
+                repeat_key = 0;
+            }
+        }
+
+        input_tail = (input_tail + 1) & INPUT_QUEUE_MASK;
+    }
+
+    if (repeat_key != 0 && (int16_t) (input_time - repeat_due) >= 0)
+    {
+        pushed |= repeat_key;
+        repeat_due = input_time + repeat_rate;
+    }
+
+    return pushed;
+}
@@ -0,0 +1,198 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the serial port as a link cable, with a buffer each way so the game
+// loop never waits for it. the transmit interrupt sends a byte from one
+// whenever the port is ready for another, the same as telemetry.c, and
+// the receive interrupt puts each byte which comes in into the other
+//
+// each buffer has one side which only writes its head and one which
+// only writes its tail, the same as the keypad queue in input.c
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "link.h"
+
+#if LINK
+
+#define LINK_TX_MASK (LINK_TX_SIZE - 1)
+#define LINK_RX_MASK (LINK_RX_SIZE - 1)
+
+#define LINK_UART_OPEN (WS_UART_CTRL_ENABLE | WS_UART_CTRL_BAUD_38400)
+
+enum link_states {
+  LINK_CLOSED = 0,
+  LINK_OPEN,
+  // closed once what's left to send has gone
+  LINK_CLOSING
+};
+
+static uint8_t link_tx[LINK_TX_SIZE];
+static volatile uint8_t link_tx_head;
+static volatile uint8_t link_tx_tail;
+
+static uint8_t link_rx[LINK_RX_SIZE];
+static volatile uint8_t link_rx_head;
+static volatile uint8_t link_rx_tail;
+
+static volatile uint8_t link_state;
+
+uint8_t link_errors;
+
+__attribute__((interrupt)) void __far link_tx_int_handler(void)
+{
+    if (link_tx_tail != link_tx_head)
+    {
+        outportb(WS_UART_DATA_PORT, link_tx[link_tx_tail]);
+        link_tx_tail = (link_tx_tail + 1) & LINK_TX_MASK;
+    }
+
+    // the interrupt keeps firing while the port is ready for more, so
+    // it's turned off until there's something to send
+    if (link_tx_tail == link_tx_head)
+    {
+        ws_int_disable(WS_INT_ENABLE_UART_TX);
+
+        if (link_state == LINK_CLOSING)
+        {
+            outportb(WS_UART_CTRL_PORT, 0);
+            link_state = LINK_CLOSED;
+        }
+    }
+
+    ws_int_ack(WS_INT_ACK_UART_TX);
+}
+
+__attribute__((interrupt)) void __far link_rx_int_handler(void)
+{
+    uint8_t ctrl = inportb(WS_UART_CTRL_PORT);
+    uint8_t next;
+
+    if (ctrl & WS_UART_CTRL_RX_READY)
+    {
+        next = (link_rx_head + 1) & LINK_RX_MASK;
+        link_rx[link_rx_head] = inportb(WS_UART_DATA_PORT);
+
+        // with the buffer full the byte is lost, which the other
+        // side's next checkpoint will show up
+        if (next == link_rx_tail)
+        {
+            link_errors++;
+        }
+        else
+        {
+            link_rx_head = next;
+        }
+    }
+
+    // the port stops receiving after an overrun until it's reset
+    if (ctrl & WS_UART_CTRL_RX_OVERRUN)
+    {
+        link_errors++;
+        outportb(WS_UART_CTRL_PORT, LINK_UART_OPEN | WS_UART_CTRL_RX_OVERRUN_RESET);
+    }
+
+    ws_int_ack(WS_INT_ACK_UART_RX);
+}
+
+// open the serial port with both buffers empty, with the cpu's
+// interrupts disabled
+void link_open()
+{
+    link_tx_head = link_tx_tail = 0;
+    link_rx_head = link_rx_tail = 0;
+    link_errors = 0;
+    link_state = LINK_OPEN;
+
+    outportb(WS_UART_CTRL_PORT, LINK_UART_OPEN | WS_UART_CTRL_RX_OVERRUN_RESET);
+    link_start();
+}
+
+// stop receiving, and close the port once anything still waiting has
+// been sent, with the cpu's interrupts disabled
+void link_close()
+{
+    ws_int_disable(WS_INT_ENABLE_UART_RX);
+
+    if (link_state == LINK_OPEN)
+    {
+        link_state = LINK_CLOSING;
+    }
+
+    link_start();
+}
+
+// set the interrupts back up after they've all been disabled, with the
+// cpu's interrupts disabled
+void link_start()
+{
+    if (link_state == LINK_CLOSED)
+    {
+        return;
+    }
+
+    ws_int_set_handler(WS_INT_UART_TX, link_tx_int_handler);
+    ws_int_set_handler(WS_INT_UART_RX, link_rx_int_handler);
+
+    if (link_state == LINK_OPEN)
+    {
+        ws_int_enable(WS_INT_ENABLE_UART_RX);
+    }
+
+    // there's nothing left to wait for
+    if (link_tx_tail == link_tx_head)
+    {
+        if (link_state == LINK_CLOSING)
+        {
+            outportb(WS_UART_CTRL_PORT, 0);
+            link_state = LINK_CLOSED;
+        }
+    }
+    else
+    {
+        ws_int_enable(WS_INT_ENABLE_UART_TX);
+    }
+}
+
+// queue up bytes to send, all of them or none
+// returns 0 if there wasn't room for them
+uint8_t link_put(const uint8_t *bytes, uint8_t length)
+{
+    uint8_t head = link_tx_head;
+    uint8_t i;
+
+    if (link_state != LINK_OPEN || ((link_tx_tail - head - 1) & LINK_TX_MASK) < length)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < length; i++)
+    {
+        link_tx[head] = bytes[i];
+        head = (head + 1) & LINK_TX_MASK;
+    }
+
+    // the interrupt only sees the bytes once the head moves on
+    link_tx_head = head;
+    ws_int_enable(WS_INT_ENABLE_UART_TX);
+
+    return 1;
+}
+
+// the next byte which has come in
+// returns 0 if there isn't one
+uint8_t link_get(uint8_t *byte)
+{
+    if (link_rx_tail == link_rx_head)
+    {
+        return 0;
+    }
+
+    *byte = link_rx[link_rx_tail];
+    link_rx_tail = (link_rx_tail + 1) & LINK_RX_MASK;
+
+    return 1;
+}
+
+#endif
@@ -10,25 +10,49 @@
 #include <sys/bios.h>
 #endif
 
+#include "arena.h"
+#include "asset.h"
+#include "autoplay.h"
 #include "card.h"
+#include "deadend.h"
+#include "deals.h"
 #include "draw.h"
+#include "flight.h"
+#include "hint.h"
+#include "input.h"
 #include "main.h"
+#include "pcm.h"
+#include "race.h"
+#include "save.h"
+#include "sfx.h"
+#include "telemetry.h"
+#include "tween.h"
 #include "vgm.h"
-#include "entertainer_cvgm_bin.h"
-#include "title_screen_cvgm_bin.h"
-#include "you_win_cvgm_bin.h"
+#include "zobrist.h"
+#include "asset_pack.h"
 
 #define IRAM_IMPLEMENTATION
 #include "iram.h"
 
-extern void vblank_int_handler(void);
-
 enum game_states {
   GAME_DEALING = 0,
   GAME_INGAME,
   GAME_MENU,
   GAME_TITLE,
-  GAME_WON
+  GAME_WON,
+  GAME_AUTOPLAY,
+  GAME_LINKING
+};
+
+enum menu_items {
+  MENU_UNDO = 0,
+  MENU_RETRY,
+  MENU_NEW_GAME,
+  MENU_DEALS,
+  MENU_SHOW_ME,
+  MENU_NUMBER,
+  MENU_BACK,
+  MENU_ITEM_COUNT
 };
 
 uint8_t tics;
@@ -37,14 +61,65 @@ uint16_t rnd_val;
 
 uint16_t keypad;
 uint16_t keypad_pushed;
-uint16_t keypad_last;
+
+// held directions move the cursor again after a while
+#define KEY_REPEAT_DELAY 18
+#define KEY_REPEAT_RATE 5
+
+// frames shown so far, counted by the vblank interrupt
+static volatile uint8_t vblank_count;
 
 uint8_t game_state;
-uint16_t game_seed;
+uint32_t game_seed;
 
 uint8_t menu_cursor;
 
-uint8_t deal_x, deal_y;
+// menu items are every other row, with a message above them
+#define MENU_TOP_ROW 4
+#define MENU_ITEM_ROW(item) (MENU_TOP_ROW + ((item) << 1))
+#define MENU_TEXT_X 10
+#define MENU_MESSAGE_ROW 2
+#define MENU_MESSAGE_X 8
+
+// with no message, the statistics go in the top two rows
+// and the best win for the deal number goes under it
+#define MENU_STATS_X 7
+#define MENU_STATS_BLANK "              "
+#define MENU_BEST_ROW (MENU_ITEM_ROW(MENU_NUMBER) + 1)
+
+// the deal number is typed in a digit at a time on the menu
+// enough digits for any 32 bit number, most significant first
+#define DEAL_NUMBER_DIGITS 10
+#define DEAL_NUMBER_X 9
+#define NO_DIGIT 0xff
+
+uint8_t deal_number_digits[DEAL_NUMBER_DIGITS];
+uint8_t deal_number_cursor;
+
+static const uint32_t __wf_rom powers_of_ten[DEAL_NUMBER_DIGITS] = {
+	1000000000, 100000000, 10000000, 1000000, 100000,
+	10000, 1000, 100, 10, 1
+};
+
+// dealt cards fly in from below the middle of the screen
+#define DEAL_FROM_X (((WS_DISPLAY_WIDTH_TILES - 3) << 3) / 2)
+#define DEAL_FROM_Y (WS_DISPLAY_HEIGHT_TILES << 3)
+
+// the kings on the foundations fall off the "you win" screen one after another
+#define WIN_FLIGHT_FRAMES 40
+#define WIN_FLIGHT_STAGGER 10
+
+// frames spent on the title screen before the attract mode starts
+#define ATTRACT_DELAY (75 * 10)
+
+uint16_t title_idle_frames;
+solution_reader_t attract_reader;
+
+// set when the game has been played out by "show me"
+// so it isn't counted in the statistics
+uint8_t game_assisted;
+
+uint8_t deal_x;
 uint8_t checker_scroll_x, checker_scroll_y;
 
 vgmswan_state_t music_state;
@@ -52,6 +127,14 @@ uint16_t music_ticks;
 
 const uint8_t __far * current_cvgm;
 
+#ifndef __WONDERFUL_WWITCH__
+__attribute__((interrupt)) void __far vblank_int_handler(void)
+{
+	vblank_count++;
+	ws_int_ack(WS_INT_ACK_VBLANK);
+}
+#endif
+
 void disable_interrupts()
 {
 #ifndef __WONDERFUL_WWITCH__
@@ -69,39 +152,45 @@ void enable_interrupts()
 	// acknowledge interrupt
 	outportb(WS_INT_ACK_PORT, 0xFF);
 
-	// set interrupt handler which only acknowledges the vblank interrupt
-	ws_int_set_default_handler_vblank();
-
-	// enable wonderswan vblank interrupt
+	// count frames on vblank, and sample the keypad between them
+	ws_int_set_handler(WS_INT_VBLANK, vblank_int_handler);
 	ws_int_enable(WS_INT_ENABLE_VBLANK);
+	input_start();
+	telemetry_start();
+	link_start();
 
 	// enable cpu interrupts
 	ia16_enable_irq();
 #endif
 }
 
-void new_game()
+void new_game(uint32_t seed)
 {
-	// keep the random seed which this game uses around
+	// keep the deal number which this game uses around
 	// for the restart game function
-	game_seed = rnd_val;
-	srand(rnd_val);
+	game_seed = seed;
+	telemetry_game(seed);
 
-	// clear card tiles and redraw backgrounds
-	clear_card_layer();
-	draw_baize();
-	draw_empty_freecells();
-	draw_empty_foundations();
+	// anything the last game left in the arena goes back to it
+	arena_enter(ARENA_SCOPE_GAME);
 
 	// clear cascade/freecell/foundation arrays
+	zobrist_reset();
 	initialise_cascades();
 	initialise_freecells();
 	initialise_foundations();
 
-	// initialise deck of cards and shuffle it
-	initialise_cards_array();
-	initialise_deck();
-	shuffle_deck();
+	// clear card tiles and redraw backgrounds
+	clear_card_layer();
+	draw_baize();
+	draw_board();
+
+	// put the deal's cards in the deck in the order they're dealt
+	deal_game(seed);
+	flight_reset();
+
+	// the deal a race agreed on starts it, and any other leaves it
+	race_deal();
 
 	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
 
@@ -114,15 +203,41 @@ void new_game()
 	sprites[0].attr = (CURSOR_TILES) | WS_SPRITE_ATTR_PRIORITY | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE);
 	sprites[1].attr = (CURSOR_TILES + 1) | WS_SPRITE_ATTR_PRIORITY | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE);
 
+	// no sprites until the first card is dealt
+	outportb(WS_SPR_COUNT_PORT, 0);
 	show_game_screen();
 
 	// do dealing out the cards animation to start with
-	deal_x = deal_y = 0;
+	deal_x = 0;
 	game_state = GAME_DEALING;
 
 	// no cards in hand
 	card_in_hand = NO_CARD;
 	card_in_hand_tiles_count = 0;
+
+	move_count = 0;
+	game_assisted = 0;
+	autoplay_mode = AUTOPLAY_OFF;
+
+	clear_undo_journal();
+	deadend_reset();
+	hint_hide();
+}
+
+// whether the game goes in the statistics. ones played out by "show me"
+// don't, and neither do deals too big for save memory's 16 bit numbers
+uint8_t game_is_recorded()
+{
+	return !game_assisted && game_seed <= 0xffff;
+}
+
+// log a game which was left before being won
+void record_abandoned_game()
+{
+	if (move_count > 0 && game_is_recorded())
+	{
+		save_record_game(game_seed, move_count, 0);
+	}
 }
 
 
@@ -131,12 +246,20 @@ void wait_for_vblank()
 #ifdef __WONDERFUL_WWITCH__
 	sys_wait(1);
 #else
+	uint8_t frame = vblank_count;
+
 	// halt cpu
-	// the program will sit here until the vblank interrupt
-	// is triggered and unhalts it
-	ia16_halt();
+	// the program will sit here until an interrupt unhalts it
+	// the keypad sampling wakes it up too, so it goes back to
+	// sleep until it's the vblank interrupt which has
+	while (frame == vblank_count)
+	{
+		ia16_halt();
+	}
 #endif
 
+	telemetry_frame(vblank_count);
+
 	// play music
 	if (music_ticks == VGMSWAN_PLAYBACK_FINISHED)
 	{
@@ -148,20 +271,381 @@ void wait_for_vblank()
 	if (music_ticks > 1)
 		music_ticks--;
 	else
+	{
+		telemetry_music_begin(music_state.ptr);
 		music_ticks = vgmswan_play(&music_state);
+		telemetry_music_end(music_state.ptr);
+	}
+
+	sfx_update(&music_state);
+	pcm_update();
+
+	telemetry_section(TELEMETRY_SOUND);
+}
+
+// set up the title screen graphics and music
+void enter_title_screen()
+{
+	hide_screen();
+	arena_enter(ARENA_SCOPE_TITLE);
+
+	// hide sprites
+	outportb(WS_SPR_COUNT_PORT, 0);
+	flight_reset();
+	outportb(WS_SCR2_SCRL_X_PORT, 0);
+	outportb(WS_SCR2_SCRL_Y_PORT, 0);
+
+	// copy graphics for title screen
+	// and copy the tilemap
+	load_tiles(TITLE_SCREEN_TILES, ASSET_TITLE_SCREEN_TILES);
+	load_tiles(0, ASSET_CHECKERBOARD_TILES);
+	draw_title_screen();
+	draw_checkerboard();
+
+	game_state = GAME_TITLE;
+	title_idle_frames = 0;
+	autoplay_mode = AUTOPLAY_OFF;
+
+	current_cvgm = asset_data(ASSET_TITLE_SCREEN_CVGM);
+	music_ticks = VGMSWAN_PLAYBACK_FINISHED;
+
+	// show title screen
+	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1_page_2) | WS_SCR_BASE_ADDR2(screen_2));
+	show_title_screen();
+}
+
+// draw the menu into its offscreen page as it is before it's opened
+void reset_menu()
+{
+	draw_menu();
+	draw_menu_text(MENU_TEXT_X, MENU_ITEM_ROW(MENU_DEALS), deal_filter_names[deal_filter]);
+}
+
+// copy graphics used by the game over the title screen graphics
+void copy_game_gfx()
+{
+	hide_screen();
+
+	// copy game graphics
+	load_tiles(0, ASSET_CARDS_TILES);
+	load_tiles(TEXT_TILES, ASSET_TEXT_TILES);
+	load_tiles(YOU_WIN_TILES, ASSET_YOU_WIN_TILES);
+	load_tiles(BAIZE_TILES, ASSET_BAIZE_TILES);
+
+	// reset screen 1 scroll
+	outportb(WS_SCR1_SCRL_X_PORT, 0);
+	outportb(WS_SCR1_SCRL_Y_PORT, 0);
+
+	// draw menu into an offscreen page for screen_2
+	reset_menu();
+}
+
+#if LINK
+// wait on the menu's page for another player on the link cable, with
+// the deal this side would like to race on
+void enter_linking()
+{
+	uint8_t i;
+
+	copy_game_gfx();
+
+	// just the message, none of the items
+	for (i = 0; i < MENU_ITEM_COUNT; i++)
+	{
+		draw_menu_text(MENU_MESSAGE_X, MENU_ITEM_ROW(i), "            ");
+	}
+
+	draw_menu_text(MENU_MESSAGE_X, MENU_MESSAGE_ROW, "  LINKING   ");
+	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1_page_2) | WS_SCR_BASE_ADDR2(screen_2_page_2));
+	outportb(WS_SPR_COUNT_PORT, 0);
+	show_game_screen();
+
+	race_link(find_deal_seed(rnd_val), rnd_val);
+	game_state = GAME_LINKING;
+}
+#endif
+
+// play the next game from the solution book on the title screen
+void start_attract_mode()
+{
+	uint16_t seed;
+
+	if (!solution_next_game(&attract_reader, &seed))
+	{
+		// start again from the first game
+		solution_book_open(&attract_reader);
+
+		if (!solution_next_game(&attract_reader, &seed))
+		{
+			return;
+		}
+	}
+
+	copy_game_gfx();
+
+	new_game(seed);
+	autoplay_start(AUTOPLAY_ATTRACT, &attract_reader);
+}
+
+// the board and the cursor follow the cursor position
+void update_game_view()
+{
+	uint8_t row = (cursor_area == AREA_CASCADES)
+				? cascade_card_row(cursor_x, cursor_y)
+				: 0;
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+	uint8_t column;
+#endif
+
+	// keep all of the card under the cursor on screen
+	scroll_board((row + CARD_ROWS > WS_DISPLAY_HEIGHT_TILES)
+				? (row + CARD_ROWS - WS_DISPLAY_HEIGHT_TILES)
+				: 0);
+
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+	column = cursor_area_tx[cursor_area] + (cursor_x * 3) + 3;
+	pan_board((column > WS_DISPLAY_WIDTH_TILES) ? (column - WS_DISPLAY_WIDTH_TILES) : 0);
+#endif
+
+	draw_cursor();
+}
+
+// split a deal number into its digits without dividing
+void set_deal_number(uint32_t number)
+{
+	uint8_t i, digit;
+
+	for (i = 0; i < DEAL_NUMBER_DIGITS; i++)
+	{
+		for (digit = 0; number >= powers_of_ten[i]; digit++)
+		{
+			number -= powers_of_ten[i];
+		}
+
+		deal_number_digits[i] = digit;
+	}
+}
+
+// the number typed in, or the largest deal there is if it's bigger
+uint32_t get_deal_number()
+{
+	uint8_t i;
+	uint32_t number = 0;
+
+	for (i = 0; i < DEAL_NUMBER_DIGITS; i++)
+	{
+		// 4294967295 is the largest
+		if (number > 429496729 || (number == 429496729 && deal_number_digits[i] > 5))
+		{
+			return 0xffffffff;
+		}
+
+		number = (number * 10) + deal_number_digits[i];
+	}
+
+	return number;
+}
+
+// the digit being changed blinks
+void draw_deal_number()
+{
+	uint8_t i;
+
+	for (i = 0; i < DEAL_NUMBER_DIGITS; i++)
+	{
+		draw_menu_char(
+			DEAL_NUMBER_X + i,
+			MENU_ITEM_ROW(MENU_NUMBER),
+			(i == deal_number_cursor && (tics & 0x10)) ? ' ' : ('0' + deal_number_digits[i])
+		);
+	}
+}
+
+// up and down change the digit under the cursor, left and right
+// move between digits and b stops changing the number
+void edit_deal_number()
+{
+	uint8_t *digit = &deal_number_digits[deal_number_cursor];
+
+	if (keypad_pushed & WS_KEY_X1)
+	{
+		*digit = (*digit == 9) ? 0 : (*digit + 1);
+	}
+	else if (keypad_pushed & WS_KEY_X3)
+	{
+		*digit = (*digit == 0) ? 9 : (*digit - 1);
+	}
+	else if ((keypad_pushed & WS_KEY_X4) && deal_number_cursor > 0)
+	{
+		deal_number_cursor--;
+	}
+	else if ((keypad_pushed & WS_KEY_X2) && deal_number_cursor < DEAL_NUMBER_DIGITS - 1)
+	{
+		deal_number_cursor++;
+	}
+	else if (keypad_pushed & WS_KEY_B)
+	{
+		deal_number_cursor = NO_DIGIT;
+	}
+}
+
+// write a number into the menu, returning the column after it
+static uint8_t draw_menu_number(uint8_t x, uint8_t y, uint16_t number, uint16_t limit)
+{
+	char digits[5];
+	uint8_t count = 0;
+
+	if (number > limit)
+	{
+		number = limit;
+	}
+
+	do
+	{
+		digits[count++] = '0' + (number % 10);
+		number /= 10;
+	}
+	while (number > 0);
+
+	while (count > 0)
+	{
+		draw_menu_char(x++, y, digits[--count]);
+	}
+
+	return x;
+}
+
+// games won out of those played, then the current and best streaks
+static void draw_menu_stats()
+{
+	uint8_t x;
+
+	draw_menu_text(MENU_STATS_X, MENU_MESSAGE_ROW, "WON ");
+	x = draw_menu_number(MENU_STATS_X + 4, MENU_MESSAGE_ROW, save_stats.games_won, 9999);
+	draw_menu_char(x, MENU_MESSAGE_ROW, '/');
+	draw_menu_number(x + 1, MENU_MESSAGE_ROW, save_stats.games_played, 9999);
+
+	draw_menu_text(MENU_STATS_X, MENU_MESSAGE_ROW + 1, "STREAK ");
+	x = draw_menu_number(MENU_STATS_X + 7, MENU_MESSAGE_ROW + 1, save_stats.current_streak, 999);
+	draw_menu_char(x, MENU_MESSAGE_ROW + 1, '/');
+	draw_menu_number(x + 1, MENU_MESSAGE_ROW + 1, save_stats.best_streak, 999);
+}
+
+// a message replaces the statistics, or a null one puts them back
+static void draw_menu_message(const char __wf_rom* message)
+{
+	draw_menu_text(MENU_STATS_X, MENU_MESSAGE_ROW, MENU_STATS_BLANK);
+	draw_menu_text(MENU_STATS_X, MENU_MESSAGE_ROW + 1, MENU_STATS_BLANK);
+
+	if (message)
+	{
+		draw_menu_text(MENU_MESSAGE_X, MENU_MESSAGE_ROW, message);
+	}
+	else
+	{
+		draw_menu_stats();
+	}
+}
+
+// the fewest moves the typed in deal has been won in
+// save memory only keeps the low 16 bits of a deal number
+static void draw_deal_best()
+{
+	uint32_t number = get_deal_number();
+	uint16_t best = (number > 0xffff) ? SAVE_NO_BEST : save_get_best_moves(number);
+
+	draw_menu_text(MENU_TEXT_X, MENU_BEST_ROW, "         ");
+
+	if (best != SAVE_NO_BEST)
+	{
+		draw_menu_text(MENU_TEXT_X, MENU_BEST_ROW, "BEST ");
+		draw_menu_number(MENU_TEXT_X + 5, MENU_BEST_ROW, best, 9999);
+	}
+}
+
+// swap screen_2 over to the menu, with a message above the items
+// or the statistics if there isn't one
+void open_menu(uint8_t cursor, const char __wf_rom* message)
+{
+	// cards in flight go straight to where they're going
+	flight_land_all();
+
+	// change screen_2 base address to the menu screen map
+	outportb(WS_SPR_COUNT_PORT, 2);
+	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1_page_2) | WS_SCR_BASE_ADDR2(screen_2_page_2));
+	
+	// reset screen 1 scroll, and screen 2's which follows the board
+	outportb(WS_SCR1_SCRL_X_PORT, 0);
+	outportb(WS_SCR1_SCRL_Y_PORT, 0);
+	outportb(WS_SCR2_SCRL_X_PORT, 0);
+	outportb(WS_SCR2_SCRL_Y_PORT, 0);
+	invalidate_view();
+
+	checker_scroll_x = checker_scroll_y = 0;
+
+	draw_menu_message(message);
+	draw_menu_text(MENU_TEXT_X, MENU_ITEM_ROW(MENU_SHOW_ME), "SHOW ME  ");
+
+	// the number starts off as this game's
+	set_deal_number(game_seed);
+	deal_number_cursor = NO_DIGIT;
+	draw_deal_number();
+	draw_deal_best();
+
+	menu_cursor = cursor;
+	game_state = GAME_MENU;
+}
+
+// send the top card of each foundation off the bottom of the screen
+static void throw_foundations()
+{
+	uint8_t i;
+	int16_t x, y;
+
+	for (i = 0; i < FOUNDATIONS; i++)
+	{
+		if (foundation_counts[i] > 0)
+		{
+			location_position(SOLUTION_FOUNDATION, i << 4, &x, &y);
+			flight_launch(
+				foundations[i][foundation_counts[i] - 1], FLIGHT_NOWHERE,
+				x, y, x, camera_y + (WS_DISPLAY_HEIGHT_TILES << 3),
+				WIN_FLIGHT_FRAMES, TWEEN_LINEAR, i * WIN_FLIGHT_STAGGER
+			);
+		}
+	}
+}
+
+void you_win()
+{
+	flight_land_all();
+	set_up_you_win_sprites();
+	throw_foundations();
+
+	// change to You Win music, with a jingle over the top
+	// on colour hardware
+	current_cvgm = asset_data(ASSET_YOU_WIN_CVGM);
+	music_ticks = VGMSWAN_PLAYBACK_FINISHED;
+	pcm_play(asset_data(ASSET_YOU_WIN_PCM));
+
+	game_state = GAME_WON;
+	arena_enter(ARENA_SCOPE_WON);
+	tics = 0;
 }
 
 void main()
 {
+	uint16_t moves;
+
 	// disable interrupts for now
 	disable_interrupts();
 
 	// initial random seed
 	rnd_val = 0;
 
-	// current and last keypad status
+	// current keypad status
 	keypad = 0;
-	keypad_last = 0;
+	input_set_repeat(WS_KEY_X1 | WS_KEY_X2 | WS_KEY_X3 | WS_KEY_X4, KEY_REPEAT_DELAY, KEY_REPEAT_RATE);
 	
 	// checkerboard scrolling
 	tics = 0;
@@ -172,28 +656,18 @@ void main()
 	init_video();
 	copy_palettes();
 
-	// copy graphics for title screen
-	// and copy the tilemap
-	copy_title_screen_gfx();
-	copy_checkerboard_gfx();
-	draw_title_screen();
-	draw_checkerboard();
+	// load statistics from save memory
+	save_init();
 
 	// setup music driver
-	music_ticks = VGMSWAN_PLAYBACK_FINISHED;
 #ifndef __WONDERFUL_WWITCH__
 	outportb(WS_SOUND_WAVE_BASE_PORT, WS_SOUND_WAVE_BASE_ADDR(&wave_ram));
 #endif
 
 	// initial game state
-	game_state = GAME_TITLE;
-
-	// show title screen
-	outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1_page_2) | WS_SCR_BASE_ADDR2(screen_2));
-	show_title_screen();
-
-	// initial background music
-	current_cvgm = title_screen_cvgm;
+	deal_filter = DEAL_FILTER_ALL;
+	solution_book_open(&attract_reader);
+	enter_title_screen();
 
 	// reenable interrupts
 	enable_interrupts();
@@ -203,16 +677,20 @@ void main()
 	{
 		wait_for_vblank();
 
-		// get keypad state and from the last keypad state
-		// determine if a key has been pressed this frame 
-		// which wasn't pressed last frame
-#ifdef __WONDERFUL_WWITCH__
-		keypad_pushed = key_hit_check();
-		keypad = key_press_check();
-#else
-		keypad = ws_keypad_scan();
-		keypad_pushed = ((keypad ^ keypad_last) & keypad);
-#endif
+		// keys pressed since last frame, along with held
+		// directions repeating
+		keypad_pushed = input_update();
+		keypad = input_held;
+		telemetry_section(TELEMETRY_INPUT);
+
+		// the cursor, the camera and cards in flight carry
+		// on whatever the game is doing
+		tween_update();
+		flight_update();
+		telemetry_section(TELEMETRY_MOTION);
+
+		// moves from the other player in a race
+		race_update();
 
 		// increment the random number seed every frame
 		rnd_val++;
@@ -233,35 +711,43 @@ void main()
 			}
 
 			tics++;
+			title_idle_frames++;
 
+#if LINK
+			// b races another player on the link cable
+			if (keypad_pushed & WS_KEY_B)
+			{
+				disable_interrupts();
+				enter_linking();
+				enable_interrupts();
+			}
+			else
+#endif
 			// wait for a key to be pressed to start the game
 			if (keypad_pushed)
 			{
 				disable_interrupts();
-				hide_screen();
-
-				// copy game graphics
-				copy_card_tile_gfx();
-				copy_text_gfx();
-				copy_you_win_gfx();
-				copy_baize_gfx();
-
-				// reset screen 1 scroll
-				outportb(WS_SCR1_SCRL_X_PORT, 0);
-				outportb(WS_SCR1_SCRL_Y_PORT, 0);
-
-				// draw menu into an offscreen page for screen_2
-				draw_menu();
+				copy_game_gfx();
 
 				// set up new game
-				new_game();
+				rnd_val = find_deal_seed(rnd_val);
+				new_game(rnd_val);
 
 				// game music
-				current_cvgm = entertainer_cvgm;
+				current_cvgm = asset_data(ASSET_ENTERTAINER_CVGM);
 				music_ticks = VGMSWAN_PLAYBACK_FINISHED;
 				
 				enable_interrupts();
 			}
+
+			// show off a solved game after sitting at the title for a while
+			else if (title_idle_frames >= ATTRACT_DELAY)
+			{
+				disable_interrupts();
+				title_idle_frames = 0;
+				start_attract_mode();
+				enable_interrupts();
+			}
 		}
 
 		// game won screen
@@ -273,52 +759,152 @@ void main()
 				tics++;
 			}
 
+			// keep throwing cards while the screen is up
+			if (flights_active == 0)
+			{
+				throw_foundations();
+			}
+
+			// the attract mode goes back to the title screen by itself
+			if (autoplay_mode == AUTOPLAY_ATTRACT && (keypad_pushed || tics == 75))
+			{
+				disable_interrupts();
+				enter_title_screen();
+				enable_interrupts();
+			}
+
 			// wait for a key to be pressed to start a new game
-			if (keypad_pushed && tics == 75)
+			else if (keypad_pushed && tics == 75)
 			{
 				disable_interrupts();
-				current_cvgm = entertainer_cvgm;
+				current_cvgm = asset_data(ASSET_ENTERTAINER_CVGM);
 				music_ticks = VGMSWAN_PLAYBACK_FINISHED;
-				new_game();
+				rnd_val = find_deal_seed(rnd_val);
+				new_game(rnd_val);
 
 				enable_interrupts();
 			}
 		}
 
+#if LINK
+		// waiting for the other player in a race
+		else if (game_state == GAME_LINKING)
+		{
+			// update checkerboard scrolling
+			if (tics % 4 == 0)
+			{
+				checker_scroll_x++;
+				checker_scroll_y++;
+				outportb(WS_SCR1_SCRL_X_PORT, checker_scroll_x);
+				outportb(WS_SCR1_SCRL_Y_PORT, checker_scroll_y);
+			}
+
+			tics++;
+
+			// both sides have agreed on a deal
+			if (race_state == RACE_READY)
+			{
+				disable_interrupts();
+				reset_menu();
+
+				outportb(WS_SCR1_SCRL_X_PORT, 0);
+				outportb(WS_SCR1_SCRL_Y_PORT, 0);
+				new_game(race_seed);
+
+				current_cvgm = asset_data(ASSET_ENTERTAINER_CVGM);
+				music_ticks = VGMSWAN_PLAYBACK_FINISHED;
+				enable_interrupts();
+			}
+
+			// b or start gives up waiting
+			else if (keypad_pushed & (WS_KEY_B | WS_KEY_START))
+			{
+				disable_interrupts();
+				race_leave();
+				enter_title_screen();
+				enable_interrupts();
+			}
+		}
+#endif
+
 		// dealing cards at start of game
 		else if (game_state == GAME_DEALING)
 		{
-			// hide sprites
-			outportb(WS_SPR_COUNT_PORT, 0);
-
 			// still have cards to deal
-			if (deck_count > 0)
+			if (deck_count > DEALT_FREECELLS)
 			{
-				move_top_of_deck_to_cascade(deal_x);		
+				move_top_of_deck_to_cascade(deal_x);
 
-				draw_card_tiles(
-					cascades[deal_x][deal_y], 
-					(deal_x * 3) + 2, 
-					deal_y + 5,
-					1
-				);
+				// it's drawn on the cascade once it lands, which
+				// is before the next card goes to the same cascade
+				fly_card_to(cascades[deal_x][cascade_counts[deal_x] - 1], DEAL_FROM_X, DEAL_FROM_Y, deal_x, FLIGHT_DEAL_FRAMES);
 
 				// move through each cascade in turn
-				deal_x = (deal_x + 1) % 8;
+				deal_x = (deal_x + 1) % CASCADES;
+			}
 
-				// move to next row after going through all cascades
-				if (deal_x == 0)
-				{
-					deal_y++;
-				}
+#if DEALT_FREECELLS > 0
+			// the last few cards go into the freecells
+			else if (deck_count > 0)
+			{
+				deal_x = DEALT_FREECELLS - deck_count;
+				move_top_of_deck_to_freecell(deal_x);
+				fly_card_to(freecells[deal_x][0], DEAL_FROM_X, DEAL_FROM_Y, SOLUTION_FREECELL_0 + deal_x, FLIGHT_DEAL_FRAMES);
 			}
+#endif
 
-			// all cards dealt
-			else
+			// all cards dealt and landed
+			else if (flights_active == 0)
 			{
 				cursor_y = cascade_counts[cursor_x] - 1;
+				game_state = (autoplay_mode != AUTOPLAY_OFF) ? GAME_AUTOPLAY : GAME_INGAME;
+
+				// a long first cascade starts off screen
+				update_game_view();
+			}
+		}
+
+		// playing back a solution from the solution book
+		else if (game_state == GAME_AUTOPLAY)
+		{
+			// any key hands "show me" back to the player
+			if (keypad_pushed && autoplay_mode == AUTOPLAY_SHOW_ME)
+			{
+				if (card_in_hand != NO_CARD)
+				{
+					return_card();
+				}
+
+				autoplay_mode = AUTOPLAY_OFF;
 				game_state = GAME_INGAME;
 			}
+
+			// any key leaves the attract mode, and both modes
+			// stop if the solution runs out without winning
+			else if (keypad_pushed || autoplay_update() == 0)
+			{
+				if (autoplay_mode == AUTOPLAY_ATTRACT)
+				{
+					disable_interrupts();
+					enter_title_screen();
+					enable_interrupts();
+				}
+				else
+				{
+					autoplay_mode = AUTOPLAY_OFF;
+					game_state = GAME_INGAME;
+				}
+			}
+
+			else if (card_in_hand == NO_CARD && check_if_game_won())
+			{
+				you_win();
+			}
+
+			if (game_state == GAME_AUTOPLAY || game_state == GAME_INGAME)
+			{
+				update_game_view();
+			}
 		}
 
 		// ingame menu
@@ -335,6 +921,16 @@ void main()
 
 			tics++;
 
+			// while a deal number is being typed in, only a and start
+			// do what they normally would
+			if (deal_number_cursor != NO_DIGIT)
+			{
+				edit_deal_number();
+				draw_deal_number();
+				draw_deal_best();
+				keypad_pushed &= (WS_KEY_A | WS_KEY_START);
+			}
+
 			// cursor up
 			if (keypad_pushed & WS_KEY_X1)
 			{
@@ -342,45 +938,121 @@ void main()
 
 				if (menu_cursor == 255)
 				{
-					menu_cursor = 2;
+					menu_cursor = MENU_ITEM_COUNT - 1;
 				}
 			}
 			// cursor down
 			else if (keypad_pushed & WS_KEY_X3)
 			{
-				menu_cursor = (menu_cursor + 1) % 3;
+				menu_cursor = (menu_cursor + 1) % MENU_ITEM_COUNT;
 			}
 
-			if (keypad_pushed & WS_KEY_A)
+			// choose which deals new games are picked from
+			if (VARIANT_STANDARD && menu_cursor == MENU_DEALS && (keypad_pushed & (WS_KEY_A | WS_KEY_X2 | WS_KEY_X4)))
+			{
+				if (keypad_pushed & WS_KEY_X4)
+				{
+					deal_filter = (deal_filter == 0) ? (DEAL_FILTER_COUNT - 1) : (deal_filter - 1);
+				}
+				else
+				{
+					deal_filter = (deal_filter + 1) % DEAL_FILTER_COUNT;
+				}
+
+				draw_menu_text(MENU_TEXT_X, MENU_ITEM_ROW(MENU_DEALS), deal_filter_names[deal_filter]);
+			}
+
+			// left or right starts typing in a deal number
+			else if (menu_cursor == MENU_NUMBER && (keypad_pushed & (WS_KEY_X2 | WS_KEY_X4)))
+			{
+				deal_number_cursor = DEAL_NUMBER_DIGITS - 1;
+				draw_deal_number();
+			}
+
+			// watch this deal being solved if it's in the solution book
+			else if (menu_cursor == MENU_SHOW_ME && (keypad_pushed & WS_KEY_A))
+			{
+				solution_reader_t reader;
+
+				if (solution_find_game(&reader, game_seed))
+				{
+					// reset screen 1 scroll
+					outportb(WS_SCR1_SCRL_X_PORT, 0);
+					outportb(WS_SCR1_SCRL_Y_PORT, 0);
+
+					record_abandoned_game();
+
+					disable_interrupts();
+					new_game(game_seed);
+					autoplay_start(AUTOPLAY_SHOW_ME, &reader);
+					game_assisted = 1;
+					enable_interrupts();
+				}
+				else
+				{
+					draw_menu_text(MENU_TEXT_X, MENU_ITEM_ROW(MENU_SHOW_ME), "NOT FOUND");
+				}
+			}
+
+			else if (keypad_pushed & WS_KEY_A)
 			{
 				// reset screen 1 scroll
 				outportb(WS_SCR1_SCRL_X_PORT, 0);
 				outportb(WS_SCR1_SCRL_Y_PORT, 0);
 
 				// Back
-				if (menu_cursor == 2)
+				if (menu_cursor == MENU_BACK)
 				{
 					// change screen_2 base address back to the card screen map
 					outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
 
 					game_state = GAME_INGAME;
+					update_game_view();
 				}
 
 				// new game
-				else if (menu_cursor == 1)
+				else if (menu_cursor == MENU_NEW_GAME)
 				{
+					record_abandoned_game();
+					rnd_val = find_deal_seed(rnd_val);
+
 					disable_interrupts();
-					new_game();
+					new_game(rnd_val);
 					enable_interrupts();
 				}
 
+				// take back the last move
+				else if (menu_cursor == MENU_UNDO)
+				{
+					if (undo_last_move())
+					{
+						outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
+						game_state = GAME_INGAME;
+						update_game_view();
+					}
+					else
+					{
+						draw_menu_message("  NO UNDO   ");
+					}
+				}
+
 				// retry game
-				else if (menu_cursor == 0)
+				else if (menu_cursor == MENU_RETRY)
 				{
-					rnd_val = game_seed;
-					
+					record_abandoned_game();
+
 					disable_interrupts();
-					new_game();
+					new_game(game_seed);
+					enable_interrupts();
+				}
+
+				// deal the number which has been typed in
+				else if (menu_cursor == MENU_NUMBER)
+				{
+					record_abandoned_game();
+
+					disable_interrupts();
+					new_game(get_deal_number());
 					enable_interrupts();
 				}
 			}
@@ -394,11 +1066,12 @@ void main()
 				outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
 
 				game_state = GAME_INGAME;
+				update_game_view();
 			}
 
 			// cursor position
 			sprites[0].x = 152;
-			sprites[0].y = 50 + (menu_cursor << 4);
+			sprites[0].y = (MENU_ITEM_ROW(menu_cursor) << 3) - 6;
 
 			sprites[1].x = sprites[0].x;
 			sprites[1].y = sprites[0].y + 8;
@@ -407,29 +1080,46 @@ void main()
 		// ingame
 		else if (game_state == GAME_INGAME)
 		{
+			// any other button puts the hint away
+			if (keypad_pushed & ~WS_KEY_B)
+			{
+				hint_hide();
+			}
+
 			// pick up or put down a card
 			if (keypad_pushed & WS_KEY_A)
 			{				
 				// no card currently
 				if (card_in_hand == NO_CARD)
 				{
+					moves = move_count;
 					take_card();
+
+					// aces go straight on to the foundations
+					if (card_in_hand != NO_CARD)
+					{
+						sfx_play(SFX_PICK_UP);
+					}
+					else if (move_count != moves)
+					{
+						sfx_play(SFX_PLACE);
+					}
 				}
 				else
 				{
 					place_card();
+					sfx_play((card_in_hand == NO_CARD) ? SFX_PLACE : SFX_INVALID);
 
 					// check if we've won
 					if (check_if_game_won())
 					{
-						set_up_you_win_sprites();
+						if (game_is_recorded())
+						{
+							save_record_game(game_seed, move_count, 1);
+						}
 
-						// change to You Win music
-						current_cvgm = you_win_cvgm;
-						music_ticks = VGMSWAN_PLAYBACK_FINISHED;
-
-						game_state = GAME_WON;
-						tics = 0;
+						race_won();
+						you_win();
 					}
 				}
 			}
@@ -440,129 +1130,81 @@ void main()
 				return_card();
 			}
 
-			// up/down
-			if (keypad_pushed & WS_KEY_X1 || keypad_pushed & WS_KEY_X3)
+			// with no card in hand, b asks for a hint
+			else if (keypad_pushed & WS_KEY_B)
 			{
-				// moving up from the cascades
-				if (cursor_area == AREA_CASCADES)
-				{
-					if (cursor_x < 4)
-					{
-						cursor_area = AREA_FREECELLS;
-					}
-					else
-					{
-						cursor_area = AREA_FOUNDATIONS;
-						cursor_x = cursor_x - 4;
-					}
-
-					cursor_y = 0;
-				}
-				// moving back down to the cascades
-				else
-				{
-					if (cursor_area == AREA_FOUNDATIONS)
-					{
-						cursor_x = cursor_x + 4;
-					}
-
-					cursor_area = AREA_CASCADES;
-					cursor_y = cascade_counts[cursor_x] > 0
-								? cascade_counts[cursor_x] - 1
-								: 0;
-				}
+				hint_show();
 			}
 
-			// move cursor
-			if (keypad_pushed & WS_KEY_X4 || keypad_pushed & WS_KEY_X2)
+			// up/down
+			if (keypad_pushed & (WS_KEY_X1 | WS_KEY_X3))
 			{
-				// left
-				if (keypad_pushed & WS_KEY_X4)
-				{
-					cursor_x = cursor_x - 1;
-				}
-				// right
-				else if (keypad_pushed & WS_KEY_X2)
-				{
-					cursor_x = cursor_x + 1;
-				}
-
-				// moving left and right within the cascades
-				if (cursor_area == AREA_CASCADES)
-				{
-					cursor_x = cursor_x % CASCADES;
-					cursor_y = (cascade_counts[cursor_x] > 0)
-								? (cascade_counts[cursor_x] - 1) 
-								: 0;
-				}
-
-				// moving left and right within the foundations
-				else if (cursor_area == AREA_FOUNDATIONS)
-				{
-					// move into the freecells
-					if (cursor_x == 4)
-					{
-						cursor_x = 0;
-						cursor_area = 0;
-					}
-					else if (cursor_x == 255)
-					{
-						cursor_x = 3;
-						cursor_area = 0;
-					}
-				}
+				move_cursor_up_down((keypad_pushed & WS_KEY_X1) != 0);
+			}
 
-				// moving left and right within the freecells
-				else if (cursor_area == AREA_FREECELLS)
-				{
-					// move into the foundations
-					if (cursor_x == 4)
-					{
-						cursor_area = AREA_FOUNDATIONS;
-						cursor_x = 0;
-						cursor_y = 0;
-					}
-					else if (cursor_x == 255)
-					{
-						cursor_area = AREA_FOUNDATIONS;
-						cursor_x = 3;
-						cursor_y = 0;
-					}
-				}
+			// left/right
+			if (keypad_pushed & (WS_KEY_X2 | WS_KEY_X4))
+			{
+				move_cursor_left_right((keypad_pushed & WS_KEY_X2) != 0);
 			}
 
 			// start button opens the menu
 			if (keypad_pushed & WS_KEY_START)
 			{
-				// change screen_2 base address to the menu screen map
-				outportb(WS_SPR_COUNT_PORT, 2);
-				outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1_page_2) | WS_SCR_BASE_ADDR2(screen_2_page_2));
-				
-				// reset screen 1 scroll
-				outportb(WS_SCR1_SCRL_X_PORT, 0);
-				outportb(WS_SCR1_SCRL_Y_PORT, 0);
+				open_menu(MENU_UNDO, 0);
+			}
 
-				checker_scroll_x = checker_scroll_y = 0;
+			// look for dead ends a little at a time between moves
+			// and offer to undo if the player has got stuck
+			else if (game_state == GAME_INGAME && card_in_hand == NO_CARD)
+			{
+				hint_update();
+
+				switch (deadend_update())
+				{
+					case DEADEND_NO_MOVES:
+						open_menu(MENU_UNDO, "  NO MOVES  ");
+						break;
 
-				menu_cursor = 0;
-				game_state = GAME_MENU;
+					case DEADEND_STUCK:
+						open_menu(MENU_UNDO, "  DEAD END  ");
+						break;
+				}
 			}
 
 			// update cursor and camera position if the state is still ingame
 			if (game_state == GAME_INGAME)
 			{
-				camera_y = (cursor_y < 9) 
-							? 0 
-							: (cursor_y - 9) * 8;
+				update_game_view();
+				hint_draw();
+			}
+		}
 
-				outportb(WS_SCR1_SCRL_Y_PORT, camera_y);
-				outportb(WS_SCR2_SCRL_Y_PORT, camera_y);
+		// save memory is tidied up on screens with time to spare
+		if (game_state == GAME_TITLE || game_state == GAME_MENU || game_state == GAME_WON)
+		{
+			save_update();
+		}
 
-				draw_cursor();
-			}
+		telemetry_section(TELEMETRY_LOGIC);
+
+		// the sprites for cards in flight go after whichever other
+		// sprites are up, all written at once
+		if (game_state == GAME_DEALING)
+		{
+			// the cursor stays hidden while dealing
+			draw_flights(2, 2);
+		}
+		else if (game_state == GAME_WON)
+		{
+			draw_flights(YOU_WIN_SPRITES, 0);
+		}
+		else if (game_state == GAME_INGAME || game_state == GAME_AUTOPLAY)
+		{
+			draw_flights(2 + card_in_hand_tiles_count + hud_count, 0);
 		}
 
-		keypad_last = keypad;
+		telemetry_section(TELEMETRY_SPRITES);
 	}
 
 }
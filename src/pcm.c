@@ -0,0 +1,229 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// streams pcm samples through sound dma, which only the colour
+// hardware has. plain samples are played straight out of rom with no
+// copying, as the dma's 20 bit length covers any sample that fits.
+// packed samples are unpacked into a ring in iram, which the dma plays
+// round and round while the half it isn't playing is refilled, one
+// half a frame at most, so the cost of a refill never changes
+//
+// the music's 0xFB command uses the same dma, so music with samples
+// in it will cut a stream off. streams for channel 2 rely on the music
+// having put it in voice mode, so sound effects like the "you win"
+// jingle go through hyper voice instead, which is kept switched on
+// while they play
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "pcm.h"
+
+// silence for unsigned samples
+#define PCM_SILENCE 0x80
+
+// hyper voice takes unsigned samples at full volume, on both sides
+#define PORT_HYPERV_CTRL 0x6A
+#define PORT_HYPERV_CHAN_CTRL 0x6B
+#define HYPERV_ENABLE 0x80
+#define HYPERV_BOTH_SIDES 0x60
+
+enum pcm_modes {
+  PCM_OFF = 0,
+  PCM_ROM,
+  PCM_RING
+};
+
+// what each 4 bit code adds to the last sample
+static const int8_t __wf_rom pcm_deltas[16] = {
+    0, 1, 2, 4, 8, 16, 32, 64,
+    -1, -2, -4, -8, -16, -32, -64, -128
+};
+
+static uint8_t pcm_ring[PCM_RING_SIZE];
+
+static uint8_t pcm_mode;
+static uint8_t pcm_ctrl;
+
+// packed stream being unpacked into the ring
+static const uint8_t __far* pcm_ptr;
+static uint32_t pcm_remaining;
+static uint8_t pcm_sample;
+// half of the ring which is due to be filled next
+static uint8_t pcm_fill_half;
+// halves left to play after the stream has run out
+static uint8_t pcm_tail;
+
+static uint32_t linear_address(const void __far* ptr)
+{
+    return ((uint32_t) FP_SEG(ptr) << 4) + FP_OFF(ptr);
+}
+
+static void arm_dma(uint32_t source, uint32_t length, uint8_t ctrl)
+{
+    outportb(WS_SDMA_CTRL_PORT, 0);
+    outportw(WS_SDMA_SOURCE_L_PORT, source);
+    outportb(WS_SDMA_SOURCE_H_PORT, source >> 16);
+    outportw(WS_SDMA_LENGTH_L_PORT, length);
+    outportb(WS_SDMA_LENGTH_H_PORT, length >> 16);
+    outportb(WS_SDMA_CTRL_PORT, ctrl);
+}
+
+// unpack the next half of the ring
+// pads the rest of it with silence once the stream runs out
+static void fill_half()
+{
+    uint8_t *out = pcm_ring + (pcm_fill_half ? PCM_RING_HALF : 0);
+    uint8_t count, i, packed = 0;
+
+    count = (pcm_remaining < PCM_RING_HALF) ? pcm_remaining : PCM_RING_HALF;
+    pcm_remaining -= count;
+
+    // stepping a far pointer only changes its offset, which would wrap
+    // round to the start of the segment on a stream over 64KB. moving
+    // whole paragraphs into the segment first leaves the offset small
+    // enough that a fill can't get to the end of it
+    pcm_ptr = MK_FP(FP_SEG(pcm_ptr) + (FP_OFF(pcm_ptr) >> 4), FP_OFF(pcm_ptr) & 0xf);
+
+    for (i = 0; i < count; i++)
+    {
+        if ((i & 1) == 0)
+        {
+            packed = *(pcm_ptr++);
+        }
+        else
+        {
+            packed >>= 4;
+        }
+
+        pcm_sample += pcm_deltas[packed & 0xf];
+        out[i] = pcm_sample;
+    }
+
+    for (; i < PCM_RING_HALF; i++)
+    {
+        out[i] = PCM_SILENCE;
+    }
+
+    pcm_fill_half ^= 1;
+}
+
+// start playing a stream, stopping whatever was playing
+// returns 0 if there's no sound dma to play it with
+uint8_t pcm_play(const uint8_t __far* stream)
+{
+#ifdef __WONDERFUL_WWITCH__
+    return 0;
+#else
+    uint32_t length;
+
+    pcm_stop();
+
+    if (!ws_system_is_color_active())
+    {
+        return 0;
+    }
+
+    pcm_ctrl = stream[0] & ~(PCM_SDMA_ENABLE | PCM_SDMA_REPEAT);
+    length = ((const uint16_t __far*) stream)[1] | ((uint32_t) ((const uint16_t __far*) stream)[2] << 16);
+
+    if (length == 0)
+    {
+        return 1;
+    }
+
+    if (pcm_ctrl & PCM_SDMA_HYPER_VOICE)
+    {
+        outportb(PORT_HYPERV_CHAN_CTRL, HYPERV_BOTH_SIDES);
+        outportb(PORT_HYPERV_CTRL, HYPERV_ENABLE);
+    }
+
+    if (!(stream[1] & PCM_FLAG_DELTA))
+    {
+        // the samples can be played where they are
+        arm_dma(linear_address(stream + PCM_HEADER_SIZE), length, pcm_ctrl | PCM_SDMA_ENABLE);
+        pcm_mode = PCM_ROM;
+        return 1;
+    }
+
+    pcm_ptr = stream + PCM_HEADER_SIZE;
+    pcm_remaining = length;
+    pcm_sample = PCM_SILENCE;
+    pcm_fill_half = 0;
+    pcm_tail = 0;
+
+    fill_half();
+    fill_half();
+
+    arm_dma(linear_address(pcm_ring), PCM_RING_SIZE, pcm_ctrl | PCM_SDMA_ENABLE | PCM_SDMA_REPEAT);
+    pcm_mode = PCM_RING;
+    return 1;
+#endif
+}
+
+void pcm_stop()
+{
+    if (pcm_mode != PCM_OFF)
+    {
+        outportb(WS_SDMA_CTRL_PORT, 0);
+        pcm_mode = PCM_OFF;
+
+        if (pcm_ctrl & PCM_SDMA_HYPER_VOICE)
+        {
+            outportb(PORT_HYPERV_CTRL, 0);
+        }
+    }
+}
+
+uint8_t pcm_playing()
+{
+    return pcm_mode != PCM_OFF;
+}
+
+// keep the stream going
+// should be called once a frame
+void pcm_update()
+{
+    uint16_t left;
+    uint8_t playing_half;
+
+    if (pcm_mode == PCM_OFF)
+    {
+        return;
+    }
+
+    // the dma turns itself off at the end of a rom stream,
+    // or when the music plays a sample over the top
+    if (!(inportb(WS_SDMA_CTRL_PORT) & PCM_SDMA_ENABLE))
+    {
+        pcm_stop();
+        return;
+    }
+
+    if (pcm_mode != PCM_RING)
+    {
+        return;
+    }
+
+    // the dma's length counts down to the end of the ring
+    left = inportw(WS_SDMA_LENGTH_L_PORT);
+    playing_half = (left > PCM_RING_HALF) ? 0 : 1;
+
+    // the half due to be filled is still being played
+    if (playing_half == pcm_fill_half)
+    {
+        return;
+    }
+
+    // nothing left to unpack, so stop once what's in the ring has played
+    if (pcm_remaining == 0)
+    {
+        if (++pcm_tail >= 2)
+        {
+            pcm_stop();
+            return;
+        }
+    }
+
+    fill_half();
+}
@@ -0,0 +1,521 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the race between two players on the same deal over the link cable
+//
+// each side says hello with the deal it would like to play until it
+// hears back, then both deal the one they agree on. from then on every
+// move is sent as a few bytes and played on a copy of the other side's
+// board, which is only there to show how many cards they've put up and
+// to check against the board hashes they send. a move which can't be
+// played on the copy, or a hash which doesn't match it, means a record
+// has gone missing and the copy can't be trusted any more, but the race
+// carries on as the win is sent as a record of its own
+//
+// records only go into the link's buffer, so the game never waits for
+// the other side, and the ones which have come in are read once a frame
+
+#include <stdint.h>
+#include <string.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "card.h"
+#include "draw.h"
+#include "race.h"
+#include "solution.h"
+#include "zobrist.h"
+
+#if LINK
+
+// longest record, type included
+#define RACE_MAX_RECORD 8
+
+// cards are a suit in the high nibble and a value in the low one
+#define CARD_SLOTS 64
+
+static const uint8_t __wf_rom record_lengths[] = RACE_RECORD_LENGTHS;
+
+uint8_t race_state;
+uint8_t race_desynced;
+uint8_t race_send_failed;
+uint32_t race_seed;
+uint8_t race_opponent_cards;
+
+static uint16_t race_nonce;
+static uint8_t hello_timer;
+
+// the record coming in is put together here a byte at a time
+static uint8_t record[RACE_MAX_RECORD];
+static uint8_t record_have;
+static uint8_t record_want;
+
+static uint16_t moves_sent;
+static uint8_t moves_unchecked;
+
+// set while the win is still to go out, see race_won
+static uint8_t win_unsent;
+
+// the copy of the other player's board. cascades are kept as the card
+// under each card, so they take a byte per card rather than a byte for
+// every place a card could be
+static uint8_t opponent_below[CARD_SLOTS];
+static uint8_t opponent_tops[CASCADES];
+static uint8_t opponent_freecells[FREECELLS];
+static uint8_t opponent_foundations[FOUNDATIONS];
+static uint32_t opponent_hash;
+static uint16_t opponent_moves;
+
+// set when what the opponent display shows has changed
+static uint8_t hud_dirty;
+
+// returns 0 if the record didn't fit in the link's buffer
+static uint8_t send(const uint8_t *bytes)
+{
+    // a record which doesn't fit is lost, so the other side's copy of
+    // this board won't match it any more. it finds that out from the
+    // next board hash, this side's copy of the other board is still fine
+    if (!link_put(bytes, record_lengths[bytes[0] - RACE_FIRST_RECORD]))
+    {
+        race_send_failed = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+static void send_hello()
+{
+    uint8_t hello[8];
+
+    hello[0] = RACE_HELLO;
+    hello[1] = RACE_VERSION;
+    hello[2] = race_nonce;
+    hello[3] = race_nonce >> 8;
+    hello[4] = race_seed;
+    hello[5] = race_seed >> 8;
+    hello[6] = race_seed >> 16;
+    hello[7] = race_seed >> 24;
+
+    send(hello);
+}
+
+static void send_win()
+{
+    uint8_t win[3];
+
+    win[0] = RACE_WIN;
+    win[1] = moves_sent;
+    win[2] = moves_sent >> 8;
+
+    win_unsent = !send(win);
+}
+
+static void send_check()
+{
+    uint8_t check[7];
+
+    check[0] = RACE_CHECK;
+    check[1] = moves_sent;
+    check[2] = moves_sent >> 8;
+    check[3] = board_hash;
+    check[4] = board_hash >> 8;
+    check[5] = board_hash >> 16;
+    check[6] = board_hash >> 24;
+
+    send(check);
+    moves_unchecked = 0;
+}
+
+// zobrist location for a card going on top of a cascade
+static uint8_t opponent_cascade_location(uint8_t cascade)
+{
+    return (opponent_tops[cascade] != NO_CARD)
+        ? opponent_tops[cascade]
+        : ZOBRIST_CASCADE_BOTTOM;
+}
+
+// the card which can be moved from a location
+static uint8_t opponent_top(uint8_t location, uint8_t card)
+{
+    uint8_t count;
+
+    if (location < CASCADES)
+    {
+        return opponent_tops[location];
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        count = opponent_foundations[card >> 4];
+        return (count > 0) ? ((card & 0xf0) | (count - 1)) : NO_CARD;
+    }
+    else if (location < SOLUTION_FREECELL_0 + FREECELLS)
+    {
+        return opponent_freecells[location - SOLUTION_FREECELL_0];
+    }
+
+    return NO_CARD;
+}
+
+// returns 0 if the card can't go there
+static uint8_t opponent_drop(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        opponent_hash ^= ZOBRIST_KEY(card, opponent_cascade_location(location));
+        opponent_below[card] = opponent_tops[location];
+        opponent_tops[location] = card;
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        if (opponent_foundations[card >> 4] != (card & 0xf))
+        {
+            return 0;
+        }
+
+        opponent_foundations[card >> 4]++;
+        opponent_hash ^= ZOBRIST_KEY(card, ZOBRIST_FOUNDATION);
+        race_opponent_cards++;
+    }
+    else if (location < SOLUTION_FREECELL_0 + FREECELLS
+        && opponent_freecells[location - SOLUTION_FREECELL_0] == NO_CARD)
+    {
+        opponent_freecells[location - SOLUTION_FREECELL_0] = card;
+        opponent_hash ^= ZOBRIST_KEY(card, ZOBRIST_FREECELL);
+    }
+    else
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+static void opponent_lift(uint8_t location, uint8_t card)
+{
+    if (location < CASCADES)
+    {
+        opponent_tops[location] = opponent_below[card];
+        opponent_hash ^= ZOBRIST_KEY(card, opponent_cascade_location(location));
+    }
+    else if (location == SOLUTION_FOUNDATION)
+    {
+        opponent_foundations[card >> 4]--;
+        opponent_hash ^= ZOBRIST_KEY(card, ZOBRIST_FOUNDATION);
+        race_opponent_cards--;
+    }
+    else
+    {
+        opponent_freecells[location - SOLUTION_FREECELL_0] = NO_CARD;
+        opponent_hash ^= ZOBRIST_KEY(card, ZOBRIST_FREECELL);
+    }
+}
+
+// deal the copy the same way the game is dealt, with the deck still full
+static void opponent_deal()
+{
+    uint8_t i;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        opponent_tops[i] = NO_CARD;
+    }
+
+    for (i = 0; i < FREECELLS; i++)
+    {
+        opponent_freecells[i] = NO_CARD;
+    }
+
+    for (i = 0; i < FOUNDATIONS; i++)
+    {
+        opponent_foundations[i] = 0;
+    }
+
+    opponent_hash = 0;
+    opponent_moves = 0;
+    race_opponent_cards = 0;
+
+    // round the cascades from the top of the deck, then the last few
+    // cards go into the freecells
+    for (i = 0; i < 52 - DEALT_FREECELLS; i++)
+    {
+        opponent_drop(i % CASCADES, deck[51 - i]);
+    }
+
+    for (i = 0; i < DEALT_FREECELLS; i++)
+    {
+        opponent_drop(SOLUTION_FREECELL_0 + i, deck[DEALT_FREECELLS - 1 - i]);
+    }
+}
+
+static void opponent_move(uint8_t source, uint8_t dest, uint8_t card)
+{
+    opponent_moves++;
+
+    if ((card & 0xf) > 12 || (card >> 4) >= FOUNDATIONS || opponent_top(source, card) != card)
+    {
+        race_desynced = 1;
+        return;
+    }
+
+    opponent_lift(source, card);
+
+    if (!opponent_drop(dest, card))
+    {
+        race_desynced = 1;
+    }
+}
+
+static void receive()
+{
+    solution_move_t move;
+    uint16_t nonce;
+    uint32_t value;
+
+    switch (record[0])
+    {
+    case RACE_HELLO:
+        // a hello from another build of the game is ignored, and once
+        // a deal has been agreed on any more are left over from that
+        if (race_state != RACE_LINKING || record[1] != RACE_VERSION)
+        {
+            break;
+        }
+
+        nonce = record[2] | (record[3] << 8);
+        value = record[4] | (record[5] << 8) | ((uint32_t) record[6] << 16) | ((uint32_t) record[7] << 24);
+
+        if (nonce > race_nonce || (nonce == race_nonce && value > race_seed))
+        {
+            race_seed = value;
+        }
+
+        // the other side might have missed the hellos sent before it
+        // was listening, but it's listening for this one
+        send_hello();
+        race_state = RACE_READY;
+        break;
+
+    case RACE_MOVE:
+        if (race_state >= RACE_RACING)
+        {
+            memcpy(&move, &record[1], sizeof(move));
+            opponent_move(SOLUTION_MOVE_SOURCE(move), SOLUTION_MOVE_DEST(move), record[1 + sizeof(move)]);
+            hud_dirty = 1;
+        }
+        break;
+
+    case RACE_CHECK:
+        value = record[3] | (record[4] << 8) | ((uint32_t) record[5] << 16) | ((uint32_t) record[6] << 24);
+
+        if (race_state >= RACE_RACING
+            && ((record[1] | (record[2] << 8)) != opponent_moves || value != opponent_hash))
+        {
+            race_desynced = 1;
+            hud_dirty = 1;
+        }
+        break;
+
+    case RACE_WIN:
+        if (race_state == RACE_RACING)
+        {
+            race_state = RACE_LOST;
+            hud_dirty = 1;
+        }
+        break;
+
+    case RACE_QUIT:
+        if (race_state == RACE_RACING)
+        {
+            race_state = RACE_ABANDONED;
+            hud_dirty = 1;
+        }
+        break;
+    }
+}
+
+// show how far the other player has got, or how the race ended
+static void update_hud()
+{
+    char text[HUD_SPRITES + 1];
+
+    hud_dirty = 0;
+
+    switch (race_state)
+    {
+    case RACE_RACING:
+        text[0] = 'V';
+        text[1] = 'S';
+        text[2] = race_desynced ? '?' : ('0' + (race_opponent_cards / 10));
+        text[3] = race_desynced ? '?' : ('0' + (race_opponent_cards % 10));
+        text[4] = 0;
+        draw_hud(text);
+        break;
+
+    case RACE_LOST:
+        draw_hud("LOST");
+        break;
+
+    case RACE_ABANDONED:
+        draw_hud("GONE");
+        break;
+
+    default:
+        draw_hud("");
+        break;
+    }
+}
+
+// start saying hello with a deal to play, with the cpu's interrupts
+// disabled. nonce should be different each time, e.g. the frame count
+void race_link(uint32_t seed, uint16_t nonce)
+{
+    link_open();
+
+    race_state = RACE_LINKING;
+    race_desynced = 0;
+    race_send_failed = 0;
+    race_seed = seed;
+    race_nonce = nonce;
+    record_have = 0;
+
+    send_hello();
+    hello_timer = RACE_HELLO_FRAMES;
+}
+
+// the deal has just been put in the deck for a new game. the deal the
+// race agreed on starts it, anything else means leaving the race
+void race_deal()
+{
+    if (race_state != RACE_READY)
+    {
+        race_leave();
+        return;
+    }
+
+    opponent_deal();
+
+    moves_sent = 0;
+    moves_unchecked = 0;
+    race_state = RACE_RACING;
+    hud_dirty = 1;
+}
+
+// stop racing, and let the other side know if it's still going
+// with the cpu's interrupts disabled
+void race_leave()
+{
+    uint8_t quit = RACE_QUIT;
+
+    if (race_state == RACE_OFF)
+    {
+        return;
+    }
+
+    if (race_state == RACE_RACING)
+    {
+        send(&quit);
+    }
+
+    link_close();
+    race_state = RACE_OFF;
+    update_hud();
+}
+
+// read what's come in and send anything which is due, once a frame
+void race_update()
+{
+    uint8_t byte;
+
+    if (race_state == RACE_OFF)
+    {
+        return;
+    }
+
+    // anything after the hello which agreed on the deal waits until
+    // it has been dealt
+    while (race_state != RACE_READY && link_get(&byte))
+    {
+        if (record_have == 0)
+        {
+            // look for the start of a record, skipping anything else
+            if (byte < RACE_FIRST_RECORD || byte > RACE_LAST_RECORD)
+            {
+                continue;
+            }
+
+            record_want = record_lengths[byte - RACE_FIRST_RECORD];
+        }
+
+        record[record_have++] = byte;
+
+        if (record_have == record_want)
+        {
+            receive();
+            record_have = 0;
+        }
+    }
+
+    // keep saying hello until the other side answers
+    if (race_state == RACE_LINKING && --hello_timer == 0)
+    {
+        send_hello();
+        hello_timer = RACE_HELLO_FRAMES;
+    }
+
+    // the board hash only covers every card while none is in hand
+    if (race_state == RACE_RACING && moves_unchecked >= RACE_CHECK_MOVES && card_in_hand == NO_CARD)
+    {
+        send_check();
+    }
+
+    // the other side can't tell the race is over without the win
+    if (race_state == RACE_WON && win_unsent)
+    {
+        send_win();
+    }
+
+    if (hud_dirty)
+    {
+        update_hud();
+    }
+}
+
+// a move the player has made, or undone, in the solution book's format
+void race_move(uint8_t source, uint8_t dest, uint8_t card)
+{
+    solution_move_t packed = SOLUTION_MOVE(source, dest);
+    uint8_t move[RACE_MAX_RECORD];
+
+    if (race_state != RACE_RACING)
+    {
+        return;
+    }
+
+    // both sides are the same build, so the move goes as it's kept
+    move[0] = RACE_MOVE;
+    memcpy(&move[1], &packed, sizeof(packed));
+    move[1 + sizeof(packed)] = card;
+
+    send(move);
+    moves_sent++;
+    moves_unchecked++;
+}
+
+// the player has won, which the other side checks the whole board for
+// before it hears about it
+void race_won()
+{
+    if (race_state != RACE_RACING)
+    {
+        return;
+    }
+
+    // a win which doesn't fit goes again each frame until it does
+    send_check();
+    send_win();
+
+    race_state = RACE_WON;
+    hud_dirty = 1;
+}
+
+#endif
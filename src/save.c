@@ -0,0 +1,462 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// statistics are kept as an append-only log of game records in
+// cartridge save memory, so finishing a game only ever writes one
+// 4 byte record. the header totals are only rewritten when the log
+// fills up and gets compacted, which keeps eeprom writes to a minimum
+//
+// there are two headers, each with a log of its own. compaction writes
+// the squashed log into the other half of save memory, then commits to
+// it by writing that half's header with the next sequence number. the
+// newest header which checks out is the one in use, so losing power
+// part way through leaves the old header and log as they were
+//
+// compaction is done a record at a time by save_update on frames with
+// time to spare, as eeprom writes are slow enough to stall a frame
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "save.h"
+
+#define SAVE_MAGIC 0x4357
+#define SAVE_VERSION 1
+
+// header layout, in words
+#define HEADER_MAGIC 0
+#define HEADER_VERSION 1
+#define HEADER_SEQUENCE 2
+#define HEADER_PLAYED 3
+#define HEADER_WON 4
+#define HEADER_STREAK 5
+#define HEADER_BEST_STREAK 6
+#define HEADER_CHECKSUM 7
+#define HEADER_WORDS 8
+
+// both headers, then both logs
+#define SAVE_WORDS ((HEADER_WORDS + (SAVE_LOG_RECORDS << 1)) << 1)
+
+#if defined(SAVE_EEPROM_WORDS) && SAVE_WORDS > SAVE_EEPROM_WORDS
+#error the statistics log is too big for the eeprom
+#endif
+
+// each record is two words: the seed, then the info word
+// the info word is written last, and its top bit stays set
+// until it is written, so a half written record is never valid
+#define RECORD_INVALID 0x8000
+#define RECORD_WON 0x4000
+// records rewritten by compaction only keep the best move count
+// for a seed and don't count towards the totals
+#define RECORD_BEST_ONLY 0x2000
+#define RECORD_MOVES_MASK 0x0fff
+
+#define INDEX_EMPTY 0xff
+
+// compaction starts once the log is this full, and leaves it half full
+#define COMPACT_FROM (SAVE_LOG_RECORDS * 3 / 4)
+
+enum compact_stages {
+  COMPACT_IDLE = 0,
+  // copying the best wins into the other log
+  COMPACT_COPY,
+  // erasing the rest of the other log
+  COMPACT_ERASE
+};
+
+save_stats_t save_stats;
+
+// index of the record holding the best win for each seed
+static uint8_t save_index[SAVE_INDEX_SIZE];
+static uint8_t save_log_count;
+
+// the header in use, which goes with the log of the same number
+static uint8_t save_half;
+static uint16_t save_sequence;
+
+static uint8_t compact_stage;
+// the next record to copy, or to erase once copying is done
+static uint8_t compact_slot;
+static uint8_t compact_write_slot;
+static uint8_t compact_skip;
+
+#ifdef __WONDERFUL_WWITCH__
+
+// the save ram belongs to the os filesystem under wonderwitch
+// so the log is kept in ram and only lasts for the current session
+static uint16_t save_ram[SAVE_WORDS];
+
+static uint16_t save_read_word(uint16_t address)
+{
+    return save_ram[address];
+}
+
+static void save_write_word(uint16_t address, uint16_t value)
+{
+    save_ram[address] = value;
+}
+
+#elif defined(SAVE_EEPROM_WORDS)
+
+static ws_eeprom_handle_t save_eeprom;
+
+static uint16_t save_read_word(uint16_t address)
+{
+    return ws_eeprom_read_word(save_eeprom, address << 1);
+}
+
+static void save_write_word(uint16_t address, uint16_t value)
+{
+    // skip writes which wouldn't change anything to save wear
+    if (ws_eeprom_read_word(save_eeprom, address << 1) != value)
+    {
+        ws_eeprom_write_word(save_eeprom, address << 1, value);
+    }
+}
+
+#else
+
+static uint16_t save_read_word(uint16_t address)
+{
+    return ((const uint16_t __far*) WS_SRAM_MEM)[address];
+}
+
+static void save_write_word(uint16_t address, uint16_t value)
+{
+    ((uint16_t __far*) WS_SRAM_MEM)[address] = value;
+}
+
+#endif
+
+static inline uint16_t header_address(uint8_t half)
+{
+    return half ? HEADER_WORDS : 0;
+}
+
+static inline uint16_t log_record_address(uint8_t half, uint8_t slot)
+{
+    return (HEADER_WORDS << 1) + (half ? (SAVE_LOG_RECORDS << 1) : 0) + (slot << 1);
+}
+
+// records in the log which is in use
+static inline uint16_t record_address(uint8_t slot)
+{
+    return log_record_address(save_half, slot);
+}
+
+static uint16_t header_checksum(uint8_t half)
+{
+    uint8_t i;
+    uint16_t checksum = SAVE_MAGIC;
+
+    for (i = HEADER_SEQUENCE; i < HEADER_CHECKSUM; i++)
+    {
+        checksum = (checksum << 1 | checksum >> 15) ^ save_read_word(header_address(half) + i);
+    }
+
+    return checksum;
+}
+
+static uint8_t header_valid(uint8_t half)
+{
+    uint16_t address = header_address(half);
+
+    return save_read_word(address + HEADER_MAGIC) == SAVE_MAGIC &&
+        save_read_word(address + HEADER_VERSION) == SAVE_VERSION &&
+        save_read_word(address + HEADER_CHECKSUM) == header_checksum(half);
+}
+
+// the magic is cleared first and written last
+// so the header can't check out until it's all there
+static void write_header(uint8_t half, uint16_t sequence)
+{
+    uint16_t address = header_address(half);
+
+    save_write_word(address + HEADER_MAGIC, 0);
+    save_write_word(address + HEADER_VERSION, SAVE_VERSION);
+    save_write_word(address + HEADER_SEQUENCE, sequence);
+    save_write_word(address + HEADER_PLAYED, save_stats.games_played);
+    save_write_word(address + HEADER_WON, save_stats.games_won);
+    save_write_word(address + HEADER_STREAK, save_stats.current_streak);
+    save_write_word(address + HEADER_BEST_STREAK, save_stats.best_streak);
+    save_write_word(address + HEADER_CHECKSUM, header_checksum(half));
+    save_write_word(address + HEADER_MAGIC, SAVE_MAGIC);
+}
+
+// mark a record as unwritten
+static void erase_record(uint8_t half, uint8_t slot)
+{
+    if (save_read_word(log_record_address(half, slot) + 1) != 0xffff)
+    {
+        save_write_word(log_record_address(half, slot) + 1, 0xffff);
+    }
+}
+
+static uint8_t index_hash(uint16_t seed)
+{
+    return (seed ^ (seed >> 8)) & (SAVE_INDEX_SIZE - 1);
+}
+
+// find the index slot for a seed, which is either the slot
+// already holding it or the empty slot where it would go
+static uint8_t index_find(uint16_t seed)
+{
+    uint8_t i = index_hash(seed);
+
+    while (save_index[i] != INDEX_EMPTY)
+    {
+        if (save_read_word(record_address(save_index[i])) == seed)
+        {
+            break;
+        }
+
+        i = (i + 1) & (SAVE_INDEX_SIZE - 1);
+    }
+
+    return i;
+}
+
+// account for a record in the stats and the index
+static void apply_record(uint8_t slot, uint16_t seed, uint16_t info)
+{
+    uint8_t i;
+
+    if (!(info & RECORD_BEST_ONLY))
+    {
+        save_stats.games_played++;
+
+        if (info & RECORD_WON)
+        {
+            save_stats.games_won++;
+            save_stats.current_streak++;
+
+            if (save_stats.current_streak > save_stats.best_streak)
+            {
+                save_stats.best_streak = save_stats.current_streak;
+            }
+        }
+        else
+        {
+            save_stats.current_streak = 0;
+        }
+    }
+
+    if (info & RECORD_WON)
+    {
+        i = index_find(seed);
+
+        if (
+            save_index[i] == INDEX_EMPTY ||
+            (info & RECORD_MOVES_MASK) < (save_read_word(record_address(save_index[i]) + 1) & RECORD_MOVES_MASK)
+        )
+        {
+            save_index[i] = slot;
+        }
+    }
+}
+
+// rebuild the stats and the index by replaying the log
+static void load_log()
+{
+    uint16_t i;
+    uint16_t info;
+    uint16_t header = header_address(save_half);
+
+    for (i = 0; i < SAVE_INDEX_SIZE; i++)
+    {
+        save_index[i] = INDEX_EMPTY;
+    }
+
+    save_sequence = save_read_word(header + HEADER_SEQUENCE);
+    save_stats.games_played = save_read_word(header + HEADER_PLAYED);
+    save_stats.games_won = save_read_word(header + HEADER_WON);
+    save_stats.current_streak = save_read_word(header + HEADER_STREAK);
+    save_stats.best_streak = save_read_word(header + HEADER_BEST_STREAK);
+
+    for (save_log_count = 0; save_log_count < SAVE_LOG_RECORDS; save_log_count++)
+    {
+        info = save_read_word(record_address(save_log_count) + 1);
+
+        if (info & RECORD_INVALID)
+        {
+            break;
+        }
+
+        apply_record(save_log_count, save_read_word(record_address(save_log_count)), info);
+    }
+}
+
+// squash the log down to the best win for each seed, into the other
+// half of save memory. totals for the removed records are folded into
+// that half's header, which is written last to switch over to it
+static void compact_start()
+{
+    uint16_t i;
+    uint8_t kept = 0;
+
+    // each seed which has been won has one record kept for it
+    for (i = 0; i < SAVE_INDEX_SIZE; i++)
+    {
+        if (save_index[i] != INDEX_EMPTY)
+        {
+            kept++;
+        }
+    }
+
+    // if compaction wouldn't free up enough space, drop the oldest ones
+    compact_skip = (kept > (SAVE_LOG_RECORDS / 2)) ? (kept - (SAVE_LOG_RECORDS / 2)) : 0;
+
+    compact_slot = 0;
+    compact_write_slot = 0;
+    compact_stage = COMPACT_COPY;
+}
+
+// copy or erase one record, or switch over once it's all done
+static void compact_step()
+{
+    uint8_t half = save_half ^ 1;
+    uint16_t seed;
+
+    if (compact_stage == COMPACT_COPY)
+    {
+        seed = save_read_word(record_address(compact_slot));
+
+        // only the best win for a seed is in the index
+        if (save_index[index_find(seed)] == compact_slot)
+        {
+            if (compact_skip > 0)
+            {
+                compact_skip--;
+            }
+            else
+            {
+                save_write_word(log_record_address(half, compact_write_slot), seed);
+                save_write_word(log_record_address(half, compact_write_slot) + 1, save_read_word(record_address(compact_slot) + 1) | RECORD_BEST_ONLY);
+                compact_write_slot++;
+            }
+        }
+
+        if (++compact_slot >= save_log_count)
+        {
+            compact_slot = compact_write_slot;
+            compact_stage = COMPACT_ERASE;
+        }
+    }
+    else if (compact_slot < SAVE_LOG_RECORDS)
+    {
+        erase_record(half, compact_slot++);
+    }
+    else
+    {
+        write_header(half, save_sequence + 1);
+
+        save_half = half;
+        load_log();
+        compact_stage = COMPACT_IDLE;
+    }
+}
+
+void save_init()
+{
+    uint8_t valid, slot;
+
+#if defined(SAVE_EEPROM_WORDS) && !defined(__WONDERFUL_WWITCH__)
+    save_eeprom = ws_eeprom_handle_cartridge(SAVE_EEPROM_BITS);
+    ws_eeprom_write_unlock(save_eeprom);
+#endif
+
+    valid = header_valid(0) | (header_valid(1) << 1);
+
+    if (valid == 3)
+    {
+        // both check out, so the newer one was written last
+        save_half = (int16_t) (save_read_word(header_address(1) + HEADER_SEQUENCE) -
+            save_read_word(header_address(0) + HEADER_SEQUENCE)) > 0;
+    }
+    else if (valid)
+    {
+        save_half = valid >> 1;
+    }
+    else
+    {
+        // format save memory if it doesn't hold a valid log
+        save_stats.games_played = 0;
+        save_stats.games_won = 0;
+        save_stats.current_streak = 0;
+        save_stats.best_streak = 0;
+
+        save_half = 0;
+
+        for (slot = 0; slot < SAVE_LOG_RECORDS; slot++)
+        {
+            erase_record(0, slot);
+        }
+
+        write_header(0, 0);
+    }
+
+    load_log();
+}
+
+void save_record_game(uint16_t seed, uint16_t moves, uint8_t won)
+{
+    uint16_t info;
+
+    // a new record changes what compaction would copy, so it starts
+    // over later, unless the log is full and it has to be finished now
+    if (save_log_count >= SAVE_LOG_RECORDS)
+    {
+        if (compact_stage == COMPACT_IDLE)
+        {
+            compact_start();
+        }
+
+        while (compact_stage != COMPACT_IDLE)
+        {
+            compact_step();
+        }
+    }
+    else
+    {
+        compact_stage = COMPACT_IDLE;
+    }
+
+    info = (moves > RECORD_MOVES_MASK) ? RECORD_MOVES_MASK : moves;
+
+    if (won)
+    {
+        info |= RECORD_WON;
+    }
+
+    // seed first, the info word makes the record valid
+    save_write_word(record_address(save_log_count), seed);
+    save_write_word(record_address(save_log_count) + 1, info);
+
+    apply_record(save_log_count, seed, info);
+    save_log_count++;
+}
+
+uint16_t save_get_best_moves(uint16_t seed)
+{
+    uint8_t i = index_find(seed);
+
+    if (save_index[i] == INDEX_EMPTY)
+    {
+        return SAVE_NO_BEST;
+    }
+
+    return save_read_word(record_address(save_index[i]) + 1) & RECORD_MOVES_MASK;
+}
+
+// do a little of any compaction the log needs
+void save_update()
+{
+    if (compact_stage != COMPACT_IDLE)
+    {
+        compact_step();
+    }
+    else if (save_log_count >= COMPACT_FROM)
+    {
+        compact_start();
+    }
+}
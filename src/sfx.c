@@ -0,0 +1,133 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// sound effects, played over the music on a channel borrowed from it
+// effects are tiny cvgm fragments run by the same driver as the music,
+// once a frame alongside it. the music keeps playing the borrowed
+// channel into a copy of its state, which is put back when the effect
+// is finished, so it never falls out of step
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "sfx.h"
+#include "vgm.h"
+
+// cvgm commands for writing to the effect channel
+#define SFX_WAVE (SFX_CHANNEL << 4), 16
+#define SFX_FREQUENCY(value) ((0x80 + (SFX_CHANNEL * 2)) ^ 0xE0), ((value) & 0xff), ((value) >> 8)
+#define SFX_VOLUME(value) ((0x88 + SFX_CHANNEL) ^ 0xC0), (value)
+#define SFX_WAIT(frames) (0xEF + (frames))
+#define SFX_END 0xF9, 0xFF, 0xFF
+
+#define SFX_CH_CTRL_PORT 0x90
+
+// frequency register value for a pitch in hz
+#define SFX_HZ(hz) (2048 - (96000 / (hz)))
+
+#define SFX_SQUARE_WAVE \
+    SFX_WAVE, \
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+// pick up, a short rising blip
+#define SFX_PICK_UP_DATA \
+    SFX_SQUARE_WAVE, \
+    SFX_FREQUENCY(SFX_HZ(880)), SFX_VOLUME(0xaa), SFX_WAIT(2), \
+    SFX_FREQUENCY(SFX_HZ(1320)), SFX_VOLUME(0x77), SFX_WAIT(2), \
+    SFX_VOLUME(0x00), SFX_END
+
+// place, a low falling thunk
+#define SFX_PLACE_DATA \
+    SFX_SQUARE_WAVE, \
+    SFX_FREQUENCY(SFX_HZ(440)), SFX_VOLUME(0xcc), SFX_WAIT(1), \
+    SFX_FREQUENCY(SFX_HZ(330)), SFX_VOLUME(0x88), SFX_WAIT(2), \
+    SFX_VOLUME(0x00), SFX_END
+
+// invalid move, a low buzz
+#define SFX_INVALID_DATA \
+    SFX_SQUARE_WAVE, \
+    SFX_FREQUENCY(SFX_HZ(196)), SFX_VOLUME(0xcc), SFX_WAIT(4), \
+    SFX_FREQUENCY(SFX_HZ(185)), SFX_VOLUME(0x99), SFX_WAIT(4), \
+    SFX_VOLUME(0x00), SFX_END
+
+// autoplay, a quiet tick
+#define SFX_AUTOPLAY_DATA \
+    SFX_SQUARE_WAVE, \
+    SFX_FREQUENCY(SFX_HZ(1320)), SFX_VOLUME(0x55), SFX_WAIT(1), \
+    SFX_VOLUME(0x00), SFX_END
+
+#define SFX_SIZE(data) sizeof((const uint8_t[]) { data })
+
+static const uint8_t __wf_rom sfx_data[] = {
+    SFX_PICK_UP_DATA,
+    SFX_PLACE_DATA,
+    SFX_INVALID_DATA,
+    SFX_AUTOPLAY_DATA,
+};
+
+// where each effect starts in sfx_data
+static const uint8_t __wf_rom sfx_offsets[SFX_COUNT] = {
+    0,
+    0,
+    SFX_SIZE(SFX_PICK_UP_DATA),
+    SFX_SIZE(SFX_PICK_UP_DATA) + SFX_SIZE(SFX_PLACE_DATA),
+    SFX_SIZE(SFX_PICK_UP_DATA) + SFX_SIZE(SFX_PLACE_DATA) + SFX_SIZE(SFX_INVALID_DATA),
+};
+
+// an effect only interrupts one of the same or lower priority
+static const uint8_t __wf_rom sfx_priority[SFX_COUNT] = { 0, 2, 2, 3, 1 };
+
+static vgmswan_state_t sfx_state;
+static uint16_t sfx_ticks;
+static uint8_t sfx_playing;
+static uint8_t sfx_pending;
+
+// queue an effect to start on the next frame
+void sfx_play(uint8_t effect)
+{
+    if (sfx_priority[effect] >= sfx_priority[sfx_pending] && sfx_priority[effect] >= sfx_priority[sfx_playing])
+    {
+        sfx_pending = effect;
+    }
+}
+
+// play the effects for this frame
+// should be called once a frame after the music has been played
+void sfx_update(vgmswan_state_t *music)
+{
+    if (sfx_pending != SFX_NONE)
+    {
+        if (sfx_playing == SFX_NONE)
+        {
+            vgmswan_mute_channel(music, SFX_CHANNEL);
+            // turn on the channel as a plain wavetable channel
+            // the music's own settings for it have been kept aside
+            outportb(SFX_CH_CTRL_PORT, (inportb(SFX_CH_CTRL_PORT) & ~(0x11 << SFX_CHANNEL)) | (1 << SFX_CHANNEL));
+        }
+
+        vgmswan_start(&sfx_state, sfx_data + sfx_offsets[sfx_pending]);
+        sfx_playing = sfx_pending;
+        sfx_pending = SFX_NONE;
+        sfx_ticks = 0;
+    }
+
+    if (sfx_playing == SFX_NONE)
+    {
+        return;
+    }
+
+    if (sfx_ticks > 1)
+    {
+        sfx_ticks--;
+        return;
+    }
+
+    sfx_ticks = vgmswan_play(&sfx_state);
+
+    if (sfx_ticks == VGMSWAN_PLAYBACK_FINISHED)
+    {
+        sfx_playing = SFX_NONE;
+        vgmswan_unmute_channel(music);
+    }
+}
@@ -0,0 +1,85 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#include <stdint.h>
+#include <wonderful.h>
+#include "solution.h"
+
+// generated by "make -f Makefile.tools book"
+// the solutions only work for standard freecell, so other variants
+// have an empty book
+#if VARIANT_STANDARD
+#include "solution_book_bin.h"
+#else
+static const uint8_t __wf_rom solution_book[2] = { 0, 0 };
+#endif
+
+static uint16_t read_word(solution_reader_t *reader)
+{
+    uint16_t value = reader->ptr[0] | (reader->ptr[1] << 8);
+    reader->ptr += 2;
+
+    return value;
+}
+
+void solution_book_open(solution_reader_t *reader)
+{
+    reader->ptr = solution_book;
+    reader->games_left = read_word(reader);
+    reader->moves_left = 0;
+}
+
+// move on to the next game in the book, skipping what's left of this one
+// returns 0 when there are no games left
+uint8_t solution_next_game(solution_reader_t *reader, uint16_t *seed)
+{
+    reader->ptr += reader->moves_left;
+    reader->moves_left = 0;
+
+    if (reader->games_left == 0)
+    {
+        return 0;
+    }
+
+    reader->games_left--;
+    *seed = read_word(reader);
+    reader->moves_left = read_word(reader);
+
+    return 1;
+}
+
+// open the book at the solution for the given seed
+// returns 0 if the book doesn't have it
+uint8_t solution_find_game(solution_reader_t *reader, uint32_t seed)
+{
+    uint16_t game_seed;
+
+    solution_book_open(reader);
+
+    // the book only has deals with 16 bit numbers
+    if (seed > 0xffff)
+    {
+        return 0;
+    }
+
+    while (solution_next_game(reader, &game_seed))
+    {
+        if (game_seed == seed)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+solution_move_t solution_next_move(solution_reader_t *reader)
+{
+    if (reader->moves_left == 0)
+    {
+        return SOLUTION_END;
+    }
+
+    reader->moves_left--;
+    return *(reader->ptr++);
+}
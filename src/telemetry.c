@@ -0,0 +1,189 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// frame timings and game events are written into a ring buffer as short
+// records, which the serial port's transmit interrupt sends a byte at a
+// time whenever it's ready for another. the game loop never waits for
+// the port: a record which doesn't fit in the buffer is dropped, and the
+// next frame record says how many were
+//
+// the game loop only ever writes the head of the buffer and the interrupt
+// only ever writes the tail, the same as the keypad queue in input.c
+//
+// sections are timed in scanlines from the display's line counter, about
+// 256 cycles each. a section which runs on past the next vblank wraps
+// around, but the frame record after it counts the vblanks missed
+
+#include <stdint.h>
+#include <ws.h>
+#include <wonderful.h>
+#include "telemetry.h"
+
+#if TELEMETRY
+
+#define TELEMETRY_BUFFER_MASK (TELEMETRY_BUFFER_SIZE - 1)
+
+static uint8_t telemetry_buffer[TELEMETRY_BUFFER_SIZE];
+static volatile uint8_t telemetry_head;
+static volatile uint8_t telemetry_tail;
+
+static uint8_t telemetry_sequence;
+static uint8_t telemetry_dropped;
+static uint8_t telemetry_vblanks;
+static uint8_t telemetry_synced;
+
+// the line the last section ended on
+static uint8_t telemetry_section_line;
+
+static uint8_t music_line;
+static uint16_t music_offset;
+
+__attribute__((interrupt)) void __far telemetry_int_handler(void)
+{
+    if (telemetry_tail != telemetry_head)
+    {
+        outportb(WS_UART_DATA_PORT, telemetry_buffer[telemetry_tail]);
+        telemetry_tail = (telemetry_tail + 1) & TELEMETRY_BUFFER_MASK;
+    }
+
+    // the interrupt keeps firing while the port is ready for more, so
+    // it's turned off until there's something to send
+    if (telemetry_tail == telemetry_head)
+    {
+        ws_int_disable(WS_INT_ENABLE_UART_TX);
+    }
+
+    ws_int_ack(WS_INT_ACK_UART_TX);
+}
+
+// scanlines since from, as the line counter wraps at the end of a frame
+static uint8_t lines_since(uint8_t from)
+{
+    uint16_t line = inportb(WS_DISPLAY_LINE_PORT);
+
+    if (line < from)
+    {
+        line += TELEMETRY_LINES;
+    }
+
+    return line - from;
+}
+
+static void telemetry_push(const uint8_t *record, uint8_t length)
+{
+    uint8_t head = telemetry_head;
+    uint8_t i;
+
+    if (((telemetry_tail - head - 1) & TELEMETRY_BUFFER_MASK) < length)
+    {
+        if (telemetry_dropped < 0xFF)
+        {
+            telemetry_dropped++;
+        }
+
+        return;
+    }
+
+    for (i = 0; i < length; i++)
+    {
+        telemetry_buffer[head] = record[i];
+        head = (head + 1) & TELEMETRY_BUFFER_MASK;
+    }
+
+    // the interrupt only sees the record once the head moves on
+    telemetry_head = head;
+    ws_int_enable(WS_INT_ENABLE_UART_TX);
+}
+
+// open the serial port and send anything left in the buffer, with the
+// cpu's interrupts disabled
+void telemetry_start()
+{
+    outportb(WS_UART_CTRL_PORT, WS_UART_CTRL_ENABLE | WS_UART_CTRL_BAUD_38400 | WS_UART_CTRL_RX_OVERRUN_RESET);
+    ws_int_set_handler(WS_INT_UART_TX, telemetry_int_handler);
+
+    if (telemetry_tail != telemetry_head)
+    {
+        ws_int_enable(WS_INT_ENABLE_UART_TX);
+    }
+}
+
+// start a frame, with the vblank interrupt's count of frames
+void telemetry_frame(uint8_t vblanks)
+{
+    uint8_t record[4];
+
+    record[0] = TELEMETRY_FRAME;
+    record[1] = telemetry_sequence++;
+    record[2] = telemetry_synced ? (uint8_t) (vblanks - telemetry_vblanks - 1) : 0;
+    record[3] = telemetry_dropped;
+
+    telemetry_vblanks = vblanks;
+    telemetry_synced = 1;
+    telemetry_dropped = 0;
+    telemetry_section_line = inportb(WS_DISPLAY_LINE_PORT);
+
+    telemetry_push(record, sizeof(record));
+}
+
+// the section which has just finished, since the last one did
+void telemetry_section(uint8_t section)
+{
+    uint8_t record[3];
+
+    record[0] = TELEMETRY_SECTION;
+    record[1] = section;
+    record[2] = lines_since(telemetry_section_line);
+
+    telemetry_section_line = inportb(WS_DISPLAY_LINE_PORT);
+
+    telemetry_push(record, sizeof(record));
+}
+
+// either side of a music driver tick, with where it is in the track
+void telemetry_music_begin(const void __far *ptr)
+{
+    music_line = inportb(WS_DISPLAY_LINE_PORT);
+    music_offset = FP_OFF(ptr);
+}
+
+void telemetry_music_end(const void __far *ptr)
+{
+    uint8_t record[3];
+    uint16_t offset = FP_OFF(ptr);
+    // going back to the loop point counts as nothing read
+    uint16_t bytes = (offset < music_offset) ? 0 : (offset - music_offset);
+
+    record[0] = TELEMETRY_MUSIC;
+    record[1] = lines_since(music_line);
+    record[2] = (bytes > 0xFF) ? 0xFF : bytes;
+
+    telemetry_push(record, sizeof(record));
+}
+
+void telemetry_move(uint8_t source, uint8_t dest, uint8_t card)
+{
+    uint8_t record[4];
+
+    record[0] = TELEMETRY_MOVE;
+    record[1] = source;
+    record[2] = dest;
+    record[3] = card;
+
+    telemetry_push(record, sizeof(record));
+}
+
+void telemetry_game(uint32_t seed)
+{
+    uint8_t record[5];
+
+    record[0] = TELEMETRY_GAME;
+    record[1] = seed;
+    record[2] = seed >> 8;
+    record[3] = seed >> 16;
+    record[4] = seed >> 24;
+
+    telemetry_push(record, sizeof(record));
+}
+
+#endif
@@ -0,0 +1,112 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the cursor, the camera and cards in flight all glide to where they're
+// going rather than jumping there. each of them is a tween in one pool,
+// which is moved on a frame at a time in one pass from the game loop
+//
+// how far a tween has got is kept in 8.8 fixed point as a position in
+// one of the easing tables, and its value is found in between the two
+// nearest steps of the table
+
+#include <stdint.h>
+#include <wonderful.h>
+#include "tween.h"
+
+// how far along a tween is at each step, 256 being all the way there
+static const int16_t __wf_rom tween_curves[TWEEN_CURVES][TWEEN_STEPS + 1] = {
+    // TWEEN_LINEAR
+    {
+        0, 16, 32, 48, 64, 80, 96, 112, 128,
+        144, 160, 176, 192, 208, 224, 240, 256
+    },
+    // TWEEN_EASE_OUT
+    {
+        0, 45, 84, 119, 148, 173, 194, 210, 224,
+        235, 242, 248, 252, 254, 256, 256, 256
+    },
+    // TWEEN_OVERSHOOT
+    {
+        0, 69, 126, 173, 209, 237, 257, 271, 278,
+        281, 281, 277, 272, 267, 261, 258, 256
+    }
+};
+
+tween_t tweens[TWEEN_SLOTS];
+
+// go from one value to another over frames, after waiting for delay
+void tween_start(uint8_t slot, int16_t from, int16_t to, uint8_t frames, uint8_t curve, uint8_t delay)
+{
+    tween_t *tween = &tweens[slot];
+
+    tween->from = tween->value = from;
+    tween->to = to;
+    tween->phase = 0;
+
+    // rounded up so it lands on the last frame rather than a frame late,
+    // tween_update stops it at TWEEN_END. it's exact up to 64 frames,
+    // longer tweens can finish a frame or so early
+    if (frames == 0)
+    {
+        frames = 1;
+    }
+
+    tween->speed = (TWEEN_END + frames - 1) / frames;
+    tween->delay = delay;
+    tween->curve = curve;
+}
+
+// jump straight to a value
+void tween_set(uint8_t slot, int16_t value)
+{
+    tween_t *tween = &tweens[slot];
+
+    tween->from = tween->to = tween->value = value;
+    tween->phase = TWEEN_END;
+    tween->delay = 0;
+}
+
+// jump straight to where a tween is going
+void tween_stop(uint8_t slot)
+{
+    tween_set(slot, tweens[slot].to);
+}
+
+// move every tween on a frame
+void tween_update()
+{
+    tween_t *tween = tweens;
+    const int16_t __wf_rom *curve;
+    uint8_t i, step;
+    int16_t ease;
+
+    for (i = 0; i < TWEEN_SLOTS; i++, tween++)
+    {
+        if (tween->phase >= TWEEN_END)
+        {
+            continue;
+        }
+
+        if (tween->delay > 0)
+        {
+            tween->delay--;
+            continue;
+        }
+
+        tween->phase += tween->speed;
+
+        if (tween->phase >= TWEEN_END)
+        {
+            tween->phase = TWEEN_END;
+            tween->value = tween->to;
+            continue;
+        }
+
+        // in between two steps of the curve
+        curve = tween_curves[tween->curve];
+        step = tween->phase >> 8;
+        ease = curve[step] + (((curve[step + 1] - curve[step]) * (int16_t) (tween->phase & 0xff)) >> 8);
+
+        tween->value = tween->from + (int16_t) (((int32_t) (tween->to - tween->from) * ease) >> 8);
+    }
+}
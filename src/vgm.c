@@ -35,25 +35,144 @@
 
 #define FLAG_USES_BANK 1
 
-void vgmswan_init(vgmswan_state_t *state, const void __far* pointer) {
-    state->ptr = pointer;
-    state->start_offset = FP_OFF(pointer);
-    state->flags = 0;
+// sound memory writes go straight to the wavetable in iram
+// the host tools point this at their own copy of iram
+#ifndef VGMSWAN_IRAM
+#define VGMSWAN_IRAM(addr) ((uint8_t __wf_iram*) (addr))
+#endif
+
+// sound ports which belong to a single channel
+#define PORT_CH_CTRL 0x90
+#define PORT_SWEEP_VALUE 0x8C
+#define PORT_SWEEP_TIME 0x8D
+#define PORT_NOISE_CTRL 0x8E
+#define PORT_VOICE_VOLUME 0x94
+#define NO_CHANNEL 0xFF
 
+// channel control bits for each channel: its enable bit, plus voice,
+// sweep and noise mode for channels 2, 3 and 4
+static const uint8_t __wf_rom channel_ctrl_bits[4] = { 0x01, 0x22, 0x44, 0x88 };
+
+static uint8_t port_channel(uint8_t port) {
+    if (port < 0x88) return (port - 0x80) >> 1;
+    if (port < 0x8C) return port - 0x88;
+    if (port == PORT_SWEEP_VALUE || port == PORT_SWEEP_TIME) return 2;
+    if (port == PORT_NOISE_CTRL) return 3;
+    if (port == PORT_VOICE_VOLUME) return 1;
+    return NO_CHANNEL;
+}
+
+static uint16_t wave_address(void) {
+    return inportb(WS_SOUND_WAVE_BASE_PORT) << 6;
+}
+
+// sound output, which goes through the bios on wonderwitch
 #ifdef __WONDERFUL_WWITCH__
+static void output_init(void) {
     sound_init();
     sound_set_output(WS_SOUND_OUT_CTRL_HEADPHONE_ENABLE | WS_SOUND_OUT_CTRL_SPEAKER_ENABLE | WS_SOUND_OUT_CTRL_SPEAKER_VOLUME_100);
+}
+
+static void output_wave(uint16_t addr, const uint8_t __far* ptr, uint8_t len) {
+    // TODO: this won't support unusual write lengths (but Furnace doesn't emit such)
+    sound_set_wave((addr >> 4) & 3, ptr);
+}
 #else
+static void output_init(void) {
     outportb(WS_SOUND_OUT_CTRL_PORT, WS_SOUND_OUT_CTRL_HEADPHONE_ENABLE | WS_SOUND_OUT_CTRL_SPEAKER_ENABLE | WS_SOUND_OUT_CTRL_SPEAKER_VOLUME_100);
+}
+
+static void output_wave(uint16_t addr, const uint8_t __far* ptr, uint8_t len) {
+    memcpy(VGMSWAN_IRAM(addr), ptr, len);
+}
 #endif
+
+// port writes while a channel is muted
+// the muted channel's writes only go to the copy of its state
+static void muted_outportb(vgmswan_state_t *state, uint8_t port, uint8_t value) {
+    uint8_t channel = state->muted_channel - 1;
+
+    if (port >= VGMSWAN_SOUND_PORT_FIRST && port < VGMSWAN_SOUND_PORT_FIRST + VGMSWAN_SOUND_PORT_COUNT) {
+        if (port == PORT_CH_CTRL) {
+            uint8_t mask = channel_ctrl_bits[channel];
+            state->muted_ports[port - VGMSWAN_SOUND_PORT_FIRST] = value;
+            outportb(port, (value & ~mask) | (inportb(port) & mask));
+            return;
+        }
+        if (port_channel(port) == channel) {
+            state->muted_ports[port - VGMSWAN_SOUND_PORT_FIRST] = value;
+            return;
+        }
+    }
+
+    outportb(port, value);
+}
+
+// sound memory writes while a channel is muted, split at each channel's 16 bytes
+static void muted_wave_write(vgmswan_state_t *state, uint16_t addr, const uint8_t __far* ptr, uint8_t len) {
+    while (len > 0) {
+        uint8_t count = 16 - (addr & 15);
+        if (count > len) count = len;
+
+        if (((addr >> 4) & 3) == state->muted_channel - 1) {
+            for (uint8_t i = 0; i < count; i++) state->muted_wave[(addr & 15) + i] = ptr[i];
+        } else {
+            output_wave(addr, ptr, count);
+        }
+
+        addr += count; ptr += count; len -= count;
+    }
+}
+
+void vgmswan_mute_channel(vgmswan_state_t *state, uint8_t channel) {
+    const uint8_t __wf_iram* wave = VGMSWAN_IRAM(wave_address() + (channel << 4));
+
+    if (state->muted_channel) vgmswan_unmute_channel(state);
+
+    // start from what the track last set the channel to
+    for (uint8_t i = 0; i < VGMSWAN_SOUND_PORT_COUNT; i++) {
+        state->muted_ports[i] = inportb(VGMSWAN_SOUND_PORT_FIRST + i);
+    }
+    for (uint8_t i = 0; i < 16; i++) state->muted_wave[i] = wave[i];
+
+    state->muted_channel = channel + 1;
+}
+
+// put back the state the track has left the muted channel in
+void vgmswan_unmute_channel(vgmswan_state_t *state) {
+    uint8_t channel = state->muted_channel - 1;
+    uint8_t mask;
+
+    if (!state->muted_channel) return;
+    state->muted_channel = 0;
+
+    output_wave(wave_address() + (channel << 4), state->muted_wave, 16);
+
+    for (uint8_t i = 0; i < VGMSWAN_SOUND_PORT_COUNT; i++) {
+        if (port_channel(VGMSWAN_SOUND_PORT_FIRST + i) == channel) {
+            outportb(VGMSWAN_SOUND_PORT_FIRST + i, state->muted_ports[i]);
+        }
+    }
+
+    mask = channel_ctrl_bits[channel];
+    outportb(PORT_CH_CTRL, (inportb(PORT_CH_CTRL) & ~mask) | (state->muted_ports[PORT_CH_CTRL - VGMSWAN_SOUND_PORT_FIRST] & mask));
+}
+
+void vgmswan_start(vgmswan_state_t *state, const void __far* pointer) {
+    state->ptr = pointer;
+    state->start_offset = FP_OFF(pointer);
+    state->flags = 0;
+}
+
+void vgmswan_init(vgmswan_state_t *state, const void __far* pointer) {
+    vgmswan_start(state, pointer);
+    output_init();
 }
 
 uint16_t vgmswan_play(vgmswan_state_t *state) {
     const uint8_t __far* ptr = state->ptr;
 
-#ifndef __WONDERFUL_WWITCH__
-    uint16_t addrPrefix = (inportb(WS_SOUND_WAVE_BASE_PORT) << 6);
-#endif
+    uint16_t addrPrefix = wave_address();
     uint16_t result = 0;
     bool restorePtr = true;
 
@@ -64,22 +183,25 @@ uint16_t vgmswan_play(vgmswan_state_t *state) {
         case 0x00:
         case 0x20: { // memory write
             uint8_t len = *(ptr++);
-#ifdef __WONDERFUL_WWITCH__
-            // TODO: this won't support unusual write lengths (but Furnace doesn't emit such)
-            sound_set_wave(cmd >> 4, ptr);
-#else
             uint16_t addr = cmd | addrPrefix;
-            memcpy((uint8_t __wf_iram*) addr, ptr, len);
-#endif
+            if (state->muted_channel) muted_wave_write(state, addr, ptr, len);
+            else output_wave(addr, ptr, len);
             ptr += len;
         } break;
         case 0x40: { // port write (byte)
             uint8_t v = *(ptr++);
-            outportb(cmd ^ 0xC0, v);
+            if (state->muted_channel) muted_outportb(state, cmd ^ 0xC0, v);
+            else outportb(cmd ^ 0xC0, v);
         } break;
         case 0x60: { // port write (word)
             uint16_t v = *((uint16_t __far*) ptr); ptr += 2;
-            outportw(cmd ^ 0xE0, v);
+            if (state->muted_channel) {
+                // the two bytes can belong to different channels
+                muted_outportb(state, cmd ^ 0xE0, v);
+                muted_outportb(state, (cmd ^ 0xE0) + 1, v >> 8);
+            } else {
+                outportw(cmd ^ 0xE0, v);
+            }
         } break;
         case 0xE0: { // special
             switch (cmd) {
@@ -126,12 +248,9 @@ uint16_t vgmswan_play(vgmswan_state_t *state) {
             case 0xFE:
             case 0xFF: {
                 uint8_t __far* mem_ptr = MK_FP(FP_SEG(ptr), state->start_offset + *((uint16_t __far*) ptr)); ptr += 2;
-#ifdef __WONDERFUL_WWITCH__
-                sound_set_wave(cmd & 0x03, mem_ptr);
-#else
                 uint16_t addr = ((cmd - 0xFC) << 4) | addrPrefix;
-                memcpy((uint8_t __wf_iram*) addr, mem_ptr, 16);
-#endif
+                if (state->muted_channel) muted_wave_write(state, addr, mem_ptr, 16);
+                else output_wave(addr, mem_ptr, 16);
             } break;
             }
         }
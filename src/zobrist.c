@@ -0,0 +1,84 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#include <stdint.h>
+#include <wonderful.h>
+#include "zobrist.h"
+
+#define ROW(card) ((card) * ZOBRIST_LOCATIONS)
+#define SUIT_ROWS(suit) \
+    ROW((suit) * 13), ROW((suit) * 13 + 1), ROW((suit) * 13 + 2), ROW((suit) * 13 + 3), \
+    ROW((suit) * 13 + 4), ROW((suit) * 13 + 5), ROW((suit) * 13 + 6), ROW((suit) * 13 + 7), \
+    ROW((suit) * 13 + 8), ROW((suit) * 13 + 9), ROW((suit) * 13 + 10), ROW((suit) * 13 + 11), \
+    ROW((suit) * 13 + 12), 0, 0, 0
+
+// the locations which aren't a card only use suit 0's gap
+#define SUIT_COLUMNS(suit, gap_0d, gap_0e, gap_0f) \
+    (suit) * 13, (suit) * 13 + 1, (suit) * 13 + 2, (suit) * 13 + 3, \
+    (suit) * 13 + 4, (suit) * 13 + 5, (suit) * 13 + 6, (suit) * 13 + 7, \
+    (suit) * 13 + 8, (suit) * 13 + 9, (suit) * 13 + 10, (suit) * 13 + 11, \
+    (suit) * 13 + 12, gap_0d, gap_0e, gap_0f
+
+// first key in the table for each card value
+const uint16_t __wf_rom zobrist_rows[64] = {
+    SUIT_ROWS(0), SUIT_ROWS(1), SUIT_ROWS(2), SUIT_ROWS(3)
+};
+
+// which key in a card's row goes with each location
+const uint8_t __wf_rom zobrist_columns[64] = {
+    SUIT_COLUMNS(0, ZOBRIST_CARDS, ZOBRIST_CARDS + 1, ZOBRIST_CARDS + 2),
+    SUIT_COLUMNS(1, 0, 0, 0),
+    SUIT_COLUMNS(2, 0, 0, 0),
+    SUIT_COLUMNS(3, 0, 0, 0)
+};
+
+uint32_t board_hash;
+
+// set when the last move went back to a position seen in the last few moves
+uint8_t board_repeated;
+
+static uint32_t zobrist_history[ZOBRIST_HISTORY_SIZE];
+static uint8_t zobrist_history_pos;
+
+void zobrist_reset()
+{
+    uint8_t i;
+
+    board_hash = 0;
+    board_repeated = 0;
+
+    for (i = 0; i < ZOBRIST_HISTORY_SIZE; i++)
+    {
+        zobrist_history[i] = 0;
+    }
+
+    zobrist_history_pos = 0;
+}
+
+// returns 1 if the board has been in the position with this hash recently
+uint8_t zobrist_seen_recently(uint32_t hash)
+{
+    uint8_t i;
+
+    for (i = 0; i < ZOBRIST_HISTORY_SIZE; i++)
+    {
+        if (zobrist_history[i] == hash)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// remember the current position once a move has been completed
+// returns 1 if the board has been in this position recently
+uint8_t zobrist_record_position()
+{
+    board_repeated = zobrist_seen_recently(board_hash);
+
+    zobrist_history[zobrist_history_pos] = board_hash;
+    zobrist_history_pos = (zobrist_history_pos + 1) & (ZOBRIST_HISTORY_SIZE - 1);
+
+    return board_repeated;
+}
@@ -0,0 +1,370 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// times the game's rules, renderer and music driver on the host
+// every benchmark uses fixed seeds and data, so the numbers can be
+// compared from one commit to the next. results are written one json
+// object per line, followed by how much of the arena was used
+//
+// usage: bench [-c commit] [-r rounds]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <ws.h>
+#include "arena.h"
+#include "asset.h"
+#include "card.h"
+#include "deadend.h"
+#include "draw.h"
+#include "flight.h"
+#include "tween.h"
+#include "vgm.h"
+#include "asset_pack.h"
+
+#define IRAM_IMPLEMENTATION
+#include "iram.h"
+
+// upper limit on the calls it takes to play a track through once
+#define MAX_TRACK_CALLS 1000000
+
+typedef struct {
+    const char *name;
+    uint8_t asset;
+} bench_track_t;
+
+static const bench_track_t tracks[] = {
+    { "entertainer", ASSET_ENTERTAINER_CVGM },
+    { "title_screen", ASSET_TITLE_SCREEN_CVGM },
+    { "you_win", ASSET_YOU_WIN_CVGM },
+};
+
+static const char *asset_names[ASSET_COUNT] = ASSET_NAMES;
+static const char *asset_set_names[ASSET_SETS] = ASSET_SET_NAMES;
+
+extern bool host_color;
+
+static const char *commit = "unknown";
+static int rounds = 5;
+
+// the cvgm driver works within a 64k segment, so tracks are
+// copied somewhere they can't cross a boundary
+static uint8_t *track_buffer;
+
+static volatile uint32_t sink;
+
+void wait_for_vblank() {}
+void race_move(uint8_t source, uint8_t dest, uint8_t card) {}
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e9) + ts.tv_nsec;
+}
+
+static void report(const char *name, const char *variant, long calls, double ns)
+{
+    printf(
+        "{\"commit\":\"%s\",\"name\":\"%s%s%s\",\"calls\":%ld,\"ns_per_call\":%.2f,\"port_writes\":%u}\n",
+        commit,
+        name,
+        (variant != NULL) ? "/" : "",
+        (variant != NULL) ? variant : "",
+        calls,
+        ns / calls,
+        host_port_writes
+    );
+}
+
+// run a benchmark several times and report the fastest round
+#define BENCH(name, variant, calls, setup, body) \
+    do { \
+        double best = 0, start; \
+        long n; \
+        int round; \
+        for (round = 0; round < rounds; round++) \
+        { \
+            setup; \
+            host_port_writes = 0; \
+            start = now_ns(); \
+            for (n = 0; n < (calls); n++) \
+            { \
+                body; \
+            } \
+            start = now_ns() - start; \
+            best = (round == 0 || start < best) ? start : best; \
+        } \
+        report(name, variant, calls, best); \
+    } while (0)
+
+static void deal(uint16_t seed)
+{
+    uint8_t cascade = 0;
+
+    initialise_cascades();
+    initialise_freecells();
+    initialise_foundations();
+    deal_game(seed);
+
+    while (deck_count > DEALT_FREECELLS)
+    {
+        move_top_of_deck_to_cascade(cascade);
+        cascade = (cascade + 1) % CASCADES;
+    }
+
+    for (cascade = 0; deck_count > 0; cascade++)
+    {
+        move_top_of_deck_to_freecell(cascade);
+    }
+}
+
+// the whole deck in two cascades, far longer than the screen
+static void deal_long()
+{
+    deal(1);
+    initialise_cascades();
+    initialise_deck();
+
+    while (deck_count > 0)
+    {
+        move_top_of_deck_to_cascade(deck_count & 1);
+    }
+
+    draw_board();
+}
+
+// four cascades running from king to ace in alternating colours,
+// which is the slowest board for check_if_game_won to look at
+static void deal_won()
+{
+    uint8_t i, value;
+
+    initialise_cascades();
+
+    for (i = 0; i < 4; i++)
+    {
+        for (value = 13; value > 0; value--)
+        {
+            cascades[i][cascade_counts[i]++] = (value - 1) | ((i ^ (value & 1)) << 4);
+        }
+    }
+}
+
+// the first cards of a deal all in the air at once
+static void deal_flying()
+{
+    uint8_t i;
+
+    deal(1);
+    draw_board();
+    flight_reset();
+
+    for (i = 0; i < FLIGHT_SLOTS; i++)
+    {
+        flight_launch(cascades[i % CASCADES][0], i % CASCADES, 100, 144, i * 24, 40, 255, TWEEN_EASE_OUT, 0);
+    }
+
+    tween_update();
+    flight_update();
+}
+
+static void bench_rules()
+{
+    uint8_t a, b;
+
+    BENCH("deal_game", NULL, 20000, (void) 0, {
+        deal_game(n);
+    });
+
+    BENCH("can_move_card_onto_card", NULL, 2000000, (void) 0, {
+        a = n & 0x3f;
+        b = (n >> 6) & 0x3f;
+        sink += can_move_card_onto_card(a, b);
+    });
+
+    BENCH("check_if_game_won", "dealt", 1000000, deal(1), {
+        sink += check_if_game_won();
+    });
+
+    BENCH("check_if_game_won", "won", 1000000, deal_won(), {
+        sink += check_if_game_won();
+    });
+
+    // a search of the first position of a deal, started again each
+    // time it finishes
+    BENCH("deadend_update", NULL, 200000, { deal(1); arena_enter(ARENA_SCOPE_GAME); deadend_reset(); }, {
+        if (deadend_update() == DEADEND_IDLE)
+        {
+            deadend_reset();
+        }
+    });
+}
+
+// the most each block of the arena had in use over all of the benchmarks
+static void report_arenas()
+{
+    uint8_t i;
+
+    for (i = 0; i < ARENA_COUNT; i++)
+    {
+        printf(
+            "{\"commit\":\"%s\",\"arena\":\"%s\",\"size\":%u,\"high\":%u}\n",
+            commit,
+            arena_names[i],
+            arenas[i].size,
+            arenas[i].high
+        );
+    }
+}
+
+static void bench_render(const char *mode)
+{
+    BENCH("draw_card_tiles", mode, 52 * 2000, (void) 0, {
+        draw_card_tiles(cards[n % 52], 2 + ((n & 7) * 3), 5 + ((n >> 3) % 13), 1);
+    });
+
+    BENCH("copy_card_tiles_to_sprites", mode, 200000, deal(1), {
+        copy_card_tiles_to_sprites(cards[n % 52]);
+    });
+
+    BENCH("draw_cascade", mode, 200000, { deal(1); draw_board(); }, {
+        draw_cascade(n & 7, 0);
+    });
+
+    // one row comes into view each call, and every 16th call the
+    // whole screen does
+    BENCH("scroll_board", mode, 200000, deal_long(), {
+        scroll_board(n & 15);
+    });
+
+    // once the cursor has stopped moving, frames shouldn't write to any ports
+    BENCH("draw_cursor_idle", mode, 200000, { deal(1); draw_board(); reset_drawn_cursor(); draw_cursor(); }, {
+        draw_cursor();
+    });
+
+    // every slot in flight, as at the height of the deal
+    BENCH("draw_flights", mode, 200000, deal_flying(), {
+        draw_flights(2, 0);
+    });
+
+    BENCH("draw_baize", mode, 20000, (void) 0, {
+        draw_baize();
+    });
+
+    BENCH("load_tiles", mode, 20000, (void) 0, {
+        load_tiles(0, ASSET_CARDS_TILES);
+    });
+}
+
+static void bench_music()
+{
+    vgmswan_state_t state;
+    uint16_t last_offset;
+    long calls = 0;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(tracks) / sizeof(tracks[0]); i++)
+    {
+        memcpy(track_buffer, asset_data(tracks[i].asset), asset_size(tracks[i].asset));
+
+        // count how many calls it takes for the track to loop
+        vgmswan_init(&state, track_buffer);
+        last_offset = 0;
+
+        for (calls = 0; calls < MAX_TRACK_CALLS; calls++)
+        {
+            if (vgmswan_play(&state) == VGMSWAN_PLAYBACK_FINISHED || FP_OFF(state.ptr) < last_offset)
+            {
+                break;
+            }
+
+            last_offset = FP_OFF(state.ptr);
+        }
+
+        BENCH("vgmswan_play", tracks[i].name, calls, vgmswan_init(&state, track_buffer), {
+            sink += vgmswan_play(&state);
+        });
+    }
+}
+
+// every asset in the pack through its codec, to see what changing one
+// would do to the time it takes to load
+static void bench_assets()
+{
+    static uint8_t out[0x10000];
+    char variant[128];
+    uint8_t set, i;
+
+    for (set = 0; set < ASSET_SETS; set++)
+    {
+        asset_select(set);
+
+        for (i = 0; i < ASSET_COUNT; i++)
+        {
+            if (asset_size(i) == 0)
+            {
+                continue;
+            }
+
+            snprintf(variant, sizeof(variant), "%s/%s", asset_set_names[set], asset_names[i]);
+
+            BENCH("asset_load", variant, 200, (void) 0, {
+                asset_load(i, out);
+                sink += out[n & 0xff];
+            });
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'c': commit = optarg; break;
+        case 'r': rounds = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: bench [-c commit] [-r rounds]\n");
+            return 1;
+        }
+    }
+
+    if (rounds < 1)
+    {
+        rounds = 1;
+    }
+
+    track_buffer = aligned_alloc(0x10000, 0x10000);
+
+    // sound memory writes land in the wavetable
+    host_ports[WS_SOUND_WAVE_BASE_PORT] = 0x0EC0 >> 6;
+
+    init_video();
+    copy_palettes();
+    load_tiles(0, ASSET_CARDS_TILES);
+    initialise_cards_array();
+
+    bench_rules();
+
+    // the renderer takes different paths on mono hardware
+    host_color = true;
+    init_video();
+    bench_render("color");
+    host_color = false;
+    init_video();
+    bench_render("mono");
+
+    bench_music();
+    bench_assets();
+    report_arenas();
+
+    free(track_buffer);
+    return 0;
+}
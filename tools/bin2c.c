@@ -0,0 +1,74 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// stand-in for wf-bin2c so the host tools can link against the files in data/
+// writes <name>_bin.c and <name>_bin.h into the output directory
+//
+// usage: bin2c outdir file.bin
+
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv)
+{
+    char name[256], path[1024];
+    const char *base;
+    char *dot;
+    long size = 0;
+    int c;
+    FILE *in, *out;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: bin2c outdir file.bin\n");
+        return 1;
+    }
+
+    base = strrchr(argv[2], '/');
+    base = (base != NULL) ? base + 1 : argv[2];
+    snprintf(name, sizeof(name), "%s", base);
+
+    if ((dot = strrchr(name, '.')) != NULL)
+    {
+        *dot = 0;
+    }
+
+    if ((in = fopen(argv[2], "rb")) == NULL)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s_bin.c", argv[1], name);
+
+    if ((out = fopen(path, "w")) == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(out, "#include <stdint.h>\n\nconst uint8_t __attribute__((aligned(2))) %s[] = {", name);
+
+    while ((c = fgetc(in)) != EOF)
+    {
+        fprintf(out, "%s%d", (size % 16) ? ", " : (size ? ",\n\t" : "\n\t"), c);
+        size++;
+    }
+
+    fprintf(out, "\n};\n");
+    fclose(out);
+    fclose(in);
+
+    snprintf(path, sizeof(path), "%s/%s_bin.h", argv[1], name);
+
+    if ((out = fopen(path, "w")) == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(out, "#pragma once\n#include <stdint.h>\n\n#define %s_size (%ld)\nextern const uint8_t %s[%ld];\n", name, size, name, size);
+    fclose(out);
+
+    return 0;
+}
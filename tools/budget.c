@@ -0,0 +1,501 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// reports how much rom and iram the game uses, from the linker's map
+// rom is broken down by asset and source file, and iram by each of the
+// regions in the [memory.layout] section of wfconfig.toml. stack space
+// is kept aside in c_heap as that's where the stack lives too
+// exits with 1 if anything is over its budget
+//
+// usage: budget [-q] [-l wfconfig.toml] [-r rom_bytes] [-s stack_bytes] game.map
+//   -q  only print anything if a budget has been exceeded
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LINE 1024
+#define MAX_NAME 256
+#define MAX_OBJECTS 128
+#define MAX_REGIONS 16
+
+// heap region that ordinary variables go in
+#define HEAP_REGION "c_heap"
+
+// where an input section ends up
+enum section_kinds {
+  KIND_NONE = 0,
+  // code and far data, only in rom
+  KIND_ROM,
+  // initialised near data, copied from rom into iram at startup
+  KIND_DATA,
+  // zeroed near data, only in iram
+  KIND_BSS,
+  // placed at a fixed iram address by the toolchain
+  KIND_FIXED
+};
+
+typedef struct {
+    char name[MAX_NAME];
+    // 0 for code, 1 for assets, 2 for libraries and startup code
+    int group;
+    unsigned long rom;
+    unsigned long heap;
+} budget_object_t;
+
+typedef struct {
+    char name[MAX_NAME];
+    unsigned long start;
+    unsigned long end;
+    unsigned long used;
+} budget_region_t;
+
+// the game's own fixed iram sections, see iram.h
+static const struct {
+    const char *section;
+    const char *region;
+} fixed_sections[] = {
+    { ".iramx_wave", "wave" },
+    { ".iramx_screen.1", "screen1" },
+    { ".iramx_screen.2", "screen1_page2" },
+    { ".iramx_screen.3", "screen2" },
+    { ".iramx_screen.4", "screen2_page2" },
+    { ".iramx_sprite", "sprites" },
+};
+
+static const char *group_names[] = { "code", "assets", "libraries" };
+
+static budget_object_t objects[MAX_OBJECTS];
+static int object_count;
+
+static budget_region_t regions[MAX_REGIONS];
+static int region_count;
+
+// tile memory is reserved by the toolchain rather than the layout
+static unsigned long fixed_other;
+
+static int starts_with(const char *s, const char *prefix)
+{
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+static int ends_with(const char *s, const char *suffix)
+{
+    size_t length = strlen(s), suffix_length = strlen(suffix);
+
+    return length >= suffix_length && strcmp(s + length - suffix_length, suffix) == 0;
+}
+
+static int section_kind(const char *section)
+{
+    if (starts_with(section, ".iramx_"))
+    {
+        return KIND_FIXED;
+    }
+
+    if (starts_with(section, ".bss") || starts_with(section, "COMMON") || starts_with(section, ".iram"))
+    {
+        return KIND_BSS;
+    }
+
+    // near constants have to be in iram too, as that's where ds points
+    if (starts_with(section, ".data") || starts_with(section, ".rodata"))
+    {
+        return KIND_DATA;
+    }
+
+    if (starts_with(section, ".text") || starts_with(section, ".far") || starts_with(section, ".rom"))
+    {
+        return KIND_ROM;
+    }
+
+    return KIND_NONE;
+}
+
+static budget_region_t *find_region(const char *name)
+{
+    int i;
+
+    for (i = 0; i < region_count; i++)
+    {
+        if (strcmp(regions[i].name, name) == 0)
+        {
+            return &regions[i];
+        }
+    }
+
+    return NULL;
+}
+
+// turn an object's path into the asset or source file it was built from
+static budget_object_t *find_object(const char *path)
+{
+    char name[MAX_NAME];
+    const char *p;
+    size_t length;
+    int group, i;
+
+    if (strchr(path, '(') != NULL || ends_with(path, ".a") || strstr(path, "crt0") != NULL)
+    {
+        // archive members are counted against their archive
+        p = strrchr(path, '/');
+        p = (p != NULL) ? p + 1 : path;
+        length = strcspn(p, "(");
+        group = 2;
+    }
+    else
+    {
+        // build/<target>/data/foo.bin.o -> data/foo.bin
+        p = strstr(path, "/data/");
+        p = (p == NULL) ? strstr(path, "/assets/") : p;
+        group = 1;
+
+        if (p == NULL)
+        {
+            p = strstr(path, "/src/");
+            group = 0;
+        }
+
+        p = (p != NULL) ? p + 1 : path;
+        length = strlen(p);
+
+        if (ends_with(p, ".o"))
+        {
+            length -= 2;
+        }
+    }
+
+    if (length >= MAX_NAME)
+    {
+        length = MAX_NAME - 1;
+    }
+
+    memcpy(name, p, length);
+    name[length] = 0;
+
+    for (i = 0; i < object_count; i++)
+    {
+        if (strcmp(objects[i].name, name) == 0)
+        {
+            return &objects[i];
+        }
+    }
+
+    if (object_count == MAX_OBJECTS)
+    {
+        fprintf(stderr, "budget: too many objects in map\n");
+        exit(1);
+    }
+
+    strcpy(objects[object_count].name, name);
+    objects[object_count].group = group;
+    return &objects[object_count++];
+}
+
+static void add_section(const char *section, unsigned long size, const char *path)
+{
+    budget_object_t *object;
+    budget_region_t *region;
+    unsigned i;
+    int kind;
+
+    kind = section_kind(section);
+
+    if (kind == KIND_NONE || size == 0)
+    {
+        return;
+    }
+
+    if (kind == KIND_FIXED)
+    {
+        for (i = 0; i < sizeof(fixed_sections) / sizeof(fixed_sections[0]); i++)
+        {
+            if (strcmp(section, fixed_sections[i].section) == 0)
+            {
+                if ((region = find_region(fixed_sections[i].region)) != NULL)
+                {
+                    region->used += size;
+                    return;
+                }
+            }
+        }
+
+        fixed_other += size;
+        return;
+    }
+
+    object = find_object(path);
+
+    if (kind != KIND_BSS)
+    {
+        object->rom += size;
+    }
+
+    if (kind != KIND_ROM)
+    {
+        object->heap += size;
+
+        if ((region = find_region(HEAP_REGION)) != NULL)
+        {
+            region->used += size;
+        }
+    }
+}
+
+// reads the [memory.layout] regions from wfconfig.toml
+static void read_layout(const char *path)
+{
+    FILE *file;
+    char line[MAX_LINE];
+    char name[MAX_NAME];
+    long start, end;
+    int in_layout = 0;
+
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (line[0] == '[')
+        {
+            in_layout = starts_with(line, "[memory.layout]");
+            continue;
+        }
+
+        if (!in_layout || region_count == MAX_REGIONS)
+        {
+            continue;
+        }
+
+        if (sscanf(line, " %255[A-Za-z0-9_] = [ %li , %li ]", name, &start, &end) == 3)
+        {
+            strcpy(regions[region_count].name, name);
+            regions[region_count].start = start;
+            regions[region_count].end = end;
+            region_count++;
+        }
+    }
+
+    fclose(file);
+}
+
+// reads the sizes of the input sections from a gnu ld map file
+//  .text.foo      0x00000010       0x40 build/wswan/src/card.c.o
+// long section names put the address, size and object on the next line
+static void read_map(const char *path)
+{
+    FILE *file;
+    char line[MAX_LINE];
+    char section[MAX_NAME] = "";
+    char object[MAX_LINE];
+    unsigned long address, size;
+    int in_map = 0, discarding = 0;
+
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (!in_map)
+        {
+            in_map = starts_with(line, "Linker script and memory map");
+            continue;
+        }
+
+        // output sections start in the first column
+        if (line[0] == '.' || line[0] == '/')
+        {
+            discarding = starts_with(line, "/DISCARD/");
+            section[0] = 0;
+            continue;
+        }
+
+        if (discarding || line[0] != ' ')
+        {
+            section[0] = 0;
+            continue;
+        }
+
+        // an input section, with or without its details on the same line
+        if (line[1] == '.' || starts_with(line + 1, "COMMON"))
+        {
+            if (sscanf(line, " %255s 0x%lx 0x%lx %1023s", section, &address, &size, object) == 4)
+            {
+                add_section(section, size, object);
+                section[0] = 0;
+            }
+
+            continue;
+        }
+
+        if (section[0] != 0 && sscanf(line, " 0x%lx 0x%lx %1023s", &address, &size, object) == 3)
+        {
+            add_section(section, size, object);
+        }
+
+        section[0] = 0;
+    }
+
+    fclose(file);
+
+    if (!in_map)
+    {
+        fprintf(stderr, "budget: %s doesn't look like a linker map\n", path);
+        exit(1);
+    }
+}
+
+static int compare_objects(const void *a, const void *b)
+{
+    const budget_object_t *x = a, *y = b;
+
+    if (x->group != y->group)
+    {
+        return x->group - y->group;
+    }
+
+    return (x->rom < y->rom) - (x->rom > y->rom);
+}
+
+static void print_percent(unsigned long used, unsigned long budget)
+{
+    if (budget > 0)
+    {
+        printf(" / %6lu  %3lu%%", budget, (used * 100) / budget);
+    }
+
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    int opt, i, group, quiet = 0, over = 0;
+    const char *layout_path = NULL;
+    unsigned long rom_budget = 0, stack = 0, rom = 0, total, size;
+    budget_region_t *heap;
+
+    while ((opt = getopt(argc, argv, "ql:r:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'q': quiet = 1; break;
+        case 'l': layout_path = optarg; break;
+        case 'r': rom_budget = strtoul(optarg, NULL, 0); break;
+        case 's': stack = strtoul(optarg, NULL, 0); break;
+        default: optind = argc; break;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        fprintf(stderr, "usage: budget [-q] [-l wfconfig.toml] [-r rom_bytes] [-s stack_bytes] game.map\n");
+        return 1;
+    }
+
+    if (layout_path != NULL)
+    {
+        read_layout(layout_path);
+    }
+
+    read_map(argv[optind]);
+    qsort(objects, object_count, sizeof(objects[0]), compare_objects);
+
+    for (i = 0; i < object_count; i++)
+    {
+        rom += objects[i].rom;
+    }
+
+    heap = find_region(HEAP_REGION);
+
+    if (heap != NULL)
+    {
+        heap->used += stack;
+    }
+
+    if (rom_budget > 0 && rom > rom_budget)
+    {
+        over = 1;
+        fprintf(stderr, "budget: rom is %lu bytes, over its budget of %lu\n", rom, rom_budget);
+    }
+
+    for (i = 0; i < region_count; i++)
+    {
+        size = regions[i].end - regions[i].start + 1;
+
+        if (regions[i].used > size)
+        {
+            over = 1;
+            fprintf(stderr, "budget: %s needs %lu bytes but only has %lu\n", regions[i].name, regions[i].used, size);
+        }
+    }
+
+    if (quiet)
+    {
+        return over;
+    }
+
+    printf("rom                              bytes\n");
+
+    for (group = 0; group < 3; group++)
+    {
+        total = 0;
+        printf("  %s\n", group_names[group]);
+
+        for (i = 0; i < object_count; i++)
+        {
+            if (objects[i].group == group && objects[i].rom > 0)
+            {
+                printf("    %-28s %6lu\n", objects[i].name, objects[i].rom);
+                total += objects[i].rom;
+            }
+        }
+
+        printf("    %-28s %6lu\n", "total", total);
+    }
+
+    printf("  %-30s %6lu", "total", rom);
+    print_percent(rom, rom_budget);
+
+    printf("\nnear data                        bytes\n");
+
+    for (i = 0; i < object_count; i++)
+    {
+        if (objects[i].heap > 0)
+        {
+            printf("    %-28s %6lu\n", objects[i].name, objects[i].heap);
+        }
+    }
+
+    if (stack > 0)
+    {
+        printf("    %-28s %6lu\n", "stack", stack);
+    }
+
+    if (region_count > 0)
+    {
+        printf("\niram              start    end  bytes\n");
+
+        for (i = 0; i < region_count; i++)
+        {
+            printf(
+                "  %-14s 0x%04lx 0x%04lx %6lu",
+                regions[i].name, regions[i].start, regions[i].end, regions[i].used
+            );
+            print_percent(regions[i].used, regions[i].end - regions[i].start + 1);
+        }
+
+        if (fixed_other > 0)
+        {
+            printf("  %-30s %6lu\n", "tiles", fixed_other);
+        }
+    }
+
+    return over;
+}
@@ -0,0 +1,801 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// host side deal solver and difficulty catalogue generator
+//
+// deals every seed the same way card.c does and searches for a
+// solution using the same single card moves as the game, spread over
+// all cpu cores with a work stealing pool. the results are written out
+// as a csv, and optionally as a packed rom table with one difficulty
+// nibble per seed (0 = no solution found, 1 = easiest ... 15 = hardest)
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ws.h>
+#include "card.h"
+#include "solution.h"
+
+#define SEED_COUNT 65536
+
+// longest cascade the search will build
+// 7 dealt cards plus a king to ace run is the most single card moves allow
+#define MAX_CASCADE 20
+
+#define DEFAULT_NODE_LIMIT 150000
+
+// steal work in chunks no smaller than this
+#define MIN_STEAL 16
+
+typedef struct {
+    uint8_t cascades[CASCADES][MAX_CASCADE];
+    uint8_t cascade_counts[CASCADES];
+    uint8_t freecells[FREECELLS];
+    uint8_t foundation_counts[FOUNDATIONS];
+} solver_state_t;
+
+typedef struct {
+    solver_state_t state;
+    uint32_t parent;
+    uint16_t depth;
+    solution_move_t move;
+} solver_node_t;
+
+typedef struct {
+    uint32_t priority;
+    uint32_t node;
+} heap_entry_t;
+
+typedef struct {
+    uint8_t solved;
+    uint8_t difficulty;
+    uint16_t length;
+    uint32_t nodes;
+    solution_move_t *solution;
+} deal_result_t;
+
+// each worker owns a range of seeds which it works through from the front
+// idle workers steal the back half of the largest range left
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t next;
+    uint32_t end;
+} work_range_t;
+
+typedef struct {
+    solver_node_t *nodes;
+    heap_entry_t *heap;
+    uint64_t *seen;
+    uint32_t seen_mask;
+    uint32_t node_limit;
+} solver_t;
+
+static deal_result_t results[SEED_COUNT];
+static work_range_t *ranges;
+static int worker_count;
+static uint32_t node_limit = DEFAULT_NODE_LIMIT;
+
+// card.c deals into global arrays, so only one thread can deal at a time
+static pthread_mutex_t deal_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void deal_seed(uint16_t seed, solver_state_t *state)
+{
+    uint8_t i, j;
+
+    pthread_mutex_lock(&deal_lock);
+
+    initialise_cascades();
+    initialise_freecells();
+    initialise_foundations();
+    deal_game(seed);
+
+    // same order as the dealing animation in main.c
+    for (i = 0; deck_count > DEALT_FREECELLS; i = (i + 1) % CASCADES)
+    {
+        move_top_of_deck_to_cascade(i);
+    }
+
+    for (i = 0; deck_count > 0; i++)
+    {
+        move_top_of_deck_to_freecell(i);
+    }
+
+    memset(state, 0, sizeof(*state));
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        state->cascade_counts[i] = cascade_counts[i];
+
+        for (j = 0; j < cascade_counts[i]; j++)
+        {
+            state->cascades[i][j] = cascades[i][j];
+        }
+    }
+
+    for (i = 0; i < FREECELLS; i++)
+    {
+        state->freecells[i] = freecells[i][0];
+    }
+
+    pthread_mutex_unlock(&deal_lock);
+}
+
+// number of cards at the bottom of a cascade which are already in sequence
+static uint8_t sorted_length(const solver_state_t *state, uint8_t cascade)
+{
+    uint8_t j;
+    const uint8_t *cards = state->cascades[cascade];
+
+    for (j = 1; j < state->cascade_counts[cascade]; j++)
+    {
+        if (!can_move_card_onto_card(cards[j], cards[j - 1]))
+        {
+            return j;
+        }
+    }
+
+    return state->cascade_counts[cascade];
+}
+
+// same test as check_if_game_won, against the solver's own state
+static int is_won(const solver_state_t *state)
+{
+    uint8_t i;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        if (sorted_length(state, i) != state->cascade_counts[i])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static uint32_t heuristic(const solver_state_t *state)
+{
+    uint8_t i, j, sorted;
+    uint32_t h = 0;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        sorted = sorted_length(state, i);
+
+        // cards which are out of sequence still need to be moved,
+        // and low cards buried under them need to be dug out first
+        for (j = sorted; j < state->cascade_counts[i]; j++)
+        {
+            h += 4;
+        }
+
+        for (j = 0; j < sorted && sorted != state->cascade_counts[i]; j++)
+        {
+            h += (13 - (state->cascades[i][j] & 0xf)) >> 2;
+        }
+    }
+
+    for (i = 0; i < FREECELLS; i++)
+    {
+        if (state->freecells[i] != NO_CARD)
+        {
+            h += 1;
+        }
+    }
+
+    return h;
+}
+
+static uint64_t hash_bytes(uint64_t h, const uint8_t *bytes, uint8_t count)
+{
+    while (count--)
+    {
+        h = (h ^ *bytes++) * 0x100000001b3ULL;
+    }
+
+    return h;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static int compare_u8(const void *a, const void *b)
+{
+    return *(const uint8_t *) a - *(const uint8_t *) b;
+}
+
+// hash which ignores the order of the cascades and freecells
+// as swapping those around doesn't change the position
+static uint64_t canonical_hash(const solver_state_t *state)
+{
+    uint8_t i;
+    uint64_t cascade_hashes[CASCADES];
+    uint8_t freecells[FREECELLS];
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (i = 0; i < CASCADES; i++)
+    {
+        cascade_hashes[i] = hash_bytes(0xcbf29ce484222325ULL, state->cascades[i], state->cascade_counts[i]);
+    }
+
+    qsort(cascade_hashes, CASCADES, sizeof(uint64_t), compare_u64);
+    memcpy(freecells, state->freecells, FREECELLS);
+    qsort(freecells, FREECELLS, 1, compare_u8);
+
+    h = hash_bytes(h, (const uint8_t *) cascade_hashes, sizeof(cascade_hashes));
+    h = hash_bytes(h, freecells, FREECELLS);
+
+    return h | 1;
+}
+
+// returns 1 if the hash was not in the set yet
+static int seen_insert(solver_t *solver, uint64_t hash)
+{
+    uint32_t i = (uint32_t) hash & solver->seen_mask;
+
+    while (solver->seen[i] != 0)
+    {
+        if (solver->seen[i] == hash)
+        {
+            return 0;
+        }
+
+        i = (i + 1) & solver->seen_mask;
+    }
+
+    solver->seen[i] = hash;
+    return 1;
+}
+
+static void heap_push(solver_t *solver, uint32_t *heap_count, uint32_t priority, uint32_t node)
+{
+    uint32_t i = (*heap_count)++;
+    heap_entry_t entry = { priority, node };
+
+    while (i > 0 && solver->heap[(i - 1) >> 1].priority > priority)
+    {
+        solver->heap[i] = solver->heap[(i - 1) >> 1];
+        i = (i - 1) >> 1;
+    }
+
+    solver->heap[i] = entry;
+}
+
+static uint32_t heap_pop(solver_t *solver, uint32_t *heap_count)
+{
+    uint32_t i = 0, child;
+    uint32_t node = solver->heap[0].node;
+    heap_entry_t last = solver->heap[--(*heap_count)];
+
+    while ((child = (i << 1) + 1) < *heap_count)
+    {
+        if (child + 1 < *heap_count && solver->heap[child + 1].priority < solver->heap[child].priority)
+        {
+            child++;
+        }
+
+        if (solver->heap[child].priority >= last.priority)
+        {
+            break;
+        }
+
+        solver->heap[i] = solver->heap[child];
+        i = child;
+    }
+
+    solver->heap[i] = last;
+    return node;
+}
+
+static uint8_t take_source(solver_state_t *state, uint8_t source)
+{
+    uint8_t card;
+
+    if (source < CASCADES)
+    {
+        return state->cascades[source][--state->cascade_counts[source]];
+    }
+
+    card = state->freecells[source - SOLUTION_FREECELL_0];
+    state->freecells[source - SOLUTION_FREECELL_0] = NO_CARD;
+    return card;
+}
+
+static void apply_move(solver_state_t *state, solution_move_t move)
+{
+    uint8_t card = take_source(state, SOLUTION_MOVE_SOURCE(move));
+    uint8_t dest = SOLUTION_MOVE_DEST(move);
+
+    if (dest == SOLUTION_FOUNDATION)
+    {
+        state->foundation_counts[card >> 4]++;
+    }
+    else if (dest < CASCADES)
+    {
+        state->cascades[dest][state->cascade_counts[dest]++] = card;
+    }
+    else
+    {
+        state->freecells[dest - SOLUTION_FREECELL_0] = card;
+    }
+}
+
+// list the single card moves the game allows from this position
+static uint8_t generate_moves(const solver_state_t *state, solution_move_t *moves)
+{
+    uint8_t source, dest, card, count = 0;
+    uint8_t first_empty_cascade = NO_CARD;
+    uint8_t first_empty_freecell = NO_CARD;
+
+    for (dest = 0; dest < CASCADES; dest++)
+    {
+        if (state->cascade_counts[dest] == 0 && first_empty_cascade == NO_CARD)
+        {
+            first_empty_cascade = dest;
+        }
+    }
+
+    for (dest = 0; dest < FREECELLS; dest++)
+    {
+        if (state->freecells[dest] == NO_CARD && first_empty_freecell == NO_CARD)
+        {
+            first_empty_freecell = dest;
+        }
+    }
+
+    for (source = 0; source < SOLUTION_FREECELL_0 + FREECELLS; source++)
+    {
+        if (source < CASCADES)
+        {
+            if (state->cascade_counts[source] == 0)
+            {
+                continue;
+            }
+
+            card = state->cascades[source][state->cascade_counts[source] - 1];
+        }
+        else if (source < SOLUTION_FREECELL_0)
+        {
+            continue;
+        }
+        else
+        {
+            card = state->freecells[source - SOLUTION_FREECELL_0];
+
+            if (card == NO_CARD)
+            {
+                continue;
+            }
+        }
+
+        // picking up an ace always sends it to the foundations
+        if (state->foundation_counts[card >> 4] == (card & 0xf))
+        {
+            moves[count++] = SOLUTION_MOVE(source, SOLUTION_FOUNDATION);
+
+            if ((card & 0xf) == 0)
+            {
+                continue;
+            }
+        }
+
+        for (dest = 0; dest < CASCADES; dest++)
+        {
+            if (dest == source || state->cascade_counts[dest] == 0)
+            {
+                continue;
+            }
+
+            if (
+                state->cascade_counts[dest] < MAX_CASCADE &&
+                can_move_card_onto_card(card, state->cascades[dest][state->cascade_counts[dest] - 1])
+            )
+            {
+                moves[count++] = SOLUTION_MOVE(source, dest);
+            }
+        }
+
+        // all empty cascades and freecells are alike, so only try the first one
+        // and don't bother moving a lone card from one empty cascade to another
+        if (
+            first_empty_cascade != NO_CARD &&
+            can_move_card_to_empty_cascade(card) &&
+            !(source < CASCADES && state->cascade_counts[source] == 1)
+        )
+        {
+            moves[count++] = SOLUTION_MOVE(source, first_empty_cascade);
+        }
+
+        if (first_empty_freecell != NO_CARD && source < CASCADES)
+        {
+            moves[count++] = SOLUTION_MOVE(source, SOLUTION_FREECELL_0 + first_empty_freecell);
+        }
+    }
+
+    return count;
+}
+
+// weighted best first search, returns the node count used
+static uint32_t solve(solver_t *solver, uint16_t seed, deal_result_t *result)
+{
+    // an ace, two cascades, an empty cascade and a freecell per card
+    solution_move_t moves[(CASCADES + FREECELLS) * 5];
+    uint8_t i, move_count;
+    uint32_t heap_count = 0;
+    uint32_t node_count = 1;
+    uint32_t current, length;
+    solver_node_t *node, *child;
+
+    memset(solver->seen, 0, (solver->seen_mask + 1) * sizeof(uint64_t));
+
+    node = &solver->nodes[0];
+    deal_seed(seed, &node->state);
+    node->parent = 0;
+    node->depth = 0;
+    node->move = 0;
+
+    seen_insert(solver, canonical_hash(&node->state));
+    heap_push(solver, &heap_count, heuristic(&node->state), 0);
+
+    result->solved = 0;
+    result->length = 0;
+    result->solution = NULL;
+
+    while (heap_count > 0)
+    {
+        current = heap_pop(solver, &heap_count);
+        node = &solver->nodes[current];
+
+        if (is_won(&node->state))
+        {
+            result->solved = 1;
+            result->length = node->depth;
+            result->solution = malloc(node->depth * sizeof(solution_move_t));
+
+            for (length = node->depth; current != 0; current = solver->nodes[current].parent)
+            {
+                result->solution[--length] = solver->nodes[current].move;
+            }
+
+            break;
+        }
+
+        move_count = generate_moves(&node->state, moves);
+
+        for (i = 0; i < move_count && node_count < solver->node_limit; i++)
+        {
+            child = &solver->nodes[node_count];
+            child->state = node->state;
+            apply_move(&child->state, moves[i]);
+
+            if (!seen_insert(solver, canonical_hash(&child->state)))
+            {
+                continue;
+            }
+
+            child->parent = current;
+            child->depth = node->depth + 1;
+            child->move = moves[i];
+
+            heap_push(solver, &heap_count, heuristic(&child->state) + child->depth, node_count);
+            node_count++;
+        }
+    }
+
+    result->nodes = node_count;
+    return node_count;
+}
+
+// seeds left in a worker's range, which other workers may be changing
+static uint32_t range_remaining(int worker)
+{
+    uint32_t remaining;
+
+    pthread_mutex_lock(&ranges[worker].lock);
+    remaining = ranges[worker].end - ranges[worker].next;
+    pthread_mutex_unlock(&ranges[worker].lock);
+
+    return remaining;
+}
+
+// get the next seed for this worker, stealing from another worker if needed
+static int next_seed(int worker, uint32_t *seed)
+{
+    int i, victim;
+    uint32_t remaining, best, steal_start, steal_end;
+    work_range_t *own = &ranges[worker];
+
+    pthread_mutex_lock(&own->lock);
+
+    if (own->next < own->end)
+    {
+        *seed = own->next++;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+
+    pthread_mutex_unlock(&own->lock);
+
+    while (1)
+    {
+        // pick the worker with the most work left
+        victim = -1;
+        best = 0;
+
+        for (i = 0; i < worker_count; i++)
+        {
+            if (i == worker)
+            {
+                continue;
+            }
+
+            remaining = range_remaining(i);
+
+            if (remaining > best)
+            {
+                best = remaining;
+                victim = i;
+            }
+        }
+
+        if (victim < 0)
+        {
+            return 0;
+        }
+
+        pthread_mutex_lock(&ranges[victim].lock);
+        remaining = ranges[victim].end - ranges[victim].next;
+
+        if (remaining == 0)
+        {
+            pthread_mutex_unlock(&ranges[victim].lock);
+            continue;
+        }
+
+        // take the back half, or everything if there's only a little left
+        steal_start = (remaining < MIN_STEAL) ? ranges[victim].next : ranges[victim].end - (remaining >> 1);
+        *seed = steal_start;
+
+        steal_end = ranges[victim].end;
+        ranges[victim].end = steal_start;
+        pthread_mutex_unlock(&ranges[victim].lock);
+
+        // only one lock is held at a time, so workers stealing
+        // from each other can't deadlock
+        pthread_mutex_lock(&own->lock);
+        own->next = steal_start + 1;
+        own->end = steal_end;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    int worker = (int) (intptr_t) arg;
+    uint32_t seed;
+    solver_t solver;
+
+    solver.node_limit = node_limit;
+    solver.nodes = malloc(sizeof(solver_node_t) * node_limit);
+    solver.heap = malloc(sizeof(heap_entry_t) * node_limit);
+
+    // keep the hash table under half full
+    for (solver.seen_mask = 1024; solver.seen_mask < node_limit * 2; solver.seen_mask <<= 1);
+    solver.seen = malloc(sizeof(uint64_t) * solver.seen_mask);
+    solver.seen_mask--;
+
+    if (solver.nodes == NULL || solver.heap == NULL || solver.seen == NULL)
+    {
+        fprintf(stderr, "dealsolve: out of memory\n");
+        exit(1);
+    }
+
+    while (next_seed(worker, &seed))
+    {
+        solve(&solver, seed, &results[seed]);
+    }
+
+    free(solver.nodes);
+    free(solver.heap);
+    free(solver.seen);
+    return NULL;
+}
+
+static double difficulty_score(const deal_result_t *result)
+{
+    // long solutions which took a lot of searching to find are hard
+    return result->length + 8.0 * log2(result->nodes + 1.0);
+}
+
+static int compare_scores(const void *a, const void *b)
+{
+    double x = difficulty_score(&results[*(const uint32_t *) a]);
+    double y = difficulty_score(&results[*(const uint32_t *) b]);
+    return (x > y) - (x < y);
+}
+
+// split the solved deals into 15 equally sized difficulty bands
+static void rank_difficulty(uint32_t first, uint32_t count)
+{
+    uint32_t i, solved = 0;
+    uint32_t *order = malloc(sizeof(uint32_t) * count);
+
+    for (i = first; i < first + count; i++)
+    {
+        results[i].difficulty = 0;
+
+        if (results[i].solved)
+        {
+            order[solved++] = i;
+        }
+    }
+
+    qsort(order, solved, sizeof(uint32_t), compare_scores);
+
+    for (i = 0; i < solved; i++)
+    {
+        results[order[i]].difficulty = 1 + (i * 15) / solved;
+    }
+
+    free(order);
+}
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: dealsolve [options]\n"
+        "  -j threads    worker threads (default: all cores)\n"
+        "  -f seed       first seed to solve (default: 0)\n"
+        "  -c count      number of seeds to solve (default: 65536)\n"
+        "  -l nodes      give up on a deal after this many nodes (default: %d)\n"
+        "  -o file       write per-seed results as csv\n"
+        "  -s file       write solutions as packed move streams\n"
+        "  -r file       write the packed rom difficulty table\n",
+        DEFAULT_NODE_LIMIT
+    );
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int opt, i;
+    uint32_t first = 0, count = SEED_COUNT, solved = 0;
+    const char *csv_path = NULL, *solution_path = NULL, *rom_path = NULL;
+    pthread_t *threads;
+    FILE *file;
+
+    worker_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    while ((opt = getopt(argc, argv, "j:f:c:l:o:s:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'j': worker_count = atoi(optarg); break;
+        case 'f': first = strtoul(optarg, NULL, 0); break;
+        case 'c': count = strtoul(optarg, NULL, 0); break;
+        case 'l': node_limit = strtoul(optarg, NULL, 0); break;
+        case 'o': csv_path = optarg; break;
+        case 's': solution_path = optarg; break;
+        case 'r': rom_path = optarg; break;
+        default: usage();
+        }
+    }
+
+    if (worker_count < 1 || first >= SEED_COUNT || count == 0 || node_limit < 1024)
+    {
+        usage();
+    }
+
+    if (first + count > SEED_COUNT)
+    {
+        count = SEED_COUNT - first;
+    }
+
+    if (rom_path != NULL && (first != 0 || count != SEED_COUNT))
+    {
+        fprintf(stderr, "dealsolve: the rom table needs every seed to be solved\n");
+        return 1;
+    }
+
+    // hand out the seeds evenly to start with
+    ranges = calloc(worker_count, sizeof(work_range_t));
+    threads = calloc(worker_count, sizeof(pthread_t));
+
+    for (i = 0; i < worker_count; i++)
+    {
+        pthread_mutex_init(&ranges[i].lock, NULL);
+        ranges[i].next = first + (uint32_t) (((uint64_t) count * i) / worker_count);
+        ranges[i].end = first + (uint32_t) (((uint64_t) count * (i + 1)) / worker_count);
+    }
+
+    for (i = 0; i < worker_count; i++)
+    {
+        pthread_create(&threads[i], NULL, worker_main, (void *) (intptr_t) i);
+    }
+
+    for (i = 0; i < worker_count; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    rank_difficulty(first, count);
+
+    for (i = first; i < first + count; i++)
+    {
+        solved += results[i].solved;
+    }
+
+    fprintf(stderr, "dealsolve: solved %u of %u deals\n", solved, count);
+
+    if (csv_path != NULL)
+    {
+        if ((file = fopen(csv_path, "w")) == NULL)
+        {
+            perror(csv_path);
+            return 1;
+        }
+
+        fprintf(file, "seed,solvable,length,nodes,difficulty\n");
+
+        for (i = first; i < first + count; i++)
+        {
+            fprintf(file, "%d,%d,%d,%u,%d\n", i, results[i].solved, results[i].length, results[i].nodes, results[i].difficulty);
+        }
+
+        fclose(file);
+    }
+
+    if (solution_path != NULL)
+    {
+        if ((file = fopen(solution_path, "w")) == NULL)
+        {
+            perror(solution_path);
+            return 1;
+        }
+
+        // one line per solved seed: seed, then the moves in hex
+        for (i = first; i < first + count; i++)
+        {
+            if (results[i].solved)
+            {
+                fprintf(file, "%d ", i);
+
+                for (opt = 0; opt < results[i].length; opt++)
+                {
+                    fprintf(file, "%0*x", (int) (sizeof(solution_move_t) * 2), results[i].solution[opt]);
+                }
+
+                fprintf(file, "\n");
+            }
+        }
+
+        fclose(file);
+    }
+
+    if (rom_path != NULL)
+    {
+        if ((file = fopen(rom_path, "wb")) == NULL)
+        {
+            perror(rom_path);
+            return 1;
+        }
+
+        // two seeds per byte, even seed in the low nibble
+        for (i = 0; i < SEED_COUNT; i += 2)
+        {
+            fputc(results[i].difficulty | (results[i + 1].difficulty << 4), file);
+        }
+
+        fclose(file);
+    }
+
+    return 0;
+}
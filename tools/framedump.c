@@ -0,0 +1,1226 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// replays a game from the solution book through the game's own renderer
+// on the host, the same way the title screen's attract mode plays it,
+// and turns what ends up in the screens, sprites, tile memory and
+// palettes back into pixels. the layers are composed the way the
+// wonderswan does it, in colour or on mono hardware through the shade lut
+//
+// chosen frames are written out as pngs, or compared against golden
+// images written out by an earlier run. every write to video memory can
+// also be counted, along with the ones which write what was already
+// there, for each frame and for each function in the game doing the
+// writing, so redraws which aren't needed stand out
+//
+// usage: framedump [-m] [-w] [-g game] [-f frames] [-n worst] [-o dir | -d dir]
+//   -m  mono hardware rather than colour
+//   -w  count video memory writes, linux on x86-64 only
+//   -g  game in the solution book to replay, from 0
+//   -f  comma separated frames to write out, 0 being the freshly dealt board
+//   -n  number of frames with the most writes to list
+//   -o  write frame_NNNN.png to dir
+//   -d  compare against the frame_NNNN.png in dir instead, exits with 1
+//       if any of them differ
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ws.h>
+#include "autoplay.h"
+#include "card.h"
+#include "draw.h"
+#include "flight.h"
+#include "solution.h"
+#include "tween.h"
+#include "zobrist.h"
+#include "asset_pack.h"
+
+#define IRAM_IMPLEMENTATION
+#include "iram.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+#define FRAMEDUMP_TRACE 1
+#include <elf.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#else
+#define FRAMEDUMP_TRACE 0
+#endif
+
+#define SCREEN_WIDTH (WS_DISPLAY_WIDTH_TILES << 3)
+#define SCREEN_HEIGHT (WS_DISPLAY_HEIGHT_TILES << 3)
+
+// the replay stops here if the solution somehow never finishes
+#define MAX_FRAMES 20000
+#define MAX_WANTED 256
+#define MAX_WORST 64
+
+// not in the host's ws.h as the game doesn't use them
+#define DISPLAY_BACK_PORT 0x01
+#define DISPLAY_SHADE_LUT_PORT 0x1C
+
+// where the cards are dealt from, see main.c
+#define DEAL_FROM_X (((WS_DISPLAY_WIDTH_TILES - 3) << 3) / 2)
+#define DEAL_FROM_Y (WS_DISPLAY_HEIGHT_TILES << 3)
+
+extern bool host_color;
+
+static uint8_t frame_rgb[SCREEN_WIDTH * SCREEN_HEIGHT * 3];
+static uint8_t golden_rgb[SCREEN_WIDTH * SCREEN_HEIGHT * 3];
+
+static unsigned wanted[MAX_WANTED];
+static unsigned wanted_count;
+
+// the replay is silent, as the attract mode is, and races nobody
+void sfx_play(uint8_t effect) {}
+void wait_for_vblank() {}
+void race_move(uint8_t source, uint8_t dest, uint8_t card) {}
+
+// Rasteriser
+// ----------
+
+// colour index of a pixel of a tile, 0 being transparent
+static uint8_t tile_pixel(uint16_t tile, uint8_t x, uint8_t y)
+{
+    const uint8_t *row;
+
+    if (host_color)
+    {
+        // packed, two pixels a byte with the left one in the high nibble
+        row = WS_TILE_4BPP_MEM(tile) + (y << 2);
+        return (x & 1) ? (row[x >> 1] & 0xf) : (row[x >> 1] >> 4);
+    }
+
+    // planar, a byte for each bit of a row of 8 pixels
+    row = WS_TILE_MEM(tile) + (y << 1);
+    return ((row[0] >> (7 - x)) & 1) | (((row[1] >> (7 - x)) & 1) << 1);
+}
+
+static uint8_t opaque(uint8_t palette, uint8_t index)
+{
+    // on mono hardware the first four palettes of each eight
+    // draw colour 0 rather than leaving it transparent
+    return index != 0 || (!host_color && !(palette & 4));
+}
+
+static void shade_rgb(uint8_t shade, uint8_t *rgb)
+{
+    uint32_t lut = inportw(DISPLAY_SHADE_LUT_PORT) | ((uint32_t) inportw(DISPLAY_SHADE_LUT_PORT + 2) << 16);
+    uint8_t grey = 255 - (((lut >> ((shade & 7) << 2)) & 0xf) * 17);
+
+    rgb[0] = rgb[1] = rgb[2] = grey;
+}
+
+static void palette_rgb(uint8_t palette, uint8_t index, uint8_t *rgb)
+{
+    uint16_t colour;
+
+    if (!host_color)
+    {
+        shade_rgb(inportw(WS_SCR_PAL_PORT(palette)) >> (index << 2), rgb);
+        return;
+    }
+
+    colour = WS_DISPLAY_COLOR_MEM(palette)[index];
+    rgb[0] = ((colour >> 8) & 0xf) * 17;
+    rgb[1] = ((colour >> 4) & 0xf) * 17;
+    rgb[2] = (colour & 0xf) * 17;
+}
+
+// the host's arrays aren't at their iram addresses, so the screen base
+// port is matched against what the game would have written for each
+static const uint16_t *screen_at(uint8_t base)
+{
+    const uint16_t *pages[] = { screen_1, screen_1_page_2, screen_2, screen_2_page_2 };
+    uint8_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (WS_SCR_BASE_ADDR1(pages[i]) == base)
+        {
+            return pages[i];
+        }
+    }
+
+    return NULL;
+}
+
+// the colour index of a screen at a pixel of the display, with its
+// palette in the high nibble, or 0xff where it's transparent
+static uint8_t screen_pixel(const uint16_t *screen, uint8_t scroll_x, uint8_t scroll_y, uint8_t x, uint8_t y)
+{
+    uint16_t attr, tile;
+    uint8_t tx, ty, palette, index;
+
+    x += scroll_x;
+    y += scroll_y;
+    attr = screen[(x >> 3) + ((y >> 3) << 5)];
+
+    // colour mode has a second bank of tiles
+    tile = (attr & 0x1ff) | ((host_color && (attr & 0x2000)) ? 0x200 : 0);
+    palette = (attr >> 9) & 0xf;
+    tx = (attr & WS_SCREEN_ATTR_FLIP_H) ? (7 - (x & 7)) : (x & 7);
+    ty = (attr & WS_SCREEN_ATTR_FLIP_V) ? (7 - (y & 7)) : (y & 7);
+    index = tile_pixel(tile, tx, ty);
+
+    return opaque(palette, index) ? ((palette << 4) | index) : 0xff;
+}
+
+// draw the sprites into a layer for those behind screen 2 and one for
+// those in front of it. lower numbered sprites go in front of higher ones
+static void draw_sprite_layers(uint8_t *behind, uint8_t *in_front)
+{
+    uint8_t first = inportb(WS_SPR_FIRST_PORT);
+    uint8_t count = inportb(WS_SPR_COUNT_PORT);
+    const ws_sprite_t *sprite;
+    uint8_t *layer, palette, index, tx, ty;
+    int i, x, y, px, py;
+
+    memset(behind, 0xff, SCREEN_WIDTH * SCREEN_HEIGHT);
+    memset(in_front, 0xff, SCREEN_WIDTH * SCREEN_HEIGHT);
+
+    for (i = first + count - 1; i >= first; i--)
+    {
+        sprite = &sprites[i & 0x7f];
+        layer = (sprite->attr & WS_SPRITE_ATTR_PRIORITY) ? in_front : behind;
+        palette = 8 + ((sprite->attr >> 9) & 7);
+
+        for (y = 0; y < 8; y++)
+        {
+            for (x = 0; x < 8; x++)
+            {
+                // positions wrap around the 256 pixel space
+                px = (uint8_t) (sprite->x + x);
+                py = (uint8_t) (sprite->y + y);
+
+                if (px >= SCREEN_WIDTH || py >= SCREEN_HEIGHT)
+                {
+                    continue;
+                }
+
+                tx = (sprite->attr & WS_SCREEN_ATTR_FLIP_H) ? (7 - x) : x;
+                ty = (sprite->attr & WS_SCREEN_ATTR_FLIP_V) ? (7 - y) : y;
+                index = tile_pixel(sprite->attr & 0x1ff, tx, ty);
+
+                if (opaque(palette, index))
+                {
+                    layer[px + (py * SCREEN_WIDTH)] = (palette << 4) | index;
+                }
+            }
+        }
+    }
+}
+
+// compose the display as the hardware would show it right now: the
+// backdrop, screen 1, sprites behind screen 2, screen 2, then the rest
+// of the sprites. windows and the 32 sprites a line limit aren't
+// modelled, as the game doesn't rely on either
+static void rasterise(uint8_t *rgb)
+{
+    static uint8_t behind[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint8_t in_front[SCREEN_WIDTH * SCREEN_HEIGHT];
+    uint16_t ctrl = inportw(WS_DISPLAY_CTRL_PORT);
+    uint8_t base = inportb(WS_SCR_BASE_PORT);
+    const uint16_t *scr1 = screen_at(base & 0xf);
+    const uint16_t *scr2 = screen_at(base >> 4);
+    uint8_t back[3], x, y, pixel;
+    uint8_t *out = rgb;
+    int i;
+
+    if (host_color)
+    {
+        palette_rgb(inportb(DISPLAY_BACK_PORT) >> 4, inportb(DISPLAY_BACK_PORT) & 0xf, back);
+    }
+    else
+    {
+        shade_rgb(inportb(DISPLAY_BACK_PORT), back);
+    }
+
+    if (ctrl & WS_DISPLAY_CTRL_SPR_ENABLE)
+    {
+        draw_sprite_layers(behind, in_front);
+    }
+    else
+    {
+        memset(behind, 0xff, sizeof(behind));
+        memset(in_front, 0xff, sizeof(in_front));
+    }
+
+    for (y = 0, i = 0; y < SCREEN_HEIGHT; y++)
+    {
+        for (x = 0; x < SCREEN_WIDTH; x++, i++, out += 3)
+        {
+            pixel = in_front[i];
+
+            if (pixel == 0xff && scr2 != NULL && (ctrl & WS_DISPLAY_CTRL_SCR2_ENABLE))
+            {
+                pixel = screen_pixel(scr2, inportb(WS_SCR2_SCRL_X_PORT), inportb(WS_SCR2_SCRL_Y_PORT), x, y);
+            }
+
+            if (pixel == 0xff)
+            {
+                pixel = behind[i];
+            }
+
+            if (pixel == 0xff && scr1 != NULL && (ctrl & WS_DISPLAY_CTRL_SCR1_ENABLE))
+            {
+                pixel = screen_pixel(scr1, inportb(WS_SCR1_SCRL_X_PORT), inportb(WS_SCR1_SCRL_Y_PORT), x, y);
+            }
+
+            if (pixel == 0xff)
+            {
+                memcpy(out, back, 3);
+            }
+            else
+            {
+                palette_rgb(pixel >> 4, pixel & 0xf, out);
+            }
+        }
+    }
+}
+
+// Pngs
+// ----
+
+// frames are written uncompressed, in stored deflate blocks, which keeps
+// this free of any libraries. golden images are read back the same way,
+// so they have to have been written by framedump
+
+#define PNG_ROW (1 + (SCREEN_WIDTH * 3))
+#define PNG_RAW (PNG_ROW * SCREEN_HEIGHT)
+#define PNG_BLOCK 0xffff
+
+static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+static uint32_t crc_table[256];
+
+static void put_be32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length)
+{
+    uint32_t c;
+    int i, k;
+
+    if (crc_table[1] == 0)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            for (c = i, k = 0; k < 8; k++)
+            {
+                c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+            }
+
+            crc_table[i] = c;
+        }
+    }
+
+    crc = ~crc;
+
+    while (length-- > 0)
+    {
+        crc = crc_table[(crc ^ *(data++)) & 0xff] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+static void write_chunk(FILE *file, const char *type, const uint8_t *data, uint32_t length)
+{
+    uint8_t word[4];
+    uint32_t crc;
+
+    put_be32(word, length);
+    fwrite(word, 1, 4, file);
+    fwrite(type, 1, 4, file);
+    fwrite(data, 1, length, file);
+
+    crc = crc32(crc32(0, (const uint8_t*) type, 4), data, length);
+    put_be32(word, crc);
+    fwrite(word, 1, 4, file);
+}
+
+static int write_png(const char *path, const uint8_t *rgb)
+{
+    static uint8_t raw[PNG_RAW];
+    static uint8_t idat[2 + PNG_RAW + ((PNG_RAW / PNG_BLOCK) + 1) * 5 + 4];
+    uint8_t ihdr[13] = { 0 };
+    uint32_t a = 1, b = 0, i, length;
+    uint8_t *out = idat;
+    FILE *file;
+    int y;
+
+    for (y = 0; y < SCREEN_HEIGHT; y++)
+    {
+        raw[y * PNG_ROW] = 0;
+        memcpy(&raw[(y * PNG_ROW) + 1], &rgb[y * SCREEN_WIDTH * 3], SCREEN_WIDTH * 3);
+    }
+
+    // zlib header, then stored blocks, then the adler32 of the raw data
+    *(out++) = 0x78;
+    *(out++) = 0x01;
+
+    for (i = 0; i < PNG_RAW; i += length)
+    {
+        length = (PNG_RAW - i < PNG_BLOCK) ? (PNG_RAW - i) : PNG_BLOCK;
+        *(out++) = (i + length == PNG_RAW) ? 1 : 0;
+        *(out++) = length;
+        *(out++) = length >> 8;
+        *(out++) = ~length;
+        *(out++) = ~length >> 8;
+        memcpy(out, &raw[i], length);
+        out += length;
+    }
+
+    for (i = 0; i < PNG_RAW; i++)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    put_be32(out, (b << 16) | a);
+    out += 4;
+
+    put_be32(&ihdr[0], SCREEN_WIDTH);
+    put_be32(&ihdr[4], SCREEN_HEIGHT);
+    ihdr[8] = 8;
+    ihdr[9] = 2;
+
+    if ((file = fopen(path, "wb")) == NULL)
+    {
+        fprintf(stderr, "framedump: can't write %s\n", path);
+        return 0;
+    }
+
+    fwrite(png_signature, 1, 8, file);
+    write_chunk(file, "IHDR", ihdr, sizeof(ihdr));
+    write_chunk(file, "IDAT", idat, out - idat);
+    write_chunk(file, "IEND", NULL, 0);
+    fclose(file);
+
+    return 1;
+}
+
+// returns 0 if the file can't be read or wasn't written by framedump
+static int read_png(const char *path, uint8_t *rgb)
+{
+    static uint8_t file_data[PNG_RAW * 2];
+    static uint8_t raw[PNG_RAW];
+    uint8_t idat[sizeof(file_data)];
+    size_t size, idat_size = 0, offset = 8, raw_size = 0;
+    uint32_t length, stored;
+    const uint8_t *p;
+    FILE *file;
+    int y, last = 0;
+
+    if ((file = fopen(path, "rb")) == NULL)
+    {
+        return 0;
+    }
+
+    size = fread(file_data, 1, sizeof(file_data), file);
+    fclose(file);
+
+    if (size < 8 || memcmp(file_data, png_signature, 8) != 0)
+    {
+        return 0;
+    }
+
+    while (offset + 12 <= size)
+    {
+        length = get_be32(&file_data[offset]);
+
+        if (offset + 12 + length > size)
+        {
+            return 0;
+        }
+
+        p = &file_data[offset + 8];
+
+        if (memcmp(&file_data[offset + 4], "IHDR", 4) == 0
+            && (get_be32(p) != SCREEN_WIDTH || get_be32(p + 4) != SCREEN_HEIGHT || p[8] != 8 || p[9] != 2))
+        {
+            return 0;
+        }
+
+        if (memcmp(&file_data[offset + 4], "IDAT", 4) == 0)
+        {
+            memcpy(&idat[idat_size], p, length);
+            idat_size += length;
+        }
+
+        offset += 12 + length;
+    }
+
+    // only stored blocks, each starting on a byte of its own
+    for (offset = 2; !last && offset + 5 <= idat_size; offset += 5 + stored)
+    {
+        last = idat[offset] & 1;
+        stored = idat[offset + 1] | (idat[offset + 2] << 8);
+
+        if ((idat[offset] & 6) != 0 || raw_size + stored > PNG_RAW || offset + 5 + stored > idat_size)
+        {
+            return 0;
+        }
+
+        memcpy(&raw[raw_size], &idat[offset + 5], stored);
+        raw_size += stored;
+    }
+
+    if (raw_size != PNG_RAW)
+    {
+        return 0;
+    }
+
+    for (y = 0; y < SCREEN_HEIGHT; y++)
+    {
+        if (raw[y * PNG_ROW] != 0)
+        {
+            return 0;
+        }
+
+        memcpy(&rgb[y * SCREEN_WIDTH * 3], &raw[(y * PNG_ROW) + 1], SCREEN_WIDTH * 3);
+    }
+
+    return 1;
+}
+
+// Write accounting
+// ----------------
+
+// video memory is kept read only while the replay runs. each store to it
+// faults, and the handler lets it through for one instruction with the
+// trap flag set, then compares what it wrote once it's done. the game's
+// sources are built with -finstrument-functions for this tool, so the
+// write goes down to whichever of its functions was running
+//
+// stores wider than a word, e.g. from memcpy, count a write for each
+// word they change, and one more if the word they fault on is unchanged
+
+#define MAX_FUNCTIONS 128
+#define TRACE_DEPTH 64
+// pages one instruction can touch
+#define TRACE_PAGES 4
+
+typedef struct {
+    const char *name;
+    uint8_t *start;
+    size_t size;
+} trace_region_t;
+
+typedef struct {
+    void *fn;
+    unsigned long writes;
+    unsigned long redundant;
+} trace_function_t;
+
+typedef struct {
+    unsigned frame;
+    unsigned long writes;
+    unsigned long redundant;
+} trace_frame_t;
+
+#if FRAMEDUMP_TRACE
+// everything the fault handler changes lives in its own mapping, so it
+// can never share a page with video memory
+typedef struct {
+    void *stack[TRACE_DEPTH];
+    unsigned depth;
+
+    uintptr_t pages[TRACE_PAGES];
+    unsigned page_count;
+    uintptr_t fault;
+    uint8_t *snapshots;
+
+    unsigned long writes;
+    unsigned long redundant;
+
+    trace_function_t functions[MAX_FUNCTIONS];
+    unsigned function_count;
+} trace_state_t;
+
+static trace_state_t *trace;
+static uintptr_t page_size;
+#endif
+
+static trace_region_t regions[] = {
+    { "screen_1", (uint8_t*) screen_1, sizeof(screen_1) },
+    { "screen_1_page_2", (uint8_t*) screen_1_page_2, sizeof(screen_1_page_2) },
+    { "screen_2", (uint8_t*) screen_2, sizeof(screen_2) },
+    { "screen_2_page_2", (uint8_t*) screen_2_page_2, sizeof(screen_2_page_2) },
+    { "sprites", (uint8_t*) sprites, sizeof(sprites) },
+    { "tiles", host_iram + 0x2000, 0x6000 },
+    { "palettes", host_iram + 0xFE00, 0x200 },
+};
+
+#define REGION_COUNT (sizeof(regions) / sizeof(regions[0]))
+
+static trace_frame_t *frames;
+static unsigned frame_count;
+
+#if FRAMEDUMP_TRACE
+__attribute__((no_instrument_function))
+void __cyg_profile_func_enter(void *fn, void *call_site)
+{
+    if (trace != NULL && trace->depth++ < TRACE_DEPTH)
+    {
+        trace->stack[trace->depth - 1] = fn;
+    }
+}
+
+__attribute__((no_instrument_function))
+void __cyg_profile_func_exit(void *fn, void *call_site)
+{
+    if (trace != NULL && trace->depth > 0)
+    {
+        trace->depth--;
+    }
+}
+
+static int in_region(uintptr_t address)
+{
+    unsigned i;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        if (address >= (uintptr_t) regions[i].start && address < (uintptr_t) regions[i].start + regions[i].size)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int on_region_page(uintptr_t page)
+{
+    unsigned i;
+    uintptr_t start, end;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        start = (uintptr_t) regions[i].start & ~(page_size - 1);
+        end = (uintptr_t) regions[i].start + regions[i].size;
+
+        if (page >= start && page < end)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void protect_regions(int prot)
+{
+    uintptr_t start, end;
+    unsigned i;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        start = (uintptr_t) regions[i].start & ~(page_size - 1);
+        end = ((uintptr_t) regions[i].start + regions[i].size + page_size - 1) & ~(page_size - 1);
+        mprotect((void*) start, end - start, prot);
+    }
+}
+
+static void count_write(int redundant)
+{
+    trace_function_t *function;
+    void *fn = (trace->depth > 0 && trace->depth <= TRACE_DEPTH) ? trace->stack[trace->depth - 1] : NULL;
+    unsigned i;
+
+    for (i = 0; i < trace->function_count && trace->functions[i].fn != fn; i++)
+    {
+    }
+
+    if (i == MAX_FUNCTIONS)
+    {
+        i = MAX_FUNCTIONS - 1;
+    }
+    else if (i == trace->function_count)
+    {
+        trace->functions[trace->function_count++].fn = fn;
+    }
+
+    function = &trace->functions[i];
+    function->writes++;
+    trace->writes++;
+
+    if (redundant)
+    {
+        function->redundant++;
+        trace->redundant++;
+    }
+}
+
+static void on_fault(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = context;
+    uintptr_t address = (uintptr_t) info->si_addr;
+    uintptr_t page = address & ~(page_size - 1);
+
+    // anything else is a real crash
+    if (!on_region_page(page) || trace->page_count == TRACE_PAGES)
+    {
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    if (trace->page_count == 0)
+    {
+        trace->fault = address;
+    }
+
+    memcpy(trace->snapshots + (trace->page_count * page_size), (void*) page, page_size);
+    trace->pages[trace->page_count++] = page;
+
+    mprotect((void*) page, page_size, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= 0x100;
+}
+
+static void on_step(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = context;
+    const uint16_t *before, *after;
+    uintptr_t fault_word = trace->fault & ~(uintptr_t) 1;
+    unsigned i, word, fault_changed = 0;
+
+    for (i = 0; i < trace->page_count; i++)
+    {
+        before = (const uint16_t*) (trace->snapshots + (i * page_size));
+        after = (const uint16_t*) trace->pages[i];
+
+        for (word = 0; word < page_size >> 1; word++)
+        {
+            if (before[word] != after[word] && in_region((uintptr_t) &after[word]))
+            {
+                count_write(0);
+                fault_changed |= ((uintptr_t) &after[word] == fault_word);
+            }
+        }
+
+        mprotect((void*) trace->pages[i], page_size, PROT_READ);
+    }
+
+    if (!fault_changed && in_region(fault_word))
+    {
+        count_write(1);
+    }
+
+    trace->page_count = 0;
+    uc->uc_mcontext.gregs[REG_EFL] &= ~0x100;
+}
+
+static int trace_start()
+{
+    struct sigaction action;
+
+    page_size = sysconf(_SC_PAGESIZE);
+    trace = mmap(NULL, sizeof(trace_state_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (trace == MAP_FAILED)
+    {
+        trace = NULL;
+        return 0;
+    }
+
+    memset(trace, 0, sizeof(trace_state_t));
+    trace->snapshots = mmap(NULL, page_size * TRACE_PAGES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO;
+    action.sa_sigaction = on_fault;
+    sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = on_step;
+    sigaction(SIGTRAP, &action, NULL);
+
+    protect_regions(PROT_READ);
+    return 1;
+}
+
+static void trace_stop()
+{
+    protect_regions(PROT_READ | PROT_WRITE);
+    signal(SIGSEGV, SIG_DFL);
+    signal(SIGTRAP, SIG_DFL);
+}
+
+// the names of the game's functions, from the symbol table of the
+// running executable
+static char *exe_data;
+static const Elf64_Sym *exe_symbols;
+static size_t exe_symbol_count;
+static const char *exe_names;
+static uintptr_t exe_base;
+
+int main(int argc, char **argv);
+
+static void load_symbols()
+{
+    const Elf64_Ehdr *header;
+    const Elf64_Shdr *sections;
+    size_t size;
+    FILE *file;
+    unsigned i;
+
+    if ((file = fopen("/proc/self/exe", "rb")) == NULL)
+    {
+        return;
+    }
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    exe_data = malloc(size);
+    size = fread(exe_data, 1, size, file);
+    fclose(file);
+
+    header = (const Elf64_Ehdr*) exe_data;
+    sections = (const Elf64_Shdr*) (exe_data + header->e_shoff);
+
+    for (i = 0; i < header->e_shnum; i++)
+    {
+        if (sections[i].sh_type == SHT_SYMTAB)
+        {
+            exe_symbols = (const Elf64_Sym*) (exe_data + sections[i].sh_offset);
+            exe_symbol_count = sections[i].sh_size / sizeof(Elf64_Sym);
+            exe_names = exe_data + sections[sections[i].sh_link].sh_offset;
+        }
+    }
+
+    // position independent executables are loaded somewhere else
+    for (i = 0; i < exe_symbol_count; i++)
+    {
+        if (strcmp(exe_names + exe_symbols[i].st_name, "main") == 0)
+        {
+            exe_base = (uintptr_t) main - exe_symbols[i].st_value;
+        }
+    }
+}
+
+static const char *function_name(void *fn)
+{
+    size_t i;
+
+    if (fn == NULL)
+    {
+        return "(framedump)";
+    }
+
+    for (i = 0; i < exe_symbol_count; i++)
+    {
+        if (ELF64_ST_TYPE(exe_symbols[i].st_info) == STT_FUNC && exe_symbols[i].st_value + exe_base == (uintptr_t) fn)
+        {
+            return exe_names + exe_symbols[i].st_name;
+        }
+    }
+
+    return "(unknown)";
+}
+
+static int compare_functions(const void *a, const void *b)
+{
+    const trace_function_t *fa = a, *fb = b;
+
+    return (fa->writes < fb->writes) - (fa->writes > fb->writes);
+}
+
+static int compare_frames(const void *a, const void *b)
+{
+    const trace_frame_t *fa = a, *fb = b;
+
+    return (fa->writes < fb->writes) - (fa->writes > fb->writes);
+}
+
+static void percent(unsigned long part, unsigned long whole, char *out)
+{
+    sprintf(out, "%5.1f%%", whole ? (part * 100.0) / whole : 0.0);
+}
+
+static void report_writes(unsigned worst)
+{
+    trace_frame_t *ranked;
+    char share[16];
+    unsigned i;
+
+    printf(
+        "  %lu video memory writes, %lu a frame on average, %lu of them redundant\n",
+        trace->writes, trace->writes / frame_count, trace->redundant
+    );
+
+    load_symbols();
+    qsort(trace->functions, trace->function_count, sizeof(trace_function_t), compare_functions);
+
+    printf("  by function\n");
+    printf("    %-32s %9s %9s %6s\n", "function", "writes", "redundant", "");
+
+    for (i = 0; i < trace->function_count; i++)
+    {
+        percent(trace->functions[i].redundant, trace->functions[i].writes, share);
+        printf(
+            "    %-32s %9lu %9lu %s\n",
+            function_name(trace->functions[i].fn),
+            trace->functions[i].writes, trace->functions[i].redundant, share
+        );
+    }
+
+    ranked = malloc(sizeof(trace_frame_t) * frame_count);
+    memcpy(ranked, frames, sizeof(trace_frame_t) * frame_count);
+    qsort(ranked, frame_count, sizeof(trace_frame_t), compare_frames);
+
+    printf("  worst frames\n");
+    printf("    %6s %9s %9s %6s\n", "frame", "writes", "redundant", "");
+
+    for (i = 0; i < worst && i < frame_count && ranked[i].writes > 0; i++)
+    {
+        percent(ranked[i].redundant, ranked[i].writes, share);
+        printf("    %6u %9lu %9lu %s\n", ranked[i].frame, ranked[i].writes, ranked[i].redundant, share);
+    }
+
+    free(ranked);
+}
+#endif
+
+// Replay
+// ------
+
+static uint8_t dealing;
+
+// as update_game_view in main.c
+static void update_game_view()
+{
+    uint8_t row = (cursor_area == AREA_CASCADES)
+                ? cascade_card_row(cursor_x, cursor_y)
+                : 0;
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+    uint8_t column;
+#endif
+
+    scroll_board((row + CARD_ROWS > WS_DISPLAY_HEIGHT_TILES)
+                ? (row + CARD_ROWS - WS_DISPLAY_HEIGHT_TILES)
+                : 0);
+
+#if LAYOUT_WIDTH_TILES > WS_DISPLAY_WIDTH_TILES
+    column = cursor_area_tx[cursor_area] + (cursor_x * 3) + 3;
+    pan_board((column > WS_DISPLAY_WIDTH_TILES) ? (column - WS_DISPLAY_WIDTH_TILES) : 0);
+#endif
+
+    draw_cursor();
+}
+
+// set up the game screen and deal, as start_attract_mode and new_game in
+// main.c do. returns the deal's seed, or -1 if the book doesn't have the game
+static int32_t start_replay(unsigned game)
+{
+    solution_reader_t reader;
+    uint16_t seed = 0;
+
+    solution_book_open(&reader);
+
+    do
+    {
+        if (!solution_next_game(&reader, &seed))
+        {
+            return -1;
+        }
+    }
+    while (game-- > 0);
+
+    load_tiles(0, ASSET_CARDS_TILES);
+    load_tiles(TEXT_TILES, ASSET_TEXT_TILES);
+    load_tiles(YOU_WIN_TILES, ASSET_YOU_WIN_TILES);
+    load_tiles(BAIZE_TILES, ASSET_BAIZE_TILES);
+
+    zobrist_reset();
+    initialise_cascades();
+    initialise_freecells();
+    initialise_foundations();
+
+    clear_card_layer();
+    draw_baize();
+    draw_board();
+
+    deal_game(seed);
+    flight_reset();
+
+    outportb(WS_SCR_BASE_PORT, WS_SCR_BASE_ADDR1(screen_1) | WS_SCR_BASE_ADDR2(screen_2));
+
+    cursor_area = AREA_CASCADES;
+    cursor_x = 0;
+    reset_drawn_cursor();
+
+    sprites[0].attr = (CURSOR_TILES) | WS_SPRITE_ATTR_PRIORITY | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE);
+    sprites[1].attr = (CURSOR_TILES + 1) | WS_SPRITE_ATTR_PRIORITY | WS_SPRITE_ATTR_PALETTE(CARDS_PALETTE);
+
+    outportb(WS_SPR_COUNT_PORT, 0);
+    show_game_screen();
+
+    card_in_hand = NO_CARD;
+    card_in_hand_tiles_count = 0;
+    dealing = 1;
+
+    autoplay_start(AUTOPLAY_ATTRACT, &reader);
+
+    return seed;
+}
+
+// one frame of the replay, in the same order as the game loop in main.c
+// returns 0 once the game has been played out
+static int replay_frame()
+{
+    static uint8_t deal_x;
+
+    tween_update();
+    flight_update();
+
+    if (dealing)
+    {
+        if (deck_count > DEALT_FREECELLS)
+        {
+            move_top_of_deck_to_cascade(deal_x);
+            fly_card_to(cascades[deal_x][cascade_counts[deal_x] - 1], DEAL_FROM_X, DEAL_FROM_Y, deal_x, FLIGHT_DEAL_FRAMES);
+            deal_x = (deal_x + 1) % CASCADES;
+        }
+#if DEALT_FREECELLS > 0
+        else if (deck_count > 0)
+        {
+            deal_x = DEALT_FREECELLS - deck_count;
+            move_top_of_deck_to_freecell(deal_x);
+            fly_card_to(freecells[deal_x][0], DEAL_FROM_X, DEAL_FROM_Y, SOLUTION_FREECELL_0 + deal_x, FLIGHT_DEAL_FRAMES);
+        }
+#endif
+        else if (flights_active == 0)
+        {
+            cursor_y = cascade_counts[cursor_x] - 1;
+            dealing = 0;
+            deal_x = 0;
+            update_game_view();
+        }
+
+        draw_flights(2, 2);
+        return 1;
+    }
+
+    if (autoplay_update() == 0 || (card_in_hand == NO_CARD && check_if_game_won()))
+    {
+        return 0;
+    }
+
+    update_game_view();
+    draw_flights(2 + card_in_hand_tiles_count, 0);
+
+    return 1;
+}
+
+static int is_wanted(unsigned frame)
+{
+    unsigned i;
+
+    for (i = 0; i < wanted_count; i++)
+    {
+        if (wanted[i] == frame)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// write the frame out, or compare it with the golden image
+// returns 0 if it differs
+static int capture(unsigned frame, const char *out_dir, const char *golden_dir)
+{
+    char path[1024];
+    int i, x, y, differ = 0, left = SCREEN_WIDTH, top = SCREEN_HEIGHT, right = 0, bottom = 0;
+
+    rasterise(frame_rgb);
+
+    if (out_dir != NULL)
+    {
+        snprintf(path, sizeof(path), "%s/frame_%04u.png", out_dir, frame);
+        return write_png(path, frame_rgb);
+    }
+
+    snprintf(path, sizeof(path), "%s/frame_%04u.png", golden_dir, frame);
+
+    if (!read_png(path, golden_rgb))
+    {
+        printf("  frame %u: no golden image framedump can read at %s\n", frame, path);
+        return 0;
+    }
+
+    for (y = 0, i = 0; y < SCREEN_HEIGHT; y++)
+    {
+        for (x = 0; x < SCREEN_WIDTH; x++, i += 3)
+        {
+            if (memcmp(&frame_rgb[i], &golden_rgb[i], 3) != 0)
+            {
+                differ++;
+                left = (x < left) ? x : left;
+                right = (x > right) ? x : right;
+                top = (y < top) ? y : top;
+                bottom = (y > bottom) ? y : bottom;
+            }
+        }
+    }
+
+    if (differ > 0)
+    {
+        printf("  frame %u: %d pixels differ, from %d,%d to %d,%d\n", frame, differ, left, top, right, bottom);
+    }
+
+    return differ == 0;
+}
+
+static void parse_frames(char *list)
+{
+    char *token;
+
+    for (token = strtok(list, ","); token != NULL && wanted_count < MAX_WANTED; token = strtok(NULL, ","))
+    {
+        wanted[wanted_count++] = strtoul(token, NULL, 0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_dir = NULL, *golden_dir = NULL;
+    unsigned game = 0, worst = 8, frame, captured = 0, failed = 0;
+    int opt, count_writes = 0, running = 1;
+    int32_t seed;
+
+    while ((opt = getopt(argc, argv, "mwg:f:n:o:d:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'm': host_color = false; break;
+        case 'w': count_writes = 1; break;
+        case 'g': game = strtoul(optarg, NULL, 0); break;
+        case 'f': parse_frames(optarg); break;
+        case 'n': worst = strtoul(optarg, NULL, 0); break;
+        case 'o': out_dir = optarg; break;
+        case 'd': golden_dir = optarg; break;
+        default: optind = -1; break;
+        }
+
+        if (optind < 0)
+        {
+            break;
+        }
+    }
+
+    if (optind < 0 || (out_dir != NULL && golden_dir != NULL) || (wanted_count > 0 && out_dir == NULL && golden_dir == NULL))
+    {
+        fprintf(stderr, "usage: framedump [-m] [-w] [-g game] [-f frames] [-n worst] [-o dir | -d dir]\n");
+        return 1;
+    }
+
+    if (worst > MAX_WORST)
+    {
+        worst = MAX_WORST;
+    }
+
+    init_video();
+    copy_palettes();
+    initialise_cards_array();
+
+#if FRAMEDUMP_TRACE
+    if (count_writes && !trace_start())
+    {
+        fprintf(stderr, "framedump: can't count writes\n");
+        count_writes = 0;
+    }
+#else
+    if (count_writes)
+    {
+        fprintf(stderr, "framedump: writes can only be counted on linux on x86-64\n");
+        count_writes = 0;
+    }
+#endif
+
+    if ((seed = start_replay(game)) < 0)
+    {
+        fprintf(stderr, "framedump: the solution book has no game %u\n", game);
+        return 1;
+    }
+
+    frames = calloc(MAX_FRAMES, sizeof(trace_frame_t));
+
+    for (frame = 0; running && frame < MAX_FRAMES; frame++)
+    {
+        if (frame > 0)
+        {
+            running = replay_frame();
+        }
+
+        frames[frame].frame = frame;
+        frame_count = frame + 1;
+
+#if FRAMEDUMP_TRACE
+        if (count_writes)
+        {
+            frames[frame].writes = trace->writes;
+            frames[frame].redundant = trace->redundant;
+        }
+#endif
+
+        if (is_wanted(frame))
+        {
+            captured++;
+            failed += !capture(frame, out_dir, golden_dir);
+        }
+    }
+
+#if FRAMEDUMP_TRACE
+    if (count_writes)
+    {
+        trace_stop();
+
+        // the running totals become each frame's own
+        for (frame = frame_count - 1; frame > 0; frame--)
+        {
+            frames[frame].writes -= frames[frame - 1].writes;
+            frames[frame].redundant -= frames[frame - 1].redundant;
+        }
+    }
+#endif
+
+    printf("game %u, deal %d, %u frames, %s\n", game, seed, frame_count, host_color ? "colour" : "mono");
+
+    if (captured < wanted_count)
+    {
+        printf("  %u of the frames asked for are past the end of the replay\n", wanted_count - captured);
+    }
+
+    if (golden_dir != NULL)
+    {
+        printf("  %u of %u frames match %s\n", captured - failed, captured, golden_dir);
+    }
+
+#if FRAMEDUMP_TRACE
+    if (count_writes)
+    {
+        report_writes(worst);
+    }
+#endif
+
+    free(frames);
+    return failed > 0;
+}
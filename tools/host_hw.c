@@ -0,0 +1,83 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// host stand-ins for the hardware and libws calls the renderer
+// and music driver use, so they can be run by the host tools
+
+#include <stdint.h>
+#include <string.h>
+#include <ws.h>
+#include <wonderful.h>
+
+uint8_t host_iram[0x10000];
+uint8_t host_ports[0x100];
+uint32_t host_port_writes;
+
+// set by the host tool to choose between the colour and mono paths
+bool host_color = true;
+
+bool ws_system_set_mode(uint8_t mode)
+{
+    return host_color;
+}
+
+bool ws_system_is_color_active(void)
+{
+    return host_color;
+}
+
+void ws_display_set_shade_lut(uint32_t lut)
+{
+    outportw(0x1C, lut);
+    outportw(0x1E, lut >> 16);
+}
+
+void ws_gdma_copy(void *dest, const void *src, uint16_t length)
+{
+    memcpy(dest, src, length);
+}
+
+void ws_screen_fill_tiles(void *dest, uint16_t tile, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    uint16_t *row = (uint16_t*) dest + x + (y * WS_SCREEN_WIDTH_TILES);
+    uint16_t i;
+
+    for (; height > 0; height--, row += WS_SCREEN_WIDTH_TILES)
+    {
+        for (i = 0; i < width; i++)
+        {
+            row[i] = tile;
+        }
+    }
+}
+
+void ws_screen_put_tiles(void *dest, const void *src, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    uint16_t *row = (uint16_t*) dest + x + (y * WS_SCREEN_WIDTH_TILES);
+    const uint16_t *tiles = src;
+
+    for (; height > 0; height--, row += WS_SCREEN_WIDTH_TILES, tiles += width)
+    {
+        memcpy(row, tiles, width * sizeof(uint16_t));
+    }
+}
+
+// the blit kernels in src/blit.s, copying a tile at a time forwards
+// the same way rep movsw does, so overlapping copies repeat the same
+void blit_fill_rect(uint16_t *dest, uint16_t tile, uint16_t size)
+{
+    ws_screen_fill_tiles(dest, tile, 0, 0, size & 0xff, size >> 8);
+}
+
+void blit_copy_rect(uint16_t *dest, const uint16_t *src, uint16_t size)
+{
+    uint16_t i, height = size >> 8;
+
+    for (; height > 0; height--, dest += WS_SCREEN_WIDTH_TILES)
+    {
+        for (i = 0; i < (size & 0xff); i++)
+        {
+            dest[i] = *(src++);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the link cable for the host tools, see include/link.h. it's a pair of
+// non-blocking file descriptors, e.g. two fifos with another host build
+// at the other end, so neither side ever waits for the other the same
+// as with the serial port's buffers in the game
+
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "link.h"
+
+static int link_in = -1;
+static int link_out = -1;
+static uint8_t link_is_open;
+
+uint8_t link_errors;
+
+// where bytes come in from and go out to, before the link is opened
+void link_connect(int in, int out)
+{
+    link_in = in;
+    link_out = out;
+}
+
+void link_open()
+{
+    link_is_open = 1;
+    link_errors = 0;
+}
+
+// anything already written has gone, so there's nothing to wait for
+void link_close()
+{
+    link_is_open = 0;
+}
+
+void link_start() {}
+
+// writes to a pipe this short go all at once or not at all
+uint8_t link_put(const uint8_t *bytes, uint8_t length)
+{
+    if (!link_is_open)
+    {
+        return 0;
+    }
+
+    return write(link_out, bytes, length) == length;
+}
+
+uint8_t link_get(uint8_t *byte)
+{
+    ssize_t got;
+
+    if (!link_is_open)
+    {
+        return 0;
+    }
+
+    if ((got = read(link_in, byte, 1)) == 1)
+    {
+        return 1;
+    }
+
+    if (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        link_errors++;
+    }
+
+    return 0;
+}
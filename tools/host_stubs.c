@@ -0,0 +1,32 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// card.c calls into the renderer when cards are picked up and put down
+// the host tools only use the rules, so these do nothing
+
+#include <stdint.h>
+#include "draw.h"
+#include "flight.h"
+#include "main.h"
+
+uint16_t camera_y;
+
+void wait_for_vblank() {}
+
+void reset_drawn_cursor() {}
+void draw_cursor() {}
+void copy_card_tiles_to_sprites(uint8_t card) {}
+void clear_card_tiles(uint8_t x, uint8_t y) {}
+void draw_card_tiles(uint8_t card, uint8_t x, uint8_t y, uint8_t full_card) {}
+void draw_empty_card(uint8_t x, uint8_t y) {}
+void draw_empty_foundation(uint8_t i) {}
+void draw_cascade(uint8_t cascade, uint8_t from) {}
+uint8_t cascade_card_row(uint8_t cascade, uint8_t index) { return 0; }
+void draw_hud(const char *text) {}
+
+// moves only go to another player when the race is built in too
+__attribute__((weak)) void race_move(uint8_t source, uint8_t dest, uint8_t card) {}
+
+// with nothing flying, cards are put where they're going straight away
+uint8_t flight_launch(uint8_t card, uint8_t location, int16_t from_x, int16_t from_y, int16_t to_x, int16_t to_y, uint8_t frames, uint8_t curve, uint8_t delay) { return 0; }
+void flight_land_card(uint8_t card) {}
@@ -0,0 +1,20 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// just enough of the Wonderful toolchain headers
+// to build parts of the game for the host tools
+
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define __far
+#define __wf_rom
+#define __wf_iram
+
+// far pointers are plain pointers, split at 64k boundaries
+// to stand in for the segment and offset
+#define FP_SEG(p) ((uintptr_t) (p) & ~(uintptr_t) 0xFFFF)
+#define FP_OFF(p) ((uint16_t) (uintptr_t) (p))
+#define MK_FP(seg, off) ((void*) ((seg) + (uint16_t) (off)))
@@ -0,0 +1,112 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// the parts of libws used by the game, for building it on the host
+// iram is a plain array and port writes are kept in another one,
+// see tools/host_hw.c
+
+#pragma once
+#include <wonderful.h>
+
+typedef struct {
+    uint16_t attr;
+    uint8_t y;
+    uint8_t x;
+} ws_sprite_t;
+
+typedef struct {
+    uint8_t wave[4][16];
+} ws_sound_wavetable_t;
+
+extern uint8_t host_iram[0x10000];
+extern uint8_t host_ports[0x100];
+
+// number of port writes since the counter was last cleared
+extern uint32_t host_port_writes;
+
+static inline void outportb(uint8_t port, uint8_t value)
+{
+    host_ports[port] = value;
+    host_port_writes++;
+}
+
+static inline void outportw(uint8_t port, uint16_t value)
+{
+    host_ports[port] = value;
+    host_ports[(uint8_t) (port + 1)] = value >> 8;
+    host_port_writes++;
+}
+
+static inline uint8_t inportb(uint8_t port)
+{
+    return host_ports[port];
+}
+
+static inline uint16_t inportw(uint8_t port)
+{
+    return host_ports[port] | (host_ports[(uint8_t) (port + 1)] << 8);
+}
+
+#define WS_SCREEN_WIDTH_TILES 32
+#define WS_SCREEN_HEIGHT_TILES 32
+#define WS_DISPLAY_WIDTH_TILES 28
+#define WS_DISPLAY_HEIGHT_TILES 18
+
+#define WS_DISPLAY_TILE_SIZE 16
+#define WS_DISPLAY_TILE_SIZE_4BPP 32
+
+#define WS_SCREEN_ATTR_PALETTE(x) ((x) << 9)
+#define WS_SCREEN_ATTR_FLIP_H 0x4000
+#define WS_SCREEN_ATTR_FLIP_V 0x8000
+#define WS_SPRITE_ATTR_PALETTE(x) (((x) & 7) << 9)
+#define WS_SPRITE_ATTR_PRIORITY 0x2000
+
+#define WS_TILE_MEM(i) (host_iram + 0x2000 + ((i) << 4))
+#define WS_TILE_4BPP_MEM(i) (host_iram + 0x4000 + ((i) << 5))
+#define WS_DISPLAY_COLOR_MEM(i) ((uint16_t*) (host_iram + 0xFE00 + ((i) << 5)))
+
+#define WS_DISPLAY_CTRL_PORT 0x00
+#define WS_DISPLAY_CTRL_SCR1_ENABLE 0x01
+#define WS_DISPLAY_CTRL_SCR2_ENABLE 0x02
+#define WS_DISPLAY_CTRL_SPR_ENABLE 0x04
+#define WS_SPR_BASE_PORT 0x04
+#define WS_SPR_FIRST_PORT 0x05
+#define WS_SPR_COUNT_PORT 0x06
+#define WS_SCR_BASE_PORT 0x07
+#define WS_SCR1_SCRL_X_PORT 0x10
+#define WS_SCR1_SCRL_Y_PORT 0x11
+#define WS_SCR2_SCRL_X_PORT 0x12
+#define WS_SCR2_SCRL_Y_PORT 0x13
+#define WS_SCR_PAL_0_PORT 0x20
+#define WS_SCR_PAL_PORT(i) (0x20 + ((i) << 1))
+
+// host arrays aren't at their iram addresses, so these only keep the low bits
+#define WS_SCR_BASE_ADDR1(a) ((((uintptr_t) (a)) >> 11) & 0xF)
+#define WS_SCR_BASE_ADDR2(a) (((((uintptr_t) (a)) >> 11) & 0xF) << 4)
+#define WS_SPR_BASE_ADDR(a) ((((uintptr_t) (a)) >> 9) & 0x3F)
+
+#define WS_DISPLAY_MONO_PALETTE(a, b, c, d) ((a) | ((b) << 4) | ((c) << 8) | ((d) << 12))
+#define WS_DISPLAY_SHADE_LUT(a, b, c, d, e, f, g, h) \
+    ((uint32_t) (a) | ((uint32_t) (b) << 4) | ((uint32_t) (c) << 8) | ((uint32_t) (d) << 12) | \
+    ((uint32_t) (e) << 16) | ((uint32_t) (f) << 20) | ((uint32_t) (g) << 24) | ((uint32_t) (h) << 28))
+
+#define WS_MODE_COLOR_4BPP 0xE0
+
+#define WS_SDMA_SOURCE_L_PORT 0x4A
+#define WS_SDMA_SOURCE_H_PORT 0x4C
+#define WS_SDMA_LENGTH_L_PORT 0x4E
+#define WS_SDMA_LENGTH_H_PORT 0x50
+#define WS_SDMA_CTRL_PORT 0x52
+
+#define WS_SOUND_WAVE_BASE_PORT 0x8F
+#define WS_SOUND_OUT_CTRL_PORT 0x91
+#define WS_SOUND_OUT_CTRL_HEADPHONE_ENABLE 0x08
+#define WS_SOUND_OUT_CTRL_SPEAKER_ENABLE 0x01
+#define WS_SOUND_OUT_CTRL_SPEAKER_VOLUME_100 0x00
+
+bool ws_system_set_mode(uint8_t mode);
+bool ws_system_is_color_active(void);
+void ws_display_set_shade_lut(uint32_t lut);
+void ws_gdma_copy(void *dest, const void *src, uint16_t length);
+void ws_screen_fill_tiles(void *dest, uint16_t tile, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void ws_screen_put_tiles(void *dest, const void *src, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
@@ -0,0 +1,8 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+#pragma once
+#include <wonderful.h>
+
+// see tools/lzsa2.c
+void *wsx_lzsa2_decompress(void *dest, const void *src);
@@ -0,0 +1,349 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// one side of a link cable race, see include/race.h, played on the host
+// by the game's own rules and race code. the link is a pair of fifos,
+// so two of these can race each other, or one can race a game whose
+// serial port an emulator connects to them
+//
+// the player makes the moves of a game from the solution book, picking
+// each card up and putting it down a few frames later the way "show me"
+// does. it can also undo moves and make them again, throw its own board
+// hash off so the other side should spot that it no longer matches, or
+// leave part way through
+//
+// usage: linkrace [-n name] [-g game] [-p frames] [-u moves] [-c move]
+//                 [-q move] [-f] in out
+//   -n  name to put in front of everything printed
+//   -g  game in the solution book to ask to race on, from 0
+//   -p  frames between picking a card up and putting it down, and
+//       between moves
+//   -u  undo every this many moves, then make the move again
+//   -c  throw the board hash off after this many moves
+//   -q  leave the race after this many moves
+//   -f  run flat out rather than 75 frames a second
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <ws.h>
+#include "card.h"
+#include "race.h"
+#include "solution.h"
+#include "zobrist.h"
+
+// frames a second, as the hello and board hash timings are in frames
+#define FRAME_RATE 75
+
+// the race is given up on after this long without a deal agreed or a winner
+#define LINK_TIMEOUT_FRAMES (FRAME_RATE * 10)
+#define RACE_TIMEOUT_FRAMES (FRAME_RATE * 600)
+
+// the game keeps the link going after a win, which is sent again if it
+// didn't fit, so the winner stays on the link this long before leaving
+#define WON_FRAMES FRAME_RATE
+
+void link_connect(int in, int out);
+
+static const char *name = "race";
+static unsigned frame;
+
+static void say(const char *message, unsigned value)
+{
+    printf("%s: frame %5u: ", name, frame);
+    printf(message, value);
+    printf("\n");
+    fflush(stdout);
+}
+
+static unsigned foundation_cards()
+{
+    unsigned i, cards = 0;
+
+    for (i = 0; i < FOUNDATIONS; i++)
+    {
+        cards += foundation_counts[i];
+    }
+
+    return cards;
+}
+
+// the seed of a game in the solution book, or -1 if there isn't one
+static int32_t book_seed(unsigned game)
+{
+    solution_reader_t reader;
+    uint16_t seed;
+
+    solution_book_open(&reader);
+
+    do
+    {
+        if (!solution_next_game(&reader, &seed))
+        {
+            return -1;
+        }
+    }
+    while (game-- > 0);
+
+    return seed;
+}
+
+// deal the agreed deal straight out, the way new_game and the dealing in
+// main.c do it
+static void deal()
+{
+    uint8_t x = 0;
+
+    zobrist_reset();
+    initialise_cascades();
+    initialise_freecells();
+    initialise_foundations();
+
+    deal_game(race_seed);
+    race_deal();
+
+    while (deck_count > DEALT_FREECELLS)
+    {
+        move_top_of_deck_to_cascade(x);
+        x = (x + 1) % CASCADES;
+    }
+
+    while (deck_count > 0)
+    {
+        move_top_of_deck_to_freecell(DEALT_FREECELLS - deck_count);
+    }
+
+    card_in_hand = NO_CARD;
+    card_in_hand_tiles_count = 0;
+    move_count = 0;
+    clear_undo_journal();
+}
+
+// pick a move's card up, returns 0 if it went straight to the foundations
+static uint8_t pick_up(solution_move_t move)
+{
+    move_cursor_to(SOLUTION_MOVE_SOURCE(move), NO_CARD);
+    take_card();
+
+    return card_in_hand != NO_CARD;
+}
+
+// returns 0 if the card couldn't go there
+static uint8_t put_down(solution_move_t move)
+{
+    move_cursor_to(SOLUTION_MOVE_DEST(move), card_in_hand);
+    place_card();
+
+    return card_in_hand == NO_CARD;
+}
+
+static void open_fifo(const char *path, int *fd)
+{
+    // opened for both so neither end waits for the other to turn up
+    if ((*fd = open(path, O_RDWR | O_NONBLOCK)) < 0)
+    {
+        fprintf(stderr, "linkrace: can't open %s\n", path);
+        exit(1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned game = 0, pace = 12, undo_every = 0, corrupt_at = 0, quit_at = 0;
+    unsigned moves = 0, timer = 0, opponent_cards = 0, timeout;
+    uint8_t holding = 0, desynced = 0, send_failed = 0, fast = 0;
+    solution_reader_t reader;
+    solution_move_t move = SOLUTION_END;
+    struct timespec tick = { 0, 1000000000 / FRAME_RATE };
+    int32_t seed;
+    int opt, in, out;
+
+    while ((opt = getopt(argc, argv, "n:g:p:u:c:q:f")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n': name = optarg; break;
+        case 'g': game = strtoul(optarg, NULL, 0); break;
+        case 'p': pace = strtoul(optarg, NULL, 0); break;
+        case 'u': undo_every = strtoul(optarg, NULL, 0); break;
+        case 'c': corrupt_at = strtoul(optarg, NULL, 0); break;
+        case 'q': quit_at = strtoul(optarg, NULL, 0); break;
+        case 'f': fast = 1; break;
+        default: optind = argc + 1; break;
+        }
+    }
+
+    if (optind != argc - 2)
+    {
+        fprintf(stderr, "usage: linkrace [-n name] [-g game] [-p frames] [-u moves] [-c move] [-q move] [-f] in out\n");
+        return 1;
+    }
+
+    if ((seed = book_seed(game)) < 0)
+    {
+        fprintf(stderr, "linkrace: the solution book has no game %u\n", game);
+        return 1;
+    }
+
+    open_fifo(argv[optind], &in);
+    open_fifo(argv[optind + 1], &out);
+    link_connect(in, out);
+
+    initialise_cards_array();
+    race_link(seed, getpid() ^ time(NULL));
+    say("asking to race on deal %u", seed);
+
+    timeout = LINK_TIMEOUT_FRAMES;
+
+    for (frame = 0; frame < timeout; frame++)
+    {
+        if (!fast)
+        {
+            nanosleep(&tick, NULL);
+        }
+
+        race_update();
+
+        if (race_state == RACE_READY)
+        {
+            if (!solution_find_game(&reader, race_seed))
+            {
+                say("deal %u isn't in the solution book", race_seed);
+                race_leave();
+                return 1;
+            }
+
+            say("racing on deal %u", race_seed);
+            deal();
+
+            move = solution_next_move(&reader);
+            timer = pace;
+            timeout = frame + RACE_TIMEOUT_FRAMES;
+        }
+
+        if (race_state == RACE_LINKING)
+        {
+            continue;
+        }
+
+        if (race_opponent_cards != opponent_cards)
+        {
+            opponent_cards = race_opponent_cards;
+            say("the other player has %u cards up", opponent_cards);
+        }
+
+        if (race_desynced && !desynced)
+        {
+            desynced = 1;
+            say("the other player's board no longer matches their moves", 0);
+        }
+
+        if (race_send_failed && !send_failed)
+        {
+            send_failed = 1;
+            say("a record didn't fit in the link's buffer", 0);
+        }
+
+        if (race_state == RACE_LOST)
+        {
+            say("lost with %u cards up", foundation_cards());
+            return 0;
+        }
+
+        if (race_state == RACE_ABANDONED)
+        {
+            say("the other player left with %u cards up", opponent_cards);
+            return 0;
+        }
+
+        if (timer > 0)
+        {
+            timer--;
+            continue;
+        }
+
+        timer = pace;
+
+        if (move == SOLUTION_END)
+        {
+            say("the solution ran out after %u moves", moves);
+            race_leave();
+            return 1;
+        }
+
+        // a card goes up one frame and down another, so the board hash
+        // has to wait for it
+        if (!holding)
+        {
+            holding = pick_up(move);
+
+            if (holding)
+            {
+                continue;
+            }
+        }
+        else if (!put_down(move))
+        {
+            say("move %u can't be made", moves);
+            race_leave();
+            return 1;
+        }
+
+        holding = 0;
+        moves++;
+
+        if (undo_every > 0 && moves % undo_every == 0 && undo_last_move())
+        {
+            if (pick_up(move))
+            {
+                put_down(move);
+            }
+        }
+
+        if (moves == corrupt_at)
+        {
+            board_hash ^= 1;
+            say("threw the board hash off after move %u", moves);
+        }
+
+        if (moves == quit_at)
+        {
+            say("leaving after move %u", moves);
+            race_leave();
+            return 0;
+        }
+
+        if (check_if_game_won())
+        {
+            race_won();
+            say("won in %u moves", moves);
+            say("the other player had %u cards up", race_opponent_cards);
+
+            for (timeout = frame + WON_FRAMES; frame < timeout; frame++)
+            {
+                if (!fast)
+                {
+                    nanosleep(&tick, NULL);
+                }
+
+                race_update();
+            }
+
+            if (race_send_failed && !send_failed)
+            {
+                say("a record didn't fit in the link's buffer", 0);
+            }
+
+            return 0;
+        }
+
+        move = solution_next_move(&reader);
+    }
+
+    say((race_state == RACE_LINKING) ? "nobody answered" : "gave up after %u frames", frame);
+    race_leave();
+    return 1;
+}
@@ -0,0 +1,130 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// host version of libwsx's raw lzsa2 block decompressor
+// returns a pointer to the end of the decompressed data
+
+#include <stdint.h>
+#include <string.h>
+#include <wsx/lzsa.h>
+
+typedef struct {
+    const uint8_t *in;
+    uint8_t nibbles;
+    uint8_t nibbles_left;
+} lzsa2_reader_t;
+
+// nibbles come high first, two to a byte, shared with the other reads
+static uint8_t read_nibble(lzsa2_reader_t *reader)
+{
+    if (reader->nibbles_left)
+    {
+        reader->nibbles_left = 0;
+        return reader->nibbles & 0xF;
+    }
+
+    reader->nibbles = *(reader->in++);
+    reader->nibbles_left = 1;
+    return reader->nibbles >> 4;
+}
+
+static uint16_t read_word(lzsa2_reader_t *reader)
+{
+    uint16_t value = reader->in[0] | (reader->in[1] << 8);
+    reader->in += 2;
+    return value;
+}
+
+void *wsx_lzsa2_decompress(void *dest, const void *src)
+{
+    lzsa2_reader_t reader = { src, 0, 0 };
+    uint8_t *out = dest;
+    uint16_t offset = 0;
+    uint16_t length;
+    uint8_t token;
+
+    while (1)
+    {
+        token = *(reader.in++);
+
+        // literals
+        length = (token >> 3) & 3;
+
+        if (length == 3)
+        {
+            length += read_nibble(&reader);
+
+            if (length == 18)
+            {
+                length = *(reader.in++);
+                length = (length == 239) ? read_word(&reader) : (length + 18);
+            }
+        }
+
+        memcpy(out, reader.in, length);
+        out += length;
+        reader.in += length;
+
+        // match offset
+        switch (token & 0xE0)
+        {
+        case 0x00:
+        case 0x20:
+            offset = ((read_nibble(&reader) << 1) | ((token >> 5) & 1)) ^ 0x1E;
+            offset++;
+            break;
+
+        case 0x40:
+        case 0x60:
+            offset = (*(reader.in++) | ((token & 0x20) << 3)) ^ 0xFF;
+            offset++;
+            break;
+
+        case 0x80:
+        case 0xA0:
+            offset = read_nibble(&reader) << 9;
+            offset |= *(reader.in++) | ((token & 0x20) << 3);
+            offset = (offset ^ 0x1EFF) + 513;
+            break;
+
+        case 0xC0:
+            offset = *(reader.in++) << 8;
+            offset |= *(reader.in++);
+            offset = (offset ^ 0xFFFF) + 1;
+            break;
+
+        default:
+            // repeat the last offset
+            break;
+        }
+
+        // match length
+        length = token & 7;
+
+        if (length == 7)
+        {
+            length += read_nibble(&reader);
+
+            if (length == 22)
+            {
+                length = *(reader.in++);
+
+                // end of data
+                if (length == 232)
+                {
+                    return out;
+                }
+
+                length = (length == 233) ? read_word(&reader) : (length + 22);
+            }
+        }
+
+        length += 2;
+
+        // matches can overlap the bytes they're writing
+        for (; length > 0; length--, out++)
+        {
+            *out = *(out - offset);
+        }
+    }
+}
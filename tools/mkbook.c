@@ -0,0 +1,112 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// builds the rom solution book from the solutions written by dealsolve
+// see include/solution.h for the format
+//
+// usage: mkbook [-n count] -o book.bin solutions.txt [seed...]
+// takes the listed seeds, or the first count solutions if none are listed
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LINE 1024
+
+static void put_word(FILE *file, unsigned value)
+{
+    fputc(value & 0xff, file);
+    fputc((value >> 8) & 0xff, file);
+}
+
+static int wanted(unsigned seed, int argc, char **argv)
+{
+    int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (strtoul(argv[i], NULL, 0) == seed)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    unsigned seed, count = 32, games = 0, i, length;
+    unsigned move;
+    const char *out_path = NULL;
+    char line[MAX_LINE];
+    char moves[MAX_LINE];
+    FILE *in, *out;
+
+    while ((opt = getopt(argc, argv, "n:o:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n': count = strtoul(optarg, NULL, 0); break;
+        case 'o': out_path = optarg; break;
+        default: out_path = NULL; optind = argc; break;
+        }
+    }
+
+    if (out_path == NULL || optind >= argc)
+    {
+        fprintf(stderr, "usage: mkbook [-n count] -o book.bin solutions.txt [seed...]\n");
+        return 1;
+    }
+
+    if ((in = fopen(argv[optind], "r")) == NULL)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    if ((out = fopen(out_path, "wb")) == NULL)
+    {
+        perror(out_path);
+        return 1;
+    }
+
+    // game count gets filled in at the end
+    put_word(out, 0);
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        if (sscanf(line, "%u %1023s", &seed, moves) != 2)
+        {
+            continue;
+        }
+
+        if (optind + 1 < argc ? !wanted(seed, argc - optind - 1, argv + optind + 1) : games >= count)
+        {
+            continue;
+        }
+
+        length = strlen(moves) / 2;
+        put_word(out, seed);
+        put_word(out, length);
+
+        for (i = 0; i < length; i++)
+        {
+            sscanf(moves + (i * 2), "%2x", &move);
+            fputc(move, out);
+        }
+
+        games++;
+    }
+
+    fprintf(stderr, "mkbook: %u games, %ld bytes\n", games, ftell(out));
+
+    fseek(out, 0, SEEK_SET);
+    put_word(out, games);
+
+    fclose(out);
+    fclose(in);
+    return 0;
+}
@@ -0,0 +1,828 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// builds the rom asset pack from a list of assets, see include/asset.h
+// for the format, and writes a header with an id for each asset
+//
+// each line of the list is an asset's id and codec, then where it comes
+// from, then the bytes of it to take if it isn't all of it:
+//
+//   cards_tiles  raw  assets/graphics/cards.lua  gfx_cards_tiles  0:5120
+//   menu_tilemap raw  data/menu_tilemap.bin
+//
+// a .lua file is read from the c wf-process wrote for it in the build
+// directory, as the named symbol. anything else is read as it is. a line
+// like [mono] starts a set, and assets listed before the first set are
+// in all of them
+//
+// usage: mkpack [-v] [-b builddir] [-x set]... -o pack.bin -i ids.h list.txt
+//   -v  print the directory
+//   -b  where wf-process wrote the graphics, build/wswan by default
+//   -x  leave a set out, e.g. for a build without one of the backends
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <wsx/lzsa.h>
+#include "asset.h"
+
+#define MAX_LINE 1024
+#define MAX_NAME 64
+#define MAX_ASSETS 255
+#define MAX_SETS 8
+#define MAX_SOURCE 0x10000
+
+typedef struct {
+    char name[MAX_NAME];
+    uint8_t codec;
+    uint8_t id;
+    // in every set
+    int8_t set;
+    uint16_t size;
+    uint16_t offset;
+    uint16_t stored;
+    uint8_t *data;
+    int line;
+} pack_asset_t;
+
+static const char *codec_names[ASSET_CODECS] = { "raw", "lzsa2" };
+
+static const char *build_dir = "build/wswan";
+static const char *list_path;
+static int list_line;
+
+static pack_asset_t assets[MAX_ASSETS];
+static int asset_count;
+
+// ids in the order they're first listed
+static char ids[MAX_ASSETS][MAX_NAME];
+static int id_count;
+
+static char sets[MAX_SETS][MAX_NAME];
+static int set_count;
+
+static const char *left_out[MAX_SETS];
+static int left_out_count;
+
+static uint8_t pack[ASSET_PACK_LIMIT];
+static long pack_size;
+
+static void fail(const char *message, const char *what)
+{
+    fprintf(stderr, "mkpack: %s:%d: ", list_path, list_line);
+    fprintf(stderr, message, what);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+static int find_id(const char *name)
+{
+    int i;
+
+    for (i = 0; i < id_count; i++)
+    {
+        if (strcmp(ids[i], name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int is_left_out(const char *set)
+{
+    int i;
+
+    for (i = 0; i < left_out_count; i++)
+    {
+        if (strcmp(left_out[i], set) == 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static long read_file(const char *path, uint8_t *data)
+{
+    FILE *in;
+    long size;
+
+    if ((in = fopen(path, "rb")) == NULL)
+    {
+        fail("can't open %s", path);
+    }
+
+    size = fread(data, 1, MAX_SOURCE, in);
+
+    if (!feof(in))
+    {
+        fail("%s is too big", path);
+    }
+
+    fclose(in);
+    return size;
+}
+
+// the bytes of an array wf-process wrote out as c, with each element
+// little endian
+static long read_symbol(const char *path, const char *symbol, uint8_t *data)
+{
+    static char text[MAX_SOURCE * 8];
+    size_t length = strlen(symbol);
+    char *found, *start, *end, *next;
+    unsigned long value;
+    long size = 0;
+    int width, i;
+    FILE *in;
+
+    if ((in = fopen(path, "r")) == NULL)
+    {
+        fail("can't open %s", path);
+    }
+
+    text[fread(text, 1, sizeof(text) - 1, in)] = 0;
+
+    if (!feof(in))
+    {
+        fail("%s is too big", path);
+    }
+
+    fclose(in);
+
+    // the definition rather than any declarations, which come to a ; first
+    for (found = strstr(text, symbol); found != NULL; found = strstr(found + length, symbol))
+    {
+        if ((found > text && (isalnum((unsigned char) found[-1]) || found[-1] == '_')) || found[length] != '[')
+        {
+            continue;
+        }
+
+        end = strchr(found, ';');
+        start = strchr(found, '=');
+
+        if (start != NULL && end != NULL && start < end)
+        {
+            break;
+        }
+    }
+
+    if (found == NULL || (start = strchr(start, '{')) == NULL)
+    {
+        fail("can't find %s", symbol);
+    }
+
+    // the element type is somewhere on the line before the name
+    for (end = found; end > text && end[-1] != '\n' && end[-1] != ';'; end--);
+    width = (strstr(end, "int16_t") != NULL && strstr(end, "int16_t") < found) ? 2 :
+            (strstr(end, "int32_t") != NULL && strstr(end, "int32_t") < found) ? 4 : 1;
+
+    for (next = start + 1; *next != '}'; )
+    {
+        if (isspace((unsigned char) *next) || *next == ',')
+        {
+            next++;
+            continue;
+        }
+
+        value = strtoul(next, &end, 0);
+
+        if (end == next || size + width > MAX_SOURCE)
+        {
+            fail("can't read %s", symbol);
+        }
+
+        for (i = 0; i < width; i++)
+        {
+            data[size++] = (value >> (i * 8)) & 0xff;
+        }
+
+        // suffixes like 0x1234u
+        for (next = end; isalnum((unsigned char) *next); next++);
+    }
+
+    return size;
+}
+
+// lzsa2 nibbles go two to a byte, high first, each byte going where
+// the first of its nibbles does in between the other bytes
+typedef struct {
+    uint8_t *out;
+    long size;
+    long nibble_at;
+} lzsa2_writer_t;
+
+static void put_byte(lzsa2_writer_t *writer, uint8_t value)
+{
+    writer->out[writer->size++] = value;
+}
+
+static void put_nibble(lzsa2_writer_t *writer, uint8_t value)
+{
+    if (writer->nibble_at >= 0)
+    {
+        writer->out[writer->nibble_at] |= value;
+        writer->nibble_at = -1;
+    }
+    else
+    {
+        writer->nibble_at = writer->size;
+        put_byte(writer, value << 4);
+    }
+}
+
+static void put_literals(lzsa2_writer_t *writer, const uint8_t *literals, unsigned count)
+{
+    if (count >= 18)
+    {
+        put_nibble(writer, 15);
+
+        if (count < 257)
+        {
+            put_byte(writer, count - 18);
+        }
+        else
+        {
+            put_byte(writer, 239);
+            put_byte(writer, count & 0xff);
+            put_byte(writer, count >> 8);
+        }
+    }
+    else if (count >= 3)
+    {
+        put_nibble(writer, count - 3);
+    }
+
+    memcpy(writer->out + writer->size, literals, count);
+    writer->size += count;
+}
+
+// a token's literals and match, with length 0 for the end of the data
+static void put_token(lzsa2_writer_t *writer, const uint8_t *literals, unsigned count,
+                      unsigned offset, unsigned length, unsigned last_offset)
+{
+    long token_at = writer->size;
+    unsigned value;
+    uint8_t token = ((count < 3) ? count : 3) << 3;
+
+    put_byte(writer, 0);
+    put_literals(writer, literals, count);
+
+    if (length == 0 || offset == last_offset)
+    {
+        token |= 0xE0;
+    }
+    else if (offset <= 32)
+    {
+        value = (offset - 1) ^ 0x1E;
+        token |= (value & 1) << 5;
+        put_nibble(writer, value >> 1);
+    }
+    else if (offset <= 512)
+    {
+        value = (offset - 1) ^ 0xFF;
+        token |= 0x40 | ((value >> 8) & 1) << 5;
+        put_byte(writer, value & 0xff);
+    }
+    else if (offset <= 8704)
+    {
+        value = (offset - 513) ^ 0x1EFF;
+        token |= 0x80 | ((value >> 8) & 1) << 5;
+        put_nibble(writer, value >> 9);
+        put_byte(writer, value & 0xff);
+    }
+    else
+    {
+        value = (offset - 1) ^ 0xFFFF;
+        token |= 0xC0;
+        put_byte(writer, value >> 8);
+        put_byte(writer, value & 0xff);
+    }
+
+    if (length == 0)
+    {
+        token |= 7;
+        put_nibble(writer, 15);
+        put_byte(writer, 232);
+    }
+    else if (length < 9)
+    {
+        token |= length - 2;
+    }
+    else
+    {
+        token |= 7;
+
+        if (length < 24)
+        {
+            put_nibble(writer, length - 9);
+        }
+        else
+        {
+            put_nibble(writer, 15);
+
+            if (length < 256)
+            {
+                put_byte(writer, length - 24);
+            }
+            else
+            {
+                put_byte(writer, 233);
+                put_byte(writer, (length - 2) & 0xff);
+                put_byte(writer, (length - 2) >> 8);
+            }
+        }
+    }
+
+    writer->out[token_at] = token;
+}
+
+// nibbles a match's offset and length take up, as well as its token
+static int match_cost(unsigned offset, unsigned length, unsigned last_offset)
+{
+    int cost = 2;
+
+    if (offset != last_offset)
+    {
+        cost += (offset <= 32) ? 1 : (offset <= 512) ? 2 : (offset <= 8704) ? 3 : 4;
+    }
+
+    cost += (length < 9) ? 0 : (length < 24) ? 1 : (length < 256) ? 3 : 7;
+
+    return cost;
+}
+
+// nibbles a match saves over sending its bytes as literals
+static int match_gain(unsigned offset, unsigned length, unsigned last_offset)
+{
+    return (length * 2) - match_cost(offset, length, last_offset);
+}
+
+// the best match at here which ends by end, looking back as far as the
+// start of the data as the blocks before are unpacked by then
+static unsigned find_match(const uint8_t *data, long here, long end, unsigned last_offset, unsigned *best_offset)
+{
+    unsigned length, best_length = 0, limit = end - here;
+    long from;
+    int best_gain = 0, gain;
+
+    if (limit > 0xFFFF)
+    {
+        limit = 0xFFFF;
+    }
+
+    for (from = here - 1; from >= 0 && here - from <= 0xFFFF; from--)
+    {
+        for (length = 0; length < limit && data[from + length] == data[here + length]; length++);
+
+        if (length >= 2 && (gain = match_gain(here - from, length, last_offset)) > best_gain)
+        {
+            best_gain = gain;
+            best_length = length;
+            *best_offset = here - from;
+        }
+    }
+
+    return best_length;
+}
+
+// compress data[start, end) into an lzsa2 block, taking the longest
+// match at each byte unless the next byte has a better one
+static long compress_block(const uint8_t *data, long start, long end, uint8_t *out)
+{
+    lzsa2_writer_t writer = { out, 0, -1 };
+    unsigned offset, next_offset, length, next_length, last_offset = 0;
+    long here = start, literals = start;
+
+    while (here < end)
+    {
+        length = find_match(data, here, end, last_offset, &offset);
+
+        if (length > 0 && here + 1 < end)
+        {
+            next_length = find_match(data, here + 1, end, last_offset, &next_offset);
+
+            if (next_length > 0 && match_gain(next_offset, next_length, last_offset) > match_gain(offset, length, last_offset) + 2)
+            {
+                length = 0;
+            }
+        }
+
+        if (length == 0)
+        {
+            here++;
+            continue;
+        }
+
+        put_token(&writer, data + literals, here - literals, offset, length, last_offset);
+        last_offset = offset;
+        here += length;
+        literals = here;
+    }
+
+    put_token(&writer, data + literals, end - literals, 0, 0, last_offset);
+
+    return writer.size;
+}
+
+// compress an asset a block at a time, each after its length, and check
+// it unpacks back into the same bytes
+static long compress_asset(const uint8_t *data, long size, uint8_t *out)
+{
+    static uint8_t unpacked[MAX_SOURCE + ASSET_BLOCK_SIZE];
+    uint8_t *end;
+    long start, stored = 0, length;
+
+    for (start = 0; start < size; start += ASSET_BLOCK_SIZE)
+    {
+        length = compress_block(data, start, (start + ASSET_BLOCK_SIZE < size) ? start + ASSET_BLOCK_SIZE : size, out + stored + 2);
+        out[stored] = length & 0xff;
+        out[stored + 1] = length >> 8;
+
+        end = wsx_lzsa2_decompress(unpacked + start, out + stored + 2);
+
+        if (end - unpacked != ((start + ASSET_BLOCK_SIZE < size) ? start + ASSET_BLOCK_SIZE : size))
+        {
+            return -1;
+        }
+
+        stored += 2 + length;
+    }
+
+    return memcmp(unpacked, data, size) == 0 ? stored : -1;
+}
+
+static void read_list(const char *path)
+{
+    static uint8_t source[MAX_SOURCE];
+    char line[MAX_LINE], *words[6], *word, *colon;
+    char c_path[MAX_LINE];
+    pack_asset_t *asset;
+    int count, set = -1, codec, i;
+    long size, first, last;
+    FILE *in;
+
+    list_path = path;
+
+    if ((in = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        list_line++;
+
+        if ((word = strchr(line, '#')) != NULL)
+        {
+            *word = 0;
+        }
+
+        for (count = 0, word = strtok(line, " \t\r\n"); word != NULL && count < 6; word = strtok(NULL, " \t\r\n"))
+        {
+            words[count++] = word;
+        }
+
+        if (count == 0)
+        {
+            continue;
+        }
+
+        if (words[0][0] == '[')
+        {
+            words[0][strcspn(words[0], "]")] = 0;
+
+            if (set_count == MAX_SETS)
+            {
+                fail("too many sets", NULL);
+            }
+
+            set = is_left_out(words[0] + 1) ? MAX_SETS : set_count;
+
+            if (set < MAX_SETS)
+            {
+                snprintf(sets[set_count++], MAX_NAME, "%s", words[0] + 1);
+            }
+
+            continue;
+        }
+
+        if (count < 3 || count > 5)
+        {
+            fail("expected an id, a codec and a source", NULL);
+        }
+
+        for (codec = 0; codec < ASSET_CODECS && strcmp(words[1], codec_names[codec]) != 0; codec++);
+
+        if (codec == ASSET_CODECS)
+        {
+            fail("unknown codec %s", words[1]);
+        }
+
+        // the last word is a range of bytes if it has a colon in it
+        first = 0;
+        last = -1;
+
+        if (count > 3 && (colon = strchr(words[count - 1], ':')) != NULL)
+        {
+            first = strtol(words[count - 1], NULL, 0);
+            last = (colon[1] != 0) ? strtol(colon + 1, NULL, 0) : -1;
+            count--;
+        }
+
+        size = strlen(words[2]);
+
+        if (size > 4 && strcmp(words[2] + size - 4, ".lua") == 0)
+        {
+            if (count != 4)
+            {
+                fail("expected a symbol from %s", words[2]);
+            }
+
+            snprintf(c_path, sizeof(c_path), "%s/%.*s.c", build_dir, (int) size - 4, words[2]);
+            size = read_symbol(c_path, words[3], source);
+        }
+        else
+        {
+            size = read_file(words[2], source);
+        }
+
+        if (last < 0)
+        {
+            last = size;
+        }
+
+        if (first > last || last > size)
+        {
+            fail("%s isn't that big", words[2]);
+        }
+
+        if (set == MAX_SETS)
+        {
+            continue;
+        }
+
+        for (i = 0; i < asset_count; i++)
+        {
+            if (strcmp(assets[i].name, words[0]) == 0 && (assets[i].set < 0 || set < 0 || assets[i].set == set))
+            {
+                fail("%s is listed twice", words[0]);
+            }
+        }
+
+        if (find_id(words[0]) < 0)
+        {
+            if (id_count == MAX_ASSETS)
+            {
+                fail("too many assets", NULL);
+            }
+
+            snprintf(ids[id_count++], MAX_NAME, "%s", words[0]);
+        }
+
+        asset = &assets[asset_count++];
+        snprintf(asset->name, MAX_NAME, "%s", words[0]);
+        asset->codec = codec;
+        asset->id = find_id(words[0]);
+        asset->set = set;
+        asset->line = list_line;
+        asset->size = last - first;
+        asset->data = malloc(last - first);
+        memcpy(asset->data, source + first, last - first);
+
+        if (last - first > 0xFFFF)
+        {
+            fail("%s is too big", words[0]);
+        }
+    }
+
+    fclose(in);
+}
+
+static void put_word(uint8_t *at, unsigned value)
+{
+    at[0] = value & 0xff;
+    at[1] = (value >> 8) & 0xff;
+}
+
+// the data of each asset goes in once, word aligned for the dma
+static void pack_assets()
+{
+    static uint8_t stored[MAX_SOURCE * 2];
+    pack_asset_t *asset;
+    long length;
+    int i;
+
+    pack_size = sizeof(asset_header_t) + ((set_count ? set_count : 1) * id_count * sizeof(asset_entry_t));
+
+    for (i = 0; i < asset_count; i++)
+    {
+        asset = &assets[i];
+        list_line = asset->line;
+
+        if (asset->codec == ASSET_LZSA2)
+        {
+            if ((length = compress_asset(asset->data, asset->size, stored)) < 0)
+            {
+                fail("%s doesn't unpack again", asset->name);
+            }
+        }
+        else
+        {
+            memcpy(stored, asset->data, asset->size);
+            length = asset->size;
+        }
+
+        pack_size += pack_size & 1;
+
+        if (pack_size + length > ASSET_PACK_LIMIT)
+        {
+            fail("the pack is full at %s", asset->name);
+        }
+
+        asset->offset = pack_size;
+        asset->stored = length;
+        memcpy(pack + pack_size, stored, length);
+        pack_size += length;
+    }
+}
+
+// each set's directory, with the assets which aren't in the set empty
+static void write_directories()
+{
+    pack_asset_t *asset;
+    uint8_t *entry;
+    int set, i;
+
+    pack[0] = id_count;
+    pack[1] = set_count ? set_count : 1;
+
+    for (i = 0; i < asset_count; i++)
+    {
+        asset = &assets[i];
+
+        for (set = 0; set < pack[1]; set++)
+        {
+            if (asset->set >= 0 && asset->set != set)
+            {
+                continue;
+            }
+
+            entry = pack + sizeof(asset_header_t) + (((set * id_count) + asset->id) * sizeof(asset_entry_t));
+            entry[0] = asset->id;
+            entry[1] = asset->codec;
+            put_word(entry + 2, asset->size);
+            put_word(entry + 4, asset->offset);
+        }
+    }
+
+    for (set = 0; set < pack[1]; set++)
+    {
+        for (i = 0; i < id_count; i++)
+        {
+            entry = pack + sizeof(asset_header_t) + (((set * id_count) + i) * sizeof(asset_entry_t));
+            entry[0] = i;
+        }
+    }
+}
+
+static void upper_case(FILE *out, const char *name)
+{
+    for (; *name != 0; name++)
+    {
+        fputc(toupper((unsigned char) *name), out);
+    }
+}
+
+static void write_ids(const char *path)
+{
+    FILE *out;
+    int i;
+
+    if ((out = fopen(path, "w")) == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    fprintf(out, "// written by mkpack from %s\n\n#pragma once\n\n", list_path);
+
+    for (i = 0; i < id_count; i++)
+    {
+        fprintf(out, "#define ASSET_");
+        upper_case(out, ids[i]);
+        fprintf(out, " %d\n", i);
+    }
+
+    fprintf(out, "#define ASSET_COUNT %d\n\n", id_count);
+
+    for (i = 0; i < set_count; i++)
+    {
+        fprintf(out, "#define ASSET_SET_");
+        upper_case(out, sets[i]);
+        fprintf(out, " %d\n", i);
+    }
+
+    fprintf(out, "#define ASSET_SETS %d\n\n", set_count ? set_count : 1);
+
+    // for the host tools
+    fprintf(out, "#define ASSET_NAMES {");
+
+    for (i = 0; i < id_count; i++)
+    {
+        fprintf(out, "%s \"%s\"", i ? "," : "", ids[i]);
+    }
+
+    fprintf(out, " }\n#define ASSET_SET_NAMES {");
+
+    for (i = 0; i < set_count; i++)
+    {
+        fprintf(out, "%s \"%s\"", i ? "," : "", sets[i]);
+    }
+
+    fprintf(out, "%s }\n", set_count ? "" : " \"all\"");
+    fclose(out);
+}
+
+static void print_directory()
+{
+    pack_asset_t *asset;
+    int i;
+
+    printf("%-24s %-8s %-6s %6s %6s %6s\n", "asset", "set", "codec", "size", "stored", "offset");
+
+    for (i = 0; i < asset_count; i++)
+    {
+        asset = &assets[i];
+        printf(
+            "%-24s %-8s %-6s %6u %6u %6u\n",
+            asset->name,
+            (asset->set >= 0) ? sets[asset->set] : "all",
+            codec_names[asset->codec],
+            asset->size,
+            asset->stored,
+            asset->offset
+        );
+    }
+
+    printf("%-24s %-8s %-6s %6s %6ld %6s\n", "pack", "", "", "", pack_size, "");
+}
+
+int main(int argc, char **argv)
+{
+    int opt, verbose = 0;
+    const char *out_path = NULL, *ids_path = NULL;
+    FILE *out;
+
+    while ((opt = getopt(argc, argv, "vb:x:o:i:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'v': verbose = 1; break;
+        case 'b': build_dir = optarg; break;
+        case 'x':
+            if (left_out_count < MAX_SETS)
+            {
+                left_out[left_out_count++] = optarg;
+            }
+            break;
+        case 'o': out_path = optarg; break;
+        case 'i': ids_path = optarg; break;
+        default: out_path = NULL; optind = argc; break;
+        }
+    }
+
+    if (out_path == NULL || ids_path == NULL || optind != argc - 1)
+    {
+        fprintf(stderr, "usage: mkpack [-v] [-b builddir] [-x set]... -o pack.bin -i ids.h list.txt\n");
+        return 1;
+    }
+
+    read_list(argv[optind]);
+    pack_assets();
+    write_directories();
+
+    if ((out = fopen(out_path, "wb")) == NULL)
+    {
+        perror(out_path);
+        return 1;
+    }
+
+    fwrite(pack, 1, pack_size, out);
+    fclose(out);
+
+    write_ids(ids_path);
+
+    if (verbose)
+    {
+        print_directory();
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// turns unsigned 8 bit pcm samples into a stream for src/pcm.c
+// see include/pcm.h for the format
+//
+// usage: mkpcm [-d] [-h] [-r rate] -o stream.bin samples.raw
+//   -d  pack the samples as 4 bit deltas, to be unpacked into iram
+//   -h  play through hyper voice rather than channel 2
+//   -r  sample rate in hz, one of 4000, 6000, 12000 or 24000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pcm.h"
+
+static const unsigned rates[4] = { 4000, 6000, 12000, 24000 };
+
+// must match pcm_deltas in src/pcm.c
+static const int deltas[16] = {
+    0, 1, 2, 4, 8, 16, 32, 64,
+    -1, -2, -4, -8, -16, -32, -64, -128
+};
+
+static void put_word(FILE *file, unsigned value)
+{
+    fputc(value & 0xff, file);
+    fputc((value >> 8) & 0xff, file);
+}
+
+// the code which gets closest to the wanted sample
+static int nearest_code(unsigned last, unsigned wanted)
+{
+    int code, best = 0, error, best_error = 1 << 16;
+
+    for (code = 0; code < 16; code++)
+    {
+        error = abs((int) ((last + deltas[code]) & 0xff) - (int) wanted);
+
+        if (error < best_error)
+        {
+            best = code;
+            best_error = error;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    int opt, delta = 0, code;
+    unsigned ctrl = 0, rate = 12000, i, last = 0x80, packed = 0;
+    const char *out_path = NULL;
+    unsigned char *samples;
+    long length;
+    FILE *in, *out;
+
+    while ((opt = getopt(argc, argv, "dhr:o:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'd': delta = 1; break;
+        case 'h': ctrl |= PCM_SDMA_HYPER_VOICE; break;
+        case 'r': rate = strtoul(optarg, NULL, 0); break;
+        case 'o': out_path = optarg; break;
+        default: out_path = NULL; optind = argc; break;
+        }
+    }
+
+    for (i = 0; i < 4 && rates[i] != rate; i++);
+
+    if (out_path == NULL || optind != argc - 1 || i == 4)
+    {
+        fprintf(stderr, "usage: mkpcm [-d] [-h] [-r 4000|6000|12000|24000] -o stream.bin samples.raw\n");
+        return 1;
+    }
+
+    ctrl |= i;
+
+    if ((in = fopen(argv[optind], "rb")) == NULL)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    fseek(in, 0, SEEK_END);
+    length = ftell(in);
+    fseek(in, 0, SEEK_SET);
+
+    samples = malloc(length + 1);
+
+    if (samples == NULL || fread(samples, 1, length, in) != (size_t) length)
+    {
+        fprintf(stderr, "mkpcm: couldn't read %s\n", argv[optind]);
+        return 1;
+    }
+
+    fclose(in);
+
+    // the ring is refilled once a frame, so each half has to last that long
+    if (delta && rate > PCM_RING_HALF * 75)
+    {
+        fprintf(stderr, "mkpcm: packed streams can't be faster than %u hz\n", PCM_RING_HALF * 75);
+        return 1;
+    }
+
+    if ((out = fopen(out_path, "wb")) == NULL)
+    {
+        perror(out_path);
+        return 1;
+    }
+
+    fputc(ctrl, out);
+    fputc(delta ? PCM_FLAG_DELTA : 0, out);
+    put_word(out, length & 0xffff);
+    put_word(out, (length >> 16) & 0xffff);
+
+    for (i = 0; i < (unsigned) length; i++)
+    {
+        if (!delta)
+        {
+            fputc(samples[i], out);
+            continue;
+        }
+
+        // track what the player will unpack, so errors don't build up
+        code = nearest_code(last, samples[i]);
+        last = (last + deltas[code]) & 0xff;
+
+        if ((i & 1) == 0)
+        {
+            packed = code;
+        }
+        else
+        {
+            fputc(packed | (code << 4), out);
+        }
+    }
+
+    if (delta && (length & 1))
+    {
+        fputc(packed, out);
+    }
+
+    fprintf(stderr, "mkpcm: %ld samples, %ld bytes\n", length, ftell(out));
+
+    fclose(out);
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// writes the table of random keys used for zobrist hashing
+// 52 cards by 55 locations, each a little endian 32-bit word
+// see zobrist.h for the layout
+//
+// usage: mkzobrist keys.bin
+
+#include <stdint.h>
+#include <stdio.h>
+
+// ZOBRIST_CARDS and ZOBRIST_LOCATIONS in zobrist.h
+#define CARDS 52
+#define LOCATIONS (CARDS + 3)
+
+int main(int argc, char **argv)
+{
+    int i;
+    uint32_t x = 0x57c3e11d;
+    FILE *out;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: mkzobrist keys.bin\n");
+        return 1;
+    }
+
+    if ((out = fopen(argv[1], "wb")) == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    // fixed seed so the table only changes if this tool does
+    for (i = 0; i < CARDS * LOCATIONS; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+
+        fputc(x & 0xff, out);
+        fputc((x >> 8) & 0xff, out);
+        fputc((x >> 16) & 0xff, out);
+        fputc((x >> 24) & 0xff, out);
+    }
+
+    fclose(out);
+    return 0;
+}
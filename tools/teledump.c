@@ -0,0 +1,370 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// decodes the telemetry a game built with make TELEMETRY=1 sends out of
+// the serial port, see include/telemetry.h. it reads from a file, a fifo
+// an emulator's serial output is piped into, or a serial adapter, which
+// is set to 38400 baud. when the stream ends, or on ctrl-c, it sums up
+// how long each section of a frame took, the frames which ran long and
+// what the music driver cost
+//
+// -l writes a made-up stream instead, in the same format, as a stand in
+// for the game at the other end of a fifo or a pty pair to check the
+// decoder and the pipe with
+//
+// usage: teledump [-v] [source]
+//        teledump -l frames [dest]
+//   -v  print every record as it arrives
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include "telemetry.h"
+
+// display refresh rate, one frame record each
+#define FRAME_RATE 75.47
+
+// longest record, type included
+#define MAX_RECORD 8
+
+typedef struct {
+    unsigned long count;
+    unsigned long total;
+    unsigned max;
+} stat_t;
+
+static const uint8_t record_lengths[] = TELEMETRY_RECORD_LENGTHS;
+
+static const char *section_names[TELEMETRY_SECTIONS] = {
+    "sound",
+    "input",
+    "motion",
+    "logic",
+    "sprites",
+};
+
+static stat_t sections[TELEMETRY_SECTIONS];
+static stat_t music_lines;
+static stat_t music_bytes;
+
+static unsigned long frames;
+static unsigned long frames_lost;
+static unsigned long frames_late;
+static unsigned long vblanks_missed;
+static unsigned long records_dropped;
+static unsigned long moves;
+static unsigned long games;
+static unsigned long bytes_skipped;
+
+static int verbose;
+static volatile sig_atomic_t stopping;
+
+static void on_interrupt(int sig)
+{
+    stopping = 1;
+}
+
+static void add_stat(stat_t *stat, unsigned value)
+{
+    stat->count++;
+    stat->total += value;
+
+    if (value > stat->max)
+    {
+        stat->max = value;
+    }
+}
+
+static void decode(const uint8_t *record)
+{
+    static int sequence = -1;
+    uint32_t seed;
+
+    switch (record[0])
+    {
+    case TELEMETRY_FRAME:
+        frames++;
+
+        // frame records which didn't make it, going by the sequence
+        if (sequence >= 0)
+        {
+            frames_lost += (uint8_t) (record[1] - sequence - 1);
+        }
+
+        sequence = record[1];
+        vblanks_missed += record[2];
+        frames_late += (record[2] > 0);
+        records_dropped += record[3];
+
+        if (verbose)
+        {
+            printf("frame %3u", record[1]);
+
+            if (record[2] > 0)
+            {
+                printf(", %u vblanks missed", record[2]);
+            }
+
+            if (record[3] > 0)
+            {
+                printf(", %u records dropped", record[3]);
+            }
+
+            printf("\n");
+        }
+        break;
+
+    case TELEMETRY_SECTION:
+        if (record[1] < TELEMETRY_SECTIONS)
+        {
+            add_stat(&sections[record[1]], record[2]);
+        }
+
+        if (verbose)
+        {
+            printf("  %-8s %3u lines\n", (record[1] < TELEMETRY_SECTIONS) ? section_names[record[1]] : "?", record[2]);
+        }
+        break;
+
+    case TELEMETRY_MUSIC:
+        add_stat(&music_lines, record[1]);
+        add_stat(&music_bytes, record[2]);
+
+        if (verbose)
+        {
+            printf("  music    %3u lines, %u bytes\n", record[1], record[2]);
+        }
+        break;
+
+    case TELEMETRY_MOVE:
+        moves++;
+
+        if (verbose)
+        {
+            printf("  move     card %u from %u to %u\n", record[3], record[1], record[2]);
+        }
+        break;
+
+    case TELEMETRY_GAME:
+        games++;
+        seed = record[1] | (record[2] << 8) | (record[3] << 16) | ((uint32_t) record[4] << 24);
+
+        // the first frame of a game follows a pause while it's set up
+        sequence = -1;
+
+        if (verbose)
+        {
+            printf("game %u\n", seed);
+        }
+        break;
+    }
+}
+
+static void print_stat(const char *name, const stat_t *stat, const char *unit)
+{
+    printf(
+        "    %-8s %9lu %8.1f %6u %s\n",
+        name, stat->count,
+        stat->count ? (double) stat->total / stat->count : 0.0,
+        stat->max, unit
+    );
+}
+
+static void summarise()
+{
+    int i;
+
+    printf(
+        "%lu frames, %.1f seconds, %lu games, %lu moves\n",
+        frames, frames / FRAME_RATE, games, moves
+    );
+    printf(
+        "  %lu frames ran long, missing %lu vblanks\n",
+        frames_late, vblanks_missed
+    );
+
+    if (frames_lost > 0 || records_dropped > 0 || bytes_skipped > 0)
+    {
+        printf(
+            "  %lu frames lost, %lu records dropped by the game, %lu bytes skipped\n",
+            frames_lost, records_dropped, bytes_skipped
+        );
+    }
+
+    printf("  scanlines, %u a frame\n", TELEMETRY_LINES);
+    printf("    %-8s %9s %8s %6s\n", "", "count", "average", "most");
+
+    for (i = 0; i < TELEMETRY_SECTIONS; i++)
+    {
+        print_stat(section_names[i], &sections[i], "");
+    }
+
+    printf("  music ticks\n");
+    print_stat("time", &music_lines, "lines");
+    print_stat("track", &music_bytes, "bytes");
+}
+
+// serial adapters are read raw at the game's baud rate
+static void set_raw(int fd)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        return;
+    }
+
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, B38400);
+    cfsetospeed(&tio, B38400);
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+static int dump(int fd)
+{
+    uint8_t record[MAX_RECORD], byte;
+    unsigned have = 0, want = 0;
+    struct sigaction action;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_interrupt;
+    sigaction(SIGINT, &action, NULL);
+
+    while (!stopping && read(fd, &byte, 1) == 1)
+    {
+        if (have == 0)
+        {
+            // look for the start of a record, skipping anything else
+            if (byte < TELEMETRY_FIRST_RECORD || byte > TELEMETRY_LAST_RECORD)
+            {
+                bytes_skipped++;
+                continue;
+            }
+
+            want = record_lengths[byte - TELEMETRY_FIRST_RECORD];
+        }
+
+        record[have++] = byte;
+
+        if (have == want)
+        {
+            decode(record);
+            have = 0;
+        }
+    }
+
+    summarise();
+    return 0;
+}
+
+// Loopback
+// --------
+
+static void put_record(FILE *file, const uint8_t *record)
+{
+    fwrite(record, 1, record_lengths[record[0] - TELEMETRY_FIRST_RECORD], file);
+}
+
+// a game's worth of frames, with a music tick every few of them, a move
+// every second or so, and the odd frame running long
+static void loopback(FILE *file, unsigned count)
+{
+    uint8_t record[MAX_RECORD];
+    unsigned frame, i;
+
+    record[0] = TELEMETRY_GAME;
+    record[1] = 0x39;
+    record[2] = 0x30;
+    record[3] = record[4] = 0;
+    put_record(file, record);
+
+    for (frame = 0; frame < count; frame++)
+    {
+        record[0] = TELEMETRY_FRAME;
+        record[1] = frame;
+        record[2] = (frame % 97 == 96) ? 1 : 0;
+        record[3] = 0;
+        put_record(file, record);
+
+        if (frame % 3 == 0)
+        {
+            record[0] = TELEMETRY_MUSIC;
+            record[1] = 2 + (frame % 5);
+            record[2] = 4 + (frame % 11);
+            put_record(file, record);
+        }
+
+        for (i = 0; i < TELEMETRY_SECTIONS; i++)
+        {
+            record[0] = TELEMETRY_SECTION;
+            record[1] = i;
+            record[2] = 4 + ((frame * (i + 1)) % 20);
+            put_record(file, record);
+        }
+
+        if (frame % 75 == 74)
+        {
+            record[0] = TELEMETRY_MOVE;
+            record[1] = frame % 8;
+            record[2] = (frame / 8) % 8;
+            record[3] = frame % 52;
+            put_record(file, record);
+        }
+
+        fflush(file);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned loopback_frames = 0;
+    FILE *file = stdout;
+    int opt, fd = 0;
+
+    while ((opt = getopt(argc, argv, "vl:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'v': verbose = 1; break;
+        case 'l': loopback_frames = strtoul(optarg, NULL, 0); break;
+        default: optind = argc + 1; break;
+        }
+    }
+
+    if (optind > argc || optind < argc - 1)
+    {
+        fprintf(stderr, "usage: teledump [-v] [source]\n       teledump -l frames [dest]\n");
+        return 1;
+    }
+
+    if (loopback_frames > 0)
+    {
+        if (optind < argc && (file = fopen(argv[optind], "wb")) == NULL)
+        {
+            fprintf(stderr, "teledump: can't write %s\n", argv[optind]);
+            return 1;
+        }
+
+        loopback(file, loopback_frames);
+        fclose(file);
+        return 0;
+    }
+
+    if (optind < argc && (fd = open(argv[optind], O_RDONLY | O_NOCTTY)) < 0)
+    {
+        fprintf(stderr, "teledump: can't read %s\n", argv[optind]);
+        return 1;
+    }
+
+    if (isatty(fd))
+    {
+        set_raw(fd);
+    }
+
+    return dump(fd);
+}
@@ -0,0 +1,360 @@
+// Wondercell
+// Joe Kennedy - 2023
+
+// profiles the work vgmswan_play does each time it's called
+// walks a cvgm track the same way the driver in src/vgm.c does, one
+// tick at a time, until it finishes or loops, and reports how many
+// commands and bytes each tick takes, an estimate of the cpu cycles
+// they cost, and where in the track the most expensive ticks are
+//
+// usage: vgmprof [-q] [-n worst] [-w cycles] track_cvgm.bin...
+//   -q  only print warnings
+//   -w  warn about any tick estimated to take more than this many cycles
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// cvgm tracks live within a 64k segment
+#define MAX_TRACK 0x10000
+
+// ticks walked before giving up on finding the end or the loop
+#define MAX_TICKS 100000
+
+#define MAX_WORST 64
+
+// display refresh rate, vgmswan_play is called once a frame
+#define FRAME_RATE 75.47
+
+#define PLAYBACK_FINISHED 0xffff
+
+// rough cpu cycle costs on the v30mz, going by the code the compiler
+// generates for vgmswan_play. good for comparing ticks and tracks
+// rather than for exact timings
+#define CYCLES_CALL 60
+#define CYCLES_COMMAND 16
+#define CYCLES_MEMORY_WRITE 30
+#define CYCLES_PER_BYTE 4
+#define CYCLES_PORT_BYTE 12
+#define CYCLES_PORT_WORD 14
+#define CYCLES_JUMP 24
+#define CYCLES_WAIT 10
+#define CYCLES_SAMPLE 90
+#define CYCLES_WAVE 40
+
+// commands and bytes per tick are counted into these buckets
+#define COMMAND_BUCKETS 16
+#define BYTE_BUCKETS 16
+#define BYTE_BUCKET_SIZE 8
+
+typedef struct {
+    unsigned tick;
+    unsigned offset;
+    unsigned frame;
+    unsigned commands;
+    unsigned bytes;
+    unsigned cycles;
+} vgmprof_tick_t;
+
+static uint8_t track[MAX_TRACK];
+static size_t track_size;
+
+static vgmprof_tick_t worst[MAX_WORST];
+static unsigned worst_count;
+static unsigned worst_wanted = 8;
+
+static unsigned read_word(unsigned offset)
+{
+    return track[offset & 0xffff] | (track[(offset + 1) & 0xffff] << 8);
+}
+
+// keep the most expensive ticks, most expensive first
+static void rank_tick(const vgmprof_tick_t *tick)
+{
+    unsigned i;
+
+    if (worst_count == worst_wanted && tick->cycles <= worst[worst_count - 1].cycles)
+    {
+        return;
+    }
+
+    i = (worst_count < worst_wanted) ? worst_count++ : (worst_wanted - 1);
+
+    for (; i > 0 && worst[i - 1].cycles < tick->cycles; i--)
+    {
+        worst[i] = worst[i - 1];
+    }
+
+    worst[i] = *tick;
+}
+
+// runs one call of vgmswan_play from offset
+// returns the number of frames until the next call, and where it starts
+static unsigned play_tick(unsigned *offset, vgmprof_tick_t *tick)
+{
+    unsigned ptr = *offset, resume = 0, result = 0, len;
+    int restore = 1;
+    uint8_t cmd, ctrl;
+
+    tick->commands = 0;
+    tick->bytes = 0;
+    tick->cycles = CYCLES_CALL;
+
+    while (result == 0)
+    {
+        cmd = track[ptr++ & 0xffff];
+        tick->commands++;
+        tick->cycles += CYCLES_COMMAND;
+
+        switch (cmd & 0xe0)
+        {
+        case 0x00:
+        case 0x20:
+            // memory write
+            len = track[ptr++ & 0xffff];
+            ptr += len;
+            tick->bytes += len;
+            tick->cycles += CYCLES_MEMORY_WRITE + (len * CYCLES_PER_BYTE);
+            break;
+
+        case 0x40:
+            ptr += 1;
+            tick->cycles += CYCLES_PORT_BYTE;
+            break;
+
+        case 0x60:
+            ptr += 2;
+            tick->cycles += CYCLES_PORT_WORD;
+            break;
+
+        case 0xe0:
+            switch (cmd)
+            {
+            case 0xef:
+                // play a shared block, carrying on after this next time
+                resume = ptr + 2;
+                ptr = read_word(ptr);
+                restore = 0;
+                tick->cycles += CYCLES_JUMP;
+                break;
+
+            case 0xf0: case 0xf1: case 0xf2: case 0xf3:
+            case 0xf4: case 0xf5: case 0xf6:
+                result = cmd - 0xef;
+                tick->cycles += CYCLES_WAIT;
+                break;
+
+            case 0xf8:
+                result = track[ptr++ & 0xffff];
+                tick->cycles += CYCLES_WAIT;
+                break;
+
+            case 0xf9:
+                result = read_word(ptr);
+                ptr += 2;
+                tick->cycles += CYCLES_WAIT;
+                break;
+
+            case 0xfa:
+                ptr = read_word(ptr);
+                tick->cycles += CYCLES_JUMP;
+                break;
+
+            case 0xfb:
+                ctrl = track[ptr++ & 0xffff];
+                tick->cycles += CYCLES_PORT_BYTE;
+
+                if (ctrl & 0x80)
+                {
+                    ptr += 4;
+                    tick->cycles += CYCLES_SAMPLE;
+                }
+                break;
+
+            case 0xfc: case 0xfd: case 0xfe: case 0xff:
+                ptr += 2;
+                tick->bytes += 16;
+                tick->cycles += CYCLES_WAVE + (16 * CYCLES_PER_BYTE);
+                break;
+            }
+            break;
+
+        default:
+            // 0x80 to 0xdf aren't used, the driver skips them
+            break;
+        }
+
+        // a broken track could otherwise go round forever
+        if (tick->commands > MAX_TRACK)
+        {
+            return PLAYBACK_FINISHED;
+        }
+    }
+
+    *offset = (restore ? ptr : resume) & 0xffff;
+    return result;
+}
+
+static int load_track(const char *path)
+{
+    FILE *file;
+
+    if ((file = fopen(path, "rb")) == NULL)
+    {
+        perror(path);
+        return 0;
+    }
+
+    memset(track, 0xf9, sizeof(track));
+    track_size = fread(track, 1, sizeof(track), file);
+    fclose(file);
+
+    return 1;
+}
+
+static void print_histogram(const char *title, const unsigned *buckets, unsigned count, unsigned size, unsigned ticks)
+{
+    unsigned i, bar;
+
+    printf("  %s\n", title);
+
+    for (i = 0; i < count; i++)
+    {
+        if (buckets[i] == 0)
+        {
+            continue;
+        }
+
+        bar = (buckets[i] * 40 + ticks - 1) / ticks;
+
+        if (i == count - 1)
+        {
+            printf("    %4u+     %6u ", i * size, buckets[i]);
+        }
+        else if (size == 1)
+        {
+            printf("    %4u      %6u ", i, buckets[i]);
+        }
+        else
+        {
+            printf("    %4u-%-4u %6u ", i * size, (i * size) + size - 1, buckets[i]);
+        }
+
+        while (bar-- > 0)
+        {
+            putchar('#');
+        }
+
+        putchar('\n');
+    }
+}
+
+static void profile_track(const char *path, int quiet, unsigned warn_cycles)
+{
+    vgmprof_tick_t tick;
+    unsigned command_buckets[COMMAND_BUCKETS] = { 0 };
+    unsigned byte_buckets[BYTE_BUCKETS] = { 0 };
+    unsigned offset = 0, last_offset = 0, frame = 0, wait, i;
+    unsigned long total_cycles = 0;
+
+    worst_count = 0;
+
+    for (tick.tick = 0; tick.tick < MAX_TICKS; tick.tick++)
+    {
+        tick.offset = offset;
+        tick.frame = frame;
+        wait = play_tick(&offset, &tick);
+
+        command_buckets[(tick.commands < COMMAND_BUCKETS) ? tick.commands : (COMMAND_BUCKETS - 1)]++;
+        byte_buckets[(tick.bytes / BYTE_BUCKET_SIZE < BYTE_BUCKETS) ? (tick.bytes / BYTE_BUCKET_SIZE) : (BYTE_BUCKETS - 1)]++;
+        total_cycles += tick.cycles;
+        rank_tick(&tick);
+
+        if (warn_cycles > 0 && tick.cycles > warn_cycles)
+        {
+            fprintf(
+                stderr,
+                "%s: warning: tick %u at 0x%04x (%.2fs) takes ~%u cycles, over the limit of %u\n",
+                path, tick.tick, tick.offset, frame / FRAME_RATE, tick.cycles, warn_cycles
+            );
+        }
+
+        // stop once the track finishes or jumps back to loop
+        if (wait == PLAYBACK_FINISHED || offset < last_offset || offset >= track_size)
+        {
+            tick.tick++;
+            break;
+        }
+
+        last_offset = offset;
+        frame += wait;
+    }
+
+    if (quiet)
+    {
+        return;
+    }
+
+    printf("%s\n", path);
+    printf(
+        "  %u ticks over %.2fs, ~%lu cycles a tick on average\n",
+        tick.tick, frame / FRAME_RATE, total_cycles / tick.tick
+    );
+
+    print_histogram("commands per tick", command_buckets, COMMAND_BUCKETS, 1, tick.tick);
+    print_histogram("bytes written per tick", byte_buckets, BYTE_BUCKETS, BYTE_BUCKET_SIZE, tick.tick);
+
+    printf("  worst ticks\n");
+    printf("      tick offset   time commands bytes cycles\n");
+
+    for (i = 0; i < worst_count; i++)
+    {
+        printf(
+            "    %6u 0x%04x %5.2fs %8u %5u %6u\n",
+            worst[i].tick, worst[i].offset, worst[i].frame / FRAME_RATE,
+            worst[i].commands, worst[i].bytes, worst[i].cycles
+        );
+    }
+
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    int opt, i, quiet = 0;
+    unsigned warn_cycles = 0;
+
+    while ((opt = getopt(argc, argv, "qn:w:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'q': quiet = 1; break;
+        case 'n': worst_wanted = strtoul(optarg, NULL, 0); break;
+        case 'w': warn_cycles = strtoul(optarg, NULL, 0); break;
+        default: optind = argc + 1; break;
+        }
+    }
+
+    if (optind >= argc)
+    {
+        fprintf(stderr, "usage: vgmprof [-q] [-n worst] [-w cycles] track_cvgm.bin...\n");
+        return 1;
+    }
+
+    if (worst_wanted < 1 || worst_wanted > MAX_WORST)
+    {
+        worst_wanted = (worst_wanted < 1) ? 1 : MAX_WORST;
+    }
+
+    for (i = optind; i < argc; i++)
+    {
+        if (load_track(argv[i]))
+        {
+            profile_track(argv[i], quiet, warn_cycles);
+        }
+    }
+
+    return 0;
+}